@@ -26,12 +26,14 @@
 
 #include "app_config/AppConfig.h"
 #include "collection_pipeline/batch/TimeoutFlushManager.h"
+#include "collection_pipeline/limiter/MemoryBudget.h"
 #include "collection_pipeline/plugin/PluginRegistry.h"
 #include "collection_pipeline/queue/ProcessQueueManager.h"
 #include "collection_pipeline/queue/QueueKeyManager.h"
 #include "collection_pipeline/queue/SenderQueueManager.h"
 #include "common/Flags.h"
 #include "common/ParamExtractor.h"
+#include "common/TimeUtil.h"
 #include "go_pipeline/LogtailPlugin.h"
 #include "plugin/flusher/sls/FlusherSLS.h"
 #include "plugin/input/InputFeedbackInterfaceRegistry.h"
@@ -163,6 +165,12 @@ bool CollectionPipeline::Init(CollectionConfig&& config) {
         }
     }
 
+    // when data returned from go pipeline can be sent by a single flusher_sls without route, the flusher_sls in go
+    // pipeline is generated from the native one and the data is sent directly, otherwise it is routed natively
+    mRoutingGoPipelineData = config.ShouldNativeFlusherConnectedByGoPipeline() && !config.mHasGoFlusher
+        && !(config.mFlushers.size() == 1 && (*config.mFlushers[0])["Type"].asString() == FlusherSLS::sName
+             && config.mRouter.size() == 1 && config.mRouter[0].second == nullptr);
+
     for (size_t i = 0; i < config.mFlushers.size(); ++i) {
         const Json::Value& detail = *config.mFlushers[i];
         string pluginType = detail["Type"].asString();
@@ -174,7 +182,8 @@ bool CollectionPipeline::Init(CollectionConfig&& config) {
                 return false;
             }
             mFlushers.emplace_back(std::move(flusher));
-            if (!optionalGoPipeline.isNull() && config.ShouldNativeFlusherConnectedByGoPipeline()) {
+            if (!optionalGoPipeline.isNull() && config.ShouldNativeFlusherConnectedByGoPipeline()
+                && !mRoutingGoPipelineData) {
                 if (ShouldAddPluginToGoPipelineWithInput()) {
                     MergeGoPipeline(optionalGoPipeline, mGoPipelineWithInput);
                 } else {
@@ -194,7 +203,7 @@ bool CollectionPipeline::Init(CollectionConfig&& config) {
         }
     }
 
-    // route is only enabled in native flushing mode, thus the index in config is the same as that in mFlushers
+    // route is disabled when extended flushers exist, thus the index in config is the same as that in mFlushers
     if (!mRouter.Init(config.mRouter, mContext)) {
         return false;
     }
@@ -332,8 +341,17 @@ bool CollectionPipeline::Init(CollectionConfig&& config) {
         ProcessQueueManager::GetInstance()->SetFeedbackInterface(
             mContext.GetProcessQueueKey(), vector<FeedbackInterface*>(feedbackSet.begin(), feedbackSet.end()));
 
+        // inputs blocked by memory budget are waken up the same way as those blocked by process queue
+        auto quota = MemoryBudget::GetInstance()->GetQuota(mName, mContext.GetGlobalConfig().mMemoryWeight);
+        quota->SetFeedbacks(mContext.GetProcessQueueKey(),
+                            vector<FeedbackInterface*>(feedbackSet.begin(), feedbackSet.end()));
+        ProcessQueueManager::GetInstance()->SetMemoryQuota(mContext.GetProcessQueueKey(), quota);
+        ProcessQueueManager::GetInstance()->SetCpuWeight(mContext.GetProcessQueueKey(),
+                                                         mContext.GetGlobalConfig().mCpuWeight);
+
         vector<BoundedSenderQueueInterface*> senderQueues;
         for (const auto& flusher : mFlushers) {
+            SenderQueueManager::GetInstance()->SetMemoryQuota(flusher->GetQueueKey(), quota);
             senderQueues.push_back(SenderQueueManager::GetInstance()->GetQueue(flusher->GetQueueKey()));
         }
         ProcessQueueManager::GetInstance()->SetDownStreamQueues(mContext.GetProcessQueueKey(), std::move(senderQueues));
@@ -350,10 +368,12 @@ bool CollectionPipeline::Init(CollectionConfig&& config) {
     mProcessorsInSizeBytes = mMetricsRecordRef.CreateCounter(METRIC_PIPELINE_PROCESSORS_IN_SIZE_BYTES);
     mProcessorsTotalProcessTimeMs
         = mMetricsRecordRef.CreateTimeCounter(METRIC_PIPELINE_PROCESSORS_TOTAL_PROCESS_TIME_MS);
+    mProcessorsTotalCpuTimeMs = mMetricsRecordRef.CreateTimeCounter(METRIC_PIPELINE_PROCESSORS_TOTAL_CPU_TIME_MS);
     mFlushersInGroupsTotal = mMetricsRecordRef.CreateCounter(METRIC_PIPELINE_FLUSHERS_IN_EVENT_GROUPS_TOTAL);
     mFlushersInEventsTotal = mMetricsRecordRef.CreateCounter(METRIC_PIPELINE_FLUSHERS_IN_EVENTS_TOTAL);
     mFlushersInSizeBytes = mMetricsRecordRef.CreateCounter(METRIC_PIPELINE_FLUSHERS_IN_SIZE_BYTES);
     mFlushersTotalPackageTimeMs = mMetricsRecordRef.CreateTimeCounter(METRIC_PIPELINE_FLUSHERS_TOTAL_PACKAGE_TIME_MS);
+    mFlushersTotalCpuTimeMs = mMetricsRecordRef.CreateTimeCounter(METRIC_PIPELINE_FLUSHERS_TOTAL_CPU_TIME_MS);
 
     return true;
 }
@@ -393,6 +413,7 @@ void CollectionPipeline::Process(vector<PipelineEventGroup>& logGroupList, size_
     ADD_COUNTER(mProcessorsInGroupsTotal, logGroupList.size())
 
     auto before = chrono::system_clock::now();
+    auto cpuBefore = GetCurrentThreadCpuTime();
     for (auto& p : mInputs[inputIndex]->GetInnerProcessors()) {
         p->Process(logGroupList);
     }
@@ -403,6 +424,7 @@ void CollectionPipeline::Process(vector<PipelineEventGroup>& logGroupList, size_
         p->Process(logGroupList);
     }
     ADD_COUNTER(mProcessorsTotalProcessTimeMs, chrono::system_clock::now() - before);
+    ADD_COUNTER(mProcessorsTotalCpuTimeMs, GetCurrentThreadCpuTime() - cpuBefore);
 }
 
 bool CollectionPipeline::Send(vector<PipelineEventGroup>&& groupList) {
@@ -413,6 +435,7 @@ bool CollectionPipeline::Send(vector<PipelineEventGroup>&& groupList) {
     ADD_COUNTER(mFlushersInGroupsTotal, groupList.size());
 
     auto before = chrono::system_clock::now();
+    auto cpuBefore = GetCurrentThreadCpuTime();
     bool allSucceeded = true;
     for (auto& group : groupList) {
         if (group.GetEvents().empty()) {
@@ -431,6 +454,7 @@ bool CollectionPipeline::Send(vector<PipelineEventGroup>&& groupList) {
         }
     }
     ADD_COUNTER(mFlushersTotalPackageTimeMs, chrono::system_clock::now() - before);
+    ADD_COUNTER(mFlushersTotalCpuTimeMs, GetCurrentThreadCpuTime() - cpuBefore);
     return allSucceeded;
 }
 
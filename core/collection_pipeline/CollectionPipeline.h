@@ -67,6 +67,8 @@ public:
     const std::optional<std::string>& GetSingletonInput() const { return mSingletonInput; }
     const std::vector<std::unique_ptr<FlusherInstance>>& GetFlushers() const { return mFlushers; }
     bool IsFlushingThroughGoPipeline() const { return !mGoPipelineWithoutInput.isNull(); }
+    // true if data returned from go pipeline should be decoded and routed to native flushers
+    bool IsRoutingGoPipelineData() const { return mRoutingGoPipelineData; }
 
     // only for input_file
     const std::vector<std::unique_ptr<InputInstance>>& GetInputs() const { return mInputs; }
@@ -104,6 +106,7 @@ private:
     std::optional<std::string> mSingletonInput;
     std::atomic_uint16_t mPluginID;
     std::atomic_int16_t mInProcessCnt;
+    bool mRoutingGoPipelineData = false;
 
     mutable MetricsRecordRef mMetricsRecordRef;
     IntGaugePtr mStartTime;
@@ -111,10 +114,12 @@ private:
     CounterPtr mProcessorsInGroupsTotal;
     CounterPtr mProcessorsInSizeBytes;
     TimeCounterPtr mProcessorsTotalProcessTimeMs;
+    TimeCounterPtr mProcessorsTotalCpuTimeMs;
     CounterPtr mFlushersInGroupsTotal;
     CounterPtr mFlushersInEventsTotal;
     CounterPtr mFlushersInSizeBytes;
     TimeCounterPtr mFlushersTotalPackageTimeMs;
+    TimeCounterPtr mFlushersTotalCpuTimeMs;
 
 #ifdef APSARA_UNIT_TEST_MAIN
     friend class PipelineMock;
@@ -27,6 +27,8 @@ namespace logtail {
 const unordered_set<string> GlobalConfig::sNativeParam = {"TopicType",
                                                           "TopicFormat",
                                                           "Priority",
+                                                          "MemoryWeight",
+                                                          "CpuWeight",
                                                           "EnableTimestampNanosecond",
                                                           "UsingOldContentTag",
                                                           "PipelineMetaTagKey",
@@ -127,6 +129,58 @@ bool GlobalConfig::Init(const Json::Value& config, const CollectionPipelineConte
         mPriority = priority;
     }
 
+    // MemoryWeight
+    uint32_t memoryWeight = 1;
+    if (!GetOptionalUIntParam(config, "MemoryWeight", memoryWeight, errorMsg)) {
+        PARAM_WARNING_DEFAULT(ctx.GetLogger(),
+                              ctx.GetAlarm(),
+                              errorMsg,
+                              mMemoryWeight,
+                              moduleName,
+                              ctx.GetConfigName(),
+                              ctx.GetProjectName(),
+                              ctx.GetLogstoreName(),
+                              ctx.GetRegion());
+    } else if (memoryWeight == 0) {
+        PARAM_WARNING_DEFAULT(ctx.GetLogger(),
+                              ctx.GetAlarm(),
+                              "param MemoryWeight is out of range",
+                              mMemoryWeight,
+                              moduleName,
+                              ctx.GetConfigName(),
+                              ctx.GetProjectName(),
+                              ctx.GetLogstoreName(),
+                              ctx.GetRegion());
+    } else {
+        mMemoryWeight = memoryWeight;
+    }
+
+    // CpuWeight
+    uint32_t cpuWeight = 1;
+    if (!GetOptionalUIntParam(config, "CpuWeight", cpuWeight, errorMsg)) {
+        PARAM_WARNING_DEFAULT(ctx.GetLogger(),
+                              ctx.GetAlarm(),
+                              errorMsg,
+                              mCpuWeight,
+                              moduleName,
+                              ctx.GetConfigName(),
+                              ctx.GetProjectName(),
+                              ctx.GetLogstoreName(),
+                              ctx.GetRegion());
+    } else if (cpuWeight == 0) {
+        PARAM_WARNING_DEFAULT(ctx.GetLogger(),
+                              ctx.GetAlarm(),
+                              "param CpuWeight is out of range",
+                              mCpuWeight,
+                              moduleName,
+                              ctx.GetConfigName(),
+                              ctx.GetProjectName(),
+                              ctx.GetLogstoreName(),
+                              ctx.GetRegion());
+    } else {
+        mCpuWeight = cpuWeight;
+    }
+
     // EnableTimestampNanosecond
     if (!GetOptionalBoolParam(config, "EnableTimestampNanosecond", mEnableTimestampNanosecond, errorMsg)) {
         PARAM_WARNING_DEFAULT(ctx.GetLogger(),
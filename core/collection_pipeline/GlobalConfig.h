@@ -37,6 +37,8 @@ struct GlobalConfig {
     TopicType mTopicType = TopicType::NONE;
     std::string mTopicFormat;
     uint32_t mPriority = 1U;
+    uint32_t mMemoryWeight = 1U;
+    uint32_t mCpuWeight = 1U;
     bool mEnableTimestampNanosecond = false;
     bool mUsingOldContentTag = false;
 };
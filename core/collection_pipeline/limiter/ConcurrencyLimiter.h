@@ -56,6 +56,8 @@ public:
             return METRIC_COMPONENT_QUEUE_FETCH_REJECTED_BY_PROJECT_LIMITER_TIMES_TOTAL;
         } else if (limiter == "logstore") {
             return METRIC_COMPONENT_QUEUE_FETCH_REJECTED_BY_LOGSTORE_LIMITER_TIMES_TOTAL;
+        } else if (limiter == "endpoint") {
+            return METRIC_COMPONENT_QUEUE_FETCH_REJECTED_BY_ENDPOINT_LIMITER_TIMES_TOTAL;
         }
         return limiter;
     }
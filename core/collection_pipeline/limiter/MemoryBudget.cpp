@@ -0,0 +1,192 @@
+// Copyright 2025 iLogtail Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "collection_pipeline/limiter/MemoryBudget.h"
+
+#include <algorithm>
+
+#include "app_config/AppConfig.h"
+#include "common/Flags.h"
+#include "logger/Logger.h"
+
+DEFINE_FLAG_DOUBLE(pipeline_memory_budget_ratio,
+                   "ratio of memory usage limit that data in pipelines can take at most, 0 means unlimited",
+                   0.5);
+
+using namespace std;
+
+namespace logtail {
+
+MemoryQuota::~MemoryQuota() {
+    MemoryBudget::GetInstance()->RemoveQuota(this);
+}
+
+bool MemoryQuota::IsValidToPush() {
+    auto budget = MemoryBudget::GetInstance();
+    uint64_t usage = mUsage;
+    if (budget->mBudget == 0 || usage == 0 || usage < mQuota || budget->mUsage < budget->mBudget) {
+        return true;
+    }
+    OnRejected();
+    return false;
+}
+
+bool MemoryQuota::TryAcquire(size_t size) {
+    auto budget = MemoryBudget::GetInstance();
+    uint64_t usage = mUsage;
+    // a pipeline holding nothing is always admitted, otherwise a group larger than the quota would never get in
+    if (budget->mBudget == 0 || usage == 0 || usage + size <= mQuota || budget->mUsage + size <= budget->mBudget) {
+        Acquire(size, false);
+        return true;
+    }
+    OnRejected();
+    return false;
+}
+
+void MemoryQuota::Acquire(size_t size, bool sending) {
+    mUsage += size;
+    if (sending) {
+        mSendingUsage += size;
+    }
+    MemoryBudget::GetInstance()->mUsage += size;
+}
+
+void MemoryQuota::Release(size_t size, bool sending) {
+    mUsage -= size;
+    if (sending) {
+        mSendingUsage -= size;
+    }
+    auto budget = MemoryBudget::GetInstance();
+    budget->mUsage -= size;
+    budget->OnRelease();
+}
+
+bool MemoryQuota::IsValidToProcess() const {
+    auto budget = MemoryBudget::GetInstance();
+    return budget->mBudget == 0 || mSendingUsage <= mQuota || budget->mUsage <= budget->mBudget;
+}
+
+void MemoryQuota::SetFeedbacks(QueueKey key, vector<FeedbackInterface*>&& feedbacks) {
+    lock_guard<mutex> lock(mFeedbackMux);
+    mKey = key;
+    mFeedbacks.clear();
+    for (auto& item : feedbacks) {
+        if (item == nullptr) {
+            // should not happen
+            continue;
+        }
+        mFeedbacks.emplace_back(item);
+    }
+}
+
+void MemoryQuota::OnRejected() {
+    if (!mRejected.exchange(true)) {
+        LOG_DEBUG(sLogger,
+                  ("data rejected by memory budget, config", mConfigName)("usage", mUsage.load())(
+                      "quota", mQuota.load())("total usage", MemoryBudget::GetInstance()->mUsage.load()));
+        MemoryBudget::GetInstance()->AddBlockedQuota(this);
+    }
+}
+
+void MemoryQuota::GiveFeedback() const {
+    lock_guard<mutex> lock(mFeedbackMux);
+    for (auto& item : mFeedbacks) {
+        item->Feedback(mKey);
+    }
+}
+
+MemoryBudget::MemoryBudget() {
+    // memory usage limit is in MB
+    SetBudget(static_cast<uint64_t>(max(DOUBLE_FLAG(pipeline_memory_budget_ratio), 0.0)
+                                    * AppConfig::GetInstance()->GetMemUsageUpLimit() * 1024 * 1024));
+}
+
+shared_ptr<MemoryQuota> MemoryBudget::GetQuota(const string& configName, uint32_t weight) {
+    weight = max(weight, 1U);
+    lock_guard<mutex> lock(mMux);
+    auto& quota = mQuotas[configName];
+    auto res = quota.lock();
+    if (res) {
+        if (res->mWeight == weight) {
+            return res;
+        }
+        mTotalWeight -= res->mWeight;
+        res->mWeight = weight;
+    } else {
+        res = make_shared<MemoryQuota>(configName, weight);
+        quota = res;
+    }
+    mTotalWeight += weight;
+    UpdateQuotas();
+    return res;
+}
+
+void MemoryBudget::SetBudget(uint64_t budget) {
+    lock_guard<mutex> lock(mMux);
+    mBudget = budget;
+    UpdateQuotas();
+}
+
+void MemoryBudget::RemoveQuota(MemoryQuota* quota) {
+    {
+        lock_guard<mutex> lock(mBlockedMux);
+        auto iter = find(mBlockedQuotas.begin(), mBlockedQuotas.end(), quota);
+        if (iter != mBlockedQuotas.end()) {
+            mBlockedQuotas.erase(iter);
+        }
+    }
+    lock_guard<mutex> lock(mMux);
+    auto iter = mQuotas.find(quota->mConfigName);
+    // the entry may have been taken by a newer quota of the same name
+    if (iter != mQuotas.end() && iter->second.expired()) {
+        mQuotas.erase(iter);
+    }
+    mTotalWeight -= quota->mWeight;
+    UpdateQuotas();
+}
+
+void MemoryBudget::UpdateQuotas() {
+    for (auto& item : mQuotas) {
+        if (auto quota = item.second.lock()) {
+            quota->mQuota = mTotalWeight == 0 ? 0 : mBudget * quota->mWeight / mTotalWeight;
+        }
+    }
+}
+
+void MemoryBudget::AddBlockedQuota(MemoryQuota* quota) {
+    lock_guard<mutex> lock(mBlockedMux);
+    mBlockedQuotas.push_back(quota);
+    mHasBlockedQuota = true;
+}
+
+void MemoryBudget::OnRelease() {
+    if (!mHasBlockedQuota) {
+        return;
+    }
+    lock_guard<mutex> lock(mBlockedMux);
+    for (auto iter = mBlockedQuotas.begin(); iter != mBlockedQuotas.end();) {
+        auto quota = *iter;
+        uint64_t usage = quota->mUsage;
+        if (usage == 0 || usage < quota->mQuota || mUsage < mBudget) {
+            quota->mRejected = false;
+            quota->GiveFeedback();
+            iter = mBlockedQuotas.erase(iter);
+        } else {
+            ++iter;
+        }
+    }
+    mHasBlockedQuota = !mBlockedQuotas.empty();
+}
+
+} // namespace logtail
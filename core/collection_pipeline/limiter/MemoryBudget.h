@@ -0,0 +1,164 @@
+/*
+ * Copyright 2025 iLogtail Authors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cstdint>
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "collection_pipeline/queue/QueueKey.h"
+#include "common/FeedbackInterface.h"
+
+namespace logtail {
+
+class MemoryBudget;
+
+// Bytes of one pipeline held in its process queue, processor threads and sender queues. The quota is the weighted
+// share of the global budget, which is guaranteed to the pipeline. Beyond its quota, a pipeline may still borrow idle
+// budget as long as the total usage of all pipelines is below the budget.
+class MemoryQuota {
+public:
+    MemoryQuota(const std::string& configName, uint32_t weight) : mConfigName(configName), mWeight(weight) {}
+    ~MemoryQuota();
+
+    MemoryQuota(const MemoryQuota&) = delete;
+    MemoryQuota& operator=(const MemoryQuota&) = delete;
+
+    // for data entering the pipeline, which can wait in the source when rejected
+    bool IsValidToPush();
+    bool TryAcquire(size_t size);
+    // for data already in the pipeline, which is always accepted
+    void Acquire(size_t size, bool sending);
+    void Release(size_t size, bool sending);
+    // whether more data can be processed, i.e. the data waiting to be sent is not over quota
+    bool IsValidToProcess() const;
+
+    void SetFeedbacks(QueueKey key, std::vector<FeedbackInterface*>&& feedbacks);
+
+    const std::string& GetConfigName() const { return mConfigName; }
+    uint32_t GetWeight() const { return mWeight; }
+    uint64_t GetQuota() const { return mQuota; }
+    uint64_t GetUsage() const { return mUsage; }
+    uint64_t GetSendingUsage() const { return mSendingUsage; }
+
+private:
+    void OnRejected();
+    void GiveFeedback() const;
+
+    const std::string mConfigName;
+    uint32_t mWeight = 1;
+    std::atomic_uint64_t mQuota = 0;
+    std::atomic_uint64_t mUsage = 0;
+    std::atomic_uint64_t mSendingUsage = 0;
+    std::atomic_bool mRejected = false;
+
+    mutable std::mutex mFeedbackMux;
+    QueueKey mKey = -1;
+    std::vector<FeedbackInterface*> mFeedbacks;
+
+    friend class MemoryBudget;
+#ifdef APSARA_UNIT_TEST_MAIN
+    friend class MemoryBudgetUnittest;
+#endif
+};
+
+// Bytes reserved from a quota by an item in the pipeline, which are released when the item is destructed, so that no
+// path dropping items can leak the budget. Copying an item does not copy its reservation.
+class MemoryReservation {
+public:
+    MemoryReservation() = default;
+    MemoryReservation(std::shared_ptr<MemoryQuota> quota, size_t size, bool sending)
+        : mQuota(std::move(quota)), mSize(size), mSending(sending) {}
+    MemoryReservation(MemoryReservation&& rhs) noexcept
+        : mQuota(std::move(rhs.mQuota)), mSize(rhs.mSize), mSending(rhs.mSending) {}
+    MemoryReservation& operator=(MemoryReservation&& rhs) noexcept {
+        if (this != &rhs) {
+            Reset();
+            mQuota = std::move(rhs.mQuota);
+            mSize = rhs.mSize;
+            mSending = rhs.mSending;
+        }
+        return *this;
+    }
+    ~MemoryReservation() { Reset(); }
+
+    void Reset() {
+        if (mQuota) {
+            mQuota->Release(mSize, mSending);
+            mQuota.reset();
+        }
+    }
+
+    size_t GetSize() const { return mQuota ? mSize : 0; }
+
+private:
+    std::shared_ptr<MemoryQuota> mQuota;
+    size_t mSize = 0;
+    bool mSending = false;
+};
+
+// Global byte accounting of data in all pipelines, complementary to the item count bound of each queue, so that a
+// pipeline with huge groups cannot exhaust the memory of the agent. Quotas are shared by pipelines of the same name,
+// since they share the same queues during pipeline update.
+class MemoryBudget {
+public:
+    MemoryBudget(const MemoryBudget&) = delete;
+    MemoryBudget& operator=(const MemoryBudget&) = delete;
+
+    static MemoryBudget* GetInstance() {
+        static MemoryBudget instance;
+        return &instance;
+    }
+
+    std::shared_ptr<MemoryQuota> GetQuota(const std::string& configName, uint32_t weight);
+    // 0 means unlimited
+    void SetBudget(uint64_t budget);
+    uint64_t GetBudget() const { return mBudget; }
+    uint64_t GetUsage() const { return mUsage; }
+
+private:
+    MemoryBudget();
+    ~MemoryBudget() = default;
+
+    void RemoveQuota(MemoryQuota* quota);
+    void UpdateQuotas();
+    void AddBlockedQuota(MemoryQuota* quota);
+    void OnRelease();
+
+    std::atomic_uint64_t mBudget = 0;
+    std::atomic_uint64_t mUsage = 0;
+
+    std::mutex mMux;
+    std::unordered_map<std::string, std::weak_ptr<MemoryQuota>> mQuotas;
+    uint64_t mTotalWeight = 0;
+
+    std::mutex mBlockedMux;
+    std::vector<MemoryQuota*> mBlockedQuotas;
+    std::atomic_bool mHasBlockedQuota = false;
+
+    friend class MemoryQuota;
+#ifdef APSARA_UNIT_TEST_MAIN
+    friend class MemoryBudgetUnittest;
+#endif
+};
+
+} // namespace logtail
@@ -27,6 +27,8 @@
 #include "common/Flags.h"
 #include "plugin/flusher/blackhole/FlusherBlackHole.h"
 #include "plugin/flusher/file/FlusherFile.h"
+#include "plugin/flusher/otlp/FlusherOTLP.h"
+#include "plugin/flusher/prometheus/FlusherPrometheusRemoteWrite.h"
 #include "plugin/flusher/sls/FlusherSLS.h"
 #include "plugin/input/InputContainerStdio.h"
 #include "plugin/input/InputFile.h"
@@ -173,6 +175,8 @@ void PluginRegistry::LoadStaticPlugins() {
     RegisterFlusherCreator(new StaticFlusherCreator<FlusherSLS>());
     RegisterFlusherCreator(new StaticFlusherCreator<FlusherBlackHole>());
     RegisterFlusherCreator(new StaticFlusherCreator<FlusherFile>());
+    RegisterFlusherCreator(new StaticFlusherCreator<FlusherPrometheusRemoteWrite>());
+    RegisterFlusherCreator(new StaticFlusherCreator<FlusherOTLP>());
 #ifdef __ENTERPRISE__
     RegisterFlusherCreator(new StaticFlusherCreator<FlusherSLSMonitor>());
 #endif
@@ -28,6 +28,8 @@ BoundedProcessQueue::BoundedProcessQueue(
     if (ctx.IsExactlyOnceEnabled()) {
         mMetricsRecordRef.AddLabels({{METRIC_LABEL_KEY_EXACTLY_ONCE_ENABLED, "true"}});
     }
+    mMemoryBudgetRejectTimesTotal
+        = mMetricsRecordRef.CreateCounter(METRIC_COMPONENT_QUEUE_PUSH_REJECTED_BY_MEMORY_BUDGET_TIMES_TOTAL);
     WriteMetrics::GetInstance()->CommitMetricsRecordRef(mMetricsRecordRef);
 }
 
@@ -35,8 +37,15 @@ bool BoundedProcessQueue::Push(unique_ptr<ProcessQueueItem>&& item) {
     if (!IsValidToPush()) {
         return false;
     }
-    item->mEnqueTime = chrono::system_clock::now();
     auto size = item->mEventGroup.DataSize();
+    if (mMemoryQuota) {
+        if (!mMemoryQuota->TryAcquire(size)) {
+            ADD_COUNTER(mMemoryBudgetRejectTimesTotal, 1);
+            return false;
+        }
+        item->mMemoryReservation = MemoryReservation(mMemoryQuota, size, false);
+    }
+    item->mEnqueTime = chrono::system_clock::now();
     mQueue.push_back(std::move(item));
     ChangeStateIfNeededAfterPush();
 
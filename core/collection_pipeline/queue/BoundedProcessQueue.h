@@ -49,12 +49,15 @@ private:
     std::deque<std::unique_ptr<ProcessQueueItem>> mQueue;
     std::vector<FeedbackInterface*> mUpStreamFeedbacks;
 
+    CounterPtr mMemoryBudgetRejectTimesTotal;
+
 #ifdef APSARA_UNIT_TEST_MAIN
     friend class BoundedProcessQueueUnittest;
     friend class ProcessQueueManagerUnittest;
     friend class ExactlyOnceQueueManagerUnittest;
     friend class PipelineUnittest;
     friend class PipelineUpdateUnittest;
+    friend class MemoryBudgetUnittest;
 #endif
 };
 
@@ -57,6 +57,9 @@ public:
         std::unordered_map<std::string, std::shared_ptr<ConcurrencyLimiter>>&& concurrencyLimitersMap);
     virtual void SetPipelineForItems(const std::shared_ptr<CollectionPipeline>& p) const = 0;
 
+    void SetMemoryQuota(const std::shared_ptr<MemoryQuota>& quota) { mMemoryQuota = quota; }
+    bool IsMemoryQuotaValidToPush() const { return !mMemoryQuota || mMemoryQuota->IsValidToPush(); }
+
 #ifdef APSARA_UNIT_TEST_MAIN
     std::optional<RateLimiter>& GetRateLimiter() { return mRateLimiter; }
     std::vector<std::pair<std::shared_ptr<ConcurrencyLimiter>, CounterPtr>>& GetConcurrencyLimiters() {
@@ -74,6 +77,7 @@ protected:
     std::vector<std::pair<std::shared_ptr<ConcurrencyLimiter>, CounterPtr>> mConcurrencyLimiters;
 
     std::deque<std::unique_ptr<SenderQueueItem>> mExtraBuffer;
+    std::shared_ptr<MemoryQuota> mMemoryQuota;
 
     IntGaugePtr mExtraBufferSize;
     IntGaugePtr mExtraBufferDataSizeBytes;
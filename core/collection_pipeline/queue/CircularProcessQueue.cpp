@@ -48,6 +48,11 @@ bool CircularProcessQueue::Push(unique_ptr<ProcessQueueItem>&& item) {
     }
     item->mEnqueTime = chrono::system_clock::now();
     auto size = item->mEventGroup.DataSize();
+    if (mMemoryQuota) {
+        // old data has been discarded above, so new data is always accepted
+        mMemoryQuota->Acquire(size, false);
+        item->mMemoryReservation = MemoryReservation(mMemoryQuota, size, false);
+    }
     mQueue.push_back(std::move(item));
     mEventCnt += newCnt;
 
@@ -28,6 +28,12 @@ ProcessQueueInterface::ProcessQueueInterface(int64_t key,
     mMetricsRecordRef.AddLabels({{METRIC_LABEL_KEY_COMPONENT_NAME, METRIC_LABEL_VALUE_COMPONENT_NAME_PROCESS_QUEUE}});
     mFetchTimesCnt = mMetricsRecordRef.CreateCounter(METRIC_COMPONENT_QUEUE_FETCH_TIMES_TOTAL);
     mValidFetchTimesCnt = mMetricsRecordRef.CreateCounter(METRIC_COMPONENT_QUEUE_VALID_FETCH_TIMES_TOTAL);
+    mOverCpuShareFlag = mMetricsRecordRef.CreateIntGauge(METRIC_COMPONENT_QUEUE_OVER_CPU_SHARE_FLAG);
+}
+
+void ProcessQueueInterface::SetOverCpuShare(bool overShare) {
+    mOverCpuShare = overShare;
+    SET_GAUGE(mOverCpuShareFlag, overShare);
 }
 
 void ProcessQueueInterface::SetDownStreamQueues(vector<BoundedSenderQueueInterface*>&& ques) {
@@ -42,7 +48,8 @@ void ProcessQueueInterface::SetDownStreamQueues(vector<BoundedSenderQueueInterfa
 }
 
 bool ProcessQueueInterface::IsValidToPop() const {
-    return mValidToPop && IsDownStreamQueuesValidToPush();
+    // data waiting to be sent beyond memory quota should be drained before more data is processed
+    return mValidToPop && IsDownStreamQueuesValidToPush() && (!mMemoryQuota || mMemoryQuota->IsValidToProcess());
 }
 
 bool ProcessQueueInterface::IsDownStreamQueuesValidToPush() const {
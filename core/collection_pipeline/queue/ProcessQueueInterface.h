@@ -43,6 +43,17 @@ public:
 
     void SetDownStreamQueues(std::vector<BoundedSenderQueueInterface*>&& ques);
 
+    void SetCpuWeight(uint32_t weight) { mCpuWeight = weight; }
+    uint32_t GetCpuWeight() const { return mCpuWeight; }
+    void AddCpuTime(uint64_t ns) { mCpuTimeNs += ns; }
+    void DecayCpuTime() { mCpuTimeNs /= 2; }
+    uint64_t GetCpuTime() const { return mCpuTimeNs; }
+    void SetOverCpuShare(bool overShare);
+    bool IsOverCpuShare() const { return mOverCpuShare; }
+
+    void SetMemoryQuota(const std::shared_ptr<MemoryQuota>& quota) { mMemoryQuota = quota; }
+    bool IsMemoryQuotaValidToPush() const { return !mMemoryQuota || mMemoryQuota->IsValidToPush(); }
+
     void DisablePop() { mValidToPop = false; }
     void EnablePop() { mValidToPop = true; }
 
@@ -53,8 +64,11 @@ public:
 protected:
     bool IsValidToPop() const;
 
+    std::shared_ptr<MemoryQuota> mMemoryQuota;
+
     CounterPtr mFetchTimesCnt;
     CounterPtr mValidFetchTimesCnt;
+    IntGaugePtr mOverCpuShareFlag;
 
 private:
     bool IsDownStreamQueuesValidToPush() const;
@@ -65,6 +79,11 @@ private:
     std::vector<BoundedSenderQueueInterface*> mDownStreamQueues;
     bool mValidToPop = false;
 
+    // recent cpu time of processing data from this queue, used for fair scheduling among queues of the same priority
+    uint32_t mCpuWeight = 1;
+    uint64_t mCpuTimeNs = 0;
+    bool mOverCpuShare = false;
+
 #ifdef APSARA_UNIT_TEST_MAIN
     friend class BoundedProcessQueueUnittest;
     friend class CircularProcessQueueUnittest;
@@ -20,6 +20,7 @@
 #include <memory>
 
 #include "collection_pipeline/CollectionPipelineManager.h"
+#include "collection_pipeline/limiter/MemoryBudget.h"
 #include "models/PipelineEventGroup.h"
 
 namespace logtail {
@@ -31,6 +32,7 @@ struct ProcessQueueItem {
     std::shared_ptr<CollectionPipeline> mPipeline; // not null only during pipeline update
     size_t mInputIndex = 0; // index of the input in the pipeline
     std::chrono::system_clock::time_point mEnqueTime;
+    MemoryReservation mMemoryReservation;
 
     ProcessQueueItem(PipelineEventGroup&& group, size_t index) : mEventGroup(std::move(group)), mInputIndex(index) {}
 
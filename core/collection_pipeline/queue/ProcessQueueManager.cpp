@@ -21,6 +21,10 @@
 #include "common/Flags.h"
 
 DEFINE_FLAG_INT32(bounded_process_queue_capacity, "", 5);
+DEFINE_FLAG_INT32(process_queue_cpu_share_update_interval_ms, "", 1000);
+DEFINE_FLAG_DOUBLE(process_queue_cpu_share_tolerance_ratio,
+                   "process queue using more cpu than this ratio of its fair share is deprioritized, 0 means disabled",
+                   1.5);
 
 DECLARE_FLAG_INT32(process_thread_count);
 
@@ -103,7 +107,8 @@ bool ProcessQueueManager::IsValidToPush(QueueKey key) const {
     auto iter = mQueues.find(key);
     if (iter != mQueues.end()) {
         if (iter->second.second == QueueType::BOUNDED) {
-            return static_cast<BoundedProcessQueue*>(iter->second.first->get())->IsValidToPush();
+            auto que = static_cast<BoundedProcessQueue*>(iter->second.first->get());
+            return que->IsValidToPush() && que->IsMemoryQuotaValidToPush();
         } else {
             return true;
         }
@@ -133,40 +138,12 @@ QueueStatus ProcessQueueManager::PushQueue(QueueKey key, unique_ptr<ProcessQueue
 bool ProcessQueueManager::PopItem(int64_t threadNo, unique_ptr<ProcessQueueItem>& item, string& configName) {
     configName.clear();
     lock_guard<mutex> lock(mQueueMux);
+    UpdateCpuShares();
     for (size_t i = 0; i <= sMaxPriority; ++i) {
-        ProcessQueueIterator iter;
-        if (mCurrentQueueIndex.first == i) {
-            for (iter = mCurrentQueueIndex.second; iter != mPriorityQueue[i].end(); ++iter) {
-                if (!(*iter)->Pop(item)) {
-                    continue;
-                }
-                configName = (*iter)->GetConfigName();
-                break;
-            }
-            if (configName.empty()) {
-                for (iter = mPriorityQueue[i].begin(); iter != mCurrentQueueIndex.second; ++iter) {
-                    if (!(*iter)->Pop(item)) {
-                        continue;
-                    }
-                    configName = (*iter)->GetConfigName();
-                    break;
-                }
-            }
-        } else {
-            for (iter = mPriorityQueue[i].begin(); iter != mPriorityQueue[i].end(); ++iter) {
-                if (!(*iter)->Pop(item)) {
-                    continue;
-                }
-                configName = (*iter)->GetConfigName();
-                break;
-            }
-        }
-        if (!configName.empty()) {
-            mCurrentQueueIndex.first = i;
-            mCurrentQueueIndex.second = ++iter;
-            if (mCurrentQueueIndex.second == mPriorityQueue[i].end()) {
-                mCurrentQueueIndex.second = mPriorityQueue[i].begin();
-            }
+        // queues exceeding their cpu share are served only when other queues of the same priority have nothing to pop
+        bool hasSkippedQueue = false;
+        if (PopItemFromQueues(i, true, item, configName, hasSkippedQueue)
+            || (hasSkippedQueue && PopItemFromQueues(i, false, item, configName, hasSkippedQueue))) {
             return true;
         }
         // find exactly once queues next
@@ -218,6 +195,36 @@ bool ProcessQueueManager::SetDownStreamQueues(QueueKey key, vector<BoundedSender
     return true;
 }
 
+bool ProcessQueueManager::SetMemoryQuota(QueueKey key, const shared_ptr<MemoryQuota>& quota) {
+    lock_guard<mutex> lock(mQueueMux);
+    auto iter = mQueues.find(key);
+    if (iter == mQueues.end()) {
+        return false;
+    }
+    (*iter->second.first)->SetMemoryQuota(quota);
+    return true;
+}
+
+bool ProcessQueueManager::SetCpuWeight(QueueKey key, uint32_t weight) {
+    lock_guard<mutex> lock(mQueueMux);
+    auto iter = mQueues.find(key);
+    if (iter == mQueues.end()) {
+        return false;
+    }
+    (*iter->second.first)->SetCpuWeight(weight);
+    return true;
+}
+
+void ProcessQueueManager::AddCpuTime(QueueKey key, chrono::nanoseconds cpuTime) {
+    lock_guard<mutex> lock(mQueueMux);
+    auto iter = mQueues.find(key);
+    if (iter == mQueues.end()) {
+        // exactly once queues are not scheduled by cpu share
+        return;
+    }
+    (*iter->second.first)->AddCpuTime(cpuTime.count());
+}
+
 bool ProcessQueueManager::SetFeedbackInterface(QueueKey key, vector<FeedbackInterface*>&& feedback) {
     lock_guard<mutex> lock(mQueueMux);
     auto iter = mQueues.find(key);
@@ -331,6 +338,72 @@ void ProcessQueueManager::ResetCurrentQueueIndex() {
     mCurrentQueueIndex.second = mPriorityQueue[0].begin();
 }
 
+bool ProcessQueueManager::PopItemFromQueues(uint32_t priority,
+                                            bool checkCpuShare,
+                                            unique_ptr<ProcessQueueItem>& item,
+                                            string& configName,
+                                            bool& hasSkippedQueue) {
+    auto& queues = mPriorityQueue[priority];
+    auto popFrom = [&](ProcessQueueIterator begin, ProcessQueueIterator end) {
+        for (auto iter = begin; iter != end; ++iter) {
+            if (checkCpuShare && (*iter)->IsOverCpuShare()) {
+                hasSkippedQueue = true;
+                continue;
+            }
+            if (!(*iter)->Pop(item)) {
+                continue;
+            }
+            configName = (*iter)->GetConfigName();
+            mCurrentQueueIndex.first = priority;
+            mCurrentQueueIndex.second = ++iter;
+            if (mCurrentQueueIndex.second == queues.end()) {
+                mCurrentQueueIndex.second = queues.begin();
+            }
+            return true;
+        }
+        return false;
+    };
+    if (mCurrentQueueIndex.first == priority) {
+        auto current = mCurrentQueueIndex.second;
+        return popFrom(current, queues.end()) || popFrom(queues.begin(), current);
+    }
+    return popFrom(queues.begin(), queues.end());
+}
+
+void ProcessQueueManager::UpdateCpuShares() {
+    auto now = chrono::steady_clock::now();
+    if (now - mLastCpuShareUpdateTime < chrono::milliseconds(INT32_FLAG(process_queue_cpu_share_update_interval_ms))) {
+        return;
+    }
+    mLastCpuShareUpdateTime = now;
+
+    double ratio = DOUBLE_FLAG(process_queue_cpu_share_tolerance_ratio);
+    for (auto& queues : mPriorityQueue) {
+        // only queues with data or recent cpu usage take part in sharing
+        uint64_t totalCpuTime = 0;
+        uint64_t totalWeight = 0;
+        size_t activeCnt = 0;
+        for (const auto& q : queues) {
+            if (q->GetCpuTime() == 0 && q->Empty()) {
+                continue;
+            }
+            totalCpuTime += q->GetCpuTime();
+            totalWeight += q->GetCpuWeight();
+            ++activeCnt;
+        }
+        for (auto& q : queues) {
+            bool isOverShare = false;
+            if (ratio > 0 && activeCnt > 1 && totalWeight > 0) {
+                double share = static_cast<double>(totalCpuTime) * q->GetCpuWeight() / totalWeight;
+                isOverShare = q->GetCpuTime() > share * ratio;
+            }
+            q->SetOverCpuShare(isOverShare);
+            // cpu time decays by half every interval, so that only recent usage matters
+            q->DecayCpuTime();
+        }
+    }
+}
+
 #ifdef APSARA_UNIT_TEST_MAIN
 void ProcessQueueManager::Clear() {
     lock_guard<mutex> lock(mQueueMux);
@@ -18,6 +18,7 @@
 
 #include <cstdint>
 
+#include <chrono>
 #include <condition_variable>
 #include <list>
 #include <memory>
@@ -66,6 +67,9 @@ public:
     bool IsAllQueueEmpty() const;
     bool SetDownStreamQueues(QueueKey key, std::vector<BoundedSenderQueueInterface*>&& ques);
     bool SetFeedbackInterface(QueueKey key, std::vector<FeedbackInterface*>&& feedback);
+    bool SetMemoryQuota(QueueKey key, const std::shared_ptr<MemoryQuota>& quota);
+    bool SetCpuWeight(QueueKey key, uint32_t weight);
+    void AddCpuTime(QueueKey key, std::chrono::nanoseconds cpuTime);
     void DisablePop(const std::string& configName, bool isPipelineRemoving);
     void EnablePop(const std::string& configName);
 
@@ -81,6 +85,12 @@ private:
     void AdjustQueuePriority(const ProcessQueueIterator& iter, uint32_t priority);
     void DeleteQueueEntity(const ProcessQueueIterator& iter);
     void ResetCurrentQueueIndex();
+    bool PopItemFromQueues(uint32_t priority,
+                           bool checkCpuShare,
+                           std::unique_ptr<ProcessQueueItem>& item,
+                           std::string& configName,
+                           bool& hasSkippedQueue);
+    void UpdateCpuShares();
 
     BoundedQueueParam mBoundedQueueParam;
 
@@ -88,6 +98,7 @@ private:
     std::unordered_map<QueueKey, std::pair<ProcessQueueIterator, QueueType>> mQueues;
     std::list<std::unique_ptr<ProcessQueueInterface>> mPriorityQueue[sMaxPriority + 1];
     std::pair<uint32_t, ProcessQueueIterator> mCurrentQueueIndex;
+    std::chrono::steady_clock::time_point mLastCpuShareUpdateTime;
 
     mutable std::mutex mStateMux;
     mutable std::condition_variable mCond;
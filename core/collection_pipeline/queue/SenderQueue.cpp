@@ -33,6 +33,11 @@ SenderQueue::SenderQueue(
 bool SenderQueue::Push(unique_ptr<SenderQueueItem>&& item) {
     item->mFirstEnqueTime = chrono::system_clock::now();
     auto size = item->mData.size();
+    if (mMemoryQuota) {
+        // data already processed cannot be rejected, it only stops the process queue from popping when over quota
+        mMemoryQuota->Acquire(size, true);
+        item->mMemoryReservation = MemoryReservation(mMemoryQuota, size, true);
+    }
 
     ADD_COUNTER(mInItemsTotal, 1);
     ADD_COUNTER(mInItemDataSizeBytes, size);
@@ -23,6 +23,7 @@
 #include <memory>
 #include <string>
 
+#include "collection_pipeline/limiter/MemoryBudget.h"
 #include "collection_pipeline/queue/QueueKey.h"
 
 namespace logtail {
@@ -46,6 +47,7 @@ struct SenderQueueItem {
     std::chrono::system_clock::time_point mFirstEnqueTime;
     std::chrono::system_clock::time_point mLastSendTime;
     uint32_t mTryCnt = 1;
+    MemoryReservation mMemoryReservation;
 
     SenderQueueItem(std::string&& data,
                     size_t rawSize,
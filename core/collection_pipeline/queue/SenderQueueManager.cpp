@@ -51,6 +51,16 @@ bool SenderQueueManager::CreateQueue(
     return true;
 }
 
+bool SenderQueueManager::SetMemoryQuota(QueueKey key, const shared_ptr<MemoryQuota>& quota) {
+    lock_guard<mutex> lock(mQueueMux);
+    auto iter = mQueues.find(key);
+    if (iter == mQueues.end()) {
+        return false;
+    }
+    iter->second.SetMemoryQuota(quota);
+    return true;
+}
+
 SenderQueue* SenderQueueManager::GetQueue(QueueKey key) {
     lock_guard<mutex> lock(mQueueMux);
     auto iter = mQueues.find(key);
@@ -199,7 +209,7 @@ bool SenderQueueManager::IsValidToPush(QueueKey key) const {
     lock_guard<mutex> lock(mQueueMux);
     auto iter = mQueues.find(key);
     if (iter != mQueues.end()) {
-        return iter->second.IsValidToPush();
+        return iter->second.IsValidToPush() && iter->second.IsMemoryQuotaValidToPush();
     }
     // no need to check exactly once queue, since the caller does not support exactly once
     // should not happen
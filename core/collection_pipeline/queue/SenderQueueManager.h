@@ -52,6 +52,7 @@ public:
                      std::unordered_map<std::string, std::shared_ptr<ConcurrencyLimiter>>&& concurrencyLimitersMap
                      = std::unordered_map<std::string, std::shared_ptr<ConcurrencyLimiter>>(),
                      uint32_t maxRate = 0);
+    bool SetMemoryQuota(QueueKey key, const std::shared_ptr<MemoryQuota>& quota);
     SenderQueue* GetQueue(QueueKey key);
     bool DeleteQueue(QueueKey key);
     bool ReuseQueue(QueueKey key);
@@ -14,6 +14,8 @@
 
 #include "collection_pipeline/serializer/JsonSerializer.h"
 
+#include "common/JsonUtil.h"
+#include "common/StringTools.h"
 #include "constants/SpanConstants.h"
 // TODO: the following dependencies should be removed
 #include "protobuf/sls/LogGroupSerializer.h"
@@ -24,6 +26,29 @@ namespace logtail {
 
 const string JSON_KEY_TIME = "__time__";
 
+namespace {
+
+void AppendJsonMember(StringView key, StringView value, string& res) {
+    AppendJsonString(key, res);
+    res.push_back(':');
+    AppendJsonString(value, res);
+    res.push_back(',');
+}
+
+void AppendTime(time_t t, string& res) {
+    AppendJsonString(JSON_KEY_TIME, res);
+    res.push_back(':');
+    res.append(ToString(static_cast<int64_t>(t)));
+    res.push_back(',');
+}
+
+// replaces the trailing comma of the last member
+void EndJsonObject(string& res) {
+    res.back() = '}';
+}
+
+} // namespace
+
 bool JsonEventGroupSerializer::Serialize(BatchedEvents&& group, string& res, string& errorMsg) {
     if (group.mEvents.empty()) {
         errorMsg = "empty event group";
@@ -37,29 +62,65 @@ bool JsonEventGroupSerializer::Serialize(BatchedEvents&& group, string& res, str
         return false;
     }
 
-    Json::Value groupTags;
+    // Each event is written as a single-line json object, with group tags written ahead of its own fields. Fields of
+    // the event take precedence over group tags with the same key, so such tags are skipped. Group tags are escaped
+    // once and copied to each event.
+    auto isReservedKey = [eventType](StringView key) {
+        if (key == JSON_KEY_TIME) {
+            return true;
+        }
+        switch (eventType) {
+            case PipelineEvent::Type::METRIC:
+                return key == METRIC_RESERVED_KEY_LABELS || key == METRIC_RESERVED_KEY_NAME
+                    || key == METRIC_RESERVED_KEY_VALUE;
+            case PipelineEvent::Type::RAW:
+                return key == DEFAULT_CONTENT_KEY;
+            default:
+                return false;
+        }
+    };
+    string groupTags;
     for (const auto& tag : group.mTags.mInner) {
-        groupTags[tag.first.to_string()] = tag.second.to_string();
+        if (!isReservedKey(tag.first)) {
+            AppendJsonMember(tag.first, tag.second, groupTags);
+        }
     }
 
+    res.clear();
+    res.reserve(group.mSizeBytes + group.mEvents.size() * (groupTags.size() + 32));
     // TODO: should support nano second
-    ostringstream oss;
     switch (eventType) {
         case PipelineEvent::Type::LOG:
             for (const auto& item : group.mEvents) {
                 const auto& e = item.Cast<LogEvent>();
-                Json::Value eventJson;
+                res.push_back('{');
                 // tags
-                eventJson.copy(groupTags);
+                bool tagOverwritten = false;
+                for (const auto& tag : group.mTags.mInner) {
+                    if (e.HasContent(tag.first)) {
+                        tagOverwritten = true;
+                        break;
+                    }
+                }
+                if (!tagOverwritten) {
+                    res.append(groupTags);
+                } else {
+                    for (const auto& tag : group.mTags.mInner) {
+                        if (!isReservedKey(tag.first) && !e.HasContent(tag.first)) {
+                            AppendJsonMember(tag.first, tag.second, res);
+                        }
+                    }
+                }
                 // time
-                eventJson[JSON_KEY_TIME] = e.GetTimestamp();
+                if (!e.HasContent(JSON_KEY_TIME)) {
+                    AppendTime(e.GetTimestamp(), res);
+                }
                 // contents
                 for (const auto& kv : e) {
-                    eventJson[kv.first.to_string()] = kv.second.to_string();
+                    AppendJsonMember(kv.first, kv.second, res);
                 }
-                Json::StreamWriterBuilder writer;
-                writer["indentation"] = "";
-                oss << Json::writeString(writer, eventJson) << endl;
+                EndJsonObject(res);
+                res.push_back('\n');
             }
             break;
         case PipelineEvent::Type::METRIC:
@@ -69,34 +130,48 @@ bool JsonEventGroupSerializer::Serialize(BatchedEvents&& group, string& res, str
                 if (e.Is<std::monostate>()) {
                     continue;
                 }
-                Json::Value eventJson;
+                res.push_back('{');
                 // tags
-                eventJson.copy(groupTags);
+                res.append(groupTags);
                 // time
-                eventJson[JSON_KEY_TIME] = e.GetTimestamp();
+                AppendTime(e.GetTimestamp(), res);
                 // __labels__
-                eventJson[METRIC_RESERVED_KEY_LABELS] = Json::objectValue;
-                auto& labels = eventJson[METRIC_RESERVED_KEY_LABELS];
+                AppendJsonString(METRIC_RESERVED_KEY_LABELS, res);
+                res.append(":{", 2);
+                if (e.TagsBegin() == e.TagsEnd()) {
+                    res.push_back(',');
+                }
                 for (auto tag = e.TagsBegin(); tag != e.TagsEnd(); tag++) {
-                    labels[tag->first.to_string()] = tag->second.to_string();
+                    AppendJsonMember(tag->first, tag->second, res);
                 }
+                EndJsonObject(res);
+                res.push_back(',');
                 // __name__
-                eventJson[METRIC_RESERVED_KEY_NAME] = e.GetName().to_string();
+                AppendJsonMember(METRIC_RESERVED_KEY_NAME, e.GetName(), res);
                 // __value__
                 if (e.Is<UntypedSingleValue>()) {
-                    eventJson[METRIC_RESERVED_KEY_VALUE] = e.GetValue<UntypedSingleValue>()->mValue;
+                    AppendJsonString(METRIC_RESERVED_KEY_VALUE, res);
+                    res.push_back(':');
+                    AppendJsonDouble(e.GetValue<UntypedSingleValue>()->mValue, res);
+                    res.push_back(',');
                 } else if (e.Is<UntypedMultiDoubleValues>()) {
-                    eventJson[METRIC_RESERVED_KEY_VALUE] = Json::objectValue;
-                    auto& values = eventJson[METRIC_RESERVED_KEY_VALUE];
-                    for (auto value = e.GetValue<UntypedMultiDoubleValues>()->ValuesBegin();
-                         value != e.GetValue<UntypedMultiDoubleValues>()->ValuesEnd();
-                         value++) {
-                        values[value->first.to_string()] = value->second.Value;
+                    AppendJsonString(METRIC_RESERVED_KEY_VALUE, res);
+                    res.append(":{", 2);
+                    const auto* values = e.GetValue<UntypedMultiDoubleValues>();
+                    if (values->ValuesBegin() == values->ValuesEnd()) {
+                        res.push_back(',');
+                    }
+                    for (auto value = values->ValuesBegin(); value != values->ValuesEnd(); value++) {
+                        AppendJsonString(value->first, res);
+                        res.push_back(':');
+                        AppendJsonDouble(value->second.Value, res);
+                        res.push_back(',');
                     }
+                    EndJsonObject(res);
+                    res.push_back(',');
                 }
-                Json::StreamWriterBuilder writer;
-                writer["indentation"] = "";
-                oss << Json::writeString(writer, eventJson) << endl;
+                EndJsonObject(res);
+                res.push_back('\n');
             }
             break;
         case PipelineEvent::Type::SPAN:
@@ -108,22 +183,20 @@ bool JsonEventGroupSerializer::Serialize(BatchedEvents&& group, string& res, str
         case PipelineEvent::Type::RAW:
             for (const auto& item : group.mEvents) {
                 const auto& e = item.Cast<RawEvent>();
-                Json::Value eventJson;
+                res.push_back('{');
                 // tags
-                eventJson.copy(groupTags);
+                res.append(groupTags);
                 // time
-                eventJson[JSON_KEY_TIME] = e.GetTimestamp();
+                AppendTime(e.GetTimestamp(), res);
                 // content
-                eventJson[DEFAULT_CONTENT_KEY] = e.GetContent().to_string();
-                Json::StreamWriterBuilder writer;
-                writer["indentation"] = "";
-                oss << Json::writeString(writer, eventJson) << endl;
+                AppendJsonMember(DEFAULT_CONTENT_KEY, e.GetContent(), res);
+                EndJsonObject(res);
+                res.push_back('\n');
             }
             break;
         default:
             break;
     }
-    res = oss.str();
     return true;
 }
 
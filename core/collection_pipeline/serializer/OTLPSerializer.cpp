@@ -0,0 +1,448 @@
+// Copyright 2025 iLogtail Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "collection_pipeline/serializer/OTLPSerializer.h"
+
+#include <xxhash/xxhash.h>
+
+#include <algorithm>
+#include <cstring>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "constants/Constants.h"
+#include "logger/Logger.h"
+#include "protobuf/otlp/ExportRequestSerializer.h"
+
+using namespace std;
+
+namespace logtail {
+
+namespace {
+
+// field numbers in opentelemetry/proto
+// Export{Logs,Metrics,Trace}ServiceRequest
+constexpr uint32_t REQUEST_RESOURCE_DATA = 1;
+// Resource{Logs,Metrics,Spans}
+constexpr uint32_t RESOURCE_DATA_RESOURCE = 1;
+constexpr uint32_t RESOURCE_DATA_SCOPE_DATA = 2;
+// Resource
+constexpr uint32_t RESOURCE_ATTRIBUTES = 1;
+// Scope{Logs,Metrics,Spans}
+constexpr uint32_t SCOPE_DATA_SCOPE = 1;
+constexpr uint32_t SCOPE_DATA_RECORDS = 2;
+// InstrumentationScope
+constexpr uint32_t SCOPE_NAME = 1;
+constexpr uint32_t SCOPE_VERSION = 2;
+constexpr uint32_t SCOPE_ATTRIBUTES = 3;
+// LogRecord
+constexpr uint32_t LOG_TIME_UNIX_NANO = 1;
+constexpr uint32_t LOG_SEVERITY_TEXT = 3;
+constexpr uint32_t LOG_BODY = 5;
+constexpr uint32_t LOG_ATTRIBUTES = 6;
+// AnyValue
+constexpr uint32_t ANY_VALUE_STRING = 1;
+// Metric
+constexpr uint32_t METRIC_NAME = 1;
+constexpr uint32_t METRIC_GAUGE = 5;
+constexpr uint32_t METRIC_SUM = 7;
+// Gauge and Sum
+constexpr uint32_t METRIC_DATA_POINTS = 1;
+constexpr uint32_t SUM_AGGREGATION_TEMPORALITY = 2;
+constexpr uint32_t SUM_IS_MONOTONIC = 3;
+// NumberDataPoint
+constexpr uint32_t POINT_TIME_UNIX_NANO = 3;
+constexpr uint32_t POINT_AS_DOUBLE = 4;
+constexpr uint32_t POINT_ATTRIBUTES = 7;
+// Span
+constexpr uint32_t SPAN_TRACE_ID = 1;
+constexpr uint32_t SPAN_SPAN_ID = 2;
+constexpr uint32_t SPAN_TRACE_STATE = 3;
+constexpr uint32_t SPAN_PARENT_SPAN_ID = 4;
+constexpr uint32_t SPAN_NAME = 5;
+constexpr uint32_t SPAN_KIND = 6;
+constexpr uint32_t SPAN_START_TIME_UNIX_NANO = 7;
+constexpr uint32_t SPAN_END_TIME_UNIX_NANO = 8;
+constexpr uint32_t SPAN_ATTRIBUTES = 9;
+constexpr uint32_t SPAN_EVENTS = 11;
+constexpr uint32_t SPAN_LINKS = 13;
+constexpr uint32_t SPAN_STATUS = 15;
+// Span.Event
+constexpr uint32_t SPAN_EVENT_TIME_UNIX_NANO = 1;
+constexpr uint32_t SPAN_EVENT_NAME = 2;
+constexpr uint32_t SPAN_EVENT_ATTRIBUTES = 3;
+// Span.Link
+constexpr uint32_t SPAN_LINK_TRACE_ID = 1;
+constexpr uint32_t SPAN_LINK_SPAN_ID = 2;
+constexpr uint32_t SPAN_LINK_TRACE_STATE = 3;
+constexpr uint32_t SPAN_LINK_ATTRIBUTES = 4;
+// Status
+constexpr uint32_t STATUS_CODE = 3;
+
+constexpr uint64_t AGGREGATION_TEMPORALITY_CUMULATIVE = 2;
+
+constexpr size_t TRACE_ID_SIZE = 16;
+constexpr size_t SPAN_ID_SIZE = 8;
+
+using OTLPAttributes = vector<pair<StringView, StringView>>;
+
+// events of the same instrumentation scope
+struct OTLPScope {
+    OTLPAttributes mTags;
+    vector<const PipelineEvent*> mEvents;
+};
+
+struct OTLPResource {
+    OTLPAttributes mAttributes;
+    vector<OTLPScope> mScopes;
+
+    template <typename It>
+    OTLPScope& GetScope(It begin, It end) {
+        // there are only a few scopes in a resource
+        for (auto& scope : mScopes) {
+            if (equal(scope.mTags.begin(), scope.mTags.end(), begin, end)) {
+                return scope;
+            }
+        }
+        mScopes.emplace_back();
+        mScopes.back().mTags.assign(begin, end);
+        return mScopes.back();
+    }
+};
+
+class OTLPResourceSet {
+public:
+    OTLPResource& Get(OTLPAttributes& attributes) {
+        uint64_t h = 0;
+        for (const auto& attr : attributes) {
+            h = XXH64(attr.first.data(), attr.first.size(), h);
+            h = XXH64(attr.second.data(), attr.second.size(), h);
+        }
+        auto range = mIndex.equal_range(h);
+        for (auto it = range.first; it != range.second; ++it) {
+            auto& resource = mResources[it->second];
+            if (resource.mAttributes == attributes) {
+                return resource;
+            }
+        }
+        mIndex.emplace(h, mResources.size());
+        mResources.emplace_back();
+        mResources.back().mAttributes.swap(attributes);
+        return mResources.back();
+    }
+
+    vector<OTLPResource>& GetResources() { return mResources; }
+
+private:
+    vector<OTLPResource> mResources;
+    unordered_multimap<uint64_t, size_t> mIndex;
+};
+
+int HexValue(char c) {
+    if (c >= '0' && c <= '9') {
+        return c - '0';
+    }
+    if (c >= 'a' && c <= 'f') {
+        return c - 'a' + 10;
+    }
+    if (c >= 'A' && c <= 'F') {
+        return c - 'A' + 10;
+    }
+    return -1;
+}
+
+// ids are hex strings in span events, but raw bytes in otlp
+bool DecodeHexId(StringView hex, uint8_t* res, size_t size) {
+    if (hex.size() != size * 2) {
+        return false;
+    }
+    for (size_t i = 0; i < size; ++i) {
+        int hi = HexValue(hex[2 * i]);
+        int lo = HexValue(hex[2 * i + 1]);
+        if (hi < 0 || lo < 0) {
+            return false;
+        }
+        res[i] = static_cast<uint8_t>((hi << 4) | lo);
+    }
+    return true;
+}
+
+bool IsValidSpan(const SpanEvent& e) {
+    uint8_t traceId[TRACE_ID_SIZE], spanId[SPAN_ID_SIZE];
+    return DecodeHexId(e.GetTraceId(), traceId, TRACE_ID_SIZE) && DecodeHexId(e.GetSpanId(), spanId, SPAN_ID_SIZE)
+        && (e.GetParentSpanId().empty() || DecodeHexId(e.GetParentSpanId(), spanId, SPAN_ID_SIZE));
+}
+
+uint64_t GetTimeUnixNano(const PipelineEvent& e) {
+    return static_cast<uint64_t>(e.GetTimestamp()) * 1000000000ULL
+        + (e.GetTimestampNanosecond() ? e.GetTimestampNanosecond().value() : 0);
+}
+
+void AddScope(const OTLPScope& scope, ExportRequestSerializer& serializer) {
+    if (scope.mTags.empty()) {
+        return;
+    }
+    serializer.StartMessage(SCOPE_DATA_SCOPE);
+    for (const auto& tag : scope.mTags) {
+        if (tag.first == SpanEvent::OTLP_SCOPE_NAME) {
+            serializer.AddString(SCOPE_NAME, tag.second);
+        } else if (tag.first == SpanEvent::OTLP_SCOPE_VERSION) {
+            serializer.AddString(SCOPE_VERSION, tag.second);
+        } else {
+            serializer.AddStringKeyValue(SCOPE_ATTRIBUTES, tag.first, tag.second);
+        }
+    }
+    serializer.EndMessage();
+}
+
+void AddLogRecord(const PipelineEvent& event, ExportRequestSerializer& serializer) {
+    serializer.StartMessage(SCOPE_DATA_RECORDS);
+    serializer.AddFixed64(LOG_TIME_UNIX_NANO, GetTimeUnixNano(event));
+    if (event.GetType() == PipelineEvent::Type::RAW) {
+        serializer.StartMessage(LOG_BODY);
+        serializer.AddString(ANY_VALUE_STRING, static_cast<const RawEvent&>(event).GetContent());
+        serializer.EndMessage();
+    } else {
+        const auto& e = static_cast<const LogEvent&>(event);
+        if (!e.GetLevel().empty()) {
+            serializer.AddString(LOG_SEVERITY_TEXT, e.GetLevel());
+        }
+        // content is the body, and other contents are attributes
+        for (const auto& kv : e) {
+            if (kv.first == DEFAULT_CONTENT_KEY) {
+                serializer.StartMessage(LOG_BODY);
+                serializer.AddString(ANY_VALUE_STRING, kv.second);
+                serializer.EndMessage();
+            } else {
+                serializer.AddStringKeyValue(LOG_ATTRIBUTES, kv.first, kv.second);
+            }
+        }
+    }
+    serializer.EndMessage();
+}
+
+void AddNumberMetric(const MetricEvent& e,
+                     StringView name,
+                     double value,
+                     bool isCounter,
+                     uint64_t timeUnixNano,
+                     ExportRequestSerializer& serializer) {
+    serializer.StartMessage(SCOPE_DATA_RECORDS);
+    serializer.AddString(METRIC_NAME, name);
+    serializer.StartMessage(isCounter ? METRIC_SUM : METRIC_GAUGE);
+    serializer.StartMessage(METRIC_DATA_POINTS);
+    for (auto it = e.TagsBegin(); it != e.TagsEnd(); ++it) {
+        serializer.AddStringKeyValue(POINT_ATTRIBUTES, it->first, it->second);
+    }
+    serializer.AddFixed64(POINT_TIME_UNIX_NANO, timeUnixNano);
+    serializer.AddDouble(POINT_AS_DOUBLE, value);
+    serializer.EndMessage();
+    if (isCounter) {
+        serializer.AddVarint(SUM_AGGREGATION_TEMPORALITY, AGGREGATION_TEMPORALITY_CUMULATIVE);
+        serializer.AddVarint(SUM_IS_MONOTONIC, 1);
+    }
+    serializer.EndMessage();
+    serializer.EndMessage();
+}
+
+void AddMetrics(const MetricEvent& e, string& nameBuffer, ExportRequestSerializer& serializer) {
+    uint64_t timeUnixNano = GetTimeUnixNano(e);
+    if (e.Is<UntypedSingleValue>()) {
+        AddNumberMetric(e, e.GetName(), e.GetValue<UntypedSingleValue>()->mValue, false, timeUnixNano, serializer);
+        return;
+    }
+    // each value is a metric named after the metric and the value key, the same as remote write
+    const auto* values = e.GetValue<UntypedMultiDoubleValues>();
+    for (auto it = values->ValuesBegin(); it != values->ValuesEnd(); ++it) {
+        StringView name = it->first;
+        if (!e.GetName().empty()) {
+            nameBuffer.assign(e.GetName().data(), e.GetName().size());
+            nameBuffer.push_back('_');
+            nameBuffer.append(it->first.data(), it->first.size());
+            name = StringView(nameBuffer);
+        }
+        AddNumberMetric(e,
+                        name,
+                        it->second.Value,
+                        it->second.MetricType == UntypedValueMetricType::MetricTypeCounter,
+                        timeUnixNano,
+                        serializer);
+    }
+}
+
+void AddSpan(const SpanEvent& e, ExportRequestSerializer& serializer) {
+    uint8_t traceId[TRACE_ID_SIZE], spanId[SPAN_ID_SIZE];
+    serializer.StartMessage(SCOPE_DATA_RECORDS);
+    DecodeHexId(e.GetTraceId(), traceId, TRACE_ID_SIZE);
+    serializer.AddBytes(SPAN_TRACE_ID, traceId, TRACE_ID_SIZE);
+    DecodeHexId(e.GetSpanId(), spanId, SPAN_ID_SIZE);
+    serializer.AddBytes(SPAN_SPAN_ID, spanId, SPAN_ID_SIZE);
+    if (!e.GetTraceState().empty()) {
+        serializer.AddString(SPAN_TRACE_STATE, e.GetTraceState());
+    }
+    if (!e.GetParentSpanId().empty()) {
+        DecodeHexId(e.GetParentSpanId(), spanId, SPAN_ID_SIZE);
+        serializer.AddBytes(SPAN_PARENT_SPAN_ID, spanId, SPAN_ID_SIZE);
+    }
+    serializer.AddString(SPAN_NAME, e.GetName());
+    // the same values as Span.SpanKind
+    if (e.GetKind() != SpanEvent::Kind::Unspecified) {
+        serializer.AddVarint(SPAN_KIND, static_cast<uint64_t>(e.GetKind()));
+    }
+    serializer.AddFixed64(SPAN_START_TIME_UNIX_NANO, e.GetStartTimeNs());
+    serializer.AddFixed64(SPAN_END_TIME_UNIX_NANO, e.GetEndTimeNs());
+    for (auto it = e.TagsBegin(); it != e.TagsEnd(); ++it) {
+        serializer.AddStringKeyValue(SPAN_ATTRIBUTES, it->first, it->second);
+    }
+    for (const auto& innerEvent : e.GetEvents()) {
+        serializer.StartMessage(SPAN_EVENTS);
+        serializer.AddFixed64(SPAN_EVENT_TIME_UNIX_NANO, innerEvent.GetTimestampNs());
+        serializer.AddString(SPAN_EVENT_NAME, innerEvent.GetName());
+        for (auto it = innerEvent.TagsBegin(); it != innerEvent.TagsEnd(); ++it) {
+            serializer.AddStringKeyValue(SPAN_EVENT_ATTRIBUTES, it->first, it->second);
+        }
+        serializer.EndMessage();
+    }
+    for (const auto& link : e.GetLinks()) {
+        // links to invalid spans are useless
+        if (!DecodeHexId(link.GetTraceId(), traceId, TRACE_ID_SIZE)
+            || !DecodeHexId(link.GetSpanId(), spanId, SPAN_ID_SIZE)) {
+            continue;
+        }
+        serializer.StartMessage(SPAN_LINKS);
+        serializer.AddBytes(SPAN_LINK_TRACE_ID, traceId, TRACE_ID_SIZE);
+        serializer.AddBytes(SPAN_LINK_SPAN_ID, spanId, SPAN_ID_SIZE);
+        if (!link.GetTraceState().empty()) {
+            serializer.AddString(SPAN_LINK_TRACE_STATE, link.GetTraceState());
+        }
+        for (auto it = link.TagsBegin(); it != link.TagsEnd(); ++it) {
+            serializer.AddStringKeyValue(SPAN_LINK_ATTRIBUTES, it->first, it->second);
+        }
+        serializer.EndMessage();
+    }
+    // the same values as Status.StatusCode
+    if (e.GetStatus() != SpanEvent::StatusCode::Unset) {
+        serializer.StartMessage(SPAN_STATUS);
+        serializer.AddVarint(STATUS_CODE, static_cast<uint64_t>(e.GetStatus()));
+        serializer.EndMessage();
+    }
+    serializer.EndMessage();
+}
+
+} // namespace
+
+bool GetOTLPSignal(PipelineEvent::Type type, OTLPSignal& signal) {
+    switch (type) {
+        case PipelineEvent::Type::LOG:
+        case PipelineEvent::Type::RAW:
+            signal = OTLPSignal::LOGS;
+            return true;
+        case PipelineEvent::Type::METRIC:
+            signal = OTLPSignal::METRICS;
+            return true;
+        case PipelineEvent::Type::SPAN:
+            signal = OTLPSignal::TRACES;
+            return true;
+        default:
+            return false;
+    }
+}
+
+bool OTLPEventGroupListSerializer::Serialize(BatchedEventsList&& groupList, string& res, string& errorMsg) {
+    OTLPResourceSet resourceSet;
+    size_t discardedCnt = 0, totalSZ = 0;
+    for (const auto& group : groupList) {
+        OTLPResource* resource = nullptr;
+        for (const auto& item : group.mEvents) {
+            OTLPSignal signal;
+            if (!GetOTLPSignal(item->GetType(), signal) || signal != mSignal) {
+                ++discardedCnt;
+                continue;
+            }
+            if ((item.Is<MetricEvent>() && item.Cast<MetricEvent>().Is<std::monostate>())
+                || (item.Is<SpanEvent>() && !IsValidSpan(item.Cast<SpanEvent>()))) {
+                ++discardedCnt;
+                continue;
+            }
+            if (resource == nullptr) {
+                OTLPAttributes attributes;
+                for (const auto& tag : group.mTags.mInner) {
+                    if (tag.second.empty() || tag.first.starts_with("__")) {
+                        continue;
+                    }
+                    attributes.emplace_back(tag.first, tag.second);
+                }
+                resource = &resourceSet.Get(attributes);
+            }
+            OTLPScope* scope = nullptr;
+            if (item.Is<SpanEvent>()) {
+                const auto& e = item.Cast<SpanEvent>();
+                scope = &resource->GetScope(e.ScopeTagsBegin(), e.ScopeTagsEnd());
+            } else {
+                scope = &resource->GetScope(OTLPAttributes::const_iterator(), OTLPAttributes::const_iterator());
+            }
+            scope->mEvents.push_back(&item.Cast<PipelineEvent>());
+        }
+        totalSZ += group.mSizeBytes;
+    }
+    if (discardedCnt > 0) {
+        LOG_WARNING(sLogger,
+                    ("invalid events in otlp batch", "discard events")("count", discardedCnt)(
+                        "config", mFlusher->GetContext().GetConfigName()));
+    }
+
+    auto& resources = resourceSet.GetResources();
+    if (resources.empty()) {
+        errorMsg = "no valid event in event group";
+        return false;
+    }
+
+    ExportRequestSerializer serializer;
+    serializer.Prepare(totalSZ);
+    string nameBuffer;
+    for (const auto& resource : resources) {
+        serializer.StartMessage(REQUEST_RESOURCE_DATA);
+        if (!resource.mAttributes.empty()) {
+            serializer.StartMessage(RESOURCE_DATA_RESOURCE);
+            for (const auto& attr : resource.mAttributes) {
+                serializer.AddStringKeyValue(RESOURCE_ATTRIBUTES, attr.first, attr.second);
+            }
+            serializer.EndMessage();
+        }
+        for (const auto& scope : resource.mScopes) {
+            serializer.StartMessage(RESOURCE_DATA_SCOPE_DATA);
+            AddScope(scope, serializer);
+            for (const auto* e : scope.mEvents) {
+                switch (mSignal) {
+                    case OTLPSignal::LOGS:
+                        AddLogRecord(*e, serializer);
+                        break;
+                    case OTLPSignal::METRICS:
+                        AddMetrics(static_cast<const MetricEvent&>(*e), nameBuffer, serializer);
+                        break;
+                    case OTLPSignal::TRACES:
+                        AddSpan(static_cast<const SpanEvent&>(*e), serializer);
+                        break;
+                }
+            }
+            serializer.EndMessage();
+        }
+        serializer.EndMessage();
+    }
+    res = std::move(serializer.GetResult());
+    return true;
+}
+
+} // namespace logtail
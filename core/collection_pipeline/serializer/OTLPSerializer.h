@@ -0,0 +1,44 @@
+/*
+ * Copyright 2025 iLogtail Authors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <string>
+
+#include "collection_pipeline/serializer/Serializer.h"
+#include "models/PipelineEvent.h"
+
+namespace logtail {
+
+enum class OTLPSignal { LOGS, METRICS, TRACES };
+
+// log and raw events are exported as logs, metric events as metrics and span events as traces
+bool GetOTLPSignal(PipelineEvent::Type type, OTLPSignal& signal);
+
+// Serializes all events of the signal in a batch into one otlp export request, where events of other signals are
+// discarded. Groups with the same tags share one resource, whose attributes are the group tags except those starting
+// with "__". Spans are further grouped by their scope tags into instrumentation scopes.
+class OTLPEventGroupListSerializer : public Serializer<BatchedEventsList> {
+public:
+    OTLPEventGroupListSerializer(Flusher* f, OTLPSignal signal) : Serializer<BatchedEventsList>(f), mSignal(signal) {}
+
+private:
+    bool Serialize(BatchedEventsList&& p, std::string& res, std::string& errorMsg) override;
+
+    OTLPSignal mSignal;
+};
+
+} // namespace logtail
@@ -0,0 +1,187 @@
+// Copyright 2025 iLogtail Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "collection_pipeline/serializer/RemoteWriteSerializer.h"
+
+#include <xxhash/xxhash.h>
+
+#include <algorithm>
+#include <cstring>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "logger/Logger.h"
+#include "protobuf/prometheus/WriteRequestSerializer.h"
+
+using namespace std;
+
+namespace logtail {
+
+static const string REMOTE_WRITE_METRIC_NAME_LABEL = "__name__";
+
+namespace {
+
+using RemoteWriteLabels = vector<pair<StringView, StringView>>;
+
+struct RemoteWriteSeries {
+    RemoteWriteLabels mLabels;
+    // timestamp in milliseconds, value
+    vector<pair<int64_t, double>> mSamples;
+};
+
+class RemoteWriteSeriesSet {
+public:
+    void Add(RemoteWriteLabels& labels, int64_t timestampMs, double value) {
+        uint64_t h = 0;
+        for (const auto& label : labels) {
+            h = XXH64(label.first.data(), label.first.size(), h);
+            h = XXH64(label.second.data(), label.second.size(), h);
+        }
+        auto range = mIndex.equal_range(h);
+        for (auto it = range.first; it != range.second; ++it) {
+            auto& series = mSeries[it->second];
+            if (series.mLabels == labels) {
+                series.mSamples.emplace_back(timestampMs, value);
+                return;
+            }
+        }
+        mIndex.emplace(h, mSeries.size());
+        mSeries.emplace_back();
+        mSeries.back().mLabels.swap(labels);
+        mSeries.back().mSamples.emplace_back(timestampMs, value);
+    }
+
+    vector<RemoteWriteSeries>& GetSeries() { return mSeries; }
+
+private:
+    vector<RemoteWriteSeries> mSeries;
+    unordered_multimap<uint64_t, size_t> mIndex;
+};
+
+} // namespace
+
+static void AddSeries(const MetricEvent& e,
+                      StringView name,
+                      const SizedMap& groupTags,
+                      int64_t timestampMs,
+                      double value,
+                      RemoteWriteSeriesSet& seriesSet) {
+    RemoteWriteLabels labels;
+    labels.reserve(e.TagsSize() + groupTags.mInner.size() + 1);
+    labels.emplace_back(REMOTE_WRITE_METRIC_NAME_LABEL, name);
+    for (auto it = e.TagsBegin(); it != e.TagsEnd(); ++it) {
+        // labels with empty value are equivalent to absent ones in prometheus
+        if (it->second.empty() || it->first == REMOTE_WRITE_METRIC_NAME_LABEL) {
+            continue;
+        }
+        labels.emplace_back(it->first, it->second);
+    }
+    for (const auto& tag : groupTags.mInner) {
+        if (tag.second.empty() || tag.first.starts_with("__") || e.HasTag(tag.first)) {
+            continue;
+        }
+        labels.emplace_back(tag.first, tag.second);
+    }
+    // labels must be sorted by name in a time series
+    sort(labels.begin(), labels.end());
+    seriesSet.Add(labels, timestampMs, value);
+}
+
+bool RemoteWriteEventGroupListSerializer::Serialize(BatchedEventsList&& groupList, string& res, string& errorMsg) {
+    SourceBuffer nameBuffer;
+    RemoteWriteSeriesSet seriesSet;
+    size_t discardedCnt = 0;
+    for (const auto& group : groupList) {
+        for (const auto& item : group.mEvents) {
+            if (!item.Is<MetricEvent>()) {
+                ++discardedCnt;
+                continue;
+            }
+            const auto& e = item.Cast<MetricEvent>();
+            if (e.GetTimestamp() < 1e9) {
+                ++discardedCnt;
+                continue;
+            }
+            int64_t timestampMs = static_cast<int64_t>(e.GetTimestamp()) * 1000
+                + (e.GetTimestampNanosecond() ? e.GetTimestampNanosecond().value() / 1000000 : 0);
+            if (e.Is<UntypedSingleValue>()) {
+                AddSeries(e, e.GetName(), group.mTags, timestampMs, e.GetValue<UntypedSingleValue>()->mValue, seriesSet);
+            } else if (e.Is<UntypedMultiDoubleValues>()) {
+                // each value is a series named after the metric and the value key
+                const auto* values = e.GetValue<UntypedMultiDoubleValues>();
+                for (auto it = values->ValuesBegin(); it != values->ValuesEnd(); ++it) {
+                    StringView name = it->first;
+                    if (!e.GetName().empty()) {
+                        auto sb = nameBuffer.AllocateStringBuffer(e.GetName().size() + 1 + it->first.size());
+                        memcpy(sb.data, e.GetName().data(), e.GetName().size());
+                        sb.data[e.GetName().size()] = '_';
+                        memcpy(sb.data + e.GetName().size() + 1, it->first.data(), it->first.size());
+                        sb.size = e.GetName().size() + 1 + it->first.size();
+                        name = StringView(sb.data, sb.size);
+                    }
+                    AddSeries(e, name, group.mTags, timestampMs, it->second.Value, seriesSet);
+                }
+            } else {
+                ++discardedCnt;
+            }
+        }
+    }
+    if (discardedCnt > 0) {
+        LOG_WARNING(sLogger,
+                    ("invalid metric events in remote write batch", "discard events")("count", discardedCnt)(
+                        "config", mFlusher->GetContext().GetConfigName()));
+    }
+
+    auto& seriesList = seriesSet.GetSeries();
+    if (seriesList.empty()) {
+        errorMsg = "no valid metric event in event group";
+        return false;
+    }
+
+    vector<size_t> seriesSZ(seriesList.size());
+    size_t totalSZ = 0;
+    for (size_t i = 0; i < seriesList.size(); ++i) {
+        auto& series = seriesList[i];
+        // samples must be in time order in a time series
+        stable_sort(series.mSamples.begin(), series.mSamples.end(), [](const auto& lhs, const auto& rhs) {
+            return lhs.first < rhs.first;
+        });
+        size_t contentSZ = 0;
+        for (const auto& label : series.mLabels) {
+            contentSZ += GetLabelSize(label.first.size(), label.second.size());
+        }
+        for (const auto& sample : series.mSamples) {
+            contentSZ += GetSampleSize(sample.first);
+        }
+        seriesSZ[i] = contentSZ;
+        totalSZ += GetTimeSeriesSize(contentSZ);
+    }
+
+    WriteRequestSerializer serializer;
+    serializer.Prepare(totalSZ);
+    for (size_t i = 0; i < seriesList.size(); ++i) {
+        serializer.StartToAddTimeSeries(seriesSZ[i]);
+        for (const auto& label : seriesList[i].mLabels) {
+            serializer.AddLabel(label.first, label.second);
+        }
+        for (const auto& sample : seriesList[i].mSamples) {
+            serializer.AddSample(sample.second, sample.first);
+        }
+    }
+    res = std::move(serializer.GetResult());
+    return true;
+}
+
+} // namespace logtail
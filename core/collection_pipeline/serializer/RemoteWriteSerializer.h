@@ -0,0 +1,36 @@
+/*
+ * Copyright 2025 iLogtail Authors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <string>
+
+#include "collection_pipeline/serializer/Serializer.h"
+
+namespace logtail {
+
+// Serializes all metric events of a batch into one remote write request. Samples of the same series within the batch,
+// e.g. those of successive scrapes of a target, are merged into one time series, so that its labels are encoded only
+// once. Group tags are added as labels unless they start with "__" or are overridden by event tags.
+class RemoteWriteEventGroupListSerializer : public Serializer<BatchedEventsList> {
+public:
+    RemoteWriteEventGroupListSerializer(Flusher* f) : Serializer<BatchedEventsList>(f) {}
+
+private:
+    bool Serialize(BatchedEventsList&& p, std::string& res, std::string& errorMsg) override;
+};
+
+} // namespace logtail
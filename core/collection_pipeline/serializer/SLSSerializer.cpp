@@ -16,10 +16,10 @@
 
 #include <array>
 
-#include "json/json.h"
-
 #include "collection_pipeline/serializer/JsonSerializer.h"
 #include "common/Flags.h"
+#include "common/JsonUtil.h"
+#include "common/StringTools.h"
 #include "common/compression/CompressType.h"
 #include "constants/SpanConstants.h"
 #include "plugin/flusher/sls/FlusherSLS.h"
@@ -33,29 +33,116 @@ using namespace std;
 
 namespace logtail {
 
-std::string SerializeSpanLinksToString(const SpanEvent& event) {
+namespace {
+
+// span attributes, links and events are written as compact json directly, without building Json::Value
+template <typename It>
+void AppendJsonStringMap(It begin, It end, string& res) {
+    res.push_back('{');
+    for (auto it = begin; it != end; ++it) {
+        if (it != begin) {
+            res.push_back(',');
+        }
+        AppendJsonString(it->first, res);
+        res.push_back(':');
+        AppendJsonString(it->second, res);
+    }
+    res.push_back('}');
+}
+
+void AppendJsonKey(const string& key, string& res) {
+    AppendJsonString(key, res);
+    res.push_back(':');
+}
+
+// tags overridden by scope tags with the same key are skipped
+void SerializeSpanAttributes(const SpanEvent& event, string& res) {
+    res.clear();
+    res.push_back('{');
+    bool first = true;
+    for (auto it = event.TagsBegin(); it != event.TagsEnd(); ++it) {
+        if (event.HasScopeTag(it->first)) {
+            continue;
+        }
+        if (!first) {
+            res.push_back(',');
+        }
+        first = false;
+        AppendJsonString(it->first, res);
+        res.push_back(':');
+        AppendJsonString(it->second, res);
+    }
+    for (auto it = event.ScopeTagsBegin(); it != event.ScopeTagsEnd(); ++it) {
+        if (!first) {
+            res.push_back(',');
+        }
+        first = false;
+        AppendJsonString(it->first, res);
+        res.push_back(':');
+        AppendJsonString(it->second, res);
+    }
+    res.push_back('}');
+}
+
+void SerializeSpanLinks(const SpanEvent& event, string& res) {
+    res.clear();
     if (event.GetLinks().empty()) {
-        return "";
+        return;
     }
-    Json::Value jsonLinks(Json::arrayValue);
+    res.push_back('[');
     for (const auto& link : event.GetLinks()) {
-        jsonLinks.append(link.ToJson());
+        if (res.size() > 1) {
+            res.push_back(',');
+        }
+        res.push_back('{');
+        AppendJsonKey(DEFAULT_TRACE_TAG_TRACE_ID, res);
+        AppendJsonString(link.GetTraceId(), res);
+        res.push_back(',');
+        AppendJsonKey(DEFAULT_TRACE_TAG_SPAN_ID, res);
+        AppendJsonString(link.GetSpanId(), res);
+        if (!link.GetTraceState().empty()) {
+            res.push_back(',');
+            AppendJsonKey(DEFAULT_TRACE_TAG_TRACE_STATE, res);
+            AppendJsonString(link.GetTraceState(), res);
+        }
+        if (link.TagsSize() > 0) {
+            res.push_back(',');
+            AppendJsonKey(DEFAULT_TRACE_TAG_ATTRIBUTES, res);
+            AppendJsonStringMap(link.TagsBegin(), link.TagsEnd(), res);
+        }
+        res.push_back('}');
     }
-    Json::StreamWriterBuilder writer;
-    return Json::writeString(writer, jsonLinks);
+    res.push_back(']');
 }
-std::string SerializeSpanEventsToString(const SpanEvent& event) {
+
+void SerializeSpanEvents(const SpanEvent& event, string& res) {
+    res.clear();
     if (event.GetEvents().empty()) {
-        return "";
+        return;
     }
-    Json::Value jsonEvents(Json::arrayValue);
-    for (const auto& event : event.GetEvents()) {
-        jsonEvents.append(event.ToJson());
+    res.push_back('[');
+    for (const auto& innerEvent : event.GetEvents()) {
+        if (res.size() > 1) {
+            res.push_back(',');
+        }
+        res.push_back('{');
+        AppendJsonKey(DEFAULT_TRACE_TAG_SPAN_EVENT_NAME, res);
+        AppendJsonString(innerEvent.GetName(), res);
+        res.push_back(',');
+        AppendJsonKey(DEFAULT_TRACE_TAG_TIMESTAMP, res);
+        res.append(ToString(static_cast<int64_t>(innerEvent.GetTimestampNs())));
+        if (innerEvent.TagsSize() > 0) {
+            res.push_back(',');
+            AppendJsonKey(DEFAULT_TRACE_TAG_ATTRIBUTES, res);
+            AppendJsonStringMap(innerEvent.TagsBegin(), innerEvent.TagsEnd(), res);
+        }
+        res.push_back('}');
     }
-    Json::StreamWriterBuilder writer;
-    return Json::writeString(writer, jsonEvents);
+    res.push_back(']');
 }
 
+} // namespace
+
 template <>
 bool Serializer<vector<CompressedLogGroup>>::DoSerialize(vector<CompressedLogGroup>&& p,
                                                          std::string& output,
@@ -161,23 +248,12 @@ bool SLSEventGroupSerializer::Serialize(BatchedEvents&& group, string& res, stri
                 contentSZ += GetLogContentSize(DEFAULT_TRACE_TAG_TRACE_STATE.size(), e.GetTraceState().size());
 
                 // set tags and scope tags
-                Json::Value jsonVal;
-                for (auto it = e.TagsBegin(); it != e.TagsEnd(); ++it) {
-                    jsonVal[it->first.to_string()] = it->second.to_string();
-                }
-                for (auto it = e.ScopeTagsBegin(); it != e.ScopeTagsEnd(); ++it) {
-                    jsonVal[it->first.to_string()] = it->second.to_string();
-                }
-                Json::StreamWriterBuilder writer;
-                std::string attrString = Json::writeString(writer, jsonVal);
-                contentSZ += GetLogContentSize(DEFAULT_TRACE_TAG_ATTRIBUTES.size(), attrString.size());
-                spanEventContentCache[i][0] = std::move(attrString);
-                auto linkString = SerializeSpanLinksToString(e);
-                contentSZ += GetLogContentSize(DEFAULT_TRACE_TAG_LINKS.size(), linkString.size());
-                spanEventContentCache[i][1] = std::move(linkString);
-                auto eventString = SerializeSpanEventsToString(e);
-                contentSZ += GetLogContentSize(DEFAULT_TRACE_TAG_EVENTS.size(), eventString.size());
-                spanEventContentCache[i][2] = std::move(eventString);
+                SerializeSpanAttributes(e, spanEventContentCache[i][0]);
+                contentSZ += GetLogContentSize(DEFAULT_TRACE_TAG_ATTRIBUTES.size(), spanEventContentCache[i][0].size());
+                SerializeSpanLinks(e, spanEventContentCache[i][1]);
+                contentSZ += GetLogContentSize(DEFAULT_TRACE_TAG_LINKS.size(), spanEventContentCache[i][1].size());
+                SerializeSpanEvents(e, spanEventContentCache[i][2]);
+                contentSZ += GetLogContentSize(DEFAULT_TRACE_TAG_EVENTS.size(), spanEventContentCache[i][2].size());
 
                 // time related
                 auto startTsNs = std::to_string(e.GetStartTimeNs());
@@ -18,14 +18,58 @@
 #include "logger/Logger.h"
 #if defined(__linux__)
 #include <iconv.h>
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+#include <algorithm>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+#include "common/Flags.h"
+#include "common/ThreadPool.h"
 #elif defined(_MSC_VER)
 #include <Windows.h>
 #endif
 
+#if defined(__linux__)
+DEFINE_FLAG_BOOL(enable_native_gbk_converter, "convert gbk to utf8 by lookup table instead of iconv", true);
+DEFINE_FLAG_INT32(gbk_converter_thread_num, "threads to convert large gbk buffers in parallel, 0 to disable", 2);
+DEFINE_FLAG_INT32(gbk_converter_parallel_threshold, "min size of gbk buffer to be converted in parallel", 256 * 1024);
+#endif
+
 namespace logtail {
 
 #if defined(__linux__)
 static iconv_t mGbk2Utf8Cd = (iconv_t)-1;
+
+// Return the length of the leading ASCII bytes of data.
+static inline size_t AsciiPrefixLength(const uint8_t* data, size_t len) {
+    size_t i = 0;
+#if defined(__SSE2__)
+    for (; i + 16 <= len; i += 16) {
+        int mask = _mm_movemask_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i)));
+        if (mask != 0) {
+            return i + __builtin_ctz(mask);
+        }
+    }
+#endif
+#if __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+    for (; i + 8 <= len; i += 8) {
+        uint64_t word = 0;
+        memcpy(&word, data + i, sizeof(word));
+        uint64_t high = word & 0x8080808080808080ULL;
+        if (high != 0) {
+            return i + (__builtin_ctzll(high) >> 3);
+        }
+    }
+#endif
+    while (i < len && data[i] < 0x80) {
+        ++i;
+    }
+    return i;
+}
 #endif
 
 EncodingConverter::EncodingConverter() {
@@ -35,6 +79,16 @@ EncodingConverter::EncodingConverter() {
         LOG_ERROR(sLogger, ("create Gbk2Utf8 iconv descriptor fail, errno", strerror(errno)));
     else
         iconv(mGbk2Utf8Cd, NULL, NULL, NULL, NULL);
+    if (!initGbkTable()) {
+        LOG_WARNING(sLogger, ("create gbk lookup table fail", "use iconv to convert gbk to utf8"));
+    }
+    // the calling thread converts one chunk itself
+    const size_t cpuNum = std::thread::hardware_concurrency();
+    mThreadNum = std::min<size_t>(std::max(INT32_FLAG(gbk_converter_thread_num), 0), cpuNum > 1 ? cpuNum - 1 : 0);
+    if (mThreadNum > 0) {
+        mThreadPool.reset(new ThreadPool(mThreadNum));
+        mThreadPool->Start();
+    }
 #endif
 }
 
@@ -45,37 +99,134 @@ EncodingConverter::~EncodingConverter() {
 #endif
 }
 
-// TODO: Refactor it, do not use the output params to do calculations, set them before return.
-size_t EncodingConverter::ConvertGbk2Utf8(
-    const char* src, size_t* srcLength, char* desOut, size_t desLength, const std::vector<long>& linePosVec) const {
 #if defined(__linux__)
-    if (src == NULL || *srcLength == 0 || mGbk2Utf8Cd == (iconv_t)(-1)) {
-        LOG_ERROR(sLogger, ("invalid iconv descriptor fail or invalid buffer pointer, cd", mGbk2Utf8Cd));
-        return 0;
+bool EncodingConverter::initGbkTable() {
+    iconv_t cd = iconv_open("UTF-8", "GBK");
+    if (cd == (iconv_t)(-1)) {
+        return false;
     }
-    size_t maxRequire = *srcLength * 2;
-    if (desOut == nullptr) {
-        return maxRequire;
+    auto convert = [cd](const char* in, size_t inLen, Utf8Char& out) {
+        char buf[8];
+        char* inPtr = const_cast<char*>(in);
+        char* outPtr = buf;
+        size_t inLeft = inLen, outLeft = sizeof(buf);
+        iconv(cd, NULL, NULL, NULL, NULL);
+        if (iconv(cd, &inPtr, &inLeft, &outPtr, &outLeft) == (size_t)(-1) || inLeft != 0) {
+            return;
+        }
+        size_t len = outPtr - buf;
+        if (len == 0 || len > sizeof(out.bytes)) {
+            return;
+        }
+        out.len = static_cast<uint8_t>(len);
+        memcpy(out.bytes, buf, len);
+    };
+    mGbkDoubleByteTable.assign(126 * 192, Utf8Char{0, {0, 0, 0}});
+    for (int lead = 0x81; lead <= 0xFE; ++lead) {
+        for (int trail = 0x40; trail <= 0xFE; ++trail) {
+            if (trail == 0x7F) {
+                continue;
+            }
+            char in[2] = {static_cast<char>(lead), static_cast<char>(trail)};
+            convert(in, 2, mGbkDoubleByteTable[(lead - 0x81) * 192 + (trail - 0x40)]);
+        }
     }
-    if (desLength < maxRequire + 1) {
-        return 0;
+    for (int b = 0x80; b <= 0xFF; ++b) {
+        mGbkSingleByteTable[b - 0x80] = Utf8Char{0, {0, 0, 0}};
+        if (b == 0x80 || b == 0xFF) {
+            char in = static_cast<char>(b);
+            convert(&in, 1, mGbkSingleByteTable[b - 0x80]);
+        }
     }
-    char* des = desOut;
-    des[*srcLength * 2] = '\0';
+    iconv_close(cd);
+    return true;
+}
+
+int64_t EncodingConverter::convertGbkLine(const uint8_t* src, size_t len, char* des, size_t desLength) const {
+    char* out = des;
+    char* const desEnd = des + desLength;
+    size_t i = 0;
+    while (i < len) {
+        size_t ascii = AsciiPrefixLength(src + i, len - i);
+        if (ascii > 0) {
+            if (ascii > static_cast<size_t>(desEnd - out)) {
+                return -1;
+            }
+            memcpy(out, src + i, ascii);
+            out += ascii;
+            i += ascii;
+            if (i == len) {
+                break;
+            }
+        }
+        const uint8_t c = src[i];
+        const Utf8Char* ch = nullptr;
+        if (c >= 0x81 && c <= 0xFE) {
+            if (i + 1 >= len || src[i + 1] < 0x40) {
+                return -1;
+            }
+            ch = &mGbkDoubleByteTable[(c - 0x81) * 192 + (src[i + 1] - 0x40)];
+            i += 2;
+        } else {
+            ch = &mGbkSingleByteTable[c - 0x80];
+            ++i;
+        }
+        if (ch->len == 0 || ch->len > desEnd - out) {
+            return -1;
+        }
+        for (uint8_t j = 0; j < ch->len; ++j) {
+            *out++ = static_cast<char>(ch->bytes[j]);
+        }
+    }
+    return out - des;
+}
+
+size_t EncodingConverter::convertGbk2Utf8ByTable(const char* src,
+                                                 char* des,
+                                                 size_t desLength,
+                                                 const std::vector<long>& linePosVec,
+                                                 size_t lineBegin,
+                                                 size_t lineEnd,
+                                                 size_t& errorLines) const {
+    size_t destIndex = 0;
+    size_t beginIndex = lineBegin == 0 ? 0 : linePosVec[lineBegin - 1] + 1;
+    for (size_t i = lineBegin; i < lineEnd; ++i) {
+        size_t endIndex = linePosVec[i];
+        // include '\n'
+        size_t len = endIndex + 1 - beginIndex;
+        int64_t ret = convertGbkLine(
+            reinterpret_cast<const uint8_t*>(src + beginIndex), len, des + destIndex, desLength - destIndex);
+        if (ret < 0) {
+            ++errorLines;
+            memcpy(des + destIndex, src + beginIndex, std::min(len, desLength - destIndex));
+            destIndex += std::min(len, desLength - destIndex);
+        } else {
+            destIndex += ret;
+        }
+        beginIndex = endIndex + 1;
+    }
+    return destIndex;
+}
+
+size_t EncodingConverter::convertGbk2Utf8ByIconv(const char* src,
+                                                 char* des,
+                                                 size_t desLength,
+                                                 const std::vector<long>& linePosVec) const {
     const char* originSrc = src;
     char* originDes = des;
     size_t beginIndex = 0;
-    size_t endIndex = *srcLength;
+    size_t endIndex = 0;
     size_t destIndex = 0;
     size_t maxDestSize = desLength;
+    size_t srcLength = 0;
     for (size_t i = 0; i < linePosVec.size(); ++i) {
         endIndex = linePosVec[i];
         src = originSrc + beginIndex;
         des = originDes + destIndex;
         // include '\n'
-        *srcLength = endIndex - beginIndex + 1;
+        srcLength = endIndex - beginIndex + 1;
         desLength = maxDestSize - destIndex;
-        size_t ret = iconv(mGbk2Utf8Cd, const_cast<char**>(&src), srcLength, &des, &desLength);
+        size_t ret = iconv(mGbk2Utf8Cd, const_cast<char**>(&src), &srcLength, &des, &desLength);
         if (ret == (size_t)(-1)) {
             LOG_ERROR(sLogger, ("convert GBK to UTF8 fail, errno", strerror(errno)));
             iconv(mGbk2Utf8Cd, NULL, NULL, NULL, NULL); // Clear status.
@@ -89,6 +240,97 @@ size_t EncodingConverter::ConvertGbk2Utf8(
         beginIndex = endIndex + 1;
     }
     return destIndex;
+}
+#endif
+
+// TODO: Refactor it, do not use the output params to do calculations, set them before return.
+size_t EncodingConverter::ConvertGbk2Utf8(
+    const char* src, size_t* srcLength, char* desOut, size_t desLength, const std::vector<long>& linePosVec) const {
+#if defined(__linux__)
+    if (src == NULL || *srcLength == 0 || (mGbk2Utf8Cd == (iconv_t)(-1) && mGbkDoubleByteTable.empty())) {
+        LOG_ERROR(sLogger, ("invalid iconv descriptor fail or invalid buffer pointer, cd", mGbk2Utf8Cd));
+        return 0;
+    }
+    // a GBK byte is converted to at most 3 UTF-8 bytes, e.g. 0x80 to U+20AC
+    size_t maxRequire = *srcLength * 3;
+    if (desOut == nullptr) {
+        return maxRequire;
+    }
+    if (desLength < maxRequire + 1) {
+        return 0;
+    }
+    desOut[maxRequire] = '\0';
+    if (mGbkDoubleByteTable.empty() || (!BOOL_FLAG(enable_native_gbk_converter) && mGbk2Utf8Cd != (iconv_t)(-1))) {
+        return convertGbk2Utf8ByIconv(src, desOut, desLength, linePosVec);
+    }
+
+    size_t errorLines = 0;
+    size_t destIndex = 0;
+    if (!mThreadPool || *srcLength < static_cast<size_t>(INT32_FLAG(gbk_converter_parallel_threshold))) {
+        destIndex = convertGbk2Utf8ByTable(src, desOut, maxRequire, linePosVec, 0, linePosVec.size(), errorLines);
+    } else {
+        // Split lines into chunks of similar size. Since each GBK byte is converted to at most 3 UTF-8 bytes, chunk i
+        // is converted into des starting at three times its offset in src without overlapping, and compacted
+        // afterwards.
+        const size_t chunkSize = *srcLength / (mThreadNum + 1) + 1;
+        std::vector<size_t> chunkLineBegins = {0};
+        for (size_t i = 0; i + 1 < linePosVec.size() && chunkLineBegins.size() <= mThreadNum; ++i) {
+            if (static_cast<size_t>(linePosVec[i] + 1) >= chunkLineBegins.size() * chunkSize) {
+                chunkLineBegins.push_back(i + 1);
+            }
+        }
+        const size_t chunkCnt = chunkLineBegins.size();
+        chunkLineBegins.push_back(linePosVec.size());
+        auto chunkSrcBegin = [&](size_t chunk) -> size_t {
+            return chunkLineBegins[chunk] == 0 ? 0 : linePosVec[chunkLineBegins[chunk] - 1] + 1;
+        };
+        auto chunkDesLength = [&](size_t chunk) {
+            return (chunk + 1 < chunkCnt ? 3 * chunkSrcBegin(chunk + 1) : maxRequire) - 3 * chunkSrcBegin(chunk);
+        };
+        std::vector<size_t> chunkResults(chunkCnt, 0);
+        std::vector<size_t> chunkErrorLines(chunkCnt, 0);
+        std::mutex mux;
+        std::condition_variable cv;
+        size_t pendingChunks = chunkCnt - 1;
+        for (size_t chunk = 1; chunk < chunkCnt; ++chunk) {
+            mThreadPool->Add([&, chunk]() {
+                chunkResults[chunk] = convertGbk2Utf8ByTable(src,
+                                                             desOut + 3 * chunkSrcBegin(chunk),
+                                                             chunkDesLength(chunk),
+                                                             linePosVec,
+                                                             chunkLineBegins[chunk],
+                                                             chunkLineBegins[chunk + 1],
+                                                             chunkErrorLines[chunk]);
+                std::lock_guard<std::mutex> lock(mux);
+                if (--pendingChunks == 0) {
+                    cv.notify_one();
+                }
+            });
+        }
+        chunkResults[0] = convertGbk2Utf8ByTable(src,
+                                                 desOut,
+                                                 chunkDesLength(0),
+                                                 linePosVec,
+                                                 chunkLineBegins[0],
+                                                 chunkLineBegins[1],
+                                                 chunkErrorLines[0]);
+        {
+            std::unique_lock<std::mutex> lock(mux);
+            cv.wait(lock, [&]() { return pendingChunks == 0; });
+        }
+        for (size_t chunk = 0; chunk < chunkCnt; ++chunk) {
+            if (chunk > 0) {
+                memmove(desOut + destIndex, desOut + 3 * chunkSrcBegin(chunk), chunkResults[chunk]);
+            }
+            destIndex += chunkResults[chunk];
+            errorLines += chunkErrorLines[chunk];
+        }
+    }
+    if (errorLines > 0) {
+        LOG_ERROR(sLogger, ("convert GBK to UTF8 fail, lines copied without converting", errorLines));
+        AlarmManager::GetInstance()->SendAlarm(ENCODING_CONVERT_ALARM, "convert GBK to UTF8 fail");
+    }
+    return destIndex;
 
 #elif defined(_MSC_VER)
     int wcLen = MultiByteToWideChar(CP_ACP, 0, src, *srcLength, NULL, 0);
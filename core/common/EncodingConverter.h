@@ -18,7 +18,9 @@
 #define __SLS_ILOGTAIL_ENCODING_CONVERTER_H__
 
 #include <cstddef>
+#include <cstdint>
 
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -27,6 +29,8 @@
 namespace logtail {
 enum FileEncoding { ENCODING_UTF8, ENCODING_GBK };
 
+class ThreadPool;
+
 class EncodingConverter {
 private:
     EncodingConverter();
@@ -51,11 +55,47 @@ public:
     // - For Linux, ConvertGbk2Utf8 converts line by line according to @linePosVec.
     //   If there is error happened during converting, corresponding line will be copied
     //   to @des without converting.
+    //   ASCII runs are copied directly and GBK characters are decoded by a lookup table built from iconv on start, so
+    //   it is thread safe, and large buffers are split into line aligned chunks converted in parallel.
+    //   iconv is used only if the lookup table is not available or enable_native_gbk_converter is false.
     // - For Windows, ConvertGbk2Utf8 converts whole @src, if any errors happened,
     //   0 will be returned (ignore @linePosVec).
     size_t ConvertGbk2Utf8(
         const char* src, size_t* srcLength, char* des, size_t desLength, const std::vector<long>& linePosVec) const;
 
+#if defined(__linux__)
+private:
+    // UTF-8 bytes of a GBK character, len is 0 if the character is invalid
+    struct Utf8Char {
+        uint8_t len;
+        uint8_t bytes[3];
+    };
+
+    bool initGbkTable();
+    size_t convertGbk2Utf8ByIconv(const char* src, char* des, size_t desLength, const std::vector<long>& linePosVec)
+        const;
+    // Convert lines [lineBegin, lineEnd), line i ends at linePosVec[i] (inclusive) and begins after line i - 1.
+    // @return bytes written to des, lines failed to convert are copied and counted in errorLines
+    size_t convertGbk2Utf8ByTable(const char* src,
+                                  char* des,
+                                  size_t desLength,
+                                  const std::vector<long>& linePosVec,
+                                  size_t lineBegin,
+                                  size_t lineEnd,
+                                  size_t& errorLines) const;
+    // @return bytes written to des, or -1 if src is not valid GBK or des has no room for the result
+    int64_t convertGbkLine(const uint8_t* src, size_t len, char* des, size_t desLength) const;
+
+    // indexed by (lead - 0x81) * 192 + (trail - 0x40)
+    std::vector<Utf8Char> mGbkDoubleByteTable;
+    // indexed by byte - 0x80, for bytes not leading a double byte character
+    Utf8Char mGbkSingleByteTable[128];
+    std::unique_ptr<ThreadPool> mThreadPool;
+    size_t mThreadNum = 0;
+
+public:
+#endif
+
 #if defined(_MSC_VER)
     // FromUTF8ToACP converts @s encoded in UTF8 to ACP.
     // @return ACP string if convert successfully, otherwise @s will be returned.
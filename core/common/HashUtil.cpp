@@ -312,20 +312,24 @@ void DoMd5(const uint8_t* poolIn, const uint64_t inputBytesNum, uint8_t md5[16])
     }
 } /// DoMd5
 
-static std::string HexToString(const uint8_t md5[16]) {
+static void HexToString(const uint8_t md5[16], char hex[32]) {
     static const char* table = "0123456789ABCDEF";
-    std::string ss(32, 'a');
     for (int i = 0; i < 16; ++i) {
-        ss[i * 2] = table[md5[i] >> 4];
-        ss[i * 2 + 1] = table[md5[i] & 0x0F];
+        hex[i * 2] = table[md5[i] >> 4];
+        hex[i * 2 + 1] = table[md5[i] & 0x0F];
     }
-    return ss;
 }
 
 std::string CalcMD5(const std::string& message) {
+    std::string ss(32, 'a');
+    CalcMD5(message.data(), message.length(), &ss[0]);
+    return ss;
+}
+
+void CalcMD5(const char* data, size_t len, char hex[32]) {
     uint8_t md5[MD5_BYTES];
-    DoMd5((const uint8_t*)message.data(), message.length(), md5);
-    return HexToString(md5);
+    DoMd5((const uint8_t*)data, len, md5);
+    HexToString(md5, hex);
 }
 
 bool SignatureToHash(const std::string& signature, uint64_t& sigHash, uint32_t& sigSize) {
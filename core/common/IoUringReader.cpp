@@ -0,0 +1,209 @@
+// Copyright 2025 iLogtail Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "common/IoUringReader.h"
+
+#if defined(__linux__)
+#include <errno.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <sys/uio.h>
+#include <unistd.h>
+
+#include <cstring>
+#endif
+
+#if defined(__linux__) && defined(__NR_io_uring_setup) && defined(__NR_io_uring_enter) \
+    && __has_include(<linux/io_uring.h>)
+#include <linux/io_uring.h>
+#define LOGTAIL_HAS_IO_URING 1
+#endif
+
+#include <algorithm>
+
+#include "common/ErrorUtil.h"
+#include "logger/Logger.h"
+
+namespace logtail {
+
+#ifdef LOGTAIL_HAS_IO_URING
+
+IoUringReader::IoUringReader(uint32_t entries) {
+    io_uring_params params;
+    memset(&params, 0, sizeof(params));
+    int fd = static_cast<int>(syscall(__NR_io_uring_setup, entries, &params));
+    if (fd < 0) {
+        LOG_INFO(sLogger, ("io_uring is not available, fall back to pread", ErrnoToString(errno)));
+        return;
+    }
+    mRingFd = fd;
+    mEntries = params.sq_entries;
+
+    mSqRingSize = params.sq_off.array + params.sq_entries * sizeof(unsigned);
+    mCqRingSize = params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+    bool singleMmap = params.features & IORING_FEAT_SINGLE_MMAP;
+    if (singleMmap) {
+        mSqRingSize = mCqRingSize = std::max(mSqRingSize, mCqRingSize);
+    }
+    mSqRingPtr = mmap(nullptr, mSqRingSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd, IORING_OFF_SQ_RING);
+    if (mSqRingPtr == MAP_FAILED) {
+        mSqRingPtr = nullptr;
+        destroy();
+        return;
+    }
+    if (singleMmap) {
+        mCqRingPtr = mSqRingPtr;
+    } else {
+        mCqRingPtr
+            = mmap(nullptr, mCqRingSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd, IORING_OFF_CQ_RING);
+        if (mCqRingPtr == MAP_FAILED) {
+            mCqRingPtr = nullptr;
+            destroy();
+            return;
+        }
+    }
+    mSqesSize = params.sq_entries * sizeof(io_uring_sqe);
+    mSqesPtr = mmap(nullptr, mSqesSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd, IORING_OFF_SQES);
+    if (mSqesPtr == MAP_FAILED) {
+        mSqesPtr = nullptr;
+        destroy();
+        return;
+    }
+
+    char* sq = static_cast<char*>(mSqRingPtr);
+    mSqTail = reinterpret_cast<unsigned*>(sq + params.sq_off.tail);
+    mSqMask = reinterpret_cast<unsigned*>(sq + params.sq_off.ring_mask);
+    mSqArray = reinterpret_cast<unsigned*>(sq + params.sq_off.array);
+    char* cq = static_cast<char*>(mCqRingPtr);
+    mCqHead = reinterpret_cast<unsigned*>(cq + params.cq_off.head);
+    mCqTail = reinterpret_cast<unsigned*>(cq + params.cq_off.tail);
+    mCqMask = reinterpret_cast<unsigned*>(cq + params.cq_off.ring_mask);
+    mCqes = cq + params.cq_off.cqes;
+}
+
+IoUringReader::~IoUringReader() {
+    destroy();
+}
+
+void IoUringReader::destroy() {
+    if (mSqesPtr) {
+        munmap(mSqesPtr, mSqesSize);
+        mSqesPtr = nullptr;
+    }
+    if (mCqRingPtr && mCqRingPtr != mSqRingPtr) {
+        munmap(mCqRingPtr, mCqRingSize);
+    }
+    mCqRingPtr = nullptr;
+    if (mSqRingPtr) {
+        munmap(mSqRingPtr, mSqRingSize);
+        mSqRingPtr = nullptr;
+    }
+    if (mRingFd >= 0) {
+        close(mRingFd);
+        mRingFd = -1;
+    }
+}
+
+bool IoUringReader::ReadBatch(std::vector<IoUringReadRequest*>& requests) {
+    for (size_t begin = 0; begin < requests.size(); begin += mEntries) {
+        if (!IsValid()) {
+            return false;
+        }
+        uint32_t count = static_cast<uint32_t>(std::min<size_t>(mEntries, requests.size() - begin));
+        if (!submitAndWait(requests.data() + begin, count)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool IoUringReader::submitAndWait(IoUringReadRequest** requests, uint32_t count) {
+    // IORING_OP_READV is used instead of IORING_OP_READ to support kernels older than 5.6.
+    std::vector<iovec> iovecs(count);
+    io_uring_sqe* sqes = static_cast<io_uring_sqe*>(mSqesPtr);
+    unsigned tail = *mSqTail;
+    const unsigned mask = *mSqMask;
+    for (uint32_t i = 0; i < count; ++i) {
+        IoUringReadRequest* req = requests[i];
+        req->result = -EINPROGRESS;
+        iovecs[i].iov_base = req->buf;
+        iovecs[i].iov_len = req->size;
+        unsigned idx = tail & mask;
+        io_uring_sqe* sqe = &sqes[idx];
+        memset(sqe, 0, sizeof(*sqe));
+        sqe->opcode = IORING_OP_READV;
+        sqe->fd = req->fd;
+        sqe->addr = reinterpret_cast<uint64_t>(&iovecs[i]);
+        sqe->len = 1;
+        sqe->off = static_cast<uint64_t>(req->offset);
+        sqe->user_data = i;
+        mSqArray[idx] = idx;
+        ++tail;
+    }
+    __atomic_store_n(mSqTail, tail, __ATOMIC_RELEASE);
+
+    uint32_t toSubmit = count;
+    uint32_t completed = 0;
+    while (completed < count) {
+        int ret = static_cast<int>(
+            syscall(__NR_io_uring_enter, mRingFd, toSubmit, count - completed, IORING_ENTER_GETEVENTS, nullptr, 0));
+        if (ret < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            // Requests left in the submission ring would be submitted by the next enter with dangling buffers, so
+            // the ring cannot be reused any more.
+            LOG_WARNING(sLogger, ("io_uring enter failed, fall back to pread", ErrnoToString(errno)));
+            destroy();
+            return false;
+        }
+        toSubmit -= std::min<uint32_t>(toSubmit, static_cast<uint32_t>(ret));
+
+        unsigned head = *mCqHead;
+        unsigned cqTail = __atomic_load_n(mCqTail, __ATOMIC_ACQUIRE);
+        io_uring_cqe* cqes = static_cast<io_uring_cqe*>(mCqes);
+        for (; head != cqTail; ++head) {
+            io_uring_cqe* cqe = &cqes[head & *mCqMask];
+            if (cqe->user_data < count) {
+                requests[cqe->user_data]->result = cqe->res;
+                ++completed;
+            }
+        }
+        __atomic_store_n(mCqHead, head, __ATOMIC_RELEASE);
+    }
+    return true;
+}
+
+#else
+
+IoUringReader::IoUringReader(uint32_t entries) {
+}
+
+IoUringReader::~IoUringReader() {
+}
+
+void IoUringReader::destroy() {
+}
+
+bool IoUringReader::ReadBatch(std::vector<IoUringReadRequest*>& requests) {
+    return false;
+}
+
+bool IoUringReader::submitAndWait(IoUringReadRequest** requests, uint32_t count) {
+    return false;
+}
+
+#endif
+
+} // namespace logtail
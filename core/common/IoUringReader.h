@@ -0,0 +1,77 @@
+/*
+ * Copyright 2025 iLogtail Authors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include <vector>
+
+namespace logtail {
+
+struct IoUringReadRequest {
+    int fd = -1;
+    void* buf = nullptr;
+    size_t size = 0;
+    int64_t offset = 0;
+    // bytes read on success, -errno on failure
+    int64_t result = 0;
+};
+
+// IoUringReader is a minimal io_uring wrapper (raw syscalls, no liburing) used to submit many file reads at once
+// and reap their completions, so that a slow file does not serialize the reads of the others.
+// It is not thread safe, each thread should own its instance.
+class IoUringReader {
+public:
+    explicit IoUringReader(uint32_t entries);
+    ~IoUringReader();
+
+    // @return false if io_uring is not supported by the kernel (or disabled by seccomp), or the ring is broken.
+    bool IsValid() const { return mRingFd >= 0; }
+
+    // Submit all requests and wait until all of them are completed.
+    // @return false if the ring failed before all requests were completed, in which case the ring is destroyed and
+    // the caller should fall back to synchronous reads for the requests whose result is not set.
+    bool ReadBatch(std::vector<IoUringReadRequest*>& requests);
+
+private:
+    IoUringReader(const IoUringReader&) = delete;
+    IoUringReader& operator=(const IoUringReader&) = delete;
+
+    bool submitAndWait(IoUringReadRequest** requests, uint32_t count);
+    void destroy();
+
+    int mRingFd = -1;
+    uint32_t mEntries = 0;
+
+    void* mSqRingPtr = nullptr;
+    size_t mSqRingSize = 0;
+    void* mCqRingPtr = nullptr;
+    size_t mCqRingSize = 0;
+    void* mSqesPtr = nullptr;
+    size_t mSqesSize = 0;
+
+    unsigned* mSqTail = nullptr;
+    unsigned* mSqMask = nullptr;
+    unsigned* mSqArray = nullptr;
+    unsigned* mCqHead = nullptr;
+    unsigned* mCqTail = nullptr;
+    unsigned* mCqMask = nullptr;
+    void* mCqes = nullptr;
+};
+
+} // namespace logtail
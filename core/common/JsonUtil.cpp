@@ -14,6 +14,10 @@
 
 #include "common/JsonUtil.h"
 
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+
 #include <memory>
 #include <sstream>
 
@@ -225,4 +229,86 @@ bool LoadBooleanParameter(bool& value, const Json::Value& confJSON, const char*
     LOAD_PARAMETER(value, confJSON, name, envName, isBool, asBool)
 }
 
+namespace {
+
+// characters to be escaped in json strings, i.e. control characters, quotation mark and reverse solidus
+struct JsonEscapeTable {
+    bool mNeedEscape[256] = {};
+
+    JsonEscapeTable() {
+        for (size_t i = 0; i < 0x20; ++i) {
+            mNeedEscape[i] = true;
+        }
+        mNeedEscape[static_cast<unsigned char>('"')] = true;
+        mNeedEscape[static_cast<unsigned char>('\\')] = true;
+    }
+};
+
+const JsonEscapeTable kJsonEscapeTable;
+
+} // namespace
+
+void AppendJsonString(StringView str, string& res) {
+    static const char* const kHex = "0123456789abcdef";
+    res.push_back('"');
+    const char* run = str.data();
+    const char* end = str.data() + str.size();
+    for (const char* cur = run; cur != end; ++cur) {
+        unsigned char c = static_cast<unsigned char>(*cur);
+        if (!kJsonEscapeTable.mNeedEscape[c]) {
+            continue;
+        }
+        res.append(run, cur - run);
+        run = cur + 1;
+        switch (c) {
+            case '"':
+                res.append("\\\"", 2);
+                break;
+            case '\\':
+                res.append("\\\\", 2);
+                break;
+            case '\b':
+                res.append("\\b", 2);
+                break;
+            case '\f':
+                res.append("\\f", 2);
+                break;
+            case '\n':
+                res.append("\\n", 2);
+                break;
+            case '\r':
+                res.append("\\r", 2);
+                break;
+            case '\t':
+                res.append("\\t", 2);
+                break;
+            default: {
+                char buf[6] = {'\\', 'u', '0', '0', kHex[c >> 4], kHex[c & 0xF]};
+                res.append(buf, sizeof(buf));
+                break;
+            }
+        }
+    }
+    res.append(run, end - run);
+    res.push_back('"');
+}
+
+// formatted the same as Json::writeString, i.e. 17 significant digits, and non-finite values are not quoted
+void AppendJsonDouble(double value, string& res) {
+    if (isnan(value)) {
+        res.append("null");
+        return;
+    }
+    if (isinf(value)) {
+        res.append(value < 0 ? "-1e+9999" : "1e+9999");
+        return;
+    }
+    char buf[32];
+    int len = snprintf(buf, sizeof(buf), "%.17g", value);
+    res.append(buf, len);
+    if (memchr(buf, '.', len) == nullptr && memchr(buf, 'e', len) == nullptr) {
+        res.append(".0", 2);
+    }
+}
+
 } // namespace logtail
@@ -22,6 +22,8 @@
 
 #include "json/json.h"
 
+#include "models/StringView.h"
+
 namespace logtail {
 
 bool ParseJsonTable(const std::string& config, Json::Value& res, std::string& errorMsg);
@@ -47,6 +49,12 @@ bool LoadInt32Parameter(int32_t& value, const Json::Value& confJSON, const char*
 bool LoadStringParameter(std::string& value, const Json::Value& confJSON, const char* name, const char* envName);
 bool LoadBooleanParameter(bool& value, const Json::Value& confJSON, const char* name, const char* envName);
 
+// Appends json text directly, for serializers on the hot path where building Json::Value is too costly.
+// str is quoted and escaped
+void AppendJsonString(StringView str, std::string& res);
+// formatted the same as Json::writeString
+void AppendJsonDouble(double value, std::string& res);
+
 template <typename T>
 void SetNotFoundJsonMember(Json::Value& j, const std::string& k, const T& v) {
     if (!j.isMember(k)) {
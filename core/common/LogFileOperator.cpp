@@ -18,6 +18,7 @@
 #include <io.h>
 #endif
 #include "FileSystemUtil.h"
+#include "IoUringReader.h"
 
 namespace logtail {
 
@@ -109,6 +110,52 @@ int LogFileOperator::Pread(void* ptr, size_t size, size_t count, int64_t offset)
 #endif
 }
 
+void LogFileOperator::PreadBatch(std::vector<PreadRequest>& requests) {
+    if (requests.empty()) {
+        return;
+    }
+#if defined(__linux__)
+    if (requests.size() > 1) {
+        // The ring is owned by the calling thread, and will be abandoned forever once it fails.
+        static thread_local IoUringReader sReader(64);
+        if (sReader.IsValid()) {
+            std::vector<IoUringReadRequest> uringRequests(requests.size());
+            std::vector<IoUringReadRequest*> uringRequestPtrs;
+            uringRequestPtrs.reserve(requests.size());
+            for (size_t i = 0; i < requests.size(); ++i) {
+                auto& req = requests[i];
+                req.result = -1;
+                if (!req.op || !req.buf || !req.size || !req.op->IsOpen()) {
+                    req.result = 0;
+                    continue;
+                }
+                uringRequests[i].fd = req.op->GetFd();
+                uringRequests[i].buf = req.buf;
+                uringRequests[i].size = req.size;
+                uringRequests[i].offset = req.offset;
+                uringRequestPtrs.push_back(&uringRequests[i]);
+            }
+            bool success = sReader.ReadBatch(uringRequestPtrs);
+            for (size_t i = 0; i < requests.size(); ++i) {
+                auto& req = requests[i];
+                if (uringRequests[i].fd < 0) {
+                    continue;
+                }
+                if (uringRequests[i].result >= 0) {
+                    req.result = uringRequests[i].result;
+                } else if (!success && uringRequests[i].result == -EINPROGRESS) {
+                    req.result = req.op->Pread(req.buf, 1, req.size, req.offset);
+                }
+            }
+            return;
+        }
+    }
+#endif
+    for (auto& req : requests) {
+        req.result = req.op ? req.op->Pread(req.buf, 1, req.size, req.offset) : 0;
+    }
+}
+
 int64_t LogFileOperator::GetFileSize() const {
     if (!IsOpen()) {
         return -1;
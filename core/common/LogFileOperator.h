@@ -19,6 +19,7 @@
 #include <cstdio>
 
 #include <string>
+#include <vector>
 #if defined(_MSC_VER)
 #include <Windows.h>
 #elif defined(__linux__)
@@ -34,6 +35,17 @@ namespace fsutil {
 class PathStat;
 }
 
+class LogFileOperator;
+
+struct PreadRequest {
+    LogFileOperator* op = nullptr;
+    void* buf = nullptr;
+    size_t size = 0;
+    int64_t offset = 0;
+    // bytes read, or -1 on failure
+    int64_t result = 0;
+};
+
 class LogFileOperator {
 public:
     LogFileOperator() = default;
@@ -49,6 +61,10 @@ public:
 
     int Pread(void* ptr, size_t size, size_t count, int64_t offset);
 
+    // PreadBatch reads all requests at once with io_uring when available, so that the reads on slow files are
+    // overlapped. It falls back to Pread one by one when io_uring is not supported.
+    static void PreadBatch(std::vector<PreadRequest>& requests);
+
     // GetFileSize gets the size of current file.
     int64_t GetFileSize() const;
 
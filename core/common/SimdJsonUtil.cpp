@@ -0,0 +1,313 @@
+// Copyright 2025 iLogtail Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "common/SimdJsonUtil.h"
+
+#include <cstring>
+
+#include "common/Flags.h"
+
+#if defined(__linux__) && !defined(__ANDROID__) && !defined(__EXCLUDE_SPL__)
+#define LOGTAIL_WITH_SIMDJSON
+#include "rapidjson/document.h"
+#include "rapidjson/stringbuffer.h"
+#include "rapidjson/writer.h"
+#include "simdjson.h"
+
+#include "common/StringTools.h"
+#endif
+
+DEFINE_FLAG_BOOL(enable_simdjson_parser,
+                 "parse json logs with simdjson when a SIMD kernel is supported by the cpu, otherwise scalar parsers "
+                 "are used",
+                 false);
+
+using namespace std;
+
+namespace logtail {
+
+#ifdef LOGTAIL_WITH_SIMDJSON
+
+static_assert(kSimdJsonPadding >= simdjson::SIMDJSON_PADDING, "padding is not enough for simdjson");
+
+namespace {
+
+simdjson::ondemand::parser& GetParser() {
+    static thread_local simdjson::ondemand::parser sParser;
+    return sParser;
+}
+
+// copy of json not owned by the caller, with padding
+string& GetPaddedBuffer(size_t size) {
+    static thread_local string sBuffer;
+    if (sBuffer.size() < size + kSimdJsonPadding) {
+        sBuffer.resize(size + kSimdJsonPadding);
+    }
+    return sBuffer;
+}
+
+// unescaped string, which is in the string buffer of the parser, and the position of its raw content
+struct JsonString {
+    string_view mValue;
+    const char* mRaw = nullptr;
+};
+
+bool GetString(simdjson::ondemand::value& value, JsonString& res) {
+    string_view token = value.raw_json_token();
+    if (token.empty() || token[0] != '"') {
+        return false;
+    }
+    if (value.get_string().get(res.mValue) != simdjson::SUCCESS) {
+        return false;
+    }
+    res.mRaw = token.data() + 1;
+    return true;
+}
+
+// log, stream and time, which are accessed on demand without building a dom
+bool ParseDockerJsonFileFields(const char* data, size_t size, size_t capacity, JsonString (&fields)[3]) {
+    simdjson::ondemand::document doc;
+    if (GetParser().iterate(simdjson::padded_string_view(data, size, capacity)).get(doc) != simdjson::SUCCESS) {
+        return false;
+    }
+    simdjson::ondemand::object obj;
+    if (doc.get_object().get(obj) != simdjson::SUCCESS) {
+        return false;
+    }
+    for (auto item : obj) {
+        simdjson::ondemand::field field;
+        if (std::move(item).get(field) != simdjson::SUCCESS) {
+            return false;
+        }
+        JsonString* target = nullptr;
+        if (field.key() == "log") {
+            target = &fields[0];
+        } else if (field.key() == "stream") {
+            target = &fields[1];
+        } else if (field.key() == "time") {
+            target = &fields[2];
+        } else {
+            // other keys are left to the scalar parsers
+            return false;
+        }
+        if (!GetString(field.value(), *target)) {
+            return false;
+        }
+    }
+    if (!doc.at_end()) {
+        return false;
+    }
+    for (const auto& field : fields) {
+        if (field.mRaw == nullptr) {
+            return false;
+        }
+    }
+    return true;
+}
+
+StringView WriteBack(const JsonString& str, const char* base, char* target) {
+    char* dst = target + (str.mRaw - base);
+    memcpy(dst, str.mValue.data(), str.mValue.size());
+    return StringView(dst, str.mValue.size());
+}
+
+// formatted the same as RapidjsonValueToString in the rapidjson based parsers
+bool FormatValue(simdjson::ondemand::value& value, SourceBuffer& sourceBuffer, char* buffer, StringView& res) {
+    simdjson::ondemand::json_type type;
+    if (value.type().get(type) != simdjson::SUCCESS) {
+        return false;
+    }
+    switch (type) {
+        case simdjson::ondemand::json_type::string: {
+            JsonString str;
+            if (!GetString(value, str)) {
+                return false;
+            }
+            res = WriteBack(str, buffer, buffer);
+            return true;
+        }
+        case simdjson::ondemand::json_type::boolean: {
+            bool b = false;
+            if (value.get_bool().get(b) != simdjson::SUCCESS) {
+                return false;
+            }
+            res = b ? StringView("true") : StringView("false");
+            return true;
+        }
+        case simdjson::ondemand::json_type::null:
+            res = StringView();
+            return value.is_null();
+        case simdjson::ondemand::json_type::number: {
+            simdjson::ondemand::number_type numberType;
+            if (value.get_number_type().get(numberType) != simdjson::SUCCESS) {
+                return false;
+            }
+            string str;
+            if (numberType == simdjson::ondemand::number_type::signed_integer) {
+                int64_t i = 0;
+                if (value.get_int64().get(i) != simdjson::SUCCESS) {
+                    return false;
+                }
+                if (i == 0 && value.raw_json_token()[0] == '-') {
+                    // -0 is a double in rapidjson
+                    return false;
+                }
+                str = ToString(i);
+            } else if (numberType == simdjson::ondemand::number_type::unsigned_integer) {
+                uint64_t u = 0;
+                if (value.get_uint64().get(u) != simdjson::SUCCESS) {
+                    return false;
+                }
+                str = ToString(u);
+            } else if (numberType == simdjson::ondemand::number_type::floating_point_number) {
+                double d = 0;
+                if (value.get_double().get(d) != simdjson::SUCCESS) {
+                    return false;
+                }
+                str = ToString(d);
+            } else {
+                // big integer, left to the rapidjson based parser
+                return false;
+            }
+            StringBuffer sb = sourceBuffer.CopyString(str);
+            res = StringView(sb.data, sb.size);
+            return true;
+        }
+        default: {
+            // nested object or array, rewritten by rapidjson for the same output as before
+            string_view raw;
+            if (value.raw_json().get(raw) != simdjson::SUCCESS) {
+                return false;
+            }
+            rapidjson::Document doc;
+            doc.Parse(raw.data(), raw.size());
+            if (doc.HasParseError()) {
+                return false;
+            }
+            rapidjson::StringBuffer buf;
+            rapidjson::Writer<rapidjson::StringBuffer> writer(buf);
+            doc.Accept(writer);
+            StringBuffer sb = sourceBuffer.CopyString(buf.GetString(), buf.GetSize());
+            res = StringView(sb.data, sb.size);
+            return true;
+        }
+    }
+}
+
+} // namespace
+
+bool IsSimdJsonEnabled() {
+    static const bool sSupported = string(simdjson::get_active_implementation()->name()) != "fallback";
+    return BOOL_FLAG(enable_simdjson_parser) && sSupported;
+}
+
+string GetSimdJsonImplementation() {
+    return string(simdjson::get_active_implementation()->name());
+}
+
+bool ParseDockerJsonFileLine(StringView line, DockerJsonFileFields& fields) {
+    string& padded = GetPaddedBuffer(line.size());
+    memcpy(&padded[0], line.data(), line.size());
+    JsonString res[3];
+    if (!ParseDockerJsonFileFields(padded.data(), line.size(), padded.size(), res)) {
+        return false;
+    }
+    fields.log = StringView(res[0].mValue.data(), res[0].mValue.size());
+    fields.stream = StringView(res[1].mValue.data(), res[1].mValue.size());
+    fields.time = StringView(res[2].mValue.data(), res[2].mValue.size());
+    return true;
+}
+
+bool ParseDockerJsonFileLineInPlace(char* line, size_t size, DockerJsonFileFields& fields) {
+    string& padded = GetPaddedBuffer(size);
+    memcpy(&padded[0], line, size);
+    JsonString res[3];
+    if (!ParseDockerJsonFileFields(padded.data(), size, padded.size(), res)) {
+        return false;
+    }
+    // unescaped string is never longer than its raw content
+    fields.log = WriteBack(res[0], padded.data(), line);
+    fields.stream = WriteBack(res[1], padded.data(), line);
+    fields.time = WriteBack(res[2], padded.data(), line);
+    return true;
+}
+
+bool ParseJsonObjectInPlace(char* buffer,
+                            size_t size,
+                            SourceBuffer& sourceBuffer,
+                            vector<pair<StringView, StringView>>& members) {
+    members.clear();
+    simdjson::ondemand::document doc;
+    if (GetParser().iterate(simdjson::padded_string_view(buffer, size, size + kSimdJsonPadding)).get(doc)
+        != simdjson::SUCCESS) {
+        return false;
+    }
+    simdjson::ondemand::object obj;
+    if (doc.get_object().get(obj) != simdjson::SUCCESS) {
+        return false;
+    }
+    for (auto item : obj) {
+        simdjson::ondemand::field field;
+        if (std::move(item).get(field) != simdjson::SUCCESS) {
+            return false;
+        }
+        // string values are written back before the following members are parsed, which never reaches them
+        string_view rawKey = field.escaped_key();
+        StringView key(rawKey.data(), rawKey.size());
+        if (memchr(rawKey.data(), '\\', rawKey.size()) != nullptr) {
+            string_view unescaped;
+            if (field.unescaped_key().get(unescaped) != simdjson::SUCCESS) {
+                return false;
+            }
+            char* dst = const_cast<char*>(rawKey.data());
+            memcpy(dst, unescaped.data(), unescaped.size());
+            key = StringView(dst, unescaped.size());
+        }
+        StringView value;
+        if (!FormatValue(field.value(), sourceBuffer, buffer, value)) {
+            return false;
+        }
+        members.emplace_back(key, value);
+    }
+    return doc.at_end();
+}
+
+#else
+
+bool IsSimdJsonEnabled() {
+    return false;
+}
+
+string GetSimdJsonImplementation() {
+    return "";
+}
+
+bool ParseDockerJsonFileLine(StringView line, DockerJsonFileFields& fields) {
+    return false;
+}
+
+bool ParseDockerJsonFileLineInPlace(char* line, size_t size, DockerJsonFileFields& fields) {
+    return false;
+}
+
+bool ParseJsonObjectInPlace(char* buffer,
+                            size_t size,
+                            SourceBuffer& sourceBuffer,
+                            vector<pair<StringView, StringView>>& members) {
+    return false;
+}
+
+#endif
+
+} // namespace logtail
@@ -0,0 +1,62 @@
+/*
+ * Copyright 2025 iLogtail Authors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cstddef>
+
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "common/memory/SourceBuffer.h"
+#include "models/StringView.h"
+
+namespace logtail {
+
+// Vectorized json parsing with simdjson, which is only available when built with SPL on linux. simdjson picks the
+// kernel best fit for the running cpu at runtime. Callers should fall back to their own parsers when it is not enabled
+// or when parsing fails, so that the behavior on malformed logs stays the same.
+
+// bytes readable after the end of json to be parsed in place
+constexpr size_t kSimdJsonPadding = 64;
+
+// true if enable_simdjson_parser is set and a SIMD kernel is supported by the cpu
+bool IsSimdJsonEnabled();
+// e.g. haswell, westmere, arm64, or empty if simdjson is not built in
+std::string GetSimdJsonImplementation();
+
+// Fields of a docker json-file log line, e.g. {"log":"Hello\n","stream":"stdout","time":"2021-12-01T00:00:00Z"}.
+struct DockerJsonFileFields {
+    StringView log;
+    StringView stream;
+    StringView time;
+};
+
+// The fields are only valid until the next parse in the same thread.
+bool ParseDockerJsonFileLine(StringView line, DockerJsonFileFields& fields);
+// The fields are unescaped in place, so they are views of line.
+bool ParseDockerJsonFileLineInPlace(char* line, size_t size, DockerJsonFileFields& fields);
+
+// Members of the json object in buffer, which should have at least kSimdJsonPadding bytes readable after size. String
+// keys and values are unescaped in place, so they are views of buffer. Other values are formatted the same as the
+// rapidjson based parsers, and nested objects and arrays are serialized compactly into sourceBuffer.
+bool ParseJsonObjectInPlace(char* buffer,
+                            size_t size,
+                            SourceBuffer& sourceBuffer,
+                            std::vector<std::pair<StringView, StringView>>& members);
+
+} // namespace logtail
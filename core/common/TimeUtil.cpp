@@ -23,6 +23,8 @@
 #if defined(__linux__)
 #include <sys/sysinfo.h>
 #include <utmp.h>
+#elif defined(_MSC_VER)
+#include <Windows.h>
 #endif
 #include "common/LogtailCommonFlags.h"
 #include "common/ParamExtractor.h"
@@ -66,6 +68,30 @@ uint64_t GetCurrentTimeInMilliSeconds() {
         .count();
 }
 
+std::chrono::nanoseconds GetCurrentThreadCpuTime() {
+#if defined(__linux__)
+    timespec ts;
+    if (clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts) != 0) {
+        return std::chrono::nanoseconds(0);
+    }
+    return std::chrono::seconds(ts.tv_sec) + std::chrono::nanoseconds(ts.tv_nsec);
+#elif defined(_MSC_VER)
+    FILETIME creationTime, exitTime, kernelTime, userTime;
+    if (!GetThreadTimes(GetCurrentThread(), &creationTime, &exitTime, &kernelTime, &userTime)) {
+        return std::chrono::nanoseconds(0);
+    }
+    ULARGE_INTEGER kernel, user;
+    kernel.LowPart = kernelTime.dwLowDateTime;
+    kernel.HighPart = kernelTime.dwHighDateTime;
+    user.LowPart = userTime.dwLowDateTime;
+    user.HighPart = userTime.dwHighDateTime;
+    // in 100 nanoseconds
+    return std::chrono::nanoseconds((kernel.QuadPart + user.QuadPart) * 100);
+#else
+    return std::chrono::nanoseconds(0);
+#endif
+}
+
 int GetLocalTimeZoneOffsetSecond() {
     time_t nowTime = time(NULL);
     tm timeInfo;
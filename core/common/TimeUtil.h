@@ -48,6 +48,9 @@ uint64_t GetCurrentTimeInMicroSeconds();
 uint64_t GetCurrentTimeInMilliSeconds();
 uint64_t GetCurrentTimeInNanoSeconds();
 
+// Get cpu time consumed by the calling thread.
+std::chrono::nanoseconds GetCurrentThreadCpuTime();
+
 // Get offset between current time zone and UTC in seconds.
 // For example, for UTC+8, returns 8*60*60.
 int GetLocalTimeZoneOffsetSecond();
@@ -21,7 +21,9 @@ namespace logtail {
 enum class CompressType {
     NONE,
     LZ4,
-    ZSTD
+    ZSTD,
+    SNAPPY,
+    GZIP
 #ifdef APSARA_UNIT_TEST_MAIN
     ,
     MOCK
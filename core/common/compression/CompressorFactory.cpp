@@ -15,7 +15,9 @@
 #include "common/compression/CompressorFactory.h"
 
 #include "common/ParamExtractor.h"
+#include "common/compression/GzipCompressor.h"
 #include "common/compression/LZ4Compressor.h"
+#include "common/compression/SnappyCompressor.h"
 #include "common/compression/ZstdCompressor.h"
 #include "monitor/metric_constants/MetricConstants.h"
 
@@ -45,6 +47,10 @@ unique_ptr<Compressor> CompressorFactory::Create(const Json::Value& config,
         compressor = Create(CompressType::LZ4);
     } else if (compressType == "zstd") {
         compressor = Create(CompressType::ZSTD);
+    } else if (compressType == "snappy") {
+        compressor = Create(CompressType::SNAPPY);
+    } else if (compressType == "gzip") {
+        compressor = Create(CompressType::GZIP);
     } else if (compressType == "none") {
         return nullptr;
     } else if (!compressType.empty()) {
@@ -74,6 +80,10 @@ unique_ptr<Compressor> CompressorFactory::Create(CompressType type) {
             return make_unique<LZ4Compressor>(type);
         case CompressType::ZSTD:
             return make_unique<ZstdCompressor>(type);
+        case CompressType::SNAPPY:
+            return make_unique<SnappyCompressor>(type);
+        case CompressType::GZIP:
+            return make_unique<GzipCompressor>(type);
         default:
             return nullptr;
     }
@@ -87,6 +97,12 @@ const string& CompressTypeToString(CompressType type) {
         case CompressType::ZSTD:
             static string zstd = "zstd";
             return zstd;
+        case CompressType::SNAPPY:
+            static string snappy = "snappy";
+            return snappy;
+        case CompressType::GZIP:
+            static string gzip = "gzip";
+            return gzip;
         case CompressType::NONE:
             static string none = "none";
             return none;
@@ -0,0 +1,74 @@
+// Copyright 2025 iLogtail Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "common/compression/GzipCompressor.h"
+
+#include <zlib.h>
+
+using namespace std;
+
+namespace logtail {
+
+// window bits plus 16 selects the gzip header and trailer
+static const int kGzipWindowBits = MAX_WBITS + 16;
+
+bool GzipCompressor::Compress(const string& input, string& output, string& errorMsg) {
+    z_stream stream{};
+    if (deflateInit2(&stream, Z_DEFAULT_COMPRESSION, Z_DEFLATED, kGzipWindowBits, 8, Z_DEFAULT_STRATEGY) != Z_OK) {
+        errorMsg = "failed to init gzip stream";
+        return false;
+    }
+    output.resize(deflateBound(&stream, input.size()));
+    stream.next_in = reinterpret_cast<Bytef*>(const_cast<char*>(input.data()));
+    stream.avail_in = input.size();
+    stream.next_out = reinterpret_cast<Bytef*>(&output[0]);
+    stream.avail_out = output.size();
+    int res = deflate(&stream, Z_FINISH);
+    deflateEnd(&stream);
+    if (res != Z_STREAM_END) {
+        errorMsg = stream.msg ? stream.msg : "failed to compress data with gzip";
+        return false;
+    }
+    output.resize(stream.total_out);
+    return true;
+}
+
+#ifdef APSARA_UNIT_TEST_MAIN
+bool GzipCompressor::UnCompress(const string& input, string& output, string& errorMsg) {
+    z_stream stream{};
+    if (inflateInit2(&stream, kGzipWindowBits) != Z_OK) {
+        errorMsg = "failed to init gzip stream";
+        return false;
+    }
+    stream.next_in = reinterpret_cast<Bytef*>(const_cast<char*>(input.data()));
+    stream.avail_in = input.size();
+    output.clear();
+    char buf[4096];
+    int res = Z_OK;
+    while (res == Z_OK) {
+        stream.next_out = reinterpret_cast<Bytef*>(buf);
+        stream.avail_out = sizeof(buf);
+        res = inflate(&stream, Z_NO_FLUSH);
+        output.append(buf, sizeof(buf) - stream.avail_out);
+    }
+    inflateEnd(&stream);
+    if (res != Z_STREAM_END) {
+        errorMsg = "invalid gzip data";
+        return false;
+    }
+    return true;
+}
+#endif
+
+} // namespace logtail
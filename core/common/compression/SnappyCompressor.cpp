@@ -0,0 +1,46 @@
+// Copyright 2025 iLogtail Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "common/compression/SnappyCompressor.h"
+
+#include "snappy.h"
+
+using namespace std;
+
+namespace logtail {
+
+bool SnappyCompressor::Compress(const string& input, string& output, string& errorMsg) {
+    try {
+        snappy::Compress(input.data(), input.size(), &output);
+        return true;
+    } catch (...) {
+    }
+    return false;
+}
+
+#ifdef APSARA_UNIT_TEST_MAIN
+bool SnappyCompressor::UnCompress(const string& input, string& output, string& errorMsg) {
+    try {
+        if (!snappy::Uncompress(input.data(), input.size(), &output)) {
+            errorMsg = "invalid snappy data";
+            return false;
+        }
+        return true;
+    } catch (...) {
+    }
+    return false;
+}
+#endif
+
+} // namespace logtail
@@ -58,6 +58,7 @@ private:
 
 #ifdef APSARA_UNIT_TEST_MAIN
     friend class HttpRequestTimerEventUnittest;
+    friend class ScrapeExecutorUnittest;
 #endif
 };
 
@@ -25,6 +25,7 @@ const string HOST = "Host";
 const string DATE = "Date";
 const string USER_AGENT = "User-Agent";
 const string CONTENT_TYPE = "Content-Type";
+const string CONTENT_ENCODING = "Content-Encoding";
 const string CONTENT_LENGTH = "Content-Length";
 const string AUTHORIZATION = "Authorization";
 const string SIGNATURE = "Signature";
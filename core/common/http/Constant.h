@@ -28,6 +28,7 @@ extern const std::string DATE;
 extern const std::string USER_AGENT;
 extern const std::string CONTENT_LENGTH;
 extern const std::string CONTENT_TYPE;
+extern const std::string CONTENT_ENCODING;
 extern const std::string AUTHORIZATION;
 extern const std::string SIGNATURE;
 
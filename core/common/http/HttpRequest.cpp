@@ -14,6 +14,8 @@
 
 #include "common/http/HttpRequest.h"
 
+#include "common/StringTools.h"
+
 DEFINE_FLAG_INT32(default_http_request_timeout_sec, "", 15);
 DEFINE_FLAG_INT32(default_http_request_max_try_cnt, "", 3);
 
@@ -55,4 +57,36 @@ string GetQueryString(const map<string, string>& parameters) {
     return res;
 }
 
+bool ParseHttpUrl(const string& url, bool& httpsFlag, string& host, int32_t& port, string& path) {
+    static const string kHttpPrefix = "http://", kHttpsPrefix = "https://";
+    string rest;
+    if (StartWith(url, kHttpsPrefix)) {
+        httpsFlag = true;
+        port = 443;
+        rest = url.substr(kHttpsPrefix.size());
+    } else if (StartWith(url, kHttpPrefix)) {
+        httpsFlag = false;
+        port = 80;
+        rest = url.substr(kHttpPrefix.size());
+    } else {
+        return false;
+    }
+    auto pathPos = rest.find('/');
+    path = pathPos == string::npos ? "/" : rest.substr(pathPos);
+    host = rest.substr(0, pathPos);
+    auto portPos = host.rfind(':');
+    if (portPos != string::npos && host.find(']', portPos) == string::npos) {
+        try {
+            port = StringTo<int32_t>(host.substr(portPos + 1));
+        } catch (...) {
+            return false;
+        }
+        if (port <= 0 || port > 65535) {
+            return false;
+        }
+        host.resize(portPos);
+    }
+    return !host.empty();
+}
+
 } // namespace logtail
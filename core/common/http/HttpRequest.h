@@ -139,5 +139,7 @@ struct AsynHttpRequest : public HttpRequest {
 };
 
 std::string GetQueryString(const std::map<std::string, std::string>& parameters);
+// splits an http or https url into its parts, with the default port of the scheme if not given, and "/" if no path
+bool ParseHttpUrl(const std::string& url, bool& httpsFlag, std::string& host, int32_t& port, std::string& path);
 
 } // namespace logtail
@@ -22,6 +22,7 @@ macro(common_link target_name)
     link_lz4(${target_name})
     link_zlib(${target_name})
     link_zstd(${target_name})
+    link_snappy(${target_name})
     link_unwind(${target_name})
     if (ENABLE_ADDRESS_SANITIZER)
         link_asan(${target_name})
@@ -0,0 +1,97 @@
+// Copyright 2025 iLogtail Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "common/memory/ChunkPool.h"
+
+#include "common/Flags.h"
+
+DEFINE_FLAG_INT64(source_buffer_pool_max_bytes,
+                  "max total size of idle chunks kept for reuse by source buffers, 0 to disable recycling",
+                  64 * 1024 * 1024);
+
+using namespace std;
+
+namespace logtail {
+
+ChunkPool::ChunkPool() {
+    size_t classCnt = 0;
+    for (size_t size = kMinChunkSize; size <= kMaxChunkSize; size <<= 1) {
+        ++classCnt;
+    }
+    mFreeChunks.resize(classCnt);
+}
+
+size_t ChunkPool::getSizeClass(size_t size) {
+    size_t idx = 0;
+    for (size_t capacity = kMinChunkSize; capacity < size; capacity <<= 1) {
+        ++idx;
+    }
+    return idx;
+}
+
+uint8_t* ChunkPool::Acquire(size_t size, size_t& capacity) {
+    mAcquireCnt.fetch_add(1, memory_order_relaxed);
+    if (size > kMaxChunkSize) {
+        capacity = size;
+        return new uint8_t[size];
+    }
+    size_t idx = getSizeClass(size);
+    capacity = kMinChunkSize << idx;
+    {
+        lock_guard<mutex> lock(mMux);
+        auto& chunks = mFreeChunks[idx];
+        if (!chunks.empty()) {
+            uint8_t* chunk = chunks.back();
+            chunks.pop_back();
+            mPooledBytes.fetch_sub(capacity, memory_order_relaxed);
+            mReuseCnt.fetch_add(1, memory_order_relaxed);
+            return chunk;
+        }
+    }
+    return new uint8_t[capacity];
+}
+
+void ChunkPool::Release(uint8_t* chunk, size_t capacity) {
+    const size_t maxPooledBytes = static_cast<size_t>(INT64_FLAG(source_buffer_pool_max_bytes));
+    if (capacity <= kMaxChunkSize && mPooledBytes.load(memory_order_relaxed) + capacity <= maxPooledBytes) {
+        lock_guard<mutex> lock(mMux);
+        mFreeChunks[getSizeClass(capacity)].push_back(chunk);
+        mPooledBytes.fetch_add(capacity, memory_order_relaxed);
+        return;
+    }
+    delete[] chunk;
+}
+
+double ChunkPool::GetAndResetReuseRatio() {
+    uint64_t acquireCnt = mAcquireCnt.exchange(0, memory_order_relaxed);
+    uint64_t reuseCnt = mReuseCnt.exchange(0, memory_order_relaxed);
+    return acquireCnt == 0 ? 0.0 : static_cast<double>(reuseCnt) / acquireCnt;
+}
+
+#ifdef APSARA_UNIT_TEST_MAIN
+void ChunkPool::Clear() {
+    lock_guard<mutex> lock(mMux);
+    for (auto& chunks : mFreeChunks) {
+        for (auto chunk : chunks) {
+            delete[] chunk;
+        }
+        chunks.clear();
+    }
+    mPooledBytes = 0;
+    mAcquireCnt = 0;
+    mReuseCnt = 0;
+}
+#endif
+
+} // namespace logtail
@@ -0,0 +1,72 @@
+/*
+ * Copyright 2025 iLogtail Authors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+namespace logtail {
+
+// ChunkPool recycles the large chunks of BufferAllocator (mostly file read buffers), so that the chunks of the
+// SourceBuffers whose event groups have been sent are reused by the following reads instead of being freed and
+// allocated again. Chunks are grouped by power-of-two size classes, and the total size of idle chunks is bounded by
+// the flag source_buffer_pool_max_bytes.
+class ChunkPool {
+public:
+    static const size_t kMinChunkSize = 64 * 1024;
+    static const size_t kMaxChunkSize = 16 * 1024 * 1024;
+
+    // never destructed, since source buffers may be released by other singletons on exit
+    static ChunkPool* GetInstance() {
+        static ChunkPool* ptr = new ChunkPool();
+        return ptr;
+    }
+
+    // @param capacity the real size of the returned chunk, which is not smaller than size
+    uint8_t* Acquire(size_t size, size_t& capacity);
+    // chunk must be the one returned by Acquire with the same capacity
+    void Release(uint8_t* chunk, size_t capacity);
+
+    // ratio of acquisitions served by recycled chunks since the last call
+    double GetAndResetReuseRatio();
+    size_t GetPooledBytes() const { return mPooledBytes.load(std::memory_order_relaxed); }
+
+private:
+    ChunkPool();
+    ~ChunkPool() = default;
+
+    static size_t getSizeClass(size_t size);
+
+    mutable std::mutex mMux;
+    // idle chunks of each size class, the capacity of class i is kMinChunkSize << i
+    std::vector<std::vector<uint8_t*>> mFreeChunks;
+    std::atomic_size_t mPooledBytes{0};
+
+    std::atomic_uint64_t mAcquireCnt{0};
+    std::atomic_uint64_t mReuseCnt{0};
+
+#ifdef APSARA_UNIT_TEST_MAIN
+    void Clear();
+
+    friend class SourceBufferUnittest;
+#endif
+};
+
+} // namespace logtail
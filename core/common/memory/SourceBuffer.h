@@ -18,7 +18,10 @@
 
 #include <list>
 #include <memory>
+#include <utility>
+#include <vector>
 
+#include "common/memory/ChunkPool.h"
 #include "models/StringView.h"
 
 namespace logtail {
@@ -63,6 +66,7 @@ public:
         for (size_t i = 0; i < mAllocatedChunks.size(); i++) {
             delete[] mAllocatedChunks[i];
         }
+        releasePooledChunks();
     }
 
     void Reset(void) {
@@ -70,6 +74,7 @@ public:
             delete[] mAllocatedChunks[i];
         }
         mAllocatedChunks.resize(1);
+        releasePooledChunks();
         mAllocPtr = mAllocatedChunks[0];
         mChunkSize = mFirstChunkSize;
         mFreeBytesInChunk = mChunkSize;
@@ -87,7 +92,9 @@ public:
 
     size_t TotalAllocated() { return mAllocated; }
 
-    int64_t GetAllocatedSize() const { return mAllocated + mAllocatedChunks.size() * sizeof(void*); }
+    int64_t GetAllocatedSize() const {
+        return mAllocated + (mAllocatedChunks.size() + mPooledChunks.size()) * sizeof(void*);
+    }
 
 private:
     // Please do not make it public, user should always use Allocate() to get a better performance.
@@ -105,10 +112,18 @@ private:
              * This request is unexpectedly large. We believe the next request
              * will not be so large. Thus, it is wise to allocate it directly
              * from heap in order to avoid polluting chunk size.
+             * Chunks large enough (mostly file read buffers) are recycled by ChunkPool.
              */
-            mem = new uint8_t[bytes];
-            mAllocatedChunks.push_back(mem);
-            mAllocated += bytes;
+            if (bytes >= ChunkPool::kMinChunkSize) {
+                size_t capacity = 0;
+                mem = ChunkPool::GetInstance()->Acquire(bytes, capacity);
+                mPooledChunks.emplace_back(mem, capacity);
+                mAllocated += capacity;
+            } else {
+                mem = new uint8_t[bytes];
+                mAllocatedChunks.push_back(mem);
+                mAllocated += bytes;
+            }
         } else {
             /*
              * Here we intentionally waste some space in the current chunk.
@@ -127,12 +142,21 @@ private:
         return mem;
     }
 
+    void releasePooledChunks() {
+        for (auto& chunk : mPooledChunks) {
+            ChunkPool::GetInstance()->Release(chunk.first, chunk.second);
+        }
+        mPooledChunks.clear();
+    }
+
 private:
     uint32_t mFirstChunkSize = 4096;
     uint32_t mChunkSizeLimit = 1024 * 128;
 
     // The allocated memory chunks
     std::vector<uint8_t*> mAllocatedChunks;
+    // The chunks acquired from ChunkPool and their capacity
+    std::vector<std::pair<uint8_t*, size_t>> mPooledChunks;
     // Statistics data
     uint64_t mAllocated = 0;
     uint64_t mUsed = 0;
@@ -14,8 +14,15 @@
 
 #include "common/timer/Timer.h"
 
+#include "common/Flags.h"
 #include "logger/Logger.h"
 
+DEFINE_FLAG_BOOL(enable_timer_timing_wheel, "keep timer events in a hierarchical timing wheel", false);
+DEFINE_FLAG_INT32(timer_wheel_tick_ms, "tick of the timing wheel, events are fired at most one tick late", 10);
+DEFINE_FLAG_INT32(timer_worker_thread_count,
+                  "number of threads executing timer events when the timing wheel is enabled, 0 means the timer thread",
+                  1);
+
 using namespace std;
 
 namespace logtail {
@@ -28,7 +35,27 @@ void Timer::Init() {
         }
         mIsThreadRunning = true;
     }
-    mThreadRes = async(launch::async, &Timer::Run, this);
+    {
+        lock_guard<mutex> lock(mQueueMux);
+        if (!mWheel && BOOL_FLAG(enable_timer_timing_wheel)) {
+            mWheel = make_unique<TimingWheel>(chrono::steady_clock::now(),
+                                              chrono::milliseconds(max(INT32_FLAG(timer_wheel_tick_ms), 1)));
+            // events pushed before init
+            while (!mQueue.empty()) {
+                mWheel->Add(std::move(const_cast<unique_ptr<TimerEvent>&>(mQueue.top())));
+                mQueue.pop();
+            }
+        }
+    }
+    if (!mWheel) {
+        mThreadRes = async(launch::async, &Timer::Run, this);
+        return;
+    }
+    if (INT32_FLAG(timer_worker_thread_count) > 0) {
+        mWorkers = make_unique<ThreadPool>(INT32_FLAG(timer_worker_thread_count));
+        mWorkers->Start();
+    }
+    mThreadRes = async(launch::async, &Timer::RunWheel, this);
 }
 
 void Timer::Stop() {
@@ -39,6 +66,10 @@ void Timer::Stop() {
         }
         mIsThreadRunning = false;
     }
+    {
+        // the wheel thread checks the running flag and waits with mQueueMux held, so that the notification is not lost
+        lock_guard<mutex> lock(mQueueMux);
+    }
     mCV.notify_one();
     if (!mThreadRes.valid()) {
         return;
@@ -49,10 +80,23 @@ void Timer::Stop() {
     } else {
         LOG_WARNING(sLogger, ("timer", "forced to stopped"));
     }
+    if (mWorkers) {
+        mWorkers->Stop();
+        mWorkers.reset();
+    }
 }
 
 void Timer::PushEvent(unique_ptr<TimerEvent>&& e) {
     lock_guard<mutex> lock(mQueueMux);
+    if (mWheel) {
+        auto execTime = e->GetExecTime();
+        mWheel->Add(std::move(e));
+        if (execTime < mWheelWakeTime) {
+            mWheelWakeTime = execTime;
+            mCV.notify_one();
+        }
+        return;
+    }
     if (mQueue.empty() || e->GetExecTime() < mQueue.top()->GetExecTime()) {
         mQueue.push(std::move(e));
         mCV.notify_one();
@@ -94,12 +138,74 @@ void Timer::Run() {
     }
 }
 
+void Timer::RunWheel() {
+    LOG_INFO(sLogger, ("timer", "started")("mode", "timing wheel"));
+    vector<unique_ptr<TimerEvent>> due;
+    unique_lock<mutex> queueLock(mQueueMux);
+    while (true) {
+        {
+            lock_guard<mutex> threadLock(mThreadRunningMux);
+            if (!mIsThreadRunning) {
+                break;
+            }
+        }
+        mWheel->Advance(chrono::steady_clock::now(), due);
+        if (!due.empty()) {
+            // the wheel is advanced again right after firing, so pushes in the meantime need not wake the thread
+            mWheelWakeTime = chrono::steady_clock::time_point::min();
+            queueLock.unlock();
+            Fire(due);
+            due.clear();
+            queueLock.lock();
+            continue;
+        }
+        mWheelWakeTime = mWheel->NextExpireTime();
+        if (mWheelWakeTime == chrono::steady_clock::time_point::max()) {
+            mCV.wait(queueLock);
+        } else {
+            mCV.wait_until(queueLock, mWheelWakeTime);
+        }
+    }
+    mWheelWakeTime = chrono::steady_clock::time_point::max();
+}
+
+void Timer::Fire(vector<unique_ptr<TimerEvent>>& events) {
+    if (!mWorkers) {
+        Execute(events);
+        return;
+    }
+    // hand off the due events by batches, so that one busy tick is shared by all workers
+    static const size_t kEventsPerTask = 64;
+    for (size_t begin = 0; begin < events.size(); begin += kEventsPerTask) {
+        size_t end = min(begin + kEventsPerTask, events.size());
+        auto batch = make_shared<vector<unique_ptr<TimerEvent>>>();
+        batch->reserve(end - begin);
+        for (size_t i = begin; i < end; ++i) {
+            batch->push_back(std::move(events[i]));
+        }
+        mWorkers->Add([batch]() { Execute(*batch); });
+    }
+}
+
+void Timer::Execute(vector<unique_ptr<TimerEvent>>& events) {
+    for (auto& e : events) {
+        if (!e->IsValid()) {
+            LOG_INFO(sLogger, ("invalid timer event", "task is cancelled"));
+        } else {
+            e->Execute();
+        }
+    }
+}
+
 #ifdef APSARA_UNIT_TEST_MAIN
 void Timer::Clear() {
     lock_guard<mutex> lock(mQueueMux);
     while (!mQueue.empty()) {
         mQueue.pop();
     }
+    if (mWheel) {
+        mWheel->Clear();
+    }
 }
 #endif
 
@@ -22,7 +22,9 @@
 #include <mutex>
 #include <queue>
 
+#include "common/ThreadPool.h"
 #include "common/timer/TimerEvent.h"
+#include "common/timer/TimingWheel.h"
 
 namespace logtail {
 
@@ -53,10 +55,18 @@ private:
     Timer() = default;
     ~Timer() = default;
     void Run();
+    void RunWheel();
+    void Fire(std::vector<std::unique_ptr<TimerEvent>>& events);
+    static void Execute(std::vector<std::unique_ptr<TimerEvent>>& events);
 
     mutable std::mutex mQueueMux;
     std::priority_queue<std::unique_ptr<TimerEvent>, std::vector<std::unique_ptr<TimerEvent>>, TimerEventCompare>
         mQueue;
+    // when enabled, events are kept in the timing wheel instead of mQueue, and the due events of each tick are fired
+    // together by the worker pool
+    std::unique_ptr<TimingWheel> mWheel;
+    std::chrono::steady_clock::time_point mWheelWakeTime = std::chrono::steady_clock::time_point::max();
+    std::unique_ptr<ThreadPool> mWorkers;
 
     std::future<void> mThreadRes;
     mutable std::mutex mThreadRunningMux;
@@ -65,6 +75,7 @@ private:
 
 #ifdef APSARA_UNIT_TEST_MAIN
     friend class TimerUnittest;
+    friend class TimerBenchmark;
     friend class ScrapeSchedulerUnittest;
     friend class HostMonitorInputRunnerUnittest;
 #endif
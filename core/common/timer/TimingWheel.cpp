@@ -0,0 +1,156 @@
+// Copyright 2025 iLogtail Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "common/timer/TimingWheel.h"
+
+#include <algorithm>
+#include <limits>
+
+using namespace std;
+
+namespace logtail {
+
+TimingWheel::TimingWheel(chrono::steady_clock::time_point start, chrono::steady_clock::duration tick)
+    : mStart(start), mTick(tick), mLevel0(kLevel0Size) {
+    for (auto& level : mUpperLevels) {
+        level.resize(kLevelSize);
+    }
+}
+
+void TimingWheel::Add(unique_ptr<TimerEvent>&& e) {
+    uint64_t expireTick = GetExpireTick(e->GetExecTime());
+    AddToSlot(std::move(e), expireTick);
+    ++mSize;
+}
+
+void TimingWheel::Advance(chrono::steady_clock::time_point now, vector<unique_ptr<TimerEvent>>& due) {
+    size_t begin = due.size();
+    while (GetTickTime(mCurrentTick) <= now) {
+        if (mLevelSizes[0] == 0) {
+            // nothing to fire before the next cascade, skip the idle ticks at once
+            uint64_t nextTick = min(NextCascadeTick(), static_cast<uint64_t>((now - mStart) / mTick) + 1);
+            if (nextTick > mCurrentTick) {
+                mCurrentTick = nextTick;
+                continue;
+            }
+        }
+        if ((mCurrentTick & (kLevel0Size - 1)) == 0) {
+            Cascade(1);
+        }
+        auto& slot = mLevel0[mCurrentTick & (kLevel0Size - 1)];
+        if (!slot.empty()) {
+            mSize -= slot.size();
+            mLevelSizes[0] -= slot.size();
+            for (auto& e : slot) {
+                due.push_back(std::move(e));
+            }
+            slot.clear();
+        }
+        ++mCurrentTick;
+    }
+    stable_sort(due.begin() + begin,
+                due.end(),
+                [](const unique_ptr<TimerEvent>& lhs, const unique_ptr<TimerEvent>& rhs) {
+                    return lhs->GetExecTime() < rhs->GetExecTime();
+                });
+}
+
+chrono::steady_clock::time_point TimingWheel::NextExpireTime() const {
+    if (mSize == 0) {
+        return chrono::steady_clock::time_point::max();
+    }
+    uint64_t cascadeTick = NextCascadeTick();
+    if (mLevelSizes[0] > 0) {
+        uint64_t end = min(cascadeTick, mCurrentTick + kLevel0Size);
+        for (uint64_t tick = mCurrentTick; tick < end; ++tick) {
+            if (!mLevel0[tick & (kLevel0Size - 1)].empty()) {
+                return GetTickTime(tick);
+            }
+        }
+    }
+    return GetTickTime(cascadeTick);
+}
+
+void TimingWheel::Clear() {
+    for (auto& slot : mLevel0) {
+        slot.clear();
+    }
+    for (auto& level : mUpperLevels) {
+        for (auto& slot : level) {
+            slot.clear();
+        }
+    }
+    mLevelSizes.fill(0);
+    mSize = 0;
+}
+
+uint64_t TimingWheel::NextCascadeTick() const {
+    // the lowest non-empty upper level is cascaded once all levels below it finish a rotation
+    uint32_t shift = kLevel0Bits;
+    for (uint32_t level = 1; level < kLevelCnt; ++level, shift += kLevelBits) {
+        if (mLevelSizes[level] > 0) {
+            uint64_t mask = (static_cast<uint64_t>(1) << shift) - 1;
+            return (mCurrentTick + mask) & ~mask;
+        }
+    }
+    return numeric_limits<uint64_t>::max();
+}
+
+uint64_t TimingWheel::GetExpireTick(chrono::steady_clock::time_point execTime) const {
+    if (execTime <= GetTickTime(mCurrentTick)) {
+        return mCurrentTick;
+    }
+    // round up, so that no event is fired before its exec time
+    auto ticks = (execTime - mStart + mTick - chrono::steady_clock::duration(1)) / mTick;
+    return static_cast<uint64_t>(ticks);
+}
+
+void TimingWheel::AddToSlot(unique_ptr<TimerEvent>&& e, uint64_t expireTick) {
+    uint64_t delta = expireTick - mCurrentTick;
+    if (delta < kLevel0Size) {
+        mLevel0[expireTick & (kLevel0Size - 1)].push_back(std::move(e));
+        ++mLevelSizes[0];
+        return;
+    }
+    uint32_t shift = kLevel0Bits;
+    for (uint32_t level = 1; level < kLevelCnt; ++level, shift += kLevelBits) {
+        if (delta < (kLevelSize << shift) || level == kLevelCnt - 1) {
+            if (delta >= (kLevelSize << shift)) {
+                // too far away, keep it in the farthest slot and it will be added again once cascaded
+                expireTick = mCurrentTick + (kLevelSize << shift) - 1;
+            }
+            mUpperLevels[level - 1][(expireTick >> shift) & (kLevelSize - 1)].push_back(std::move(e));
+            ++mLevelSizes[level];
+            return;
+        }
+    }
+}
+
+void TimingWheel::Cascade(uint32_t level) {
+    uint32_t shift = kLevel0Bits + kLevelBits * (level - 1);
+    uint64_t index = (mCurrentTick >> shift) & (kLevelSize - 1);
+    Slot slot;
+    slot.swap(mUpperLevels[level - 1][index]);
+    mLevelSizes[level] -= slot.size();
+    for (auto& e : slot) {
+        uint64_t expireTick = GetExpireTick(e->GetExecTime());
+        AddToSlot(std::move(e), expireTick);
+    }
+    // the upper level finishes a rotation as well
+    if (index == 0 && level + 1 < kLevelCnt) {
+        Cascade(level + 1);
+    }
+}
+
+} // namespace logtail
@@ -0,0 +1,82 @@
+/*
+ * Copyright 2025 iLogtail Authors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "common/timer/TimerEvent.h"
+
+namespace logtail {
+
+// TimingWheel is a hierarchical timing wheel of 4 levels. Level 0 has 256 slots of one tick each, and every upper level
+// has 64 slots each covering a whole rotation of the level below, so that events within about 12 days (with the
+// default 10ms tick) are added in O(1), and due events are collected by whole slots instead of being popped one by one.
+// Events of upper levels are cascaded down once the lower level finishes a rotation. Events are fired at the first tick
+// not earlier than their exec time, i.e. at most one tick late.
+//
+// TimingWheel is not thread safe.
+class TimingWheel {
+public:
+    TimingWheel(std::chrono::steady_clock::time_point start, std::chrono::steady_clock::duration tick);
+
+    void Add(std::unique_ptr<TimerEvent>&& e);
+    // move all events due at now to due, in the order of exec time
+    void Advance(std::chrono::steady_clock::time_point now, std::vector<std::unique_ptr<TimerEvent>>& due);
+    // the time when Advance should be called next, which is time_point::max() if the wheel is empty
+    std::chrono::steady_clock::time_point NextExpireTime() const;
+
+    size_t Size() const { return mSize; }
+    bool Empty() const { return mSize == 0; }
+    void Clear();
+
+private:
+    static constexpr uint32_t kLevelCnt = 4;
+    static constexpr uint32_t kLevel0Bits = 8;
+    static constexpr uint32_t kLevelBits = 6;
+    static constexpr uint64_t kLevel0Size = 1 << kLevel0Bits;
+    static constexpr uint64_t kLevelSize = 1 << kLevelBits;
+
+    using Slot = std::vector<std::unique_ptr<TimerEvent>>;
+
+    // the first tick not earlier than the current one at which some upper level is cascaded, max if they are empty
+    uint64_t NextCascadeTick() const;
+    uint64_t GetExpireTick(std::chrono::steady_clock::time_point execTime) const;
+    void AddToSlot(std::unique_ptr<TimerEvent>&& e, uint64_t expireTick);
+    void Cascade(uint32_t level);
+    std::chrono::steady_clock::time_point GetTickTime(uint64_t tick) const { return mStart + mTick * tick; }
+
+    std::chrono::steady_clock::time_point mStart;
+    std::chrono::steady_clock::duration mTick;
+    // the next tick to be processed, all ticks before it have been fired
+    uint64_t mCurrentTick = 0;
+    size_t mSize = 0;
+
+    std::vector<Slot> mLevel0;
+    std::array<std::vector<Slot>, kLevelCnt - 1> mUpperLevels;
+    // number of events in each level, so that empty levels are skipped when looking for the next expire time
+    std::array<size_t, kLevelCnt> mLevelSizes{};
+
+#ifdef APSARA_UNIT_TEST_MAIN
+    friend class TimingWheelUnittest;
+#endif
+};
+
+} // namespace logtail
@@ -527,7 +527,8 @@ bool CollectionConfig::Parse() {
     for (size_t i = 0; i < mFlushers.size(); ++i) {
         auto itr = mFlushers[i]->find(key.c_str(), key.c_str() + key.size());
         if (itr) {
-            if (IsFlushingThroughGoPipelineExisted()) {
+            // data returned from go pipeline is routed natively unless extended flushers are given
+            if (mHasGoFlusher) {
                 PARAM_ERROR_RETURN(sLogger,
                                    alarm,
                                    "route found in non-native flushing mode",
@@ -539,7 +540,7 @@ bool CollectionConfig::Parse() {
             }
             mRouter.emplace_back(i, itr);
         } else {
-            if (!IsFlushingThroughGoPipelineExisted()) {
+            if (!mHasGoFlusher) {
                 mRouter.emplace_back(i, nullptr);
             }
         }
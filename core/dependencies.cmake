@@ -55,6 +55,7 @@ set(DEP_NAME_LIST
         lz4
         zlib
         zstd
+        snappy
         curl
         unwind                  # google breakpad on Windows
         ssl                     # openssl
@@ -301,6 +302,19 @@ macro(link_zstd target_name)
     endif ()
 endmacro()
 
+# snappy
+macro(link_snappy target_name)
+    if (snappy_${LINK_OPTION_SUFFIX})
+        target_link_libraries(${target_name} "${snappy_${LINK_OPTION_SUFFIX}}")
+    elseif (UNIX)
+        target_link_libraries(${target_name} "${snappy_${LIBRARY_DIR_SUFFIX}}/libsnappy.a")
+    elseif (MSVC)
+        target_link_libraries(${target_name}
+                debug "snappyd"
+                optimized "snappy")
+    endif ()
+endmacro()
+
 # libcurl
 macro(link_curl target_name)
     if (curl_${LINK_OPTION_SUFFIX})
@@ -353,12 +353,62 @@ bool CheckProbeConfigValid(const Json::Value& config, std::string& errorMsg) {
     return true;
 }
 
+void InitSecurityAggregateOption(const Json::Value& config,
+                                 SecurityAggregateOption& option,
+                                 const CollectionPipelineContext* mContext,
+                                 const std::string& sName) {
+    std::string errorMsg;
+    // Aggregation (Optional)
+    if (!config.isMember("Aggregation")) {
+        // No Aggregation, events are not aggregated, no warning
+        return;
+    }
+    if (!config["Aggregation"].isObject()) {
+        PARAM_WARNING_IGNORE(mContext->GetLogger(),
+                             mContext->GetAlarm(),
+                             "Aggregation is not of type map",
+                             sName,
+                             mContext->GetConfigName(),
+                             mContext->GetProjectName(),
+                             mContext->GetLogstoreName(),
+                             mContext->GetRegion());
+        return;
+    }
+    const auto& aggregationConfig = config["Aggregation"];
+    // WindowSecs (Optional)
+    if (!GetOptionalUIntParam(aggregationConfig, "WindowSecs", option.mWindowSecs, errorMsg)) {
+        PARAM_WARNING_DEFAULT(mContext->GetLogger(),
+                              mContext->GetAlarm(),
+                              errorMsg,
+                              option.mWindowSecs,
+                              sName,
+                              mContext->GetConfigName(),
+                              mContext->GetProjectName(),
+                              mContext->GetLogstoreName(),
+                              mContext->GetRegion());
+    }
+    // Keys (Optional)
+    if (!GetOptionalListParam<std::string>(aggregationConfig, "Keys", option.mKeys, errorMsg)) {
+        option.mKeys.clear();
+        PARAM_WARNING_IGNORE(mContext->GetLogger(),
+                             mContext->GetAlarm(),
+                             errorMsg,
+                             sName,
+                             mContext->GetConfigName(),
+                             mContext->GetProjectName(),
+                             mContext->GetLogstoreName(),
+                             mContext->GetRegion());
+    }
+}
+
 bool SecurityOptions::Init(SecurityProbeType probeType,
                            const Json::Value& config,
                            const CollectionPipelineContext* mContext,
                            const std::string& sName) {
     std::string errorMsg;
 
+    InitSecurityAggregateOption(config, mAggregateOption, mContext, sName);
+
     // ProbeConfig (Optional)
     if (!CheckProbeConfigValid(config, errorMsg)) {
         if (!errorMsg.empty()) {
@@ -39,6 +39,13 @@ bool InitObserverNetworkOption(const Json::Value& config,
 
 enum class SecurityProbeType { PROCESS, FILE, NETWORK, MAX };
 
+// Security events with the same values of mKeys, or with the same tags if mKeys is empty, are rolled up into one event
+// within each window. Aggregation is disabled if mWindowSecs is 0.
+struct SecurityAggregateOption {
+    uint32_t mWindowSecs = 0;
+    std::vector<std::string> mKeys;
+};
+
 class SecurityOptions {
 public:
     bool Init(SecurityProbeType filterType,
@@ -48,6 +55,7 @@ public:
 
     std::vector<nami::SecurityOption> mOptionList;
     SecurityProbeType mProbeType;
+    SecurityAggregateOption mAggregateOption;
 };
 
 ///////////////////// Process Level Config /////////////////////
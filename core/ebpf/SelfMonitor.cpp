@@ -79,6 +79,12 @@ void BaseBPFMonitor::InitMetricInner() {
     ref = mPluginMetricMgr->GetOrCreateReentrantMetricsRecordRef(pushSpansLabels);
     mPushSpansTotal = ref->GetCounter(METRIC_PLUGIN_IN_EVENTS_TOTAL);
     mRefAndLabels.emplace_back(std::make_pair<>(ref, pushSpansLabels));
+
+    // events dropped before pushed to process queue
+    MetricLabels ringLabels = {{METRIC_LABEL_KEY_RECV_EVENT_STAGE, METRIC_LABEL_VALUE_RECV_EVENT_STAGE_REPORT_TO_LC}};
+    ref = mPluginMetricMgr->GetOrCreateReentrantMetricsRecordRef(ringLabels);
+    mRingDropEventsTotal = ref->GetCounter(METRIC_PLUGIN_EBPF_RING_DROP_EVENTS_TOTAL);
+    mRefAndLabels.emplace_back(std::make_pair<>(ref, ringLabels));
 }
 
 void BaseBPFMonitor::UpdateMetricInner(nami::eBPFStatistics& currStat) {
@@ -251,5 +257,12 @@ void eBPFSelfMonitorMgr::HandleStatistic(std::vector<nami::eBPFStatistics>& stat
     }
 }
 
+void eBPFSelfMonitorMgr::HandleDroppedEvents(const nami::PluginType type, uint64_t cnt) {
+    ReadLock lk(mLock);
+    if (mInited[int(type)] && mSelfMonitors[int(type)]) {
+        mSelfMonitors[int(type)]->HandleDroppedEvents(cnt);
+    }
+}
+
 } // namespace ebpf
 } // namespace logtail
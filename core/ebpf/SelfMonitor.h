@@ -33,6 +33,8 @@ public:
     virtual void InitMetric();
     virtual void ReleaseMetric();
     virtual ~BaseBPFMonitor() = default;
+    // events dropped by the handlers because their rings are full
+    void HandleDroppedEvents(uint64_t cnt) { ADD_COUNTER(mRingDropEventsTotal, cnt); }
 
 protected:
     BaseBPFMonitor(const std::string& name, PluginMetricManagerPtr mgr) : mPipelineName(name), mPluginMetricMgr(mgr) {}
@@ -57,6 +59,7 @@ protected:
     CounterPtr mPushMetricsTotal;
     IntGaugePtr mProcessCacheEntitiesNum;
     CounterPtr mProcessCacheMissTotal;
+    CounterPtr mRingDropEventsTotal;
 
 #ifdef APSARA_UNIT_TEST_MAIN
     friend class eBPFServerUnittest;
@@ -124,6 +127,7 @@ public:
     void Release(const nami::PluginType type);
     void Suspend(const nami::PluginType type);
     void HandleStatistic(std::vector<nami::eBPFStatistics>& stats);
+    void HandleDroppedEvents(const nami::PluginType type, uint64_t cnt);
 
 private:
     // `mLock` is used to protect mSelfMonitors
@@ -32,6 +32,7 @@
 DEFINE_FLAG_INT64(kernel_min_version_for_ebpf,
                   "the minimum kernel version that supported eBPF normal running, 4.19.0.0 -> 4019000000",
                   4019000000);
+DEFINE_FLAG_INT32(ebpf_event_consume_interval_ms, "interval of assembling events buffered by ebpf handlers", 10);
 
 namespace logtail {
 namespace ebpf {
@@ -177,6 +178,12 @@ void eBPFServer::Init() {
     mNetworkSecureCB = std::make_unique<SecurityHandler>(nullptr, -1, 0);
     mProcessSecureCB = std::make_unique<SecurityHandler>(nullptr, -1, 0);
     mFileSecureCB = std::make_unique<SecurityHandler>(nullptr, -1, 0);
+
+    {
+        std::lock_guard<std::mutex> lock(mConsumerMux);
+        mConsumerStopped = false;
+    }
+    mConsumerThreadRes = std::async(std::launch::async, &eBPFServer::ConsumeEventsThread, this);
 }
 
 void eBPFServer::Stop() {
@@ -186,6 +193,15 @@ void eBPFServer::Stop() {
     LOG_INFO(sLogger, ("begin to stop all plugins", ""));
     // destroy source manager
     mSourceManager.reset();
+    // events polled before are still consumed
+    {
+        std::lock_guard<std::mutex> lock(mConsumerMux);
+        mConsumerStopped = true;
+    }
+    mConsumerCV.notify_all();
+    if (mConsumerThreadRes.valid()) {
+        mConsumerThreadRes.get();
+    }
     for (int i = 0; i < int(nami::PluginType::MAX); i++) {
         UpdatePipelineName(static_cast<nami::PluginType>(i), "", "");
     }
@@ -239,6 +255,8 @@ bool eBPFServer::StartPluginInternal(const std::string& pipeline_name,
             };
             SecurityOptions* opts = std::get<SecurityOptions*>(options);
             pconfig.options_ = opts->mOptionList;
+            // events aggregated in the current window are flushed to the previous pipeline before switching context
+            mProcessSecureCB->UpdateAggregateOption(opts->mAggregateOption);
             // UpdateContext must ahead of StartPlugin
             mProcessSecureCB->UpdateContext(ctx, ctx->GetProcessQueueKey(), plugin_index);
             eBPFConfig->config_ = std::move(pconfig);
@@ -288,6 +306,8 @@ bool eBPFServer::StartPluginInternal(const std::string& pipeline_name,
             SecurityOptions* opts = std::get<SecurityOptions*>(options);
             nconfig.options_ = opts->mOptionList;
             eBPFConfig->config_ = std::move(nconfig);
+            // events aggregated in the current window are flushed to the previous pipeline before switching context
+            mNetworkSecureCB->UpdateAggregateOption(opts->mAggregateOption);
             // UpdateContext must ahead of StartPlugin
             mNetworkSecureCB->UpdateContext(ctx, ctx->GetProcessQueueKey(), plugin_index);
             ret = mSourceManager->StartPlugin(type, std::move(eBPFConfig));
@@ -302,6 +322,8 @@ bool eBPFServer::StartPluginInternal(const std::string& pipeline_name,
             SecurityOptions* opts = std::get<SecurityOptions*>(options);
             fconfig.options_ = opts->mOptionList;
             eBPFConfig->config_ = std::move(fconfig);
+            // events aggregated in the current window are flushed to the previous pipeline before switching context
+            mFileSecureCB->UpdateAggregateOption(opts->mAggregateOption);
             // UpdateContext must ahead of StartPlugin
             mFileSecureCB->UpdateContext(ctx, ctx->GetProcessQueueKey(), plugin_index);
             ret = mSourceManager->StartPlugin(type, std::move(eBPFConfig));
@@ -403,8 +425,11 @@ void eBPFServer::UpdateCBContext(nami::PluginType type,
                                  int idx) {
     switch (type) {
         case nami::PluginType::PROCESS_SECURITY: {
-            if (mProcessSecureCB)
+            if (mProcessSecureCB) {
+                // events aggregated in the current window go to the previous pipeline
+                mProcessSecureCB->FlushAggregatedEvents();
                 mProcessSecureCB->UpdateContext(ctx, key, idx);
+            }
             return;
         }
         case nami::PluginType::NETWORK_OBSERVE: {
@@ -417,13 +442,19 @@ void eBPFServer::UpdateCBContext(nami::PluginType type,
             return;
         }
         case nami::PluginType::NETWORK_SECURITY: {
-            if (mNetworkSecureCB)
+            if (mNetworkSecureCB) {
+                // events aggregated in the current window go to the previous pipeline
+                mNetworkSecureCB->FlushAggregatedEvents();
                 mNetworkSecureCB->UpdateContext(ctx, key, idx);
+            }
             return;
         }
         case nami::PluginType::FILE_SECURITY: {
-            if (mFileSecureCB)
+            if (mFileSecureCB) {
+                // events aggregated in the current window go to the previous pipeline
+                mFileSecureCB->FlushAggregatedEvents();
                 mFileSecureCB->UpdateContext(ctx, key, idx);
+            }
             return;
         }
         default:
@@ -431,5 +462,44 @@ void eBPFServer::UpdateCBContext(nami::PluginType type,
     }
 }
 
+void eBPFServer::ConsumeEventsThread() {
+    LOG_INFO(sLogger, ("ebpf event consumer", "started"));
+    while (true) {
+        ConsumeEvents();
+        std::unique_lock<std::mutex> lock(mConsumerMux);
+        if (mConsumerCV.wait_for(lock,
+                                 std::chrono::milliseconds(INT32_FLAG(ebpf_event_consume_interval_ms)),
+                                 [this]() { return mConsumerStopped; })) {
+            break;
+        }
+    }
+    ConsumeEvents();
+    for (auto* handler : {mProcessSecureCB.get(), mNetworkSecureCB.get(), mFileSecureCB.get()}) {
+        if (handler) {
+            handler->FlushAggregatedEvents();
+        }
+    }
+    LOG_INFO(sLogger, ("ebpf event consumer", "stopped"));
+}
+
+void eBPFServer::ConsumeEvents() {
+    auto consume = [this](AbstractHandler* handler, nami::PluginType type) {
+        if (handler == nullptr) {
+            return;
+        }
+        handler->ConsumeEvents();
+        uint64_t dropped = handler->FetchDroppedCnt();
+        if (dropped > 0) {
+            mMonitorMgr->HandleDroppedEvents(type, dropped);
+        }
+    };
+    consume(mMeterCB.get(), nami::PluginType::NETWORK_OBSERVE);
+    consume(mSpanCB.get(), nami::PluginType::NETWORK_OBSERVE);
+    consume(mEventCB.get(), nami::PluginType::NETWORK_OBSERVE);
+    consume(mProcessSecureCB.get(), nami::PluginType::PROCESS_SECURITY);
+    consume(mNetworkSecureCB.get(), nami::PluginType::NETWORK_SECURITY);
+    consume(mFileSecureCB.get(), nami::PluginType::FILE_SECURITY);
+}
+
 } // namespace ebpf
 } // namespace logtail
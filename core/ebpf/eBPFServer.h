@@ -16,6 +16,8 @@
 
 #include <array>
 #include <atomic>
+#include <condition_variable>
+#include <future>
 #include <map>
 #include <memory>
 #include <mutex>
@@ -101,6 +103,8 @@ private:
                          const logtail::CollectionPipelineContext* ctx,
                          logtail::QueueKey key,
                          int idx);
+    void ConsumeEventsThread();
+    void ConsumeEvents();
 
     std::unique_ptr<SourceManager> mSourceManager;
     // source manager
@@ -111,6 +115,12 @@ private:
     std::unique_ptr<SecurityHandler> mProcessSecureCB;
     std::unique_ptr<SecurityHandler> mFileSecureCB;
 
+    // events buffered by the handlers are assembled into groups by a single consumer thread
+    std::future<void> mConsumerThreadRes;
+    std::mutex mConsumerMux;
+    std::condition_variable mConsumerCV;
+    bool mConsumerStopped = false;
+
     mutable std::mutex mMtx;
     std::array<std::string, (int)nami::PluginType::MAX> mLoadedPipeline = {};
     std::array<std::string, (int)nami::PluginType::MAX> mPluginProject = {};
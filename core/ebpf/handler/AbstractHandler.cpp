@@ -0,0 +1,60 @@
+// Copyright 2025 iLogtail Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "ebpf/handler/AbstractHandler.h"
+
+#include "collection_pipeline/queue/ProcessQueueItem.h"
+#include "collection_pipeline/queue/ProcessQueueManager.h"
+#include "common/Flags.h"
+#include "logger/Logger.h"
+
+DEFINE_FLAG_INT32(ebpf_event_ring_size,
+                  "max items buffered by each ebpf handler before consumed, i.e. events for security plugins and "
+                  "batches for network observer",
+                  8192);
+DEFINE_FLAG_INT32(ebpf_event_group_size, "max events in one group assembled from ebpf security events", 1024);
+
+namespace logtail {
+namespace ebpf {
+
+static const size_t kMaxTagKeys = 1024;
+
+bool AbstractHandler::IsValidToPush() const {
+    return mCtx != nullptr && ProcessQueueManager::GetInstance()->IsValidToPush(mQueueKey);
+}
+
+void AbstractHandler::PushGroup(PipelineEventGroup&& group, size_t eventCnt) {
+    auto item = std::make_unique<ProcessQueueItem>(std::move(group), mPluginIdx);
+    if (ProcessQueueManager::GetInstance()->PushQueue(mQueueKey, std::move(item)) != QueueStatus::OK) {
+        mDroppedCnt += eventCnt;
+        LOG_WARNING(sLogger,
+                    ("configName", mCtx ? mCtx->GetConfigName() : "")("pluginIdx", mPluginIdx)("push queue failed",
+                                                                                               eventCnt));
+    }
+}
+
+StringView AbstractHandler::InternTagKey(const std::string& key, SourceBuffer& sourceBuffer) {
+    auto it = mTagKeys.find(key);
+    if (it != mTagKeys.end()) {
+        return StringView(*it);
+    }
+    if (mTagKeys.size() < kMaxTagKeys) {
+        // elements of unordered_set never move
+        return StringView(*mTagKeys.insert(key).first);
+    }
+    return CopyValue(key, sourceBuffer);
+}
+
+} // namespace ebpf
+} // namespace logtail
@@ -14,34 +14,66 @@
 
 #pragma once
 
+#include <atomic>
 #include <mutex>
+#include <string>
+#include <unordered_set>
 
 #include "collection_pipeline/CollectionPipelineContext.h"
+#include "models/PipelineEventGroup.h"
+#include "models/StringView.h"
 #include "monitor/MetricManager.h"
 #include "monitor/metric_models/MetricTypes.h"
 
 namespace logtail {
 namespace ebpf {
 
+// Callbacks of eBPF plugins only buffer events into the ring of the handler, and groups are assembled and pushed into
+// the process queue by ConsumeEvents on the consumer thread of eBPFServer. Events are left in the ring while the
+// process queue is not valid to push, and those not buffered because the ring is full are counted as dropped.
 class AbstractHandler {
 public:
     AbstractHandler() {}
     AbstractHandler(const logtail::CollectionPipelineContext* ctx, logtail::QueueKey key, uint32_t idx)
         : mCtx(ctx), mQueueKey(key), mPluginIdx(idx) {}
+    virtual ~AbstractHandler() = default;
+
     void UpdateContext(const logtail::CollectionPipelineContext* ctx, logtail::QueueKey key, uint32_t index) {
         mCtx = ctx;
         mQueueKey = key;
         mPluginIdx = index;
     }
 
+    // must be called by one thread at a time
+    virtual void ConsumeEvents() = 0;
+
+    // events dropped since last fetch
+    uint64_t FetchDroppedCnt() { return mDroppedCnt.exchange(0); }
+
 protected:
+    bool IsValidToPush() const;
+    void PushGroup(PipelineEventGroup&& group, size_t eventCnt);
+    // Tag keys of eBPF events are of a fixed schema, so they are kept by the handler once rather than copied into the
+    // source buffer of each group. Keys beyond the limit are copied into sourceBuffer instead.
+    StringView InternTagKey(const std::string& key, SourceBuffer& sourceBuffer);
+    StringView CopyValue(const std::string& value, SourceBuffer& sourceBuffer) {
+        auto sb = sourceBuffer.CopyString(value);
+        return StringView(sb.data, sb.size);
+    }
+
     const logtail::CollectionPipelineContext* mCtx = nullptr;
     logtail::QueueKey mQueueKey = 0;
     uint64_t mProcessTotalCnt = 0;
     uint32_t mPluginIdx = 0;
+    std::atomic_uint64_t mDroppedCnt = 0;
+
+private:
+    // only accessed by the consumer
+    std::unordered_set<std::string> mTagKeys;
 
 #ifdef APSARA_UNIT_TEST_MAIN
     friend class eBPFServerUnittest;
+    friend class EventRingUnittest;
 #endif
 };
 
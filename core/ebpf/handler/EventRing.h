@@ -0,0 +1,101 @@
+// Copyright 2025 iLogtail Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include <atomic>
+#include <memory>
+
+namespace logtail {
+namespace ebpf {
+
+// Bounded lock-free ring with multiple producers and a single consumer, i.e. the bounded queue of Dmitry Vyukov with
+// the consumer side simplified. Each slot carries a sequence telling whether it is ready to be written or read, so
+// producers only contend on the tail with a CAS and never wait for each other. Pushing to a full ring fails at once,
+// leaving the item to the caller, so that eBPF pollers are never blocked by the consumer.
+template <typename T>
+class EventRing {
+public:
+    // capacity is rounded up to a power of 2
+    explicit EventRing(size_t capacity) {
+        size_t size = 2;
+        while (size < capacity) {
+            size <<= 1;
+        }
+        mMask = size - 1;
+        mSlots.reset(new Slot[size]);
+        for (size_t i = 0; i < size; ++i) {
+            mSlots[i].mSeq.store(i, std::memory_order_relaxed);
+        }
+    }
+    EventRing(const EventRing&) = delete;
+    EventRing& operator=(const EventRing&) = delete;
+
+    // thread safe, and item is moved only on success
+    bool TryPush(T&& item) {
+        size_t pos = mTail.load(std::memory_order_relaxed);
+        Slot* slot = nullptr;
+        while (true) {
+            slot = &mSlots[pos & mMask];
+            size_t seq = slot->mSeq.load(std::memory_order_acquire);
+            auto diff = static_cast<intptr_t>(seq) - static_cast<intptr_t>(pos);
+            if (diff == 0) {
+                if (mTail.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    break;
+                }
+            } else if (diff < 0) {
+                // the slot is not consumed yet since the last round
+                return false;
+            } else {
+                pos = mTail.load(std::memory_order_relaxed);
+            }
+        }
+        slot->mItem = std::move(item);
+        slot->mSeq.store(pos + 1, std::memory_order_release);
+        return true;
+    }
+
+    // must be called by one thread at a time
+    bool TryPop(T& item) {
+        Slot& slot = mSlots[mHead & mMask];
+        if (slot.mSeq.load(std::memory_order_acquire) != mHead + 1) {
+            return false;
+        }
+        item = std::move(slot.mItem);
+        slot.mItem = T();
+        slot.mSeq.store(mHead + mMask + 1, std::memory_order_release);
+        ++mHead;
+        return true;
+    }
+
+    size_t Capacity() const { return mMask + 1; }
+
+private:
+    struct Slot {
+        std::atomic<size_t> mSeq{0};
+        T mItem;
+    };
+
+    std::unique_ptr<Slot[]> mSlots;
+    size_t mMask = 0;
+    // producers and the consumer are kept on different cache lines
+    alignas(64) std::atomic<size_t> mTail{0};
+    alignas(64) size_t mHead = 0;
+};
+
+} // namespace ebpf
+} // namespace logtail
@@ -19,8 +19,7 @@
 #include <thread>
 
 #include "collection_pipeline/CollectionPipelineContext.h"
-#include "collection_pipeline/queue/ProcessQueueItem.h"
-#include "collection_pipeline/queue/ProcessQueueManager.h"
+#include "common/Flags.h"
 #include "common/RuntimeUtil.h"
 #include "ebpf/SourceManager.h"
 #include "logger/Logger.h"
@@ -28,6 +27,8 @@
 #include "models/PipelineEventGroup.h"
 #include "models/SpanEvent.h"
 
+DECLARE_FLAG_INT32(ebpf_event_ring_size);
+
 namespace logtail {
 namespace ebpf {
 
@@ -64,106 +65,149 @@ namespace ebpf {
         event->SetValue(UntypedSingleValue{(double)inner->FIELD_NAME}); \
     }
 
-void OtelMeterHandler::handle(const std::vector<std::unique_ptr<ApplicationBatchMeasure>>& measures,
-                              uint64_t timestamp) {
-    if (measures.empty()) {
-        return;
-    }
-    for (const auto& appBatchMeasures : measures) {
-        PipelineEventGroup eventGroup(std::make_shared<SourceBuffer>());
-        for (const auto& measure : appBatchMeasures->measures_) {
-            auto type = measure->type_;
-            if (type == MeasureType::MEASURE_TYPE_APP) {
-                auto* inner = static_cast<AppSingleMeasure*>(measure->inner_measure_.get());
-                auto* event = eventGroup.AddMetricEvent();
-                for (const auto& tag : measure->tags_) {
-                    event->SetTag(tag.first, tag.second);
-                }
-                event->SetName("service_requests_total");
-                event->SetTimestamp(timestamp);
-                event->SetValue(UntypedSingleValue{(double)inner->request_total_});
-            }
-            mProcessTotalCnt++;
+MeterHandler::MeterHandler(const logtail::CollectionPipelineContext* ctx, QueueKey key, uint32_t idx)
+    : AbstractHandler(ctx, key, idx), mRing(INT32_FLAG(ebpf_event_ring_size)) {
+}
+
+void MeterHandler::handle(std::vector<std::unique_ptr<ApplicationBatchMeasure>>& measures, uint64_t timestamp) {
+    for (auto& appBatchMeasures : measures) {
+        if (!appBatchMeasures) {
+            continue;
         }
-#ifdef APSARA_UNIT_TEST_MAIN
-        continue;
-#endif
-        std::unique_ptr<ProcessQueueItem> item = std::make_unique<ProcessQueueItem>(std::move(eventGroup), mPluginIdx);
-        if (ProcessQueueManager::GetInstance()->PushQueue(mQueueKey, std::move(item)) != QueueStatus::OK) {
-            LOG_WARNING(sLogger,
-                        ("configName", mCtx->GetConfigName())("pluginIdx",
-                                                              mPluginIdx)("[Otel Metrics] push queue failed!", ""));
+        size_t cnt = appBatchMeasures->measures_.size();
+        auto item = std::make_pair(std::move(appBatchMeasures), timestamp);
+        if (!mRing.TryPush(std::move(item))) {
+            mDroppedCnt += cnt;
         }
+        mProcessTotalCnt += cnt;
     }
 }
 
-void OtelSpanHandler::handle(const std::vector<std::unique_ptr<ApplicationBatchSpan>>& spans) {
-    if (spans.empty()) {
-        return;
+void MeterHandler::ConsumeEvents() {
+    std::pair<std::unique_ptr<ApplicationBatchMeasure>, uint64_t> item;
+    while (IsValidToPush() && mRing.TryPop(item)) {
+        PipelineEventGroup eventGroup(std::make_shared<SourceBuffer>());
+        BuildGroup(*item.first, item.second, eventGroup);
+        if (eventGroup.GetEvents().empty()) {
+            continue;
+        }
+        size_t cnt = eventGroup.GetEvents().size();
+        PushGroup(std::move(eventGroup), cnt);
     }
-    for (const auto& span : spans) {
-        std::shared_ptr<SourceBuffer> sourceBuffer = std::make_shared<SourceBuffer>();
-        PipelineEventGroup eventGroup(sourceBuffer);
-        for (const auto& x : span->single_spans_) {
-            auto* spanEvent = eventGroup.AddSpanEvent();
-            for (const auto& tag : x->tags_) {
-                spanEvent->SetTag(tag.first, tag.second);
+}
+
+void OtelMeterHandler::BuildGroup(const ApplicationBatchMeasure& measures,
+                                  uint64_t timestamp,
+                                  PipelineEventGroup& group) {
+    auto& sourceBuffer = *group.GetSourceBuffer();
+    for (const auto& measure : measures.measures_) {
+        auto type = measure->type_;
+        if (type == MeasureType::MEASURE_TYPE_APP) {
+            auto* inner = static_cast<AppSingleMeasure*>(measure->inner_measure_.get());
+            auto* event = group.AddMetricEvent();
+            for (const auto& tag : measure->tags_) {
+                event->SetTagNoCopy(InternTagKey(tag.first, sourceBuffer), CopyValue(tag.second, sourceBuffer));
             }
-            spanEvent->SetName(x->span_name_);
-            spanEvent->SetKind(static_cast<SpanEvent::Kind>(x->span_kind_));
-            spanEvent->SetStartTimeNs(x->start_timestamp_);
-            spanEvent->SetEndTimeNs(x->end_timestamp_);
-            spanEvent->SetTraceId(x->trace_id_);
-            spanEvent->SetSpanId(x->span_id_);
-            mProcessTotalCnt++;
+            event->SetName("service_requests_total");
+            event->SetTimestamp(timestamp);
+            event->SetValue(UntypedSingleValue{(double)inner->request_total_});
         }
-#ifdef APSARA_UNIT_TEST_MAIN
-        continue;
-#endif
-        std::unique_ptr<ProcessQueueItem> item = std::make_unique<ProcessQueueItem>(std::move(eventGroup), mPluginIdx);
-        if (ProcessQueueManager::GetInstance()->PushQueue(mQueueKey, std::move(item)) != QueueStatus::OK) {
-            LOG_WARNING(
-                sLogger,
-                ("configName", mCtx->GetConfigName())("pluginIdx", mPluginIdx)("[Span] push queue failed!", ""));
+    }
+}
+
+SpanHandler::SpanHandler(const logtail::CollectionPipelineContext* ctx, QueueKey key, uint32_t idx)
+    : AbstractHandler(ctx, key, idx), mRing(INT32_FLAG(ebpf_event_ring_size)) {
+}
+
+void SpanHandler::handle(std::vector<std::unique_ptr<ApplicationBatchSpan>>& spans) {
+    for (auto& span : spans) {
+        if (!span) {
+            continue;
+        }
+        size_t cnt = span->single_spans_.size();
+        if (!mRing.TryPush(std::move(span))) {
+            mDroppedCnt += cnt;
         }
+        mProcessTotalCnt += cnt;
     }
 }
 
-void EventHandler::handle(const std::vector<std::unique_ptr<ApplicationBatchEvent>>& events) {
-    if (events.empty()) {
-        return;
+void SpanHandler::ConsumeEvents() {
+    std::unique_ptr<ApplicationBatchSpan> span;
+    while (IsValidToPush() && mRing.TryPop(span)) {
+        PipelineEventGroup eventGroup(std::make_shared<SourceBuffer>());
+        BuildGroup(*span, eventGroup);
+        if (eventGroup.GetEvents().empty()) {
+            continue;
+        }
+        size_t cnt = eventGroup.GetEvents().size();
+        PushGroup(std::move(eventGroup), cnt);
     }
-    for (const auto& appEvents : events) {
+}
+
+void OtelSpanHandler::BuildGroup(const ApplicationBatchSpan& spans, PipelineEventGroup& group) {
+    auto& sourceBuffer = *group.GetSourceBuffer();
+    for (const auto& x : spans.single_spans_) {
+        auto* spanEvent = group.AddSpanEvent();
+        for (const auto& tag : x->tags_) {
+            spanEvent->SetTagNoCopy(InternTagKey(tag.first, sourceBuffer), CopyValue(tag.second, sourceBuffer));
+        }
+        spanEvent->SetName(x->span_name_);
+        spanEvent->SetKind(static_cast<SpanEvent::Kind>(x->span_kind_));
+        spanEvent->SetStartTimeNs(x->start_timestamp_);
+        spanEvent->SetEndTimeNs(x->end_timestamp_);
+        spanEvent->SetTraceId(x->trace_id_);
+        spanEvent->SetSpanId(x->span_id_);
+    }
+}
+
+EventHandler::EventHandler(const logtail::CollectionPipelineContext* ctx, QueueKey key, uint32_t idx)
+    : AbstractHandler(ctx, key, idx), mRing(INT32_FLAG(ebpf_event_ring_size)) {
+}
+
+void EventHandler::handle(std::vector<std::unique_ptr<ApplicationBatchEvent>>& events) {
+    for (auto& appEvents : events) {
         if (!appEvents || appEvents->events_.empty()) {
             continue;
         }
-        std::shared_ptr<SourceBuffer> sourceBuffer = std::make_shared<SourceBuffer>();
-        PipelineEventGroup eventGroup(sourceBuffer);
+        size_t cnt = 0;
+        for (const auto& event : appEvents->events_) {
+            if (event && !event->GetAllTags().empty()) {
+                ++cnt;
+            }
+        }
+        if (!mRing.TryPush(std::move(appEvents))) {
+            mDroppedCnt += cnt;
+        }
+        mProcessTotalCnt += cnt;
+    }
+}
+
+void EventHandler::ConsumeEvents() {
+    std::unique_ptr<ApplicationBatchEvent> appEvents;
+    while (IsValidToPush() && mRing.TryPop(appEvents)) {
+        PipelineEventGroup eventGroup(std::make_shared<SourceBuffer>());
+        auto& sourceBuffer = *eventGroup.GetSourceBuffer();
         for (const auto& event : appEvents->events_) {
             if (!event || event->GetAllTags().empty()) {
                 continue;
             }
             auto* logEvent = eventGroup.AddLogEvent();
             for (const auto& tag : event->GetAllTags()) {
-                logEvent->SetContent(tag.first, tag.second);
-                auto seconds
-                    = std::chrono::duration_cast<std::chrono::seconds>(std::chrono::nanoseconds(event->GetTimestamp()));
-                logEvent->SetTimestamp(seconds.count(), event->GetTimestamp() - seconds.count() * 1e9);
+                logEvent->SetContentNoCopy(InternTagKey(tag.first, sourceBuffer), CopyValue(tag.second, sourceBuffer));
             }
-            mProcessTotalCnt++;
+            auto seconds
+                = std::chrono::duration_cast<std::chrono::seconds>(std::chrono::nanoseconds(event->GetTimestamp()));
+            logEvent->SetTimestamp(seconds.count(), event->GetTimestamp() - seconds.count() * 1e9);
+        }
+        if (eventGroup.GetEvents().empty()) {
+            continue;
         }
         for (const auto& tag : appEvents->tags_) {
             eventGroup.SetTag(tag.first, tag.second);
         }
-#ifdef APSARA_UNIT_TEST_MAIN
-        continue;
-#endif
-        std::unique_ptr<ProcessQueueItem> item = std::make_unique<ProcessQueueItem>(std::move(eventGroup), mPluginIdx);
-        if (ProcessQueueManager::GetInstance()->PushQueue(mQueueKey, std::move(item)) != QueueStatus::OK) {
-            LOG_WARNING(
-                sLogger,
-                ("configName", mCtx->GetConfigName())("pluginIdx", mPluginIdx)("[Event] push queue failed!", ""));
-        }
+        size_t cnt = eventGroup.GetEvents().size();
+        PushGroup(std::move(eventGroup), cnt);
     }
 }
 
@@ -251,80 +295,44 @@ GENERATE_METRICS(GenerateTcpSendBytesTotalMetrics,
                  npm_send_byte_total,
                  send_byte_total_)
 
-void ArmsSpanHandler::handle(const std::vector<std::unique_ptr<ApplicationBatchSpan>>& spans) {
-    if (spans.empty()) {
-        return;
-    }
-    for (const auto& span : spans) {
-        std::shared_ptr<SourceBuffer> sourceBuffer = std::make_shared<SourceBuffer>();
-        PipelineEventGroup eventGroup(sourceBuffer);
-        eventGroup.SetTag(app_id_key, span->app_id_);
-        for (const auto& x : span->single_spans_) {
-            auto* spanEvent = eventGroup.AddSpanEvent();
-            for (const auto& tag : x->tags_) {
-                spanEvent->SetTag(tag.first, tag.second);
-            }
-            spanEvent->SetName(x->span_name_);
-            spanEvent->SetKind(static_cast<SpanEvent::Kind>(x->span_kind_));
-            spanEvent->SetStartTimeNs(x->start_timestamp_);
-            spanEvent->SetEndTimeNs(x->end_timestamp_);
-            spanEvent->SetTraceId(x->trace_id_);
-            spanEvent->SetSpanId(x->span_id_);
-            mProcessTotalCnt++;
-        }
-#ifdef APSARA_UNIT_TEST_MAIN
-        continue;
-#endif
-        std::unique_ptr<ProcessQueueItem> item = std::make_unique<ProcessQueueItem>(std::move(eventGroup), mPluginIdx);
-        if (ProcessQueueManager::GetInstance()->PushQueue(mQueueKey, std::move(item)) != QueueStatus::OK) {
-            LOG_WARNING(
-                sLogger,
-                ("configName", mCtx->GetConfigName())("pluginIdx", mPluginIdx)("[Span] push queue failed!", ""));
+void ArmsSpanHandler::BuildGroup(const ApplicationBatchSpan& spans, PipelineEventGroup& group) {
+    group.SetTag(app_id_key, spans.app_id_);
+    for (const auto& x : spans.single_spans_) {
+        auto* spanEvent = group.AddSpanEvent();
+        for (const auto& tag : x->tags_) {
+            spanEvent->SetTag(tag.first, tag.second);
         }
+        spanEvent->SetName(x->span_name_);
+        spanEvent->SetKind(static_cast<SpanEvent::Kind>(x->span_kind_));
+        spanEvent->SetStartTimeNs(x->start_timestamp_);
+        spanEvent->SetEndTimeNs(x->end_timestamp_);
+        spanEvent->SetTraceId(x->trace_id_);
+        spanEvent->SetSpanId(x->span_id_);
     }
 }
 
-void ArmsMeterHandler::handle(const std::vector<std::unique_ptr<ApplicationBatchMeasure>>& measures,
-                              uint64_t timestamp) {
-    if (measures.empty()) {
-        return;
-    }
-    for (const auto& appBatchMeasures : measures) {
-        std::shared_ptr<SourceBuffer> sourceBuffer = std::make_shared<SourceBuffer>();
-        ;
-        PipelineEventGroup eventGroup(sourceBuffer);
-
-        // source_ip
-        eventGroup.SetTag(std::string(app_id_key), appBatchMeasures->app_id_);
-        eventGroup.SetTag(std::string(ip_key), appBatchMeasures->ip_);
-        for (const auto& measure : appBatchMeasures->measures_) {
-            auto type = measure->type_;
-            if (type == MeasureType::MEASURE_TYPE_APP) {
-                GenerateRequestsTotalMetrics(eventGroup, measure, timestamp);
-                GenerateRequestsSlowMetrics(eventGroup, measure, timestamp);
-                GenerateRequestsErrorMetrics(eventGroup, measure, timestamp);
-                GenerateRequestsDurationSumMetrics(eventGroup, measure, timestamp);
-                GenerateRequestsStatusMetrics(eventGroup, measure, timestamp);
-            } else if (type == MeasureType::MEASURE_TYPE_NET) {
-                GenerateTcpDropTotalMetrics(eventGroup, measure, timestamp);
-                GenerateTcpRetransTotalMetrics(eventGroup, measure, timestamp);
-                GenerateTcpConnectionTotalMetrics(eventGroup, measure, timestamp);
-                GenerateTcpRecvPktsTotalMetrics(eventGroup, measure, timestamp);
-                GenerateTcpRecvBytesTotalMetrics(eventGroup, measure, timestamp);
-                GenerateTcpSendPktsTotalMetrics(eventGroup, measure, timestamp);
-                GenerateTcpSendBytesTotalMetrics(eventGroup, measure, timestamp);
-            }
-            mProcessTotalCnt++;
-        }
-
-#ifdef APSARA_UNIT_TEST_MAIN
-        continue;
-#endif
-        std::unique_ptr<ProcessQueueItem> item = std::make_unique<ProcessQueueItem>(std::move(eventGroup), mPluginIdx);
-        if (ProcessQueueManager::GetInstance()->PushQueue(mQueueKey, std::move(item)) != QueueStatus::OK) {
-            LOG_WARNING(
-                sLogger,
-                ("configName", mCtx->GetConfigName())("pluginIdx", mPluginIdx)("[Metrics] push queue failed!", ""));
+void ArmsMeterHandler::BuildGroup(const ApplicationBatchMeasure& measures,
+                                  uint64_t timestamp,
+                                  PipelineEventGroup& group) {
+    // source_ip
+    group.SetTag(std::string(app_id_key), measures.app_id_);
+    group.SetTag(std::string(ip_key), measures.ip_);
+    for (const auto& measure : measures.measures_) {
+        auto type = measure->type_;
+        if (type == MeasureType::MEASURE_TYPE_APP) {
+            GenerateRequestsTotalMetrics(group, measure, timestamp);
+            GenerateRequestsSlowMetrics(group, measure, timestamp);
+            GenerateRequestsErrorMetrics(group, measure, timestamp);
+            GenerateRequestsDurationSumMetrics(group, measure, timestamp);
+            GenerateRequestsStatusMetrics(group, measure, timestamp);
+        } else if (type == MeasureType::MEASURE_TYPE_NET) {
+            GenerateTcpDropTotalMetrics(group, measure, timestamp);
+            GenerateTcpRetransTotalMetrics(group, measure, timestamp);
+            GenerateTcpConnectionTotalMetrics(group, measure, timestamp);
+            GenerateTcpRecvPktsTotalMetrics(group, measure, timestamp);
+            GenerateTcpRecvBytesTotalMetrics(group, measure, timestamp);
+            GenerateTcpSendPktsTotalMetrics(group, measure, timestamp);
+            GenerateTcpSendBytesTotalMetrics(group, measure, timestamp);
         }
     }
 }
@@ -14,48 +14,74 @@
 
 #pragma once
 
+#include <memory>
+#include <utility>
 #include <vector>
 
 #include "ebpf/handler/AbstractHandler.h"
+#include "ebpf/handler/EventRing.h"
 #include "ebpf/include/export.h"
 
 namespace logtail {
 namespace ebpf {
 
+// Batches are moved into the ring by handle, and each batch is assembled into one group by ConsumeEvents.
 class MeterHandler : public AbstractHandler {
 public:
-    MeterHandler(const logtail::CollectionPipelineContext* ctx, QueueKey key, uint32_t idx)
-        : AbstractHandler(ctx, key, idx) {}
+    MeterHandler(const logtail::CollectionPipelineContext* ctx, QueueKey key, uint32_t idx);
 
-    virtual void handle(const std::vector<std::unique_ptr<ApplicationBatchMeasure>>&, uint64_t) = 0;
+    void handle(std::vector<std::unique_ptr<ApplicationBatchMeasure>>& measures, uint64_t timestamp);
+    void ConsumeEvents() override;
+
+protected:
+    virtual void
+    BuildGroup(const ApplicationBatchMeasure& measures, uint64_t timestamp, PipelineEventGroup& group) = 0;
+
+private:
+    EventRing<std::pair<std::unique_ptr<ApplicationBatchMeasure>, uint64_t>> mRing;
 };
 
 class OtelMeterHandler : public MeterHandler {
 public:
     OtelMeterHandler(const logtail::CollectionPipelineContext* ctx, QueueKey key, uint32_t idx)
         : MeterHandler(ctx, key, idx) {}
-    void handle(const std::vector<std::unique_ptr<ApplicationBatchMeasure>>& measures, uint64_t timestamp) override;
+
+protected:
+    void BuildGroup(const ApplicationBatchMeasure& measures, uint64_t timestamp, PipelineEventGroup& group) override;
 };
 
 class SpanHandler : public AbstractHandler {
 public:
-    SpanHandler(const logtail::CollectionPipelineContext* ctx, QueueKey key, uint32_t idx)
-        : AbstractHandler(ctx, key, idx) {}
-    virtual void handle(const std::vector<std::unique_ptr<ApplicationBatchSpan>>&) = 0;
+    SpanHandler(const logtail::CollectionPipelineContext* ctx, QueueKey key, uint32_t idx);
+
+    void handle(std::vector<std::unique_ptr<ApplicationBatchSpan>>& spans);
+    void ConsumeEvents() override;
+
+protected:
+    virtual void BuildGroup(const ApplicationBatchSpan& spans, PipelineEventGroup& group) = 0;
+
+private:
+    EventRing<std::unique_ptr<ApplicationBatchSpan>> mRing;
 };
 
 class OtelSpanHandler : public SpanHandler {
 public:
     OtelSpanHandler(const logtail::CollectionPipelineContext* ctx, QueueKey key, uint32_t idx)
         : SpanHandler(ctx, key, idx) {}
-    void handle(const std::vector<std::unique_ptr<ApplicationBatchSpan>>&) override;
+
+protected:
+    void BuildGroup(const ApplicationBatchSpan& spans, PipelineEventGroup& group) override;
 };
 
 class EventHandler : public AbstractHandler {
 public:
-    EventHandler(const logtail::CollectionPipelineContext* ctx, QueueKey key, uint32_t idx)
-        : AbstractHandler(ctx, key, idx) {}
-    void handle(const std::vector<std::unique_ptr<ApplicationBatchEvent>>&);
+    EventHandler(const logtail::CollectionPipelineContext* ctx, QueueKey key, uint32_t idx);
+
+    void handle(std::vector<std::unique_ptr<ApplicationBatchEvent>>& events);
+    void ConsumeEvents() override;
+
+private:
+    EventRing<std::unique_ptr<ApplicationBatchEvent>> mRing;
 };
 
 #ifdef __ENTERPRISE__
@@ -64,14 +90,18 @@ class ArmsMeterHandler : public MeterHandler {
 public:
     ArmsMeterHandler(const logtail::CollectionPipelineContext* ctx, QueueKey key, uint32_t idx)
         : MeterHandler(ctx, key, idx) {}
-    void handle(const std::vector<std::unique_ptr<ApplicationBatchMeasure>>& measures, uint64_t timestamp) override;
+
+protected:
+    void BuildGroup(const ApplicationBatchMeasure& measures, uint64_t timestamp, PipelineEventGroup& group) override;
 };
 
 class ArmsSpanHandler : public SpanHandler {
 public:
     ArmsSpanHandler(const logtail::CollectionPipelineContext* ctx, QueueKey key, uint32_t idx)
         : SpanHandler(ctx, key, idx) {}
-    void handle(const std::vector<std::unique_ptr<ApplicationBatchSpan>>&) override;
+
+protected:
+    void BuildGroup(const ApplicationBatchSpan& spans, PipelineEventGroup& group) override;
 };
 
 #endif
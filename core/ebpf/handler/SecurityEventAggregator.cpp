@@ -0,0 +1,157 @@
+// Copyright 2025 iLogtail Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "ebpf/handler/SecurityEventAggregator.h"
+
+#include <cstring>
+
+#include <algorithm>
+#include <functional>
+#include <string_view>
+
+#include "common/StringTools.h"
+#include "models/LogEvent.h"
+
+using namespace std;
+
+namespace logtail {
+namespace ebpf {
+
+const string SecurityEventAggregator::kEventCountKey = "event_count";
+const string SecurityEventAggregator::kFirstEventTimeKey = "first_event_time";
+const string SecurityEventAggregator::kLastEventTimeKey = "last_event_time";
+
+namespace {
+
+// length of a missing tag, which is distinguished from an empty one
+constexpr uint32_t kMissingTag = UINT32_MAX;
+
+void AppendKeyPart(string& key, const char* data, uint32_t len) {
+    key.append(reinterpret_cast<const char*>(&len), sizeof(len));
+    if (len != kMissingTag) {
+        key.append(data, len);
+    }
+}
+
+} // namespace
+
+SecurityEventAggregator::SecurityEventAggregator(const SecurityAggregateOption& option, size_t maxEntries)
+    : mOption(option), mMaxEntries(max<size_t>(maxEntries, 1)) {
+    // load factor of the table is kept under 0.5
+    size_t capacity = 16;
+    while (capacity < mMaxEntries * 2) {
+        capacity <<= 1;
+    }
+    mSlots.resize(capacity, 0);
+    mSlotMask = capacity - 1;
+    mEntries.reserve(mMaxEntries);
+    Reset();
+}
+
+void SecurityEventAggregator::Add(const AbstractSecurityEvent& event) {
+    const auto& tags = event.GetAllTags();
+    BuildKey(tags);
+    size_t hash = std::hash<string_view>()(string_view(mKeyBuffer));
+    uint64_t timestamp = event.GetTimestamp();
+    for (size_t i = hash & mSlotMask;; i = (i + 1) & mSlotMask) {
+        if (mSlots[i] == 0) {
+            if (mEntries.empty()) {
+                mWindowStart = chrono::steady_clock::now();
+            }
+            Entry entry;
+            entry.mKey = CopyString(mKeyBuffer);
+            entry.mHash = hash;
+            entry.mTagBegin = mTags.size();
+            for (const auto& tag : tags) {
+                mTags.emplace_back(CopyString(tag.first), CopyString(tag.second));
+            }
+            entry.mTagEnd = mTags.size();
+            entry.mCount = 1;
+            entry.mFirstTime = timestamp;
+            entry.mLastTime = timestamp;
+            mEntries.emplace_back(entry);
+            mSlots[i] = static_cast<uint32_t>(mEntries.size());
+            return;
+        }
+        auto& entry = mEntries[mSlots[i] - 1];
+        if (entry.mHash == hash && entry.mKey == StringView(mKeyBuffer)) {
+            ++entry.mCount;
+            // events from different cpus are not strictly ordered
+            entry.mFirstTime = min(entry.mFirstTime, timestamp);
+            entry.mLastTime = max(entry.mLastTime, timestamp);
+            return;
+        }
+    }
+}
+
+bool SecurityEventAggregator::ShouldFlush(chrono::steady_clock::time_point now) const {
+    return !mEntries.empty() && now - mWindowStart >= chrono::seconds(mOption.mWindowSecs);
+}
+
+void SecurityEventAggregator::Flush(vector<PipelineEventGroup>& groups, size_t groupSize) {
+    groupSize = max<size_t>(groupSize, 1);
+    for (size_t i = 0; i < mEntries.size(); ++i) {
+        if (i % groupSize == 0) {
+            groups.emplace_back(make_shared<SourceBuffer>());
+        }
+        const auto& entry = mEntries[i];
+        auto* event = groups.back().AddLogEvent();
+        for (size_t j = entry.mTagBegin; j < entry.mTagEnd; ++j) {
+            event->SetContent(mTags[j].first, mTags[j].second);
+        }
+        event->SetContent(kEventCountKey, ToString(entry.mCount));
+        event->SetContent(kFirstEventTimeKey, ToString(entry.mFirstTime));
+        event->SetContent(kLastEventTimeKey, ToString(entry.mLastTime));
+        event->SetTimestamp(static_cast<time_t>(entry.mFirstTime / 1000000000),
+                            static_cast<uint32_t>(entry.mFirstTime % 1000000000));
+    }
+    Reset();
+}
+
+void SecurityEventAggregator::BuildKey(const vector<pair<string, string>>& tags) {
+    mKeyBuffer.clear();
+    if (mOption.mKeys.empty()) {
+        for (const auto& tag : tags) {
+            AppendKeyPart(mKeyBuffer, tag.first.data(), static_cast<uint32_t>(tag.first.size()));
+            AppendKeyPart(mKeyBuffer, tag.second.data(), static_cast<uint32_t>(tag.second.size()));
+        }
+        return;
+    }
+    // few tags in an event, so linear search is faster than building an index
+    for (const auto& key : mOption.mKeys) {
+        auto it
+            = find_if(tags.begin(), tags.end(), [&key](const pair<string, string>& tag) { return tag.first == key; });
+        if (it == tags.end()) {
+            AppendKeyPart(mKeyBuffer, nullptr, kMissingTag);
+        } else {
+            AppendKeyPart(mKeyBuffer, it->second.data(), static_cast<uint32_t>(it->second.size()));
+        }
+    }
+}
+
+StringView SecurityEventAggregator::CopyString(const string& s) {
+    StringBuffer sb = mArena->CopyString(s);
+    return StringView(sb.data, sb.size);
+}
+
+void SecurityEventAggregator::Reset() {
+    // release the strings of the last window, which have been copied into the flushed groups
+    mArena = make_shared<SourceBuffer>();
+    mEntries.clear();
+    mTags.clear();
+    fill(mSlots.begin(), mSlots.end(), 0);
+}
+
+} // namespace ebpf
+} // namespace logtail
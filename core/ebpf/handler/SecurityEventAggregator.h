@@ -0,0 +1,92 @@
+// Copyright 2025 iLogtail Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "common/memory/SourceBuffer.h"
+#include "ebpf/Config.h"
+#include "ebpf/include/export.h"
+#include "models/PipelineEventGroup.h"
+#include "models/StringView.h"
+
+namespace logtail {
+namespace ebpf {
+
+// Rolls up security events with the same key within a window into one log event, which has the tags of the first
+// event, the number of events, and the timestamps of the first and the last event. The key is made of the values of
+// the configured tags, or of all tags if none is configured.
+//
+// Strings of a window are allocated from one source buffer, and copied into the source buffer of each event group when
+// the window is flushed, since groups may be processed by different threads. Entries are kept in flat vectors indexed
+// by an open addressing table, whose capacity is reserved once for the max entries.
+class SecurityEventAggregator {
+public:
+    static const std::string kEventCountKey;
+    static const std::string kFirstEventTimeKey;
+    static const std::string kLastEventTimeKey;
+
+    SecurityEventAggregator(const SecurityAggregateOption& option, size_t maxEntries);
+
+    // should not be called when IsFull()
+    void Add(const AbstractSecurityEvent& event);
+    bool IsFull() const { return mEntries.size() >= mMaxEntries; }
+    bool Empty() const { return mEntries.empty(); }
+    // true if the window started before now - window secs
+    bool ShouldFlush(std::chrono::steady_clock::time_point now) const;
+    // aggregated events are appended to groups, each of which has at most groupSize events, and a new window starts
+    void Flush(std::vector<PipelineEventGroup>& groups, size_t groupSize);
+
+    const SecurityAggregateOption& GetOption() const { return mOption; }
+
+private:
+    struct Entry {
+        StringView mKey;
+        size_t mHash = 0;
+        size_t mTagBegin = 0;
+        size_t mTagEnd = 0;
+        uint64_t mCount = 0;
+        uint64_t mFirstTime = 0;
+        uint64_t mLastTime = 0;
+    };
+
+    void BuildKey(const std::vector<std::pair<std::string, std::string>>& tags);
+    StringView CopyString(const std::string& s);
+    void Reset();
+
+    SecurityAggregateOption mOption;
+    size_t mMaxEntries = 0;
+
+    std::shared_ptr<SourceBuffer> mArena;
+    std::vector<Entry> mEntries;
+    std::vector<std::pair<StringView, StringView>> mTags;
+    // index of entry + 1, or 0 for empty slot
+    std::vector<uint32_t> mSlots;
+    size_t mSlotMask = 0;
+    std::string mKeyBuffer;
+    std::chrono::steady_clock::time_point mWindowStart;
+
+#ifdef APSARA_UNIT_TEST_MAIN
+    friend class SecurityEventAggregatorUnittest;
+#endif
+};
+
+} // namespace ebpf
+} // namespace logtail
@@ -14,9 +14,10 @@
 
 #include "ebpf/handler/SecurityHandler.h"
 
+#include <algorithm>
+
 #include "collection_pipeline/CollectionPipelineContext.h"
-#include "collection_pipeline/queue/ProcessQueueItem.h"
-#include "collection_pipeline/queue/ProcessQueueManager.h"
+#include "common/Flags.h"
 #include "common/MachineInfoUtil.h"
 #include "common/RuntimeUtil.h"
 #include "ebpf/SourceManager.h"
@@ -25,11 +26,17 @@
 #include "models/PipelineEventGroup.h"
 #include "models/SpanEvent.h"
 
+DECLARE_FLAG_INT32(ebpf_event_ring_size);
+DECLARE_FLAG_INT32(ebpf_event_group_size);
+DEFINE_FLAG_INT32(ebpf_security_aggregate_max_entries,
+                  "max distinct security events aggregated in a window, which is flushed early when reached",
+                  10000);
+
 namespace logtail {
 namespace ebpf {
 
 SecurityHandler::SecurityHandler(const logtail::CollectionPipelineContext* ctx, logtail::QueueKey key, uint32_t idx)
-    : AbstractHandler(ctx, key, idx) {
+    : AbstractHandler(ctx, key, idx), mRing(INT32_FLAG(ebpf_event_ring_size)) {
     mHostName = GetHostName();
     mHostIp = GetHostIp();
 }
@@ -38,31 +45,93 @@ void SecurityHandler::handle(std::vector<std::unique_ptr<AbstractSecurityEvent>>
     if (events.empty()) {
         return;
     }
-
-    std::shared_ptr<SourceBuffer> source_buffer = std::make_shared<SourceBuffer>();
-    ;
-    PipelineEventGroup event_group(source_buffer);
-    // aggregate to pipeline event group
-    for (const auto& x : events) {
-        auto* event = event_group.AddLogEvent();
-        for (const auto& tag : x->GetAllTags()) {
-            event->SetContent(tag.first, tag.second);
+    for (auto& x : events) {
+        if (!mRing.TryPush(std::move(x))) {
+            ++mDroppedCnt;
         }
-        auto seconds = std::chrono::duration_cast<std::chrono::seconds>(std::chrono::nanoseconds(x->GetTimestamp()));
-        event->SetTimestamp(seconds.count(), x->GetTimestamp());
     }
     mProcessTotalCnt += events.size();
-#ifdef APSARA_UNIT_TEST_MAIN
-    return;
-#endif
-    std::unique_ptr<ProcessQueueItem> item
-        = std::unique_ptr<ProcessQueueItem>(new ProcessQueueItem(std::move(event_group), mPluginIdx));
+}
+
+void SecurityHandler::ConsumeEvents() {
+    std::lock_guard<std::mutex> lock(mAggregatorMux);
+    if (mAggregator) {
+        AggregateEvents();
+        return;
+    }
+    const size_t groupSize = std::max(INT32_FLAG(ebpf_event_group_size), 1);
+    std::unique_ptr<AbstractSecurityEvent> x;
+    while (IsValidToPush()) {
+        PipelineEventGroup eventGroup(std::make_shared<SourceBuffer>());
+        auto& sourceBuffer = *eventGroup.GetSourceBuffer();
+        // aggregate to pipeline event group
+        while (eventGroup.GetEvents().size() < groupSize && mRing.TryPop(x)) {
+            auto* event = eventGroup.AddLogEvent();
+            for (const auto& tag : x->GetAllTags()) {
+                event->SetContentNoCopy(InternTagKey(tag.first, sourceBuffer), CopyValue(tag.second, sourceBuffer));
+            }
+            auto seconds
+                = std::chrono::duration_cast<std::chrono::seconds>(std::chrono::nanoseconds(x->GetTimestamp()));
+            event->SetTimestamp(seconds.count(), x->GetTimestamp());
+        }
+        if (eventGroup.GetEvents().empty()) {
+            return;
+        }
+        size_t cnt = eventGroup.GetEvents().size();
+        PushGroup(std::move(eventGroup), cnt);
+    }
+}
+
+void SecurityHandler::UpdateAggregateOption(const SecurityAggregateOption& option) {
+    std::lock_guard<std::mutex> lock(mAggregatorMux);
+    if (mAggregator) {
+        FlushAggregator();
+        mAggregator.reset();
+    }
+    if (option.mWindowSecs > 0) {
+        mAggregator = std::make_unique<SecurityEventAggregator>(
+            option, std::max(INT32_FLAG(ebpf_security_aggregate_max_entries), 1));
+    }
+}
 
-    if (ProcessQueueManager::GetInstance()->PushQueue(mQueueKey, std::move(item)) != QueueStatus::OK) {
-        LOG_WARNING(
-            sLogger,
-            ("configName", mCtx->GetConfigName())("pluginIdx", mPluginIdx)("Push queue failed!", events.size()));
+void SecurityHandler::FlushAggregatedEvents() {
+    std::lock_guard<std::mutex> lock(mAggregatorMux);
+    if (mAggregator) {
+        FlushAggregator();
+    }
+}
+
+void SecurityHandler::AggregateEvents() {
+    std::unique_ptr<AbstractSecurityEvent> x;
+    while (true) {
+        // events are left in the ring when the window is full and cannot be flushed
+        if (mAggregator->IsFull() && !FlushAggregator()) {
+            return;
+        }
+        if (!mRing.TryPop(x)) {
+            break;
+        }
+        mAggregator->Add(*x);
+    }
+    if (mAggregator->ShouldFlush(std::chrono::steady_clock::now())) {
+        FlushAggregator();
+    }
+}
+
+bool SecurityHandler::FlushAggregator() {
+    if (mAggregator->Empty()) {
+        return true;
+    }
+    if (!IsValidToPush()) {
+        return false;
+    }
+    std::vector<PipelineEventGroup> groups;
+    mAggregator->Flush(groups, std::max(INT32_FLAG(ebpf_event_group_size), 1));
+    for (auto& group : groups) {
+        size_t cnt = group.GetEvents().size();
+        PushGroup(std::move(group), cnt);
     }
+    return true;
 }
 
 } // namespace ebpf
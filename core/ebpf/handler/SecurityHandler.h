@@ -14,10 +14,15 @@
 
 #pragma once
 
+#include <memory>
+#include <mutex>
 #include <string>
 #include <vector>
 
+#include "ebpf/Config.h"
 #include "ebpf/handler/AbstractHandler.h"
+#include "ebpf/handler/EventRing.h"
+#include "ebpf/handler/SecurityEventAggregator.h"
 #include "ebpf/include/export.h"
 
 namespace logtail {
@@ -26,12 +31,28 @@ namespace ebpf {
 class SecurityHandler : public AbstractHandler {
 public:
     SecurityHandler(const logtail::CollectionPipelineContext* ctx, logtail::QueueKey key, uint32_t idx);
+    // events are moved into the ring
     void handle(std::vector<std::unique_ptr<AbstractSecurityEvent>>& events);
+    void ConsumeEvents() override;
+    // events aggregated before are flushed, and aggregation is disabled if window secs is 0
+    void UpdateAggregateOption(const SecurityAggregateOption& option);
+    // flush events in the current window, e.g. before the context is changed
+    void FlushAggregatedEvents();
 
 private:
+    void AggregateEvents();
+    bool FlushAggregator();
+
+    EventRing<std::unique_ptr<AbstractSecurityEvent>> mRing;
+    std::mutex mAggregatorMux;
+    std::unique_ptr<SecurityEventAggregator> mAggregator;
     // TODO 后续这两个 key 需要移到 group 的 metadata 里，在 processortagnative 中转成tag
     std::string mHostIp;
     std::string mHostName;
+
+#ifdef APSARA_UNIT_TEST_MAIN
+    friend class SecurityEventAggregatorUnittest;
+#endif
 };
 
 } // namespace ebpf
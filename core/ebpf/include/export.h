@@ -24,9 +24,9 @@ class AbstractSecurityEvent {
 public:
     AbstractSecurityEvent(std::vector<std::pair<std::string, std::string>>&& tags, SecureEventType type, uint64_t ts)
         : tags_(tags), type_(type), timestamp_(ts) {}
-    SecureEventType GetEventType() { return type_; }
-    std::vector<std::pair<std::string, std::string>> GetAllTags() { return tags_; }
-    uint64_t GetTimestamp() { return timestamp_; }
+    SecureEventType GetEventType() const { return type_; }
+    const std::vector<std::pair<std::string, std::string>>& GetAllTags() const { return tags_; }
+    uint64_t GetTimestamp() const { return timestamp_; }
     void SetEventType(SecureEventType type) { type_ = type; }
     void SetTimestamp(uint64_t ts) { timestamp_ = ts; }
     void AppendTags(std::pair<std::string, std::string>&& tag) { tags_.emplace_back(std::move(tag)); }
@@ -139,7 +139,7 @@ public:
     explicit __attribute__((visibility("default"))) SingleEvent(std::vector<std::pair<std::string, std::string>>&& tags,
                                                                 uint64_t ts)
         : tags_(tags), timestamp_(ts) {}
-    std::vector<std::pair<std::string, std::string>> GetAllTags() { return tags_; }
+    const std::vector<std::pair<std::string, std::string>>& GetAllTags() const { return tags_; }
     uint64_t GetTimestamp() { return timestamp_; }
     void SetTimestamp(uint64_t ts) { timestamp_ = ts; }
     void AppendTags(std::pair<std::string, std::string>&& tag) { tags_.emplace_back(std::move(tag)); }
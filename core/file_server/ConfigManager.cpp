@@ -1009,20 +1009,14 @@ void ConfigManager::GetContainerStoppedEvents(std::vector<Event*>& eventVec) {
             LOG_ERROR(sLogger, ("invalid container info update param", errorMsg)("action", "ignore current cmd"));
             continue;
         }
-        std::vector<ContainerInfo>::iterator iter = config.first->GetContainerInfo()->begin();
-        std::vector<ContainerInfo>::iterator iend = config.first->GetContainerInfo()->end();
-        for (; iter != iend; ++iter) {
-            if (iter->mID == containerInfo.mID) {
-                break;
-            }
-        }
-        if (iter == iend) {
+        ContainerInfo* info = config.first->GetContainerInfoByID(containerInfo.mID);
+        if (info == nullptr) {
             continue;
         }
-        Event* pStoppedEvent = new Event(iter->mRealBaseDir, "", EVENT_ISDIR | EVENT_CONTAINER_STOPPED, -1, 0);
+        Event* pStoppedEvent = new Event(info->mRealBaseDir, "", EVENT_ISDIR | EVENT_CONTAINER_STOPPED, -1, 0);
         pStoppedEvent->SetConfigName(cmd->mConfigName);
         pStoppedEvent->SetContainerID(containerInfo.mID);
-        iter->mStopped = true;
+        info->mStopped = true;
         LOG_DEBUG(
             sLogger,
             ("GetContainerStoppedEvent Type", pStoppedEvent->GetType())("Source", pStoppedEvent->GetSource())(
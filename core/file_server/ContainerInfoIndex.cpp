@@ -0,0 +1,200 @@
+// Copyright 2025 iLogtail Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "file_server/ContainerInfoIndex.h"
+
+#include <algorithm>
+
+#include "common/FileSystemUtil.h"
+
+using namespace std;
+
+namespace logtail {
+
+void ContainerInfoIndex::Build(const vector<ContainerInfo>& infos) {
+    mRoot = Node();
+    mContainers.clear();
+    for (size_t i = 0; i < infos.size(); ++i) {
+        Slot slot{mNextSeq++, i};
+        mContainers[infos[i].mID] = slot;
+        Insert(infos[i].mRealBaseDir, slot);
+    }
+}
+
+bool ContainerInfoIndex::AddOrUpdate(vector<ContainerInfo>& infos, const ContainerInfo& info) {
+    auto it = mContainers.find(info.mID);
+    if (it == mContainers.end()) {
+        infos.push_back(info);
+        Slot slot{mNextSeq++, infos.size() - 1};
+        mContainers.emplace(info.mID, slot);
+        Insert(info.mRealBaseDir, slot);
+        return true;
+    }
+    const Slot& slot = it->second;
+    auto& old = infos[slot.mPos];
+    if (old.mRealBaseDir != info.mRealBaseDir) {
+        Remove(mRoot, old.mRealBaseDir, 0, slot.mPos);
+        Insert(info.mRealBaseDir, slot);
+    }
+    old = info;
+    return false;
+}
+
+bool ContainerInfoIndex::Delete(vector<ContainerInfo>& infos, const string& id) {
+    auto it = mContainers.find(id);
+    if (it == mContainers.end()) {
+        return false;
+    }
+    size_t pos = it->second.mPos;
+    size_t last = infos.size() - 1;
+    Remove(mRoot, infos[pos].mRealBaseDir, 0, pos);
+    if (pos != last) {
+        Node* node = FindNode(infos[last].mRealBaseDir);
+        for (auto& slot : node->mSlots) {
+            if (slot.mPos == last) {
+                slot.mPos = pos;
+            }
+        }
+        mContainers[infos[last].mID].mPos = pos;
+        infos[pos] = std::move(infos[last]);
+    }
+    infos.pop_back();
+    mContainers.erase(it);
+    return true;
+}
+
+int64_t ContainerInfoIndex::FindByID(const string& id) const {
+    auto it = mContainers.find(id);
+    return it == mContainers.end() ? -1 : static_cast<int64_t>(it->second.mPos);
+}
+
+int64_t ContainerInfoIndex::FindByPath(const string& path) const {
+    const Slot* latest = nullptr;
+    VisitPath(path, [&latest](const Slot& slot) {
+        if (latest == nullptr || slot.mSeq > latest->mSeq) {
+            latest = &slot;
+        }
+    });
+    return latest == nullptr ? -1 : static_cast<int64_t>(latest->mPos);
+}
+
+void ContainerInfoIndex::FindAllByPath(const string& path, vector<size_t>& res) const {
+    res.clear();
+    VisitPath(path, [&res](const Slot& slot) { res.push_back(slot.mPos); });
+}
+
+void ContainerInfoIndex::Insert(const string& dir, const Slot& slot) {
+    Node* node = &mRoot;
+    size_t offset = 0;
+    while (offset < dir.size()) {
+        auto child = find_if(node->mChildren.begin(), node->mChildren.end(), [&](const Node& n) {
+            return n.mLabel[0] == dir[offset];
+        });
+        if (child == node->mChildren.end()) {
+            node->mChildren.emplace_back();
+            node = &node->mChildren.back();
+            node->mLabel = dir.substr(offset);
+            break;
+        }
+        size_t len = 0;
+        while (len < child->mLabel.size() && offset + len < dir.size() && child->mLabel[len] == dir[offset + len]) {
+            ++len;
+        }
+        if (len < child->mLabel.size()) {
+            // split the edge at the end of the common prefix
+            Node tail = std::move(*child);
+            Node mid;
+            mid.mLabel = tail.mLabel.substr(0, len);
+            tail.mLabel.erase(0, len);
+            mid.mChildren.push_back(std::move(tail));
+            *child = std::move(mid);
+        }
+        node = &*child;
+        offset += len;
+    }
+    node->mSlots.push_back(slot);
+}
+
+bool ContainerInfoIndex::Remove(Node& node, const string& dir, size_t offset, size_t pos) {
+    if (offset == dir.size()) {
+        auto it = find_if(node.mSlots.begin(), node.mSlots.end(), [pos](const Slot& s) { return s.mPos == pos; });
+        if (it == node.mSlots.end()) {
+            return false;
+        }
+        node.mSlots.erase(it);
+        return true;
+    }
+    auto child = find_if(
+        node.mChildren.begin(), node.mChildren.end(), [&](const Node& n) { return n.mLabel[0] == dir[offset]; });
+    if (child == node.mChildren.end() || dir.compare(offset, child->mLabel.size(), child->mLabel) != 0) {
+        return false;
+    }
+    if (!Remove(*child, dir, offset + child->mLabel.size(), pos)) {
+        return false;
+    }
+    // nodes left by deleted containers are pruned, and a node with only one child is merged with it
+    if (child->mSlots.empty()) {
+        if (child->mChildren.empty()) {
+            node.mChildren.erase(child);
+        } else if (child->mChildren.size() == 1) {
+            Node grandChild = std::move(child->mChildren[0]);
+            grandChild.mLabel = child->mLabel + grandChild.mLabel;
+            *child = std::move(grandChild);
+        }
+    }
+    return true;
+}
+
+ContainerInfoIndex::Node* ContainerInfoIndex::FindNode(const string& dir) {
+    Node* node = &mRoot;
+    size_t offset = 0;
+    while (offset < dir.size()) {
+        auto child = find_if(node->mChildren.begin(), node->mChildren.end(), [&](const Node& n) {
+            return n.mLabel[0] == dir[offset];
+        });
+        if (child == node->mChildren.end() || dir.compare(offset, child->mLabel.size(), child->mLabel) != 0) {
+            return nullptr;
+        }
+        node = &*child;
+        offset += child->mLabel.size();
+    }
+    return node;
+}
+
+template <typename F>
+void ContainerInfoIndex::VisitPath(const string& path, F&& f) const {
+    const Node* node = &mRoot;
+    size_t offset = 0;
+    while (true) {
+        // same as a sub path, i.e. the real base dir is followed by a separator in path
+        if (!node->mSlots.empty() && (offset == path.size() || path[offset] == PATH_SEPARATOR[0])) {
+            for (const auto& slot : node->mSlots) {
+                f(slot);
+            }
+        }
+        if (offset == path.size()) {
+            return;
+        }
+        auto child = find_if(node->mChildren.begin(), node->mChildren.end(), [&](const Node& n) {
+            return n.mLabel[0] == path[offset];
+        });
+        if (child == node->mChildren.end() || path.compare(offset, child->mLabel.size(), child->mLabel) != 0) {
+            return;
+        }
+        node = &*child;
+        offset += child->mLabel.size();
+    }
+}
+
+} // namespace logtail
@@ -0,0 +1,76 @@
+/*
+ * Copyright 2025 iLogtail Authors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cstdint>
+
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "file_server/ContainerInfo.h"
+
+namespace logtail {
+
+// Index of the containers of a config, which are stored in a vector shared across pipeline updates. Containers are
+// indexed by id, and by real base dir in a radix tree, so that the container of a path is found in O(path length)
+// instead of scanning all containers. Containers are updated in place, and deleted by moving the last one into their
+// positions, so the order of containers in the vector is not the order they are added.
+class ContainerInfoIndex {
+public:
+    void Build(const std::vector<ContainerInfo>& infos);
+    // returns true if the container is added, or false if an existing one with the same id is updated
+    bool AddOrUpdate(std::vector<ContainerInfo>& infos, const ContainerInfo& info);
+    bool Delete(std::vector<ContainerInfo>& infos, const std::string& id);
+
+    // position of the container in infos, or -1 if not found
+    int64_t FindByID(const std::string& id) const;
+    // position of the latest added container whose real base dir is path or an ancestor of path, or -1 if not found
+    int64_t FindByPath(const std::string& path) const;
+    // positions of all containers whose real base dir is path or an ancestor of path
+    void FindAllByPath(const std::string& path, std::vector<size_t>& res) const;
+    size_t Size() const { return mContainers.size(); }
+
+private:
+    struct Slot {
+        uint64_t mSeq = 0;
+        size_t mPos = 0;
+    };
+
+    struct Node {
+        std::string mLabel;
+        std::vector<Node> mChildren;
+        // containers whose real base dir ends at this node
+        std::vector<Slot> mSlots;
+    };
+
+    void Insert(const std::string& dir, const Slot& slot);
+    static bool Remove(Node& node, const std::string& dir, size_t offset, size_t pos);
+    Node* FindNode(const std::string& dir);
+    template <typename F>
+    void VisitPath(const std::string& path, F&& f) const;
+
+    Node mRoot;
+    std::unordered_map<std::string, Slot> mContainers;
+    uint64_t mNextSeq = 0;
+
+#ifdef APSARA_UNIT_TEST_MAIN
+    friend class ContainerInfoIndexUnittest;
+#endif
+};
+
+} // namespace logtail
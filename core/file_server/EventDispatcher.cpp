@@ -998,6 +998,13 @@ void EventDispatcher::ProcessHandlerTimeOut() {
     }
 }
 
+void EventDispatcher::FlushPendingEventGroups() {
+    MapType<int, DirInfo*>::Type::iterator mapIter = mWdDirInfoMap.begin();
+    for (; mapIter != mWdDirInfoMap.end(); ++mapIter) {
+        mapIter->second->mHandler->FlushPendingEventGroups();
+    }
+}
+
 void EventDispatcher::DumpCheckPointPeriod(int32_t curTime) {
     if (CheckPointManager::Instance()->NeedDump(curTime)) {
         DumpCheckPoint();
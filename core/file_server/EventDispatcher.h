@@ -213,6 +213,7 @@ public:
     void ReadInotifyEvents(std::vector<Event*>& eventVec);
 
     void ProcessHandlerTimeOut();
+    void FlushPendingEventGroups();
     void AddExistedCheckPointFileEvents();
 
     void DumpInotifyWatcherDirs();
@@ -514,7 +514,9 @@ bool FileDiscoveryOptions::IsMatch(const string& path, const string& name) const
         }
 
         // Normal base path.
-        for (size_t i = 0; i < mContainerInfos->size(); ++i) {
+        static thread_local vector<size_t> sCandidates;
+        mContainerIndex.FindAllByPath(path, sCandidates);
+        for (size_t i : sCandidates) {
             const string& containerBasePath = (*mContainerInfos)[i].mRealBaseDir;
             if (_IsPathMatched(containerBasePath, path, mMaxDirSearchDepth)) {
                 if (!mHasBlacklist) {
@@ -644,17 +646,30 @@ bool FileDiscoveryOptions::WithinMaxDepth(const string& path) const {
     return true;
 }
 
+void FileDiscoveryOptions::SetContainerInfo(const shared_ptr<vector<ContainerInfo>>& info) {
+    mContainerInfos = info;
+    if (mContainerInfos) {
+        mContainerIndex.Build(*mContainerInfos);
+    } else {
+        mContainerIndex.Build(vector<ContainerInfo>());
+    }
+}
+
 ContainerInfo* FileDiscoveryOptions::GetContainerPathByLogPath(const string& logPath) const {
     if (!mContainerInfos) {
         return NULL;
     }
-    // reverse order to find the latest container
-    for (int i = mContainerInfos->size() - 1; i >= 0; --i) {
-        if (_IsSubPath((*mContainerInfos)[i].mRealBaseDir, logPath)) {
-            return &(*mContainerInfos)[i];
-        }
+    // the latest container is returned if more than one matches
+    int64_t pos = mContainerIndex.FindByPath(logPath);
+    return pos < 0 ? NULL : &(*mContainerInfos)[pos];
+}
+
+ContainerInfo* FileDiscoveryOptions::GetContainerInfoByID(const string& id) const {
+    if (!mContainerInfos) {
+        return NULL;
     }
-    return NULL;
+    int64_t pos = mContainerIndex.FindByID(id);
+    return pos < 0 ? NULL : &(*mContainerInfos)[pos];
 }
 
 bool FileDiscoveryOptions::IsSameContainerInfo(const Json::Value& paramsJSON, const CollectionPipelineContext* ctx) {
@@ -671,13 +686,8 @@ bool FileDiscoveryOptions::IsSameContainerInfo(const Json::Value& paramsJSON, co
         if (!mDeduceAndSetContainerBaseDirFunc(containerInfo, ctx, this)) {
             return true;
         }
-        // try update
-        for (size_t i = 0; i < mContainerInfos->size(); ++i) {
-            if ((*mContainerInfos)[i] == containerInfo) {
-                return true;
-            }
-        }
-        return false;
+        ContainerInfo* info = GetContainerInfoByID(containerInfo.mID);
+        return info != NULL && *info == containerInfo;
     }
 
     // check all
@@ -725,16 +735,7 @@ bool FileDiscoveryOptions::UpdateContainerInfo(const Json::Value& paramsJSON, co
         if (!mDeduceAndSetContainerBaseDirFunc(containerInfo, ctx, this)) {
             return false;
         }
-        // try update
-        for (size_t i = 0; i < mContainerInfos->size(); ++i) {
-            if ((*mContainerInfos)[i].mID == containerInfo.mID) {
-                // update
-                (*mContainerInfos)[i] = containerInfo;
-                return true;
-            }
-        }
-        // add
-        mContainerInfos->push_back(containerInfo);
+        mContainerIndex.AddOrUpdate(*mContainerInfos, containerInfo);
         return true;
     }
 
@@ -746,13 +747,21 @@ bool FileDiscoveryOptions::UpdateContainerInfo(const Json::Value& paramsJSON, co
                    "skip this path")("params", paramsJSON.toStyledString())("errorMsg", errorMsg));
         return false;
     }
-    // if update all, clear and reset
-    mContainerInfos->clear();
+    // if update all, apply the diff, so that unchanged containers are not reindexed
+    vector<string> deletedIDs;
+    for (const auto& info : *mContainerInfos) {
+        if (allPathMap.find(info.mID) == allPathMap.end()) {
+            deletedIDs.push_back(info.mID);
+        }
+    }
+    for (const auto& id : deletedIDs) {
+        mContainerIndex.Delete(*mContainerInfos, id);
+    }
     for (unordered_map<string, ContainerInfo>::iterator iter = allPathMap.begin(); iter != allPathMap.end(); ++iter) {
         if (!mDeduceAndSetContainerBaseDirFunc(iter->second, ctx, this)) {
             return false;
         }
-        mContainerInfos->push_back(iter->second);
+        mContainerIndex.AddOrUpdate(*mContainerInfos, iter->second);
     }
     return true;
 }
@@ -767,12 +776,7 @@ bool FileDiscoveryOptions::DeleteContainerInfo(const Json::Value& paramsJSON) {
         LOG_ERROR(sLogger, ("invalid container info update param", errorMsg)("action", "ignore current cmd"));
         return false;
     }
-    for (vector<ContainerInfo>::iterator iter = mContainerInfos->begin(); iter != mContainerInfos->end(); ++iter) {
-        if (iter->mID == containerInfo.mID) {
-            mContainerInfos->erase(iter);
-            break;
-        }
-    }
+    mContainerIndex.Delete(*mContainerInfos, containerInfo.mID);
     return true;
 }
 
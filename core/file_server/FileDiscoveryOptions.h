@@ -27,6 +27,7 @@
 
 #include "collection_pipeline/CollectionPipelineContext.h"
 #include "file_server/ContainerInfo.h"
+#include "file_server/ContainerInfoIndex.h"
 
 namespace logtail {
 
@@ -46,7 +47,8 @@ public:
     bool IsContainerDiscoveryEnabled() const { return mEnableContainerDiscovery; }
     void SetEnableContainerDiscoveryFlag(bool flag) { mEnableContainerDiscovery = true; }
     const std::shared_ptr<std::vector<ContainerInfo>>& GetContainerInfo() const { return mContainerInfos; }
-    void SetContainerInfo(const std::shared_ptr<std::vector<ContainerInfo>>& info) { mContainerInfos = info; }
+    // containers should only be added or deleted by UpdateContainerInfo and DeleteContainerInfo afterwards
+    void SetContainerInfo(const std::shared_ptr<std::vector<ContainerInfo>>& info);
     void SetDeduceAndSetContainerBaseDirFunc(bool (*f)(ContainerInfo&,
                                                        const CollectionPipelineContext*,
                                                        const FileDiscoveryOptions*)) {
@@ -61,6 +63,7 @@ public:
     bool UpdateContainerInfo(const Json::Value& paramsJSON, const CollectionPipelineContext*);
     bool DeleteContainerInfo(const Json::Value& paramsJSON);
     ContainerInfo* GetContainerPathByLogPath(const std::string& logPath) const;
+    ContainerInfo* GetContainerInfoByID(const std::string& id) const;
     // 过渡使用
     bool IsTailingAllMatchedFiles() const { return mTailingAllMatchedFiles; }
     void SetTailingAllMatchedFiles(bool flag) { mTailingAllMatchedFiles = flag; }
@@ -111,6 +114,7 @@ private:
 
     bool mEnableContainerDiscovery = false;
     std::shared_ptr<std::vector<ContainerInfo>> mContainerInfos; // must not be null if container discovery is enabled
+    ContainerInfoIndex mContainerIndex; // index of mContainerInfos
     bool (*mDeduceAndSetContainerBaseDirFunc)(ContainerInfo& containerInfo,
                                               const CollectionPipelineContext*,
                                               const FileDiscoveryOptions*)
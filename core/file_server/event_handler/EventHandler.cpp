@@ -201,6 +201,28 @@ bool CreateModifyHandler::IsAllFileRead() {
     return true;
 }
 
+void CreateModifyHandler::FlushPendingEventGroups() {
+    for (ModifyHandlerMap::iterator iter = mModifyHandlerPtrMap.begin(); iter != mModifyHandlerPtrMap.end(); ++iter) {
+        iter->second->FlushPendingEventGroups();
+    }
+}
+
+void CreateModifyHandler::CollectReadersToPrefetch(const Event& event, std::vector<LogFileReaderPtr>& readers) {
+    if (!event.IsModify() || event.IsDir()) {
+        return;
+    }
+    if (!event.GetConfigName().empty()) {
+        ModifyHandlerMap::iterator iter = mModifyHandlerPtrMap.find(event.GetConfigName());
+        if (iter != mModifyHandlerPtrMap.end()) {
+            iter->second->CollectReadersToPrefetch(event, readers);
+        }
+        return;
+    }
+    for (ModifyHandlerMap::iterator iter = mModifyHandlerPtrMap.begin(); iter != mModifyHandlerPtrMap.end(); ++iter) {
+        iter->second->CollectReadersToPrefetch(event, readers);
+    }
+}
+
 ModifyHandler* CreateModifyHandler::GetOrCreateModifyHandler(const std::string& configName,
                                                              const FileDiscoveryConfig& pConfig) {
     ModifyHandlerMap::iterator iter = mModifyHandlerPtrMap.find(configName);
@@ -323,6 +345,7 @@ void ModifyHandler::MakeSpaceForNewReader() {
         LogFileReaderPtrArray& readerArray = *pReader->GetReaderArray();
         for (LogFileReaderPtrArray::iterator iter = readerArray.begin(); iter != readerArray.end(); ++iter) {
             if (iter->get() == pReader) {
+                PushPendingEventGroup(*iter);
                 readerArray.erase(iter);
                 break;
             }
@@ -580,6 +603,7 @@ void ModifyHandler::Handle(const Event& event) {
                         return;
                         break;
                     case LogFileReader::FileCompareResult_SigChange:
+                        PushPendingEventGroup(rotatorReader);
                         mRotatorReaderMap.erase(rotateIter);
                         break;
                     case LogFileReader::FileCompareResult_SigSameSizeChange: {
@@ -692,6 +716,7 @@ void ModifyHandler::Handle(const Event& event) {
                                                                             readerArrayPtr->size() - 1)(
                          "file device", reader->GetDevInode().dev)("file inode", reader->GetDevInode().inode)(
                          "file size", reader->GetFileSize())("rotator reader pool size", mRotatorReaderMap.size() + 1));
+            PushPendingEventGroup(reader);
             readerArrayPtr->pop_front();
             mDevInodeReaderMap.erase(reader->GetDevInode());
             mRotatorReaderMap[reader->GetDevInode()] = reader;
@@ -742,6 +767,7 @@ void ModifyHandler::Handle(const Event& event) {
                         "log reader queue name", reader->GetHostLogPath())(
                         "log reader queue size", readerArrayPtr->size() - 1)("file device", reader->GetDevInode().dev)(
                         "file inode", reader->GetDevInode().inode)("file size", reader->GetFileSize()));
+                PushPendingEventGroup(reader);
                 readerArrayPtr->pop_front();
                 mDevInodeReaderMap.erase(reader->GetDevInode());
                 // delete this reader, do not insert into rotator reader map
@@ -948,6 +974,7 @@ void ModifyHandler::HandleTimeOut() {
                         "log reader queue name", (*iter)->GetHostLogPath())("log reader queue size", 0)(
                         "file device", (*iter)->GetDevInode().dev)("file inode", (*iter)->GetDevInode().inode)(
                         "file size", (*iter)->GetFileSize())("last file position", (*iter)->GetLastFilePos()));
+                PushPendingEventGroup(*iter);
                 mDevInodeReaderMap.erase((*iter)->GetDevInode());
                 readerArray.erase(iter);
             }
@@ -1019,6 +1046,18 @@ bool ModifyHandler::IsAllFileRead() {
     return true;
 }
 
+void ModifyHandler::CollectReadersToPrefetch(const Event& event, std::vector<LogFileReaderPtr>& readers) {
+    DevInodeLogFileReaderMap::iterator iter = mDevInodeReaderMap.find(DevInode(event.GetDev(), event.GetInode()));
+    if (iter == mDevInodeReaderMap.end()) {
+        return;
+    }
+    // only the head of the reader array is read when handling the modify event
+    LogFileReaderPtrArray* readerArray = iter->second->GetReaderArray();
+    if (readerArray != nullptr && !readerArray->empty() && (*readerArray)[0] == iter->second) {
+        readers.emplace_back(iter->second);
+    }
+}
+
 void ModifyHandler::DeleteTimeoutReader() {
     if ((int32_t)mDevInodeReaderMap.size() > INT32_FLAG(logreader_count_maxlimit))
         DeleteTimeoutReader(86400);
@@ -1045,6 +1084,7 @@ void ModifyHandler::DeleteTimeoutReader(int32_t timeoutInterval) {
                                                                                  readerArray.size() - 1)(
                              "file device", (*iter)->GetDevInode().dev)("file inode", (*iter)->GetDevInode().inode)(
                              "file size", (*iter)->GetFileSize())("last file position", (*iter)->GetLastFilePos()));
+                PushPendingEventGroup(*iter);
                 mDevInodeReaderMap.erase((*iter)->GetDevInode());
                 iter = readerArray.erase(iter);
             }
@@ -1072,6 +1112,7 @@ void ModifyHandler::DeleteRollbackReader() {
         int32_t interval = curTime - readerIter->second->GetLastUpdateTime();
         readerIter->second->CloseTimeoutFilePtr(curTime);
         if (interval > INT32_FLAG(logreader_filerotate_remove_interval)) {
+            PushPendingEventGroup(readerIter->second);
             deletedReaderKeys.push_back(readerIter->first);
             LOG_INFO(sLogger,
                      ("remove the corresponding reader from the reader rotator pool",
@@ -1093,23 +1134,59 @@ void ModifyHandler::ForceReadLogAndPush(LogFileReaderPtr reader) {
     auto logBuffer = make_unique<LogBuffer>();
     auto pEvent = reader->CreateFlushTimeoutEvent();
     reader->ReadLog(*logBuffer, pEvent.get());
-    PushLogToProcessor(reader, logBuffer.get());
+    PushLogToProcessor(reader, logBuffer.get(), true);
 }
 
-int32_t ModifyHandler::PushLogToProcessor(LogFileReaderPtr reader, LogBuffer* logBuffer) {
+int32_t ModifyHandler::PushLogToProcessor(LogFileReaderPtr reader, LogBuffer* logBuffer, bool flush) {
     int32_t pushRetry = 0;
     if (!logBuffer->rawBuffer.empty()) {
         reader->ReportMetrics(logBuffer->readLength);
-        PipelineEventGroup group = LogFileReader::GenerateEventGroup(reader, logBuffer);
-
-        while (!ProcessorRunner::GetInstance()->PushQueue(reader->GetQueueKey(), 0, std::move(group))) // 10ms
-        {
-            ++pushRetry;
-            if (pushRetry % 10 == 0)
-                LogInput::GetInstance()->TryReadEvents(false);
+        if (!reader->CanCoalesceToPendingEventGroup(logBuffer->readLength)) {
+            pushRetry += PushPendingEventGroup(reader);
         }
+        LogFileReader::CoalesceToPendingEventGroup(reader, logBuffer);
+    }
+    if (flush || reader->IsPendingEventGroupReady()) {
+        pushRetry += PushPendingEventGroup(reader);
+    }
+    return pushRetry;
+}
+
+int32_t ModifyHandler::PushPendingEventGroup(LogFileReaderPtr reader) {
+    int32_t pushRetry = 0;
+    PipelineEventGroup* group = reader->GetPendingEventGroup();
+    if (group == nullptr) {
+        return pushRetry;
+    }
+    while (!ProcessorRunner::GetInstance()->PushQueue(reader->GetQueueKey(), 0, std::move(*group))) // 10ms
+    {
+        ++pushRetry;
+        if (pushRetry % 10 == 0)
+            LogInput::GetInstance()->TryReadEvents(false);
     }
+    reader->ClearPendingEventGroup();
     return pushRetry;
 }
 
+void ModifyHandler::FlushPendingEventGroups() {
+    auto flush = [](const LogFileReaderPtr& reader) {
+        PipelineEventGroup* group = reader->GetPendingEventGroup();
+        if (group == nullptr || !reader->IsPendingEventGroupReady()) {
+            return;
+        }
+        // the group is given back on failure, and will be tried again next time
+        if (ProcessorRunner::GetInstance()->PushQueue(reader->GetQueueKey(), 0, std::move(*group))) {
+            reader->ClearPendingEventGroup();
+        }
+    };
+    for (auto& item : mNameReaderMap) {
+        for (auto& reader : item.second) {
+            flush(reader);
+        }
+    }
+    for (auto& item : mRotatorReaderMap) {
+        flush(item.second);
+    }
+}
+
 } // namespace logtail
@@ -40,6 +40,10 @@ public:
     virtual void HandleTimeOut() = 0;
     virtual bool DumpReaderMeta(bool isRotatorReader, bool checkConfigFlag) = 0;
     virtual bool IsAllFileRead() { return true; }
+    // Push the pending event groups which have been held for too long, called on a short timer by LogInput.
+    virtual void FlushPendingEventGroups() {}
+    // Collect the reader which will be read when handling the event, used for prefetching.
+    virtual void CollectReadersToPrefetch(const Event& event, std::vector<LogFileReaderPtr>& readers) {}
     virtual ~EventHandler() {}
 };
 
@@ -98,7 +102,9 @@ private:
                                             uint32_t exactlyonceConcurrency = 0,
                                             bool forceBeginingFlag = false);
 
-    int32_t PushLogToProcessor(LogFileReaderPtr reader, LogBuffer* logBuffer);
+    // @param flush: push the pending event group of the reader even if it is not ready
+    int32_t PushLogToProcessor(LogFileReaderPtr reader, LogBuffer* logBuffer, bool flush = false);
+    int32_t PushPendingEventGroup(LogFileReaderPtr reader);
 
     void ForceReadLogAndPush(LogFileReaderPtr reader);
 
@@ -113,6 +119,9 @@ public:
     virtual void HandleTimeOut();
     virtual bool DumpReaderMeta(bool isRotatorReader, bool checkConfigFlag);
     bool IsAllFileRead() override;
+    // push the pending event groups of all readers which have been held for too long, without blocking
+    void FlushPendingEventGroups() override;
+    void CollectReadersToPrefetch(const Event& event, std::vector<LogFileReaderPtr>& readers) override;
     const std::string& GetConfigName() const { return mConfigName; }
 
 #ifdef APSARA_UNIT_TEST_MAIN
@@ -169,6 +178,8 @@ public:
     virtual void HandleTimeOut();
     virtual bool DumpReaderMeta(bool isRotatorReader, bool checkConfigFlag);
     bool IsAllFileRead() override;
+    void FlushPendingEventGroups() override;
+    void CollectReadersToPrefetch(const Event& event, std::vector<LogFileReaderPtr>& readers) override;
 
     ModifyHandler* GetOrCreateModifyHandler(const std::string& configName, const FileDiscoveryConfig& pConfig);
 
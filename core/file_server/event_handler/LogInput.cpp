@@ -56,6 +56,12 @@ DEFINE_FLAG_INT32(read_local_event_interval, "seconds", 60);
 DEFINE_FLAG_BOOL(force_close_file_on_container_stopped,
                  "whether close file handler immediately when associate container stopped",
                  false);
+DEFINE_FLAG_BOOL(enable_log_file_prefetch,
+                 "prefetch the files of queued modify events in batch, with io_uring if available",
+                 false);
+DEFINE_FLAG_INT32(log_file_prefetch_batch_size, "max count of queued events scanned in one prefetch", 64);
+
+DECLARE_FLAG_INT32(reader_coalesce_max_latency_ms);
 
 
 namespace logtail {
@@ -90,6 +96,12 @@ void LogInput::Start() {
         = FileServer::GetInstance()->GetMetricsRecordRef().CreateIntGauge(METRIC_RUNNER_FILE_ACTIVE_READERS_TOTAL);
     mEnableFileIncludedByMultiConfigs = FileServer::GetInstance()->GetMetricsRecordRef().CreateIntGauge(
         METRIC_RUNNER_FILE_ENABLE_FILE_INCLUDED_BY_MULTI_CONFIGS_FLAG);
+    mOpenedFilesTotal
+        = FileServer::GetInstance()->GetMetricsRecordRef().CreateCounter(METRIC_RUNNER_FILE_OPENED_FILES_TOTAL);
+    mReopenedFilesTotal
+        = FileServer::GetInstance()->GetMetricsRecordRef().CreateCounter(METRIC_RUNNER_FILE_REOPENED_FILES_TOTAL);
+    mEvictedFilesTotal
+        = FileServer::GetInstance()->GetMetricsRecordRef().CreateCounter(METRIC_RUNNER_FILE_EVICTED_FILES_TOTAL);
 
     mThreadRes = async(launch::async, &LogInput::ProcessLoop, this);
 }
@@ -348,6 +360,9 @@ void LogInput::UpdateCriticalMetric(int32_t curTime) {
     SET_GAUGE(mLastRunTime, mLastReadEventTime.load());
     LoongCollectorMonitor::GetInstance()->SetAgentOpenFdTotal(
         GloablFileDescriptorManager::GetInstance()->GetOpenedFilePtrSize());
+    ADD_COUNTER(mOpenedFilesTotal, GloablFileDescriptorManager::GetInstance()->GetAndResetOpenCnt());
+    ADD_COUNTER(mReopenedFilesTotal, GloablFileDescriptorManager::GetInstance()->GetAndResetReopenCnt());
+    ADD_COUNTER(mEvictedFilesTotal, GloablFileDescriptorManager::GetInstance()->GetAndResetEvictCnt());
     SET_GAUGE(mRegisterdHandlersTotal, EventDispatcher::GetInstance()->GetHandlerCount());
     SET_GAUGE(mActiveReadersTotal, CheckPointManager::Instance()->GetReaderCount());
     mEventProcessCount = 0;
@@ -371,12 +386,16 @@ void LogInput::ProcessLoop() {
     mLastUpdateMetricTime = prevTime - rand() % 60;
     int32_t lastCheckBlockedTime = prevTime;
     int32_t lastReadLocalEventTime = prevTime;
+    uint64_t lastFlushPendingEventGroupsTime = GetCurrentTimeInMilliSeconds();
     mEventProcessCount = 0;
     BlockedEventManager* pBlockedEventManager = BlockedEventManager::GetInstance();
     string path;
     while (true) {
         ReadLock lock(mAccessMainThreadRWL);
         TryReadEvents(false);
+        if (BOOL_FLAG(enable_log_file_prefetch)) {
+            PrefetchReaders(dispatcher);
+        }
         Event* ev = PopEventQueue();
         if (ev != NULL) {
             ++mEventProcessCount;
@@ -394,6 +413,16 @@ void LogInput::ProcessLoop() {
 
         curTime = time(NULL);
 
+        // pending event groups must not be held longer than reader_coalesce_max_latency_ms, so check them at half of
+        // the latency instead of waiting for the handler timeout
+        if (INT32_FLAG(reader_coalesce_max_latency_ms) > 0) {
+            uint64_t curTimeMs = GetCurrentTimeInMilliSeconds();
+            if (curTimeMs - lastFlushPendingEventGroupsTime
+                >= (uint64_t)INT32_FLAG(reader_coalesce_max_latency_ms) / 2) {
+                dispatcher->FlushPendingEventGroups();
+                lastFlushPendingEventGroupsTime = curTimeMs;
+            }
+        }
 
         if (curTime - lastCheckBlockedTime >= INT32_FLAG(check_block_event_interval)) {
             std::vector<Event*> pEventVec;
@@ -463,6 +492,43 @@ void LogInput::ProcessLoop() {
     mInteruptFlag = true;
 }
 
+void LogInput::PrefetchReaders(EventDispatcher* dispatcher) {
+    if (mPrefetchedEventCount > 0 || mInotifyEventQueue.size() < 2) {
+        return;
+    }
+    // data not consumed by the last batch is released to bound the memory held by prefetching
+    for (auto& weakReader : mPrefetchedReaders) {
+        auto reader = weakReader.lock();
+        if (reader) {
+            reader->ReleasePrefetchedData();
+        }
+    }
+    mPrefetchedReaders.clear();
+
+    std::vector<LogFileReaderPtr> readers;
+    size_t count = 0;
+    for (auto iter = mInotifyEventQueue.begin();
+         iter != mInotifyEventQueue.end() && count < static_cast<size_t>(INT32_FLAG(log_file_prefetch_batch_size));
+         ++iter, ++count) {
+        Event* ev = *iter;
+        if (!ev->IsModify() || ev->IsDir() || ev->IsReaderFlushTimeout()) {
+            continue;
+        }
+        EventHandler* handler = dispatcher->GetHandler(ev->GetSource().c_str());
+        if (handler) {
+            handler->CollectReadersToPrefetch(*ev, readers);
+        }
+    }
+    mPrefetchedEventCount = count;
+    if (readers.size() < 2) {
+        return;
+    }
+    LogFileReader::PrefetchReaders(readers);
+    for (auto& reader : readers) {
+        mPrefetchedReaders.emplace_back(reader);
+    }
+}
+
 void LogInput::PushEventQueue(std::vector<Event*>& eventVec) {
     for (std::vector<Event*>::iterator iter = eventVec.begin(); iter != eventVec.end(); ++iter) {
         string key;
@@ -484,7 +550,7 @@ void LogInput::PushEventQueue(std::vector<Event*>& eventVec) {
             } else
                 mModifyEventSet.insert(hashKey);
         }
-        mInotifyEventQueue.push(*iter);
+        mInotifyEventQueue.push_back(*iter);
         (*iter)->SetHashKey(hashKey);
     }
 }
@@ -509,13 +575,16 @@ void LogInput::PushEventQueue(Event* ev) {
             mModifyEventSet.insert(hashKey);
     }
     ev->SetHashKey(hashKey);
-    mInotifyEventQueue.push(ev);
+    mInotifyEventQueue.push_back(ev);
 }
 
 Event* LogInput::PopEventQueue() {
     if (mInotifyEventQueue.size() > 0) {
         Event* ev = mInotifyEventQueue.front();
-        mInotifyEventQueue.pop();
+        mInotifyEventQueue.pop_front();
+        if (mPrefetchedEventCount > 0) {
+            --mPrefetchedEventCount;
+        }
         if (ev->GetType() == EVENT_MODIFY)
             mModifyEventSet.erase(ev->GetHashKey());
         return ev;
@@ -18,7 +18,8 @@
 #define __LOG_ILOGTAIL_LOG_INPUT_H__
 
 #include <condition_variable>
-#include <queue>
+#include <deque>
+#include <memory>
 #include <string>
 #include <unordered_set>
 #include <vector>
@@ -31,6 +32,7 @@ namespace logtail {
 
 class Event;
 class EventDispatcher;
+class LogFileReader;
 
 class LogInput : public LogRunnable {
 public:
@@ -69,8 +71,12 @@ private:
     void ProcessEvent(EventDispatcher* dispatcher, Event* ev);
     Event* PopEventQueue();
     void UpdateCriticalMetric(int32_t curTime);
+    void PrefetchReaders(EventDispatcher* dispatcher);
 
-    std::queue<Event*> mInotifyEventQueue;
+    std::deque<Event*> mInotifyEventQueue;
+    // count of events at the head of mInotifyEventQueue which have been scanned by the last prefetch
+    size_t mPrefetchedEventCount = 0;
+    std::vector<std::weak_ptr<LogFileReader>> mPrefetchedReaders;
     std::unordered_set<int64_t> mModifyEventSet;
     ReadWriteLock mAccessMainThreadRWL;
     int32_t mCheckBaseDirInterval;
@@ -86,6 +92,9 @@ private:
     IntGaugePtr mRegisterdHandlersTotal;
     IntGaugePtr mActiveReadersTotal;
     IntGaugePtr mEnableFileIncludedByMultiConfigs;
+    CounterPtr mOpenedFilesTotal;
+    CounterPtr mReopenedFilesTotal;
+    CounterPtr mEvictedFilesTotal;
 
     std::atomic_int mLastReadEventTime{0};
     std::future<void> mThreadRes;
@@ -0,0 +1,106 @@
+// Copyright 2025 iLogtail Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "file_server/reader/GloablFileDescriptorManager.h"
+
+#include <ctime>
+
+#include "common/Flags.h"
+#include "file_server/reader/LogFileReader.h"
+#include "logger/Logger.h"
+
+DEFINE_FLAG_INT32(fd_cache_hot_file_interval,
+                  "files modified within this interval are not evicted from fd cache, seconds",
+                  60);
+DEFINE_FLAG_INT32(fd_cache_evict_scan_limit, "max files scanned from the lru end to find one to evict", 128);
+DECLARE_FLAG_INT32(max_reader_open_files);
+
+using namespace std;
+
+namespace logtail {
+
+bool GloablFileDescriptorManager::ReserveFd() {
+    while (mOpenFileSize >= INT32_FLAG(max_reader_open_files)) {
+        LogFileReader* victim = selectVictim();
+        if (victim == nullptr) {
+            return false;
+        }
+        LOG_DEBUG(sLogger,
+                  ("evict file from fd cache", victim->GetHostLogPath())("inode", victim->GetDevInode().inode));
+        // OnFileClose will be called, so mutex must not be held here
+        victim->EvictFilePtr();
+        ++mEvictCnt;
+    }
+    return true;
+}
+
+LogFileReader* GloablFileDescriptorManager::selectVictim() {
+    const time_t hotTime = time(nullptr) - INT32_FLAG(fd_cache_hot_file_interval);
+    const auto curThread = this_thread::get_id();
+    lock_guard<mutex> lock(mMux);
+    int32_t scanned = 0;
+    for (auto it = mLruList.rbegin(); it != mLruList.rend() && scanned < INT32_FLAG(fd_cache_evict_scan_limit);
+         ++it, ++scanned) {
+        if (it->mOwner != curThread) {
+            continue;
+        }
+        LogFileReader* reader = it->mReader;
+        // data of deleted file cannot be read again once its fd is closed, and unread data of a file would be lost if
+        // the file is rotated and deleted before it is reopened
+        if (reader->IsFileDeleted() || reader->GetLastMTime() > hotTime || !reader->IsReadToEnd()) {
+            continue;
+        }
+        return reader;
+    }
+    return nullptr;
+}
+
+void GloablFileDescriptorManager::OnFileOpen(LogFileReader* reader, bool isReopen) {
+    {
+        lock_guard<mutex> lock(mMux);
+        if (mLruIndex.find(reader) != mLruIndex.end()) {
+            return;
+        }
+        mLruList.push_front(Item{reader, this_thread::get_id()});
+        mLruIndex[reader] = mLruList.begin();
+    }
+    ++mOpenFileSize;
+    ++mOpenCnt;
+    if (isReopen) {
+        ++mReopenCnt;
+    }
+}
+
+void GloablFileDescriptorManager::OnFileAccess(LogFileReader* reader) {
+    lock_guard<mutex> lock(mMux);
+    auto it = mLruIndex.find(reader);
+    if (it != mLruIndex.end()) {
+        mLruList.splice(mLruList.begin(), mLruList, it->second);
+    }
+}
+
+void GloablFileDescriptorManager::OnFileClose(LogFileReader* reader) {
+    {
+        lock_guard<mutex> lock(mMux);
+        auto it = mLruIndex.find(reader);
+        if (it == mLruIndex.end()) {
+            return;
+        }
+        mLruList.erase(it->second);
+        mLruIndex.erase(it);
+    }
+    --mOpenFileSize;
+}
+
+} // namespace logtail
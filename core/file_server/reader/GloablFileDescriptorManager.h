@@ -16,11 +16,21 @@
 
 #pragma once
 #include <atomic>
+#include <cstdint>
+#include <list>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
 
 namespace logtail {
 
 class LogFileReader;
 
+// GloablFileDescriptorManager keeps the fds opened by readers in an LRU list bounded by the flag
+// max_reader_open_files, which is derived from RLIMIT_NOFILE on start. When the bound is reached, the least recently
+// used files are closed to make room for the new one, and they are reopened lazily by LogFileReader::UpdateFilePtr on
+// the next read, where dev inode and signature are validated. Only files read to end are evicted, and files modified
+// recently or already deleted are never evicted.
 class GloablFileDescriptorManager {
 public:
     static GloablFileDescriptorManager* GetInstance() {
@@ -28,14 +38,45 @@ public:
         return &singleton;
     }
 
-    void OnFileOpen(LogFileReader*) { ++mOpenFileSize; }
+    // Evict files opened by the current thread until there is room for a new fd.
+    // @return false if the limit is reached and no file can be evicted.
+    bool ReserveFd();
 
-    void OnFileClose(LogFileReader*) { --mOpenFileSize; }
+    void OnFileOpen(LogFileReader* reader, bool isReopen = false);
+
+    void OnFileAccess(LogFileReader* reader);
+
+    void OnFileClose(LogFileReader* reader);
 
     int32_t GetOpenedFilePtrSize() { return mOpenFileSize; }
 
+    uint64_t GetAndResetOpenCnt() { return mOpenCnt.exchange(0); }
+    uint64_t GetAndResetReopenCnt() { return mReopenCnt.exchange(0); }
+    uint64_t GetAndResetEvictCnt() { return mEvictCnt.exchange(0); }
+
 private:
+    struct Item {
+        LogFileReader* mReader;
+        // a reader is only evicted by the thread which opened it, since readers are not thread safe
+        std::thread::id mOwner;
+    };
+
+    LogFileReader* selectVictim();
+
     std::atomic_int mOpenFileSize{0};
+
+    std::mutex mMux;
+    // front is the most recently used
+    std::list<Item> mLruList;
+    std::unordered_map<LogFileReader*, std::list<Item>::iterator> mLruIndex;
+
+    std::atomic_uint64_t mOpenCnt{0};
+    std::atomic_uint64_t mReopenCnt{0};
+    std::atomic_uint64_t mEvictCnt{0};
+
+#ifdef APSARA_UNIT_TEST_MAIN
+    friend class GloablFileDescriptorManagerUnittest;
+#endif
 };
 
 } // namespace logtail
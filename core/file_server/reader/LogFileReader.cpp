@@ -46,6 +46,7 @@
 #include "common/Flags.h"
 #include "common/HashUtil.h"
 #include "common/RandomUtil.h"
+#include "common/SimdJsonUtil.h"
 #include "common/TimeUtil.h"
 #include "common/UUIDUtil.h"
 #include "constants/Constants.h"
@@ -77,6 +78,17 @@ DEFINE_FLAG_INT32(max_fix_pos_bytes, "", 128 * 1024);
 DEFINE_FLAG_INT32(force_release_deleted_file_fd_timeout,
                   "force release fd if file is deleted after specified seconds, no matter read to end or not",
                   -1);
+DEFINE_FLAG_INT32(max_adaptive_read_buffer_size,
+                  "max size of a single read of a file with backlog, the read buffer of a utf8 file grows from the max "
+                  "size of single log up to it",
+                  4 * 1024 * 1024);
+DEFINE_FLAG_INT32(reader_coalesce_max_latency_ms,
+                  "max time consecutive reads of a file can be held to be coalesced into one event group, 0 means "
+                  "each read is pushed as soon as it is read",
+                  0);
+DEFINE_FLAG_INT32(reader_coalesce_max_bytes,
+                  "max size of consecutive reads of a file coalesced into one event group",
+                  512 * 1024);
 #if defined(_MSC_VER)
 // On Windows, if Chinese config base path is used, the log path will be converted to GBK,
 // so the __tag__.__path__ have to be converted back to UTF8 to avoid bad display.
@@ -258,8 +270,14 @@ void LogFileReader::DumpMetaToMem(bool checkConfigFlag, int32_t idxInReaderArray
                      "file size", mLastFileSize)("last file position", mLastFilePos)("is file opened",
                                                                                      ToString(mLogFileOp.IsOpen())));
     }
+    // data held in the pending event group has not been pushed yet, so it should be read again after restart
+    int64_t filePos = mLastFilePos;
+    bool hasPendingData = mPendingEventGroup && mPendingEventGroupOffset < mLastFilePos;
+    if (hasPendingData) {
+        filePos = mPendingEventGroupOffset;
+    }
     CheckPoint* checkPointPtr = new CheckPoint(mHostLogPath,
-                                               mLastFilePos,
+                                               filePos,
                                                mLastFileSignatureSize,
                                                mLastFileSignatureHash,
                                                mDevInode,
@@ -271,7 +289,9 @@ void LogFileReader::DumpMetaToMem(bool checkConfigFlag, int32_t idxInReaderArray
                                                mLastForceRead);
     // use last event time as checkpoint's last update time
     checkPointPtr->mLastUpdateTime = mLastEventTime;
-    checkPointPtr->mCache = mCache;
+    if (!hasPendingData) {
+        checkPointPtr->mCache = mCache;
+    }
     checkPointPtr->mIdxInReaderArray = idxInReaderArray;
     CheckPointManager::Instance()->AddCheckPoint(checkPointPtr);
 }
@@ -948,6 +968,7 @@ bool LogFileReader::ReadLog(LogBuffer& logBuffer, const Event* event) {
         }
     }
     bool moreData = GetRawData(logBuffer, mLastFileSize, tryRollback);
+    ReleasePrefetchedData();
     if (!logBuffer.rawBuffer.empty() > 0) {
         if (mEOOption) {
             // This read was replayed by checkpoint, adjust mLastFilePos to skip hole.
@@ -1051,7 +1072,7 @@ bool LogFileReader::UpdateFilePtr() {
         if (INT32_FLAG(force_release_deleted_file_fd_timeout) < 0) {
             SetFileDeleted(false);
         }
-        if (GloablFileDescriptorManager::GetInstance()->GetOpenedFilePtrSize() > INT32_FLAG(max_reader_open_files)) {
+        if (!GloablFileDescriptorManager::GetInstance()->ReserveFd()) {
             LOG_ERROR(sLogger,
                       ("open file failed, opened fd exceed limit, too many open files",
                        GloablFileDescriptorManager::GetInstance()->GetOpenedFilePtrSize())(
@@ -1071,6 +1092,9 @@ bool LogFileReader::UpdateFilePtr() {
             errno = EMFILE;
             return false;
         }
+        if (mFdEvicted) {
+            followRotatedFile();
+        }
         int32_t tryTime = 0;
         LOG_DEBUG(sLogger, ("UpdateFilePtr open log file ", mHostLogPath));
         if (mRealLogPath.size() > 0) {
@@ -1085,7 +1109,8 @@ bool LogFileReader::UpdateFilePtr() {
             if (mLogFileOp.IsOpen() == false) {
                 OnOpenFileError();
             } else if (CheckDevInode()) {
-                GloablFileDescriptorManager::GetInstance()->OnFileOpen(this);
+                GloablFileDescriptorManager::GetInstance()->OnFileOpen(this, mFdEvicted);
+                mFdEvicted = false;
                 LOG_INFO(sLogger,
                          ("open file succeeded, project", GetProject())("logstore", GetLogstore())(
                              "config", GetConfigName())("log reader queue name", mHostLogPath)(
@@ -1123,7 +1148,8 @@ bool LogFileReader::UpdateFilePtr() {
         } else if (CheckDevInode()) {
             // the mHostLogPath's dev inode equal to mDevInode, so real log path is mHostLogPath
             mRealLogPath = mHostLogPath;
-            GloablFileDescriptorManager::GetInstance()->OnFileOpen(this);
+            GloablFileDescriptorManager::GetInstance()->OnFileOpen(this, mFdEvicted);
+            mFdEvicted = false;
             LOG_INFO(
                 sLogger,
                 ("open file succeeded, project", GetProject())("logstore", GetLogstore())("config", GetConfigName())(
@@ -1144,6 +1170,7 @@ bool LogFileReader::UpdateFilePtr() {
                      "last file position", mLastFilePos));
         return false;
     }
+    GloablFileDescriptorManager::GetInstance()->OnFileAccess(this);
     return true;
 }
 
@@ -1170,6 +1197,7 @@ bool LogFileReader::CloseTimeoutFilePtr(int32_t curTime) {
 }
 
 void LogFileReader::CloseFilePtr() {
+    ReleasePrefetchedData();
     if (mLogFileOp.IsOpen()) {
         mCache.shrink_to_fit();
         LOG_DEBUG(sLogger, ("start close LogFileReader", mHostLogPath));
@@ -1227,6 +1255,34 @@ void LogFileReader::CloseFilePtr() {
     }
 }
 
+void LogFileReader::EvictFilePtr() {
+    LOG_INFO(sLogger,
+             ("close the file", "too many files are opened, the file will be reopened on next read")(
+                 "project", GetProject())("logstore", GetLogstore())("config", GetConfigName())(
+                 "log reader queue name", mHostLogPath)("file device", ToString(mDevInode.dev))(
+                 "file inode", ToString(mDevInode.inode))("file size", mLastFileSize)("last file position",
+                                                                                     mLastFilePos));
+    CloseFilePtr();
+    mFdEvicted = true;
+}
+
+void LogFileReader::followRotatedFile() {
+    const string& filePath = mRealLogPath.empty() ? mHostLogPath : mRealLogPath;
+    if (GetFileDevInode(filePath) == mDevInode) {
+        return;
+    }
+    auto dirPath = boost::filesystem::path(mHostLogPath).parent_path();
+    const auto searchResult = SearchFilePathByDevInodeInDirectory(dirPath.string(), 0, mDevInode, nullptr);
+    if (!searchResult) {
+        return;
+    }
+    LOG_INFO(sLogger,
+             ("file has been rotated after its fd is evicted, from", filePath)("to", searchResult.value())(
+                 "config", GetConfigName())("file device", ToString(mDevInode.dev))("file inode",
+                                                                                   ToString(mDevInode.inode)));
+    mRealLogPath = searchResult.value();
+}
+
 uint64_t LogFileReader::GetLogstoreKey() const {
     return mEOOption ? mEOOption->fbKey : mReaderConfig.second->GetLogstoreKey();
 }
@@ -1502,12 +1558,40 @@ size_t LogFileReader::getNextReadSize(int64_t fileEnd, bool& fromCpt) {
         readSize = checkpoint.read_length();
         LOG_INFO(sLogger, ("read specified length", readSize)("offset", mLastFilePos));
     }
-    if (readSize > BUFFER_SIZE && !allowMoreBufferSize) {
-        readSize = BUFFER_SIZE;
+    const size_t readBufferSize = getReadBufferSize();
+    if (readSize > readBufferSize && !allowMoreBufferSize) {
+        readSize = readBufferSize;
     }
     return readSize;
 }
 
+void LogFileReader::adjustReadBufferSize(size_t readSize) {
+    const size_t readBufferSize = getReadBufferSize();
+    const size_t maxReadBufferSize
+        = std::max(static_cast<size_t>(INT32_FLAG(max_adaptive_read_buffer_size)), BUFFER_SIZE);
+    if (readSize >= readBufferSize) {
+        mReadBufferSize = std::min(readBufferSize * 2, maxReadBufferSize);
+    } else if (readSize < readBufferSize / 4 && readBufferSize > BUFFER_SIZE) {
+        // the cached incomplete log is always smaller than the data read, so it still fits in the halved buffer
+        mReadBufferSize = std::max(readBufferSize / 2, BUFFER_SIZE);
+    }
+}
+
+size_t LogFileReader::getLogsWithinMaxSize(char* buffer, size_t size) {
+    size_t pos = 0;
+    while (size - pos > BUFFER_SIZE) {
+        int32_t rollbackLineFeedCount = 0;
+        const size_t len = static_cast<size_t>(
+            RemoveLastIncompleteLog(buffer + pos, static_cast<int32_t>(BUFFER_SIZE), rollbackLineFeedCount));
+        if (len == 0) {
+            // the log starting at pos is longer than BUFFER_SIZE
+            return pos;
+        }
+        pos += len;
+    }
+    return size;
+}
+
 void LogFileReader::setExactlyOnceCheckpointAfterRead(size_t readSize) {
     if (!mEOOption || readSize == 0) {
         return;
@@ -1589,7 +1673,10 @@ void LogFileReader::ReadUTF8(LogBuffer& logBuffer, int64_t end, bool& moreData,
         logBuffer.truncateInfo.reset(truncateInfo);
         lastReadPos = mLastFilePos + nbytes; // this doesn't seem right when ulogfs is used and a hole is skipped
         LOG_DEBUG(sLogger, ("read bytes", nbytes)("last read pos", lastReadPos));
-        moreData = (nbytes == BUFFER_SIZE);
+        moreData = (nbytes == getReadBufferSize());
+        if (!fromCpt) {
+            adjustReadBufferSize(nbytes);
+        }
         auto alignedBytes = nbytes;
         if (allowRollback) {
             alignedBytes = AlignLastCharacter(stringBuffer, nbytes);
@@ -1598,9 +1685,26 @@ void LogFileReader::ReadUTF8(LogBuffer& logBuffer, int64_t end, bool& moreData,
             int32_t rollbackLineFeedCount;
             nbytes = RemoveLastIncompleteLog(stringBuffer, alignedBytes, rollbackLineFeedCount, allowRollback);
         }
+        bool rereadRest = false;
+        if (nbytes > BUFFER_SIZE) {
+            // the read buffer has been enlarged, but no log should exceed the max size of single log
+            const size_t logsBytes = getLogsWithinMaxSize(stringBuffer, nbytes);
+            if (logsBytes < nbytes) {
+                // stop before the long log, or split it at BUFFER_SIZE if it comes first, and read the rest again from
+                // the file next time
+                nbytes = logsBytes;
+                rereadRest = true;
+                moreData = true;
+            }
+        }
 
         if (nbytes == 0) {
             if (moreData) { // excessively long line without '\n' or multiline begin or valid wchar
+                if (alignedBytes > BUFFER_SIZE) {
+                    // the read buffer has been enlarged, but the log should still be split at the max size of single
+                    // log
+                    alignedBytes = AlignLastCharacter(stringBuffer, BUFFER_SIZE);
+                }
                 nbytes = alignedBytes ? alignedBytes : BUFFER_SIZE;
                 if (mReaderConfig.second->RequiringJsonReader()) {
                     int32_t rollbackLineFeedCount;
@@ -1622,7 +1726,7 @@ void LogFileReader::ReadUTF8(LogBuffer& logBuffer, int64_t end, bool& moreData,
                 return;
             }
         }
-        if (nbytes < stringBufferLen) {
+        if (nbytes < stringBufferLen && !rereadRest) {
             // rollback happend, put rollbacked part in cache
             mCache.assign(stringBuffer + nbytes, stringBufferLen - nbytes);
         } else {
@@ -1858,19 +1962,102 @@ LogFileReader::ReadFile(LogFileOperator& op, void* buf, size_t size, int64_t& of
     //             GetLogstore());
     //     }
     // } else {
-    nbytes = op.Pread(buf, 1, size, offset);
+    size_t prefetched = consumePrefetchedData(op, buf, size, offset);
+    if (prefetched == size) {
+        *((char*)buf + prefetched) = '\0';
+        return prefetched;
+    }
+    nbytes = op.Pread((char*)buf + prefetched, 1, size - prefetched, offset + prefetched);
     if (nbytes < 0) {
         LOG_ERROR(sLogger,
                   ("Pread fail to read log file", mHostLogPath)("mLastFilePos", mLastFilePos)("size", size)("offset",
                                                                                                             offset));
-        return 0;
+        if (prefetched == 0) {
+            return 0;
+        }
+        nbytes = 0;
     }
+    nbytes += prefetched;
     // }
 
     *((char*)buf + nbytes) = '\0';
     return nbytes;
 }
 
+void LogFileReader::PrefetchReaders(const std::vector<LogFileReaderPtr>& readers) {
+    std::vector<PreadRequest> requests;
+    std::vector<LogFileReader*> owners;
+    requests.reserve(readers.size());
+    owners.reserve(readers.size());
+    for (const auto& reader : readers) {
+        // exactly once reader may replay checkpoint with specified offset and length, so it is not prefetched
+        if (!reader || !reader->mLogFileOp.IsOpen() || reader->mPrefetchBuffer || reader->mEOOption) {
+            continue;
+        }
+        // the data would be held until the queue is available, so it is not worth prefetching
+        if (!ProcessQueueManager::GetInstance()->IsValidToPush(reader->GetQueueKey())) {
+            continue;
+        }
+        const size_t cacheSize = reader->mCache.size();
+        const size_t readBufferSize = reader->getReadBufferSize();
+        if (cacheSize >= readBufferSize) {
+            continue;
+        }
+        const int64_t readPos = reader->GetLastReadPos();
+        const int64_t fileSize = reader->mLogFileOp.GetFileSize();
+        if (fileSize <= readPos) {
+            continue;
+        }
+        // same as the size of the next read in ReadUTF8/ReadGBK, which excludes the cached bytes
+        const size_t size = std::min(static_cast<size_t>(fileSize - readPos), readBufferSize - cacheSize);
+        reader->mPrefetchBuffer.reset(new char[size]);
+        reader->mPrefetchOffset = readPos;
+        reader->mPrefetchSize = 0;
+
+        PreadRequest req;
+        req.op = &reader->mLogFileOp;
+        req.buf = reader->mPrefetchBuffer.get();
+        req.size = size;
+        req.offset = readPos;
+        requests.emplace_back(req);
+        owners.emplace_back(reader.get());
+    }
+    if (requests.empty()) {
+        return;
+    }
+
+    LogFileOperator::PreadBatch(requests);
+    for (size_t i = 0; i < requests.size(); ++i) {
+        if (requests[i].result <= 0) {
+            owners[i]->ReleasePrefetchedData();
+            continue;
+        }
+        owners[i]->mPrefetchSize = static_cast<size_t>(requests[i].result);
+    }
+    LOG_DEBUG(sLogger, ("prefetch readers", requests.size()));
+}
+
+size_t LogFileReader::consumePrefetchedData(LogFileOperator& op, void* buf, size_t size, int64_t offset) {
+    if (!mPrefetchBuffer || &op != &mLogFileOp || offset != mPrefetchOffset) {
+        return 0;
+    }
+    // file has been truncated after prefetching, the prefetched data is stale
+    if (mPrefetchOffset + static_cast<int64_t>(mPrefetchSize) > mLastFileSize) {
+        ReleasePrefetchedData();
+        return 0;
+    }
+    size_t copied = std::min(size, mPrefetchSize);
+    memcpy(buf, mPrefetchBuffer.get(), copied);
+    ReleasePrefetchedData();
+    return copied;
+}
+
+void LogFileReader::ReleasePrefetchedData() {
+    mPrefetchBuffer.reset();
+    mPrefetchOffset = -1;
+    mPrefetchSize = 0;
+}
+
 LogFileReader::FileCompareResult LogFileReader::CompareToFile(const string& filePath) {
     LogFileOperator logFileOp;
     logFileOp.Open(filePath.c_str());
@@ -2095,7 +2282,6 @@ std::unique_ptr<Event> LogFileReader::CreateFlushTimeoutEvent() {
 
 void LogFileReader::ReportMetrics(uint64_t readSize) {
     ADD_COUNTER(mOutEventsTotal, 1);
-    ADD_COUNTER(mOutEventGroupsTotal, 1);
     ADD_COUNTER(mOutSizeBytes, readSize);
     SET_GAUGE(mSourceReadOffsetBytes, GetLastFilePos());
     SET_GAUGE(mSourceSizeBytes, GetFileSize());
@@ -2220,27 +2406,33 @@ bool DockerJsonFileParser::parseLine(LineInfo rawLine, LineInfo& paseLine) {
     if (rawLine.data.size() == 0) {
         return false;
     }
+    StringView content;
+    DockerJsonFileFields fields;
     rapidjson::Document doc;
-    doc.Parse(rawLine.data.data(), rawLine.data.size());
+    if (IsSimdJsonEnabled() && ParseDockerJsonFileLine(rawLine.data, fields)) {
+        content = fields.log;
+    } else {
+        doc.Parse(rawLine.data.data(), rawLine.data.size());
 
-    if (doc.HasParseError()) {
-        return false;
-    } else if (!doc.IsObject()) {
-        return false;
-    }
-    auto it = doc.FindMember(ProcessorParseContainerLogNative::DOCKER_JSON_TIME.c_str());
-    if (it == doc.MemberEnd() || !it->value.IsString()) {
-        return false;
-    }
-    it = doc.FindMember(ProcessorParseContainerLogNative::DOCKER_JSON_STREAM_TYPE.c_str());
-    if (it == doc.MemberEnd() || !it->value.IsString()) {
-        return false;
-    }
-    it = doc.FindMember(ProcessorParseContainerLogNative::DOCKER_JSON_LOG.c_str());
-    if (it == doc.MemberEnd() || !it->value.IsString()) {
-        return false;
+        if (doc.HasParseError()) {
+            return false;
+        } else if (!doc.IsObject()) {
+            return false;
+        }
+        auto it = doc.FindMember(ProcessorParseContainerLogNative::DOCKER_JSON_TIME.c_str());
+        if (it == doc.MemberEnd() || !it->value.IsString()) {
+            return false;
+        }
+        it = doc.FindMember(ProcessorParseContainerLogNative::DOCKER_JSON_STREAM_TYPE.c_str());
+        if (it == doc.MemberEnd() || !it->value.IsString()) {
+            return false;
+        }
+        it = doc.FindMember(ProcessorParseContainerLogNative::DOCKER_JSON_LOG.c_str());
+        if (it == doc.MemberEnd() || !it->value.IsString()) {
+            return false;
+        }
+        content = it->value.GetString();
     }
-    StringView content = it->value.GetString();
     if (content.size() > 0 && content[content.size() - 1] == '\n') {
         content = StringView(content.data(), content.size() - 1);
     }
@@ -2469,17 +2661,64 @@ void LogFileReader::SetEventGroupMetaAndTag(PipelineEventGroup& group) {
 PipelineEventGroup LogFileReader::GenerateEventGroup(LogFileReaderPtr reader, LogBuffer* logBuffer) {
     PipelineEventGroup group{std::shared_ptr<SourceBuffer>(std::move(logBuffer->sourcebuffer))};
     reader->SetEventGroupMetaAndTag(group);
+    AddRawLogEvent(group, logBuffer->rawBuffer, logBuffer);
+    return group;
+}
 
+void LogFileReader::AddRawLogEvent(PipelineEventGroup& group, StringView content, const LogBuffer* logBuffer) {
     LogEvent* event = group.AddLogEvent();
     time_t logtime = time(nullptr);
     if (AppConfig::GetInstance()->EnableLogTimeAutoAdjust()) {
         logtime += GetTimeDelta();
     }
     event->SetTimestamp(logtime);
-    event->SetContentNoCopy(DEFAULT_CONTENT_KEY, logBuffer->rawBuffer);
+    event->SetContentNoCopy(DEFAULT_CONTENT_KEY, content);
     event->SetPosition(logBuffer->readOffset, logBuffer->readLength);
+}
 
-    return group;
+bool LogFileReader::IsEventGroupCoalescingEnabled() const {
+    // each group of an exactly once reader must match exactly one range checkpoint
+    return INT32_FLAG(reader_coalesce_max_latency_ms) > 0 && !mEOOption;
+}
+
+bool LogFileReader::CanCoalesceToPendingEventGroup(size_t readLength) const {
+    return !mPendingEventGroup
+        || (IsEventGroupCoalescingEnabled()
+            && mPendingEventGroupSize + readLength <= static_cast<size_t>(INT32_FLAG(reader_coalesce_max_bytes)));
+}
+
+void LogFileReader::CoalesceToPendingEventGroup(LogFileReaderPtr reader, LogBuffer* logBuffer) {
+    if (!reader->mPendingEventGroup) {
+        // the first read is taken over without copy
+        reader->mPendingEventGroup = std::make_unique<PipelineEventGroup>(GenerateEventGroup(reader, logBuffer));
+        reader->mPendingEventGroupOffset = static_cast<int64_t>(logBuffer->readOffset);
+        reader->mPendingEventGroupSize = logBuffer->readLength;
+        reader->mPendingEventGroupBeginTime = GetCurrentTimeInMilliSeconds();
+        ADD_COUNTER(reader->mOutEventGroupsTotal, 1);
+        return;
+    }
+    // following reads are small ones bounded by reader_coalesce_max_bytes, so the copy is cheap compared to the cost
+    // of a group along the pipeline
+    StringBuffer b = reader->mPendingEventGroup->GetSourceBuffer()->CopyString(logBuffer->rawBuffer);
+    AddRawLogEvent(*reader->mPendingEventGroup, StringView(b.data, b.size), logBuffer);
+    reader->mPendingEventGroupSize += logBuffer->readLength;
+}
+
+bool LogFileReader::IsPendingEventGroupReady() const {
+    if (!mPendingEventGroup) {
+        return false;
+    }
+    return !IsEventGroupCoalescingEnabled()
+        || mPendingEventGroupSize >= static_cast<size_t>(INT32_FLAG(reader_coalesce_max_bytes))
+        || GetCurrentTimeInMilliSeconds() - mPendingEventGroupBeginTime
+        >= static_cast<uint64_t>(INT32_FLAG(reader_coalesce_max_latency_ms));
+}
+
+void LogFileReader::ClearPendingEventGroup() {
+    mPendingEventGroup.reset();
+    mPendingEventGroupOffset = 0;
+    mPendingEventGroupSize = 0;
+    mPendingEventGroupBeginTime = 0;
 }
 
 const std::string& LogFileReader::GetConvertedPath() const {
@@ -16,6 +16,7 @@
 
 #pragma once
 
+#include <algorithm>
 #include <atomic>
 #include <deque>
 #include <string>
@@ -196,6 +197,24 @@ public:
 
     static PipelineEventGroup GenerateEventGroup(LogFileReaderPtr reader, LogBuffer* logBuffer);
 
+    // Consecutive reads of a reader can be coalesced into one pending event group, one event per read, so that a
+    // trickle file yields fewer and larger groups. The pending group is bounded by reader_coalesce_max_bytes and
+    // reader_coalesce_max_latency_ms, and the checkpoint of the reader never goes beyond the data in it.
+    bool IsEventGroupCoalescingEnabled() const;
+    // false if the pending group should be pushed before the read is coalesced
+    bool CanCoalesceToPendingEventGroup(size_t readLength) const;
+    static void CoalesceToPendingEventGroup(LogFileReaderPtr reader, LogBuffer* logBuffer);
+    bool IsPendingEventGroupReady() const;
+    PipelineEventGroup* GetPendingEventGroup() const { return mPendingEventGroup.get(); }
+    // should be called once the pending group is pushed
+    void ClearPendingEventGroup();
+
+    // Read the next chunk of all readers in one batch (with io_uring if available), so that a slow file does not
+    // block the reads of the others. The prefetched data is only valid for the following ReadLog of each reader.
+    static void PrefetchReaders(const std::vector<LogFileReaderPtr>& readers);
+
+    void ReleasePrefetchedData();
+
     LogFileReader(const std::string& hostLogPathDir,
                   const std::string& hostLogPathFile,
                   const DevInode& devInode,
@@ -332,6 +351,9 @@ public:
 
     void CloseFilePtr();
 
+    // Close the file to release fd for other readers, it will be reopened by UpdateFilePtr on next read.
+    void EvictFilePtr();
+
     // void SetLogstoreKey(uint64_t logstoreKey) { mLogstoreKey = logstoreKey; }
 
     // Return the key of queues into which next read data will push.
@@ -357,6 +379,8 @@ public:
 
     bool IsReadToEnd() const { return GetLastReadPos() == mLastFileSize; }
 
+    time_t GetLastMTime() const { return mLastMTime; }
+
     bool HasDataInCache() const { return mCache.size(); }
 
     LogFileReaderPtrArray* GetReaderArray();
@@ -486,6 +510,17 @@ protected:
     int64_t mLastFileSize = 0;
     time_t mLastMTime = 0;
     std::string mCache;
+    // reads not pushed yet, starting at mPendingEventGroupOffset
+    std::unique_ptr<PipelineEventGroup> mPendingEventGroup;
+    int64_t mPendingEventGroupOffset = 0;
+    size_t mPendingEventGroupSize = 0;
+    uint64_t mPendingEventGroupBeginTime = 0;
+    // data prefetched by PrefetchReaders, starting at mPrefetchOffset
+    std::unique_ptr<char[]> mPrefetchBuffer;
+    int64_t mPrefetchOffset = -1;
+    size_t mPrefetchSize = 0;
+    // size of the next read, grows beyond BUFFER_SIZE for files with backlog, 0 means BUFFER_SIZE
+    size_t mReadBufferSize = 0;
     // >= 0: index of reader array, -1: new reader, -2: not in reader array
     int32_t mIdxInReaderArrayFromLastCpt = CHECKPOINT_IDX_OF_NEW_READER_IN_ARRAY;
     // std::string mProjectName;
@@ -496,6 +531,8 @@ protected:
     // boost::regex* mLogEndRegPtr;
     // int mReaderFlushTimeout;
     bool mLastForceRead = false;
+    // fd is closed by GloablFileDescriptorManager to make room for other readers
+    bool mFdEvicted = false;
     // FileEncoding mFileEncoding;
     // bool mDiscardUnmatch;
     // LogType mLogType;
@@ -612,8 +649,23 @@ private:
     // @param fromCpt: if the read size is recoveried from checkpoint, set it to true.
     size_t getNextReadSize(int64_t fileEnd, bool& fromCpt);
 
+    size_t getReadBufferSize() const { return std::max(mReadBufferSize, BUFFER_SIZE); }
+    // Double the read buffer when a read fills it up, and halve it when a read uses less than a quarter of it.
+    void adjustReadBufferSize(size_t readSize);
+    // The file may be rotated while its fd is evicted, look for it by dev inode in the same directory before reopening.
+    void followRotatedFile();
+    // Return the length of the leading complete logs in buffer that are each no longer than BUFFER_SIZE, or 0 if the
+    // first log is longer than BUFFER_SIZE.
+    size_t getLogsWithinMaxSize(char* buffer, size_t size);
+
     LineInfo GetLastLine(StringView buffer, int32_t end, bool needSingleLine = false);
 
+    static void AddRawLogEvent(PipelineEventGroup& group, StringView content, const LogBuffer* logBuffer);
+
+    // Copy prefetched data at offset into buf, and release the prefetch buffer.
+    // @return bytes copied, 0 if there is no matching prefetched data.
+    size_t consumePrefetchedData(LogFileOperator& op, void* buf, size_t size, int64_t offset);
+
     // Update current checkpoint's read offset and length after success read.
     void setExactlyOnceCheckpointAfterRead(size_t readSize);
 
@@ -707,6 +759,7 @@ private:
     friend class LastMatchedContainerdTextWithDockerJsonUnittest;
     friend class ForceReadUnittest;
     friend class FileTagUnittest;
+    friend class GloablFileDescriptorManagerUnittest;
 
 protected:
     void UpdateReaderManual();
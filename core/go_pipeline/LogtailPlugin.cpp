@@ -30,6 +30,7 @@
 #include "logger/Logger.h"
 #include "monitor/AlarmManager.h"
 #include "monitor/Monitor.h"
+#include "protobuf/sls/LogGroupDeserializer.h"
 #include "provider/Provider.h"
 #ifdef APSARA_UNIT_TEST_MAIN
 #include "unittest/pipeline/LogtailPluginMock.h"
@@ -266,7 +267,9 @@ int LogtailPlugin::SendPbV2(const char* configName,
                          "logstore", logstore));
             return -2;
         }
-        // TODO: support multi-flusher
+        if (p->IsRoutingGoPipelineData()) {
+            return SendToNativeFlushers(*p, pbBuffer, &pbSize, 1);
+        }
         pConfig = const_cast<FlusherSLS*>(static_cast<const FlusherSLS*>(p->GetFlushers()[0]->GetPlugin()));
     }
     std::string shardHashStr;
@@ -276,6 +279,113 @@ int LogtailPlugin::SendPbV2(const char* configName,
     return pConfig->Send(std::string(pbBuffer, pbSize), shardHashStr, logstore) ? 0 : -1;
 }
 
+long long LogtailPlugin::GetPipelineHandle(const char* configName, int configNameSize) {
+    LogtailPlugin* instance = LogtailPlugin::GetInstance();
+    string configNameStr(configName, configNameSize);
+    if (configNameStr == instance->mPluginAlarmConfig.mLogstore
+        || configNameStr == instance->mPluginContainerConfig.mLogstore) {
+        // profile data should be sent by SendPbV2
+        return -1;
+    }
+    shared_ptr<CollectionPipeline> p = CollectionPipelineManager::GetInstance()->FindConfigByName(configNameStr);
+    if (!p) {
+        LOG_INFO(sLogger,
+                 ("error", "GetPipelineHandle can not find config, maybe config updated")("config", configNameStr));
+        return -2;
+    }
+
+    lock_guard<mutex> lock(instance->mPipelineHandleMux);
+    auto iter = instance->mPipelineHandleByName.find(configNameStr);
+    if (iter != instance->mPipelineHandleByName.end()) {
+        auto handleIter = instance->mPipelineHandles.find(iter->second);
+        if (handleIter != instance->mPipelineHandles.end()) {
+            if (handleIter->second.second.lock() == p) {
+                return iter->second;
+            }
+            instance->mPipelineHandles.erase(handleIter);
+        }
+    }
+    long long handle = instance->mNextPipelineHandle++;
+    instance->mPipelineHandles.emplace(handle, make_pair(configNameStr, weak_ptr<CollectionPipeline>(p)));
+    instance->mPipelineHandleByName[configNameStr] = handle;
+    return handle;
+}
+
+int LogtailPlugin::SendPbBatch(long long pipelineHandle,
+                               const char* logstoreName,
+                               int logstoreSize,
+                               char* pbBuffer,
+                               int* pbSizes,
+                               int count,
+                               int lines,
+                               const char* shardHash,
+                               int shardHashSize) {
+    LogtailPlugin* instance = LogtailPlugin::GetInstance();
+    shared_ptr<CollectionPipeline> p;
+    {
+        lock_guard<mutex> lock(instance->mPipelineHandleMux);
+        auto iter = instance->mPipelineHandles.find(pipelineHandle);
+        if (iter != instance->mPipelineHandles.end()) {
+            p = iter->second.second.lock();
+            if (!p) {
+                // pipeline has been updated or removed
+                auto nameIter = instance->mPipelineHandleByName.find(iter->second.first);
+                if (nameIter != instance->mPipelineHandleByName.end() && nameIter->second == pipelineHandle) {
+                    instance->mPipelineHandleByName.erase(nameIter);
+                }
+                instance->mPipelineHandles.erase(iter);
+            }
+        }
+    }
+    if (!p) {
+        LOG_INFO(sLogger,
+                 ("error", "SendPbBatch can not find pipeline, maybe config updated")("handle", pipelineHandle));
+        return -2;
+    }
+    if (count <= 0) {
+        return 0;
+    }
+
+    if (p->IsRoutingGoPipelineData()) {
+        return SendToNativeFlushers(*p, pbBuffer, pbSizes, count);
+    }
+
+    string logstore;
+    if (logstoreSize > 0 && logstoreName != NULL) {
+        logstore.assign(logstoreName, (size_t)logstoreSize);
+    }
+    string shardHashStr;
+    if (shardHashSize > 0) {
+        shardHashStr.assign(shardHash, static_cast<size_t>(shardHashSize));
+    }
+    auto pConfig = const_cast<FlusherSLS*>(static_cast<const FlusherSLS*>(p->GetFlushers()[0]->GetPlugin()));
+    return pConfig->SendBatch(pbBuffer, pbSizes, static_cast<size_t>(count), shardHashStr, logstore) ? 0 : -1;
+}
+
+int LogtailPlugin::SendToNativeFlushers(CollectionPipeline& pipeline,
+                                        const char* pbBuffer,
+                                        const int* pbSizes,
+                                        int count) {
+    vector<PipelineEventGroup> groupList;
+    groupList.reserve(count);
+    const char* data = pbBuffer;
+    for (int i = 0; i < count; ++i) {
+        groupList.emplace_back(make_shared<SourceBuffer>());
+        string errorMsg;
+        if (!LogGroupDeserializer::Deserialize(data, pbSizes[i], groupList.back(), errorMsg)) {
+            LOG_WARNING(sLogger,
+                        ("failed to decode log group from go pipeline",
+                         errorMsg)("action", "discard data")("config", pipeline.Name()));
+            AlarmManager::GetInstance()->SendAlarm(DISCARD_DATA_ALARM,
+                                                   "failed to decode log group from go pipeline: " + errorMsg
+                                                       + "\taction: discard data\tconfig: " + pipeline.Name());
+            groupList.pop_back();
+        }
+        data += pbSizes[i];
+    }
+    return pipeline.Send(std::move(groupList)) ? 0 : -1;
+}
+
 int LogtailPlugin::ExecPluginCmd(
     const char* configName, int configNameSize, int cmdId, const char* params, int paramsLen) {
     if (cmdId < (int)PLUGIN_CMD_MIN || cmdId > (int)PLUGIN_CMD_MAX) {
@@ -340,28 +450,40 @@ bool LogtailPlugin::LoadPluginBase() {
             return mPluginValid;
         }
         int version = versionFun();
-        if (!(version / 100 == 2 || version / 100 == 3)) {
+        if (!(version / 100 == 2 || version / 100 == 3 || version / 100 == 4)) {
             LOG_ERROR(sLogger, ("invalid plugin adapter version, version", version));
             return mPluginValid;
         }
         LOG_INFO(sLogger, ("valid plugin adapter version, version", version));
 
-        // Be compatible with old libGoPluginAdapter.so, V2 -> V1.
-        auto registerV2Fun = (RegisterLogtailCallBackV2)loader.LoadMethod("RegisterLogtailCallBackV2", error);
+        // Be compatible with old libGoPluginAdapter.so, V3 -> V2 -> V1.
+        auto registerV3Fun = (RegisterLogtailCallBackV3)loader.LoadMethod("RegisterLogtailCallBackV3", error);
         if (error.empty()) {
-            registerV2Fun(LogtailPlugin::IsValidToSend,
+            registerV3Fun(LogtailPlugin::IsValidToSend,
                           LogtailPlugin::SendPb,
                           LogtailPlugin::SendPbV2,
-                          LogtailPlugin::ExecPluginCmd);
+                          LogtailPlugin::ExecPluginCmd,
+                          LogtailPlugin::GetPipelineHandle,
+                          LogtailPlugin::SendPbBatch);
         } else {
-            LOG_WARNING(sLogger, ("load RegisterLogtailCallBackV2 failed", error)("try to load V1", ""));
-
-            auto registerFun = (RegisterLogtailCallBack)loader.LoadMethod("RegisterLogtailCallBack", error);
-            if (!error.empty()) {
-                LOG_WARNING(sLogger, ("load RegisterLogtailCallBack failed", error));
-                return mPluginValid;
+            LOG_WARNING(sLogger, ("load RegisterLogtailCallBackV3 failed", error)("try to load V2", ""));
+
+            auto registerV2Fun = (RegisterLogtailCallBackV2)loader.LoadMethod("RegisterLogtailCallBackV2", error);
+            if (error.empty()) {
+                registerV2Fun(LogtailPlugin::IsValidToSend,
+                              LogtailPlugin::SendPb,
+                              LogtailPlugin::SendPbV2,
+                              LogtailPlugin::ExecPluginCmd);
+            } else {
+                LOG_WARNING(sLogger, ("load RegisterLogtailCallBackV2 failed", error)("try to load V1", ""));
+
+                auto registerFun = (RegisterLogtailCallBack)loader.LoadMethod("RegisterLogtailCallBack", error);
+                if (!error.empty()) {
+                    LOG_WARNING(sLogger, ("load RegisterLogtailCallBack failed", error));
+                    return mPluginValid;
+                }
+                registerFun(LogtailPlugin::IsValidToSend, LogtailPlugin::SendPb, LogtailPlugin::ExecPluginCmd);
             }
-            registerFun(LogtailPlugin::IsValidToSend, LogtailPlugin::SendPb, LogtailPlugin::ExecPluginCmd);
         }
 
         mPluginAdapterPtr = loader.Release();
@@ -22,8 +22,11 @@
 
 #include <cstdint>
 
+#include <memory>
+#include <mutex>
 #include <numeric>
 #include <sstream>
+#include <string>
 #include <unordered_map>
 #include <utility>
 
@@ -165,6 +168,16 @@ typedef int (*SendPbV2Fun)(const char* configName,
                            int lines,
                            const char* shardHash,
                            int shardHashSize);
+typedef long long (*GetPipelineHandleFun)(const char* configName, int configNameSize);
+typedef int (*SendPbBatchFun)(long long pipelineHandle,
+                              const char* logstore,
+                              int logstoreSize,
+                              char* pbBuffer,
+                              int* pbSizes,
+                              int count,
+                              int lines,
+                              const char* shardHash,
+                              int shardHashSize);
 
 typedef int (*PluginCtlCmdFun)(
     const char* configName, int configNameSize, int optId, const char* params, int paramsLen);
@@ -174,6 +187,12 @@ typedef void (*RegisterLogtailCallBackV2)(IsValidToSendFun checkFun,
                                           SendPbFun sendFun,
                                           SendPbV2Fun sendV2Fun,
                                           PluginCtlCmdFun cmdFun);
+typedef void (*RegisterLogtailCallBackV3)(IsValidToSendFun checkFun,
+                                          SendPbFun sendFun,
+                                          SendPbV2Fun sendV2Fun,
+                                          PluginCtlCmdFun cmdFun,
+                                          GetPipelineHandleFun getHandleFun,
+                                          SendPbBatchFun sendBatchFun);
 
 typedef int (*PluginAdapterVersion)();
 }
@@ -252,6 +271,21 @@ public:
                         const char* shardHash,
                         int shardHashSize);
 
+    // the handle saves go pipeline from looking up the pipeline by name on each send, and is invalidated when the
+    // pipeline is updated, then -2 is returned by SendPbBatch and a new handle should be got
+    static long long GetPipelineHandle(const char* configName, int configNameSize);
+
+    // pbBuffer holds count serialized log groups of the same logstore and shard hash in sequence
+    static int SendPbBatch(long long pipelineHandle,
+                           const char* logstore,
+                           int logstoreSize,
+                           char* pbBuffer,
+                           int* pbSizes,
+                           int count,
+                           int lines,
+                           const char* shardHash,
+                           int shardHashSize);
+
     static int ExecPluginCmd(const char* configName, int configNameSize, int cmdId, const char* params, int paramsLen);
 
     K8sContainerMeta GetContainerMeta(const std::string& containerID);
@@ -259,6 +293,12 @@ public:
     void GetGoMetrics(std::vector<std::map<std::string, std::string>>& metircsList, const std::string& metricType);
 
 private:
+    // decodes log groups returned from go pipeline and routes them to all native flushers of the pipeline
+    static int SendToNativeFlushers(logtail::CollectionPipeline& pipeline,
+                                    const char* pbBuffer,
+                                    const int* pbSizes,
+                                    int count);
+
     void* mPluginBasePtr;
     void* mPluginAdapterPtr;
 
@@ -280,6 +320,12 @@ private:
     // Configuration for plugin system in JSON format.
     Json::Value mPluginCfg;
 
+    std::mutex mPipelineHandleMux;
+    // handle -> (config name, pipeline)
+    std::unordered_map<long long, std::pair<std::string, std::weak_ptr<logtail::CollectionPipeline>>> mPipelineHandles;
+    std::unordered_map<std::string, long long> mPipelineHandleByName;
+    long long mNextPipelineHandle = 0;
+
 private:
     static LogtailPlugin* s_instance;
 };
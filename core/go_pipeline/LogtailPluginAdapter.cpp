@@ -19,6 +19,8 @@
 IsValidToSendFun gAdapterIsValidToSendFun = NULL;
 SendPbFun gAdapterSendPbFun = NULL;
 SendPbV2Fun gAdapterSendPbV2Fun = NULL;
+GetPipelineHandleFun gAdapterGetPipelineHandleFun = NULL;
+SendPbBatchFun gAdapterSendPbBatchFun = NULL;
 PluginCtlCmdFun gPluginCtlCmdFun = NULL;
 
 void RegisterLogtailCallBack(IsValidToSendFun checkFun, SendPbFun sendFun, PluginCtlCmdFun cmdFun) {
@@ -39,6 +41,28 @@ void RegisterLogtailCallBackV2(IsValidToSendFun checkFun,
     gPluginCtlCmdFun = cmdFun;
 }
 
+void RegisterLogtailCallBackV3(IsValidToSendFun checkFun,
+                               SendPbFun sendV1Fun,
+                               SendPbV2Fun sendV2Fun,
+                               PluginCtlCmdFun cmdFun,
+                               GetPipelineHandleFun getHandleFun,
+                               SendPbBatchFun sendBatchFun) {
+    fprintf(stderr,
+            "register fun v3 %p %p %p %p %p %p\n",
+            checkFun,
+            sendV1Fun,
+            sendV2Fun,
+            cmdFun,
+            getHandleFun,
+            sendBatchFun);
+    gAdapterIsValidToSendFun = checkFun;
+    gAdapterSendPbFun = sendV1Fun;
+    gAdapterSendPbV2Fun = sendV2Fun;
+    gPluginCtlCmdFun = cmdFun;
+    gAdapterGetPipelineHandleFun = getHandleFun;
+    gAdapterSendPbBatchFun = sendBatchFun;
+}
+
 int LogtailIsValidToSend(long long logstoreKey) {
     if (gAdapterIsValidToSendFun == NULL) {
         return -1;
@@ -75,6 +99,29 @@ int LogtailSendPbV2(const char* configName,
         configName, configNameSize, logstore, logstoreSize, pbBuffer, pbSize, lines, shardHash, shardHashSize);
 }
 
+long long LogtailGetPipelineHandle(const char* configName, int configNameSize) {
+    if (NULL == gAdapterGetPipelineHandleFun) {
+        return -1;
+    }
+    return gAdapterGetPipelineHandleFun(configName, configNameSize);
+}
+
+int LogtailSendPbBatch(long long pipelineHandle,
+                       const char* logstore,
+                       int logstoreSize,
+                       char* pbBuffer,
+                       int* pbSizes,
+                       int count,
+                       int lines,
+                       const char* shardHash,
+                       int shardHashSize) {
+    if (NULL == gAdapterSendPbBatchFun) {
+        return -1;
+    }
+    return gAdapterSendPbBatchFun(
+        pipelineHandle, logstore, logstoreSize, pbBuffer, pbSizes, count, lines, shardHash, shardHashSize);
+}
+
 int LogtailCtlCmd(const char* configName, int configNameSize, int optId, const char* params, int paramsLen) {
     if (gPluginCtlCmdFun == NULL) {
         return -1;
@@ -85,6 +132,9 @@ int LogtailCtlCmd(const char* configName, int configNameSize, int optId, const c
 // # 300
 //   - Add LogtailSendPbV2.
 //   - Update RegisterLogtailCallBack to register LogtailSendPBV2.
+// # 400
+//   - Add LogtailGetPipelineHandle and LogtailSendPbBatch.
+//   - Add RegisterLogtailCallBackV3 to register them.
 int PluginAdapterVersion() {
-    return 300;
+    return 400;
 }
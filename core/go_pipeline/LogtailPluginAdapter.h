@@ -46,6 +46,16 @@ typedef int (*SendPbV2Fun)(const char* configName,
                            int lines,
                            const char* shardHash,
                            int shardHashSize);
+typedef long long (*GetPipelineHandleFun)(const char* configName, int configNameSize);
+typedef int (*SendPbBatchFun)(long long pipelineHandle,
+                              const char* logstore,
+                              int logstoreSize,
+                              char* pbBuffer,
+                              int* pbSizes,
+                              int count,
+                              int lines,
+                              const char* shardHash,
+                              int shardHashSize);
 typedef int (*PluginCtlCmdFun)(
     const char* configName, int configNameSize, int optId, const char* params, int paramsLen);
 
@@ -56,6 +66,13 @@ PLUGIN_ADAPTER_API void RegisterLogtailCallBackV2(IsValidToSendFun checkFun,
                                                   SendPbV2Fun sendV2Fun,
                                                   PluginCtlCmdFun cmdFun);
 
+PLUGIN_ADAPTER_API void RegisterLogtailCallBackV3(IsValidToSendFun checkFun,
+                                                  SendPbFun sendV1Fun,
+                                                  SendPbV2Fun sendV2Fun,
+                                                  PluginCtlCmdFun cmdFun,
+                                                  GetPipelineHandleFun getHandleFun,
+                                                  SendPbBatchFun sendBatchFun);
+
 PLUGIN_ADAPTER_API int LogtailIsValidToSend(long long logstoreKey);
 
 PLUGIN_ADAPTER_API int LogtailSendPb(const char* configName,
@@ -76,6 +93,20 @@ PLUGIN_ADAPTER_API int LogtailSendPbV2(const char* configName,
                                        const char* shardHash,
                                        int shardHashSize);
 
+// handle of the pipeline, which stays valid until LogtailSendPbBatch returns -2, or negative if not found
+PLUGIN_ADAPTER_API long long LogtailGetPipelineHandle(const char* configName, int configNameSize);
+
+// pbBuffer holds count serialized log groups in sequence, whose sizes are given by pbSizes
+PLUGIN_ADAPTER_API int LogtailSendPbBatch(long long pipelineHandle,
+                                          const char* logstore,
+                                          int logstoreSize,
+                                          char* pbBuffer,
+                                          int* pbSizes,
+                                          int count,
+                                          int lines,
+                                          const char* shardHash,
+                                          int shardHashSize);
+
 PLUGIN_ADAPTER_API int
 LogtailCtlCmd(const char* configName, int configNameSize, int cmdId, const char* params, int paramsLen);
 
@@ -57,6 +57,8 @@ void HostMonitorInputRunner::UpdateCollector(const std::vector<std::string>& new
                                              QueueKey processQueueKey,
                                              size_t inputIndex) {
     std::unique_lock<std::shared_mutex> lock(mRegisteredCollectorMapMutex);
+    // collectors added together start at the same tick, so that they can share the /proc snapshot
+    auto now = std::chrono::steady_clock::now();
     for (size_t i = 0; i < newCollectorNames.size(); ++i) {
         const auto& collectorName = newCollectorNames[i];
         auto iter = mRegisteredCollectorMap.find(collectorName);
@@ -69,7 +71,6 @@ void HostMonitorInputRunner::UpdateCollector(const std::vector<std::string>& new
         // add timer event
         HostMonitorTimerEvent::CollectConfig collectConfig(
             collectorName, processQueueKey, inputIndex, std::chrono::seconds(newCollectorIntervals[i]));
-        auto now = std::chrono::steady_clock::now();
         auto event = std::make_unique<HostMonitorTimerEvent>(now, collectConfig);
         Timer::GetInstance()->PushEvent(std::move(event));
         LOG_INFO(sLogger, ("host monitor", "add new collector")("collector", collectorName));
@@ -149,6 +150,7 @@ void HostMonitorInputRunner::ScheduleOnce(const std::chrono::steady_clock::time_
         return;
     }
 
+    config.mExecTime = execTime;
     auto collectFn = [this, config, execTime]() mutable {
         PipelineEventGroup group(std::make_shared<SourceBuffer>());
         std::unique_lock<std::shared_mutex> lock(mRegisteredCollectorMapMutex);
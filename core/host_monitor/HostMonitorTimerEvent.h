@@ -31,6 +31,8 @@ public:
         QueueKey mProcessQueueKey;
         size_t mInputIndex;
         std::chrono::seconds mInterval;
+        // exec time of the tick being collected, collectors due at the same tick share one ProcSnapshot
+        std::chrono::steady_clock::time_point mExecTime;
 
         CollectConfig(const std::string& collectorName,
                       QueueKey processQueueKey,
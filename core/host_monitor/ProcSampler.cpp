@@ -0,0 +1,207 @@
+/*
+ * Copyright 2025 iLogtail Authors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "host_monitor/ProcSampler.h"
+
+#include <dirent.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <cstring>
+#include <thread>
+
+#include "common/Flags.h"
+#include "host_monitor/Constants.h"
+
+DEFINE_FLAG_INT32(process_collect_silent_count, "number of process scanned between a sleep", 1000);
+
+using namespace std;
+
+namespace logtail {
+
+// most /proc files needed are smaller than this, larger ones are read by several chunks
+static const size_t kProcReadChunkSize = 1024;
+
+bool ProcSnapshot::GetSystemStat(StringView& content, string& errorMessage) {
+    lock_guard<mutex> lock(mSystemStatMux);
+    if (!mSystemStatLoaded) {
+        mSystemStatLoaded = true;
+        mSystemStat.clear();
+        mSystemStatValid
+            = ProcSampler::GetInstance()->ReadProcFile(PROCESS_STAT.c_str(), mSystemStat, &mSystemStatError);
+    }
+    if (!mSystemStatValid) {
+        errorMessage = mSystemStatError;
+        return false;
+    }
+    content = mSystemStat;
+    return true;
+}
+
+bool ProcSnapshot::GetProcessStats(const vector<ProcessStatItem>*& items, string& errorMessage) {
+    lock_guard<mutex> lock(mProcessStatMux);
+    if (!mProcessStatLoaded) {
+        mProcessStatLoaded = true;
+        mProcessStatValid = ProcSampler::GetInstance()->walkProcess(*this);
+    }
+    if (!mProcessStatValid) {
+        errorMessage = mProcessStatError;
+        return false;
+    }
+    items = &mProcessStats;
+    return true;
+}
+
+void ProcSnapshot::reset(const chrono::steady_clock::time_point& tick) {
+    mTick = tick;
+    mSystemStatLoaded = false;
+    mSystemStatValid = false;
+    mProcessStatLoaded = false;
+    mProcessStatValid = false;
+}
+
+shared_ptr<ProcSnapshot> ProcSampler::GetSnapshot(const chrono::steady_clock::time_point& tick) {
+    if (tick == chrono::steady_clock::time_point()) {
+        return make_shared<ProcSnapshot>();
+    }
+    lock_guard<mutex> lock(mSnapshotMux);
+    if (mSnapshot && mSnapshot->mTick == tick) {
+        return mSnapshot;
+    }
+    // the snapshot of the last tick is not used by any collector, so its buffers can be reused
+    if (mSnapshot && mSnapshot.use_count() == 1) {
+        mSnapshot->reset(tick);
+        return mSnapshot;
+    }
+    mSnapshot = make_shared<ProcSnapshot>();
+    mSnapshot->mTick = tick;
+    return mSnapshot;
+}
+
+int ProcSampler::getProcDirFd() {
+    lock_guard<mutex> lock(mProcDirMux);
+    const string& path = PROCESS_DIR.native();
+    if (mProcDirFd >= 0 && path == mProcDirPath) {
+        return mProcDirFd;
+    }
+    if (mProcDirFd >= 0) {
+        close(mProcDirFd);
+    }
+    mProcDirFd = open(path.c_str(), O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+    mProcDirPath = path;
+    return mProcDirFd;
+}
+
+bool ProcSampler::ReadProcFile(const char* relPath, string& content, string* errorMessage) {
+    int dirFd = getProcDirFd();
+    if (dirFd < 0) {
+        if (errorMessage != nullptr) {
+            *errorMessage = "failed to open dir " + PROCESS_DIR.string() + ": " + strerror(errno);
+        }
+        return false;
+    }
+    int fd = openat(dirFd, relPath, O_RDONLY | O_CLOEXEC);
+    if (fd < 0) {
+        if (errorMessage != nullptr) {
+            *errorMessage = "failed to open file " + (PROCESS_DIR / relPath).string() + ": " + strerror(errno);
+        }
+        return false;
+    }
+    const size_t begin = content.size();
+    size_t len = 0;
+    while (true) {
+        if (content.size() < begin + len + kProcReadChunkSize) {
+            content.resize(begin + len + kProcReadChunkSize);
+        }
+        ssize_t n = read(fd, &content[begin + len], content.size() - begin - len);
+        if (n < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            if (errorMessage != nullptr) {
+                *errorMessage = "failed to read file " + (PROCESS_DIR / relPath).string() + ": " + strerror(errno);
+            }
+            close(fd);
+            content.resize(begin);
+            return false;
+        }
+        if (n == 0) {
+            break;
+        }
+        len += n;
+    }
+    close(fd);
+    content.resize(begin + len);
+    return true;
+}
+
+bool ProcSampler::walkProcess(ProcSnapshot& snapshot) {
+    snapshot.mProcessStatBuffer.clear();
+    snapshot.mProcessStats.clear();
+    int dirFd = getProcDirFd();
+    // the dup shares the offset with dirFd, which is rewound before reading
+    int walkFd = dirFd < 0 ? -1 : dup(dirFd);
+    DIR* dir = walkFd < 0 ? nullptr : fdopendir(walkFd);
+    if (dir == nullptr) {
+        snapshot.mProcessStatError = "failed to open dir " + PROCESS_DIR.string() + ": " + strerror(errno);
+        if (walkFd >= 0) {
+            close(walkFd);
+        }
+        return false;
+    }
+    rewinddir(dir);
+
+    // views are built after the walk, since the buffer may be reallocated during it
+    vector<size_t> offsets;
+    char relPath[32];
+    int readCount = 0;
+    struct dirent* entry = nullptr;
+    while ((entry = readdir(dir)) != nullptr) {
+        if (entry->d_type != DT_DIR && entry->d_type != DT_UNKNOWN) {
+            continue;
+        }
+        pid_t pid = 0;
+        size_t nameLen = strlen(entry->d_name);
+        if (nameLen + sizeof("/stat") > sizeof(relPath) || !ParseProcNumber(StringView(entry->d_name, nameLen), pid)
+            || pid <= 0) {
+            continue;
+        }
+        if (++readCount > INT32_FLAG(process_collect_silent_count)) {
+            readCount = 0;
+            this_thread::sleep_for(chrono::milliseconds(100));
+        }
+        memcpy(relPath, entry->d_name, nameLen);
+        memcpy(relPath + nameLen, "/stat", sizeof("/stat"));
+        size_t offset = snapshot.mProcessStatBuffer.size();
+        // the process may exit during the walk
+        if (!ReadProcFile(relPath, snapshot.mProcessStatBuffer)) {
+            continue;
+        }
+        offsets.push_back(offset);
+        snapshot.mProcessStats.push_back({pid, StringView()});
+    }
+    closedir(dir);
+
+    const char* data = snapshot.mProcessStatBuffer.data();
+    for (size_t i = 0; i < offsets.size(); ++i) {
+        size_t end = i + 1 < offsets.size() ? offsets[i + 1] : snapshot.mProcessStatBuffer.size();
+        snapshot.mProcessStats[i].mStat = StringView(data + offsets[i], end - offsets[i]);
+    }
+    return true;
+}
+
+} // namespace logtail
@@ -0,0 +1,151 @@
+/*
+ * Copyright 2025 iLogtail Authors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <sys/types.h>
+
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "models/StringView.h"
+
+namespace logtail {
+
+// ProcSnapshot holds the content of /proc files sampled for one HostMonitorTimerEvent tick. Each part is read lazily
+// by the first collector asking for it, and then shared by all other collectors executed at the same tick.
+class ProcSnapshot {
+public:
+    struct ProcessStatItem {
+        pid_t mPid;
+        StringView mStat; // content of /proc/[pid]/stat, points into the snapshot
+    };
+
+    // content of /proc/stat
+    // @return false if the file cannot be read, and errorMessage is set
+    bool GetSystemStat(StringView& content, std::string& errorMessage);
+    // all processes and the content of their /proc/[pid]/stat, processes exiting during the walk are skipped
+    // @return false if /proc cannot be opened, and errorMessage is set
+    bool GetProcessStats(const std::vector<ProcessStatItem>*& items, std::string& errorMessage);
+
+private:
+    void reset(const std::chrono::steady_clock::time_point& tick);
+
+    std::chrono::steady_clock::time_point mTick;
+
+    std::mutex mSystemStatMux;
+    bool mSystemStatLoaded = false;
+    bool mSystemStatValid = false;
+    std::string mSystemStat;
+    std::string mSystemStatError;
+
+    std::mutex mProcessStatMux;
+    bool mProcessStatLoaded = false;
+    bool mProcessStatValid = false;
+    // all /proc/[pid]/stat are read into one buffer, which is reused by the following snapshots
+    std::string mProcessStatBuffer;
+    std::vector<ProcessStatItem> mProcessStats;
+    std::string mProcessStatError;
+
+    friend class ProcSampler;
+};
+
+// ProcSampler reads /proc by openat relative to a cached /proc dirfd instead of building paths and opening them with
+// std::filesystem, and shares one ProcSnapshot between the collectors due at the same tick, so that /proc is walked
+// only once however many collectors are configured.
+class ProcSampler {
+public:
+    static ProcSampler* GetInstance() {
+        static ProcSampler* ptr = new ProcSampler();
+        return ptr;
+    }
+
+    // @param tick the exec time of the timer event, a default one means a new snapshot not shared with others
+    std::shared_ptr<ProcSnapshot> GetSnapshot(const std::chrono::steady_clock::time_point& tick = {});
+
+    // read file relative to PROCESS_DIR and append it to content
+    bool ReadProcFile(const char* relPath, std::string& content, std::string* errorMessage = nullptr);
+
+private:
+    ProcSampler() = default;
+    ~ProcSampler() = default;
+
+    // dirfd of PROCESS_DIR, reopened once PROCESS_DIR changes
+    int getProcDirFd();
+    bool walkProcess(ProcSnapshot& snapshot);
+
+    std::mutex mSnapshotMux;
+    std::shared_ptr<ProcSnapshot> mSnapshot;
+
+    std::mutex mProcDirMux;
+    int mProcDirFd = -1;
+    std::string mProcDirPath;
+
+    friend class ProcSnapshot;
+#ifdef APSARA_UNIT_TEST_MAIN
+    friend class ProcSamplerUnittest;
+#endif
+};
+
+// Hand-rolled parsers of /proc fields, which never allocate or throw.
+
+// Get the next field separated by spaces from pos.
+// @return false if there is no more field
+inline bool NextProcField(StringView line, size_t& pos, StringView& field) {
+    while (pos < line.size() && line[pos] == ' ') {
+        ++pos;
+    }
+    if (pos >= line.size() || line[pos] == '\n') {
+        return false;
+    }
+    size_t begin = pos;
+    while (pos < line.size() && line[pos] != ' ' && line[pos] != '\n') {
+        ++pos;
+    }
+    field = line.substr(begin, pos - begin);
+    return true;
+}
+
+// Parse a decimal field with an optional sign.
+// @return false if field is not a valid number, and value is left unchanged
+template <typename T>
+bool ParseProcNumber(StringView field, T& value) {
+    size_t i = 0;
+    bool negative = false;
+    if (!field.empty() && field[0] == '-') {
+        negative = true;
+        ++i;
+    }
+    if (i == field.size()) {
+        return false;
+    }
+    uint64_t result = 0;
+    for (; i < field.size(); ++i) {
+        char c = field[i];
+        if (c < '0' || c > '9') {
+            return false;
+        }
+        result = result * 10 + static_cast<uint64_t>(c - '0');
+    }
+    value = negative ? static_cast<T>(-static_cast<int64_t>(result)) : static_cast<T>(result);
+    return true;
+}
+
+} // namespace logtail
@@ -18,13 +18,9 @@
 
 #include <string>
 
-#include "boost/algorithm/string.hpp"
-#include "boost/algorithm/string/split.hpp"
-
 #include "MetricValue.h"
-#include "common/StringTools.h"
 #include "host_monitor/Constants.h"
-#include "host_monitor/SystemInformationTools.h"
+#include "host_monitor/ProcSampler.h"
 #include "logger/Logger.h"
 
 namespace logtail {
@@ -38,7 +34,7 @@ bool CPUCollector::Collect(const HostMonitorTimerEvent::CollectConfig& collectCo
         return false;
     }
     std::vector<CPUStat> cpus;
-    if (!GetHostSystemCPUStat(cpus)) {
+    if (!GetHostSystemCPUStat(cpus, collectConfig.mExecTime)) {
         return false;
     }
     const time_t now = time(nullptr);
@@ -77,10 +73,12 @@ bool CPUCollector::Collect(const HostMonitorTimerEvent::CollectConfig& collectCo
     return true;
 }
 
-bool CPUCollector::GetHostSystemCPUStat(std::vector<CPUStat>& cpus) {
-    std::vector<std::string> cpuLines;
+bool CPUCollector::GetHostSystemCPUStat(std::vector<CPUStat>& cpus,
+                                        const std::chrono::steady_clock::time_point& execTime) {
+    auto snapshot = ProcSampler::GetInstance()->GetSnapshot(execTime);
+    StringView content;
     std::string errorMessage;
-    if (!GetHostSystemStat(cpuLines, errorMessage)) {
+    if (!snapshot->GetSystemStat(content, errorMessage)) {
         if (mValidState) {
             LOG_WARNING(sLogger, ("failed to get system cpu", "invalid CPU collector")("error msg", errorMessage));
             mValidState = false;
@@ -92,47 +90,52 @@ bool CPUCollector::GetHostSystemCPUStat(std::vector<CPUStat>& cpus) {
     // cpu0 14708487 14216 4613031 2108180843 57199 0 424744 0 0 0
     // ...
     cpus.clear();
-    cpus.reserve(cpuLines.size());
-    for (auto const& line : cpuLines) {
-        std::vector<std::string> cpuMetric;
-        boost::split(cpuMetric, line, boost::is_any_of(" "), boost::token_compress_on);
-        if (cpuMetric.size() > 0 && cpuMetric[0].substr(0, 3) == "cpu") {
-            CPUStat cpuStat{};
-            if (cpuMetric[0] == "cpu") {
-                cpuStat.index = -1;
-            } else {
-                try {
-                    cpuStat.index = StringTo<int32_t>(cpuMetric[0].substr(3));
-                } catch (...) {
-                    LOG_ERROR(sLogger, ("failed to parse cpu index", "skip")("wrong cpu index", cpuMetric[0]));
-                    continue;
-                }
-            }
-            cpuStat.user = ParseMetric(cpuMetric, EnumCpuKey::user);
-            cpuStat.nice = ParseMetric(cpuMetric, EnumCpuKey::nice);
-            cpuStat.system = ParseMetric(cpuMetric, EnumCpuKey::system);
-            cpuStat.idle = ParseMetric(cpuMetric, EnumCpuKey::idle);
-            cpuStat.iowait = ParseMetric(cpuMetric, EnumCpuKey::iowait);
-            cpuStat.irq = ParseMetric(cpuMetric, EnumCpuKey::irq);
-            cpuStat.softirq = ParseMetric(cpuMetric, EnumCpuKey::softirq);
-            cpuStat.steal = ParseMetric(cpuMetric, EnumCpuKey::steal);
-            cpuStat.guest = ParseMetric(cpuMetric, EnumCpuKey::guest);
-            cpuStat.guestNice = ParseMetric(cpuMetric, EnumCpuKey::guest_nice);
-            cpus.push_back(cpuStat);
+    size_t lineBegin = 0;
+    while (lineBegin < content.size()) {
+        size_t lineEnd = content.find('\n', lineBegin);
+        if (lineEnd == StringView::npos) {
+            lineEnd = content.size();
         }
-    }
-    return true;
-}
+        StringView line = content.substr(lineBegin, lineEnd - lineBegin);
+        lineBegin = lineEnd + 1;
 
-double CPUCollector::ParseMetric(const std::vector<std::string>& cpuMetric, EnumCpuKey key) const {
-    try {
-        if (cpuMetric.size() <= static_cast<size_t>(key)) {
-            return 0;
+        size_t pos = 0;
+        StringView name;
+        if (!NextProcField(line, pos, name) || !name.starts_with("cpu")) {
+            continue;
         }
-        return StringTo<double>(cpuMetric[static_cast<size_t>(key)]);
-    } catch (...) {
-        return 0.0;
+        CPUStat cpuStat{};
+        if (name.size() == 3) {
+            cpuStat.index = -1;
+        } else if (!ParseProcNumber(name.substr(3), cpuStat.index) || cpuStat.index < 0) {
+            LOG_ERROR(sLogger, ("failed to parse cpu index", "skip")("wrong cpu index", name.to_string()));
+            continue;
+        }
+        // fields missing in old kernels or not valid numbers are 0
+        double CPUStat::*const fields[] = {&CPUStat::user,
+                                           &CPUStat::nice,
+                                           &CPUStat::system,
+                                           &CPUStat::idle,
+                                           &CPUStat::iowait,
+                                           &CPUStat::irq,
+                                           &CPUStat::softirq,
+                                           &CPUStat::steal,
+                                           &CPUStat::guest,
+                                           &CPUStat::guestNice};
+        static_assert(sizeof(fields) / sizeof(fields[0]) == static_cast<size_t>(EnumCpuKey::guest_nice),
+                      "cpu fields mismatch");
+        StringView field;
+        for (auto member : fields) {
+            if (!NextProcField(line, pos, field)) {
+                break;
+            }
+            uint64_t value = 0;
+            ParseProcNumber(field, value);
+            cpuStat.*member = static_cast<double>(value);
+        }
+        cpus.push_back(cpuStat);
     }
+    return true;
 }
 
 } // namespace logtail
@@ -16,6 +16,7 @@
 
 #pragma once
 
+#include <chrono>
 #include <vector>
 
 #include "host_monitor/collector/BaseCollector.h"
@@ -61,8 +62,8 @@ public:
     const std::string& Name() const override { return sName; }
 
 private:
-    bool GetHostSystemCPUStat(std::vector<CPUStat>& cpus);
-    double ParseMetric(const std::vector<std::string>& cpuMetric, EnumCpuKey key) const;
+    // @param execTime the tick being collected, see ProcSampler::GetSnapshot
+    bool GetHostSystemCPUStat(std::vector<CPUStat>& cpus, const std::chrono::steady_clock::time_point& execTime = {});
 };
 
 } // namespace logtail
@@ -35,30 +35,25 @@
 #include "common/StringTools.h"
 #include "constants/EntityConstants.h"
 #include "host_monitor/Constants.h"
+#include "host_monitor/ProcSampler.h"
 #include "host_monitor/SystemInformationTools.h"
 #include "logger/Logger.h"
 #include "models/PipelineEventGroup.h"
 #include "models/StringView.h"
 
-DEFINE_FLAG_INT32(process_collect_silent_count, "number of process scanned between a sleep", 1000);
-
 namespace logtail {
 
 const size_t ProcessTopN = 20;
 
 const std::string ProcessEntityCollector::sName = "process_entity";
 
-// clang-format off
-ProcessEntityCollector::ProcessEntityCollector() : mProcessSilentCount(INT32_FLAG(process_collect_silent_count)) {};
-// clang-format on
-
 bool ProcessEntityCollector::Collect(const HostMonitorTimerEvent::CollectConfig& collectConfig,
                                      PipelineEventGroup* group) {
     if (group == nullptr) {
         return false;
     }
     std::vector<ProcessStatPtr> processes;
-    GetSortedProcess(processes, ProcessTopN);
+    GetSortedProcess(processes, ProcessTopN, collectConfig.mExecTime);
     for (auto process : processes) {
         auto* event = group->AddLogEvent();
         time_t logtime = time(nullptr);
@@ -111,7 +106,9 @@ bool ProcessEntityCollector::Collect(const HostMonitorTimerEvent::CollectConfig&
     return true;
 }
 
-void ProcessEntityCollector::GetSortedProcess(std::vector<ProcessStatPtr>& processStats, size_t topN) {
+void ProcessEntityCollector::GetSortedProcess(std::vector<ProcessStatPtr>& processStats,
+                                              size_t topN,
+                                              const steady_clock::time_point& execTime) {
     steady_clock::time_point now = steady_clock::now();
     auto compare = [](const std::pair<ProcessStatPtr, double>& a, const std::pair<ProcessStatPtr, double>& b) {
         return a.second > b.second;
@@ -121,26 +118,33 @@ void ProcessEntityCollector::GetSortedProcess(std::vector<ProcessStatPtr>& proce
                         decltype(compare)>
         queue(compare);
 
-    int readCount = 0;
+    auto snapshot = ProcSampler::GetInstance()->GetSnapshot(execTime);
+    const std::vector<ProcSnapshot::ProcessStatItem>* items = nullptr;
+    std::string errorMessage;
+    if (!snapshot->GetProcessStats(items, errorMessage)) {
+        if (mValidState) {
+            LOG_ERROR(sLogger,
+                      ("failed to walk processes", "invalid ProcessEntity collector")("error msg", errorMessage));
+            mValidState = false;
+        }
+        processStats.clear();
+        return;
+    }
+    mValidState = true;
+
     std::unordered_map<pid_t, ProcessStatPtr> newProcessStat;
-    WalkAllProcess(PROCESS_DIR, [&](const std::string& dirName) {
-        if (++readCount > mProcessSilentCount) {
-            readCount = 0;
-            std::this_thread::sleep_for(milliseconds{100});
+    newProcessStat.reserve(items->size());
+    for (const auto& item : *items) {
+        bool isFirstCollect = false;
+        auto ptr = GetProcessStat(item.mPid, item.mStat, isFirstCollect);
+        newProcessStat[item.mPid] = ptr;
+        if (ptr && !isFirstCollect) {
+            queue.emplace(ptr, ptr->cpuInfo.percent);
         }
-        auto pid = StringTo<pid_t>(dirName);
-        if (pid != 0) {
-            bool isFirstCollect = false;
-            auto ptr = GetProcessStat(pid, isFirstCollect);
-            newProcessStat[pid] = ptr;
-            if (ptr && !isFirstCollect) {
-                queue.emplace(ptr, ptr->cpuInfo.percent);
-            }
-            if (queue.size() > topN) {
-                queue.pop();
-            }
+        if (queue.size() > topN) {
+            queue.pop();
         }
-    });
+    }
 
     processStats.clear();
     processStats.reserve(queue.size());
@@ -159,7 +163,7 @@ void ProcessEntityCollector::GetSortedProcess(std::vector<ProcessStatPtr>& proce
     mProcessSortTime = now;
 }
 
-ProcessStatPtr ProcessEntityCollector::GetProcessStat(pid_t pid, bool& isFirstCollect) {
+ProcessStatPtr ProcessEntityCollector::GetProcessStat(pid_t pid, StringView stat, bool& isFirstCollect) {
     const auto now = steady_clock::now();
 
     // TODO: more accurate cache
@@ -174,7 +178,7 @@ ProcessStatPtr ProcessEntityCollector::GetProcessStat(pid_t pid, bool& isFirstCo
     if (prev != mPrevProcessStat.end() && prev->second && now < prev->second->lastTime + seconds{1}) {
         return prev->second;
     }
-    auto ptr = ReadNewProcessStat(pid);
+    auto ptr = ParseProcessStat(pid, stat);
     if (!ptr) {
         return nullptr;
     }
@@ -203,11 +207,12 @@ ProcessStatPtr ProcessEntityCollector::GetProcessStat(pid_t pid, bool& isFirstCo
 
 ProcessStatPtr ProcessEntityCollector::ReadNewProcessStat(pid_t pid) {
     LOG_DEBUG(sLogger, ("read process stat", pid));
-    auto processStat = PROCESS_DIR / std::to_string(pid) / PROCESS_STAT;
+    auto processStat = std::filesystem::path(std::to_string(pid)) / PROCESS_STAT;
 
     std::string line;
-    if (!ReadFileContent(processStat.string(), line)) {
-        LOG_ERROR(sLogger, ("read process stat", "fail")("file", processStat));
+    std::string errorMessage;
+    if (!ProcSampler::GetInstance()->ReadProcFile(processStat.c_str(), line, &errorMessage)) {
+        LOG_ERROR(sLogger, ("read process stat", "fail")("error msg", errorMessage));
         return nullptr;
     }
     return ParseProcessStat(pid, line);
@@ -218,74 +223,61 @@ ProcessStatPtr ProcessEntityCollector::ReadNewProcessStat(pid_t pid) {
 // 1 (cat) R 0 1 1 34816 1 4194560 1110 0 0 0 1 1 0 0 20 0 1 0 18938584 4505600 171 18446744073709551615 4194304 4238788
 // 140727020025920 0 0 0 0 0 0 0 0 0 17 3 0 0 0 0 0 6336016 6337300 21442560 140727020027760 140727020027777
 // 140727020027777 140727020027887 0
-ProcessStatPtr ProcessEntityCollector::ParseProcessStat(pid_t pid, std::string& line) {
+ProcessStatPtr ProcessEntityCollector::ParseProcessStat(pid_t pid, StringView line) {
     ProcessStatPtr ptr = std::make_shared<ProcessStat>();
     ptr->pid = pid;
     auto nameStartPos = line.find_first_of('(');
     auto nameEndPos = line.find_last_of(')');
-    if (nameStartPos == std::string::npos || nameEndPos == std::string::npos) {
-        LOG_ERROR(sLogger, ("can't find process name", pid)("stat", line));
+    if (nameStartPos == StringView::npos || nameEndPos == StringView::npos || nameEndPos < nameStartPos) {
+        LOG_ERROR(sLogger, ("can't find process name", pid)("stat", line.to_string()));
         return nullptr;
     }
     nameStartPos++; // 跳过左括号
-    ptr->name = line.substr(nameStartPos, nameEndPos - nameStartPos);
-    line = line.substr(nameEndPos + 2); // 跳过右括号及空格
-
-    std::vector<std::string> words = SplitString(line);
+    ptr->name.assign(line.data() + nameStartPos, nameEndPos - nameStartPos);
 
+    // fields after comm, parsed in place instead of being split into strings
     constexpr const EnumProcessStat offset = EnumProcessStat::state; // 跳过pid, comm
     constexpr const int minCount = EnumProcessStat::processor - offset + 1; // 37
-    if (words.size() < minCount) {
-        LOG_ERROR(sLogger, ("unexpected item count", pid)("stat", line));
+    StringView words[minCount];
+    size_t pos = nameEndPos + 1;
+    int count = 0;
+    while (count < minCount && NextProcField(line, pos, words[count])) {
+        ++count;
+    }
+    if (count < minCount) {
+        LOG_ERROR(sLogger, ("unexpected item count", pid)("stat", line.to_string()));
         return nullptr;
     }
+    auto field = [&](EnumProcessStat key) { return words[key - offset]; };
+    auto number = [&](EnumProcessStat key) {
+        int64_t value = 0;
+        ParseProcNumber(field(key), value);
+        return value;
+    };
 
-    ptr->state = words[EnumProcessStat::state - offset].front();
-    ptr->parentPid = StringTo<pid_t>(words[EnumProcessStat::ppid - offset]);
-    ptr->tty = StringTo<int>(words[EnumProcessStat::tty_nr - offset]);
-    ptr->minorFaults = StringTo<uint64_t>(words[EnumProcessStat::minflt - offset]);
-    ptr->majorFaults = StringTo<uint64_t>(words[EnumProcessStat::majflt - offset]);
-
-    ptr->utime = static_cast<milliseconds>(StringTo<uint64_t>(words[EnumProcessStat::utime - offset]));
-    ptr->stime = static_cast<milliseconds>(StringTo<uint64_t>(words[EnumProcessStat::stime - offset]));
-    ptr->cutime = static_cast<milliseconds>(StringTo<uint64_t>(words[EnumProcessStat::cutime - offset]));
-    ptr->cstime = static_cast<milliseconds>(StringTo<uint64_t>(words[EnumProcessStat::cstime - offset]));
-
-    ptr->priority = StringTo<int>(words[EnumProcessStat::priority - offset]);
-    ptr->nice = StringTo<int>(words[EnumProcessStat::nice - offset]);
-    ptr->numThreads = StringTo<int>(words[EnumProcessStat::num_threads - offset]);
-
-    ptr->startTime = system_clock::time_point{
-        static_cast<milliseconds>(StringTo<uint32_t>(words[EnumProcessStat::starttime - offset]))
-        + milliseconds{GetHostSystemBootTime() * 1000}};
-    ptr->vSize = StringTo<uint64_t>(words[EnumProcessStat::vsize - offset]);
-    ptr->rss = StringTo<uint64_t>(words[EnumProcessStat::rss - offset]) << (getpagesize());
-    ptr->processor = StringTo<int>(words[EnumProcessStat::processor - offset]);
+    ptr->state = field(EnumProcessStat::state).front();
+    ptr->parentPid = static_cast<pid_t>(number(EnumProcessStat::ppid));
+    ptr->tty = static_cast<int>(number(EnumProcessStat::tty_nr));
+    ptr->minorFaults = static_cast<uint64_t>(number(EnumProcessStat::minflt));
+    ptr->majorFaults = static_cast<uint64_t>(number(EnumProcessStat::majflt));
+
+    ptr->utime = milliseconds(number(EnumProcessStat::utime));
+    ptr->stime = milliseconds(number(EnumProcessStat::stime));
+    ptr->cutime = milliseconds(number(EnumProcessStat::cutime));
+    ptr->cstime = milliseconds(number(EnumProcessStat::cstime));
+
+    ptr->priority = static_cast<int>(number(EnumProcessStat::priority));
+    ptr->nice = static_cast<int>(number(EnumProcessStat::nice));
+    ptr->numThreads = static_cast<int>(number(EnumProcessStat::num_threads));
+
+    ptr->startTime = system_clock::time_point{milliseconds(number(EnumProcessStat::starttime))
+                                              + milliseconds{GetHostSystemBootTime() * 1000}};
+    ptr->vSize = static_cast<uint64_t>(number(EnumProcessStat::vsize));
+    ptr->rss = static_cast<uint64_t>(number(EnumProcessStat::rss)) * getpagesize();
+    ptr->processor = static_cast<int>(number(EnumProcessStat::processor));
     return ptr;
 }
 
-bool ProcessEntityCollector::WalkAllProcess(const std::filesystem::path& root,
-                                            const std::function<void(const std::string&)>& callback) {
-    if (!std::filesystem::exists(root) || !std::filesystem::is_directory(root)) {
-        if (mValidState) {
-            LOG_ERROR(sLogger,
-                      ("root path is not a directory or not exist", "invalid ProcessEntity collector")("root", root));
-            mValidState = false;
-        }
-        return false;
-    }
-    mValidState = true;
-
-    for (const auto& dirEntry :
-         std::filesystem::directory_iterator{root, std::filesystem::directory_options::skip_permission_denied}) {
-        std::string filename = dirEntry.path().filename().string();
-        if (IsInt(filename)) {
-            callback(filename);
-        }
-    }
-    return true;
-}
-
 const std::string
 ProcessEntityCollector::GetProcessEntityID(StringView pid, StringView createTime, StringView hostEntityID) {
     std::ostringstream oss;
@@ -137,7 +137,6 @@ constexpr int operator-(EnumProcessStat a, EnumProcessStat b) {
 
 class ProcessEntityCollector : public BaseCollector {
 public:
-    ProcessEntityCollector();
     ~ProcessEntityCollector() override = default;
 
     bool Collect(const HostMonitorTimerEvent::CollectConfig& collectConfig, PipelineEventGroup* group) override;
@@ -146,11 +145,13 @@ public:
     const std::string& Name() const override { return sName; }
 
 private:
-    void GetSortedProcess(std::vector<ProcessStatPtr>& processStats, size_t topN);
-    ProcessStatPtr GetProcessStat(pid_t pid, bool& isFirstCollect);
+    // @param execTime the tick being collected, see ProcSampler::GetSnapshot
+    void GetSortedProcess(std::vector<ProcessStatPtr>& processStats,
+                          size_t topN,
+                          const steady_clock::time_point& execTime = {});
+    ProcessStatPtr GetProcessStat(pid_t pid, StringView stat, bool& isFirstCollect);
     ProcessStatPtr ReadNewProcessStat(pid_t pid);
-    ProcessStatPtr ParseProcessStat(pid_t pid, std::string& line);
-    bool WalkAllProcess(const std::filesystem::path& root, const std::function<void(const std::string&)>& callback);
+    ProcessStatPtr ParseProcessStat(pid_t pid, StringView line);
 
     const std::string GetProcessEntityID(StringView pid, StringView createTime, StringView hostEntityID);
     void FetchDomainInfo(std::string& domain,
@@ -162,8 +163,6 @@ private:
     steady_clock::time_point mProcessSortTime;
     std::unordered_map<pid_t, ProcessStatPtr> mPrevProcessStat;
 
-    const int mProcessSilentCount;
-
 #ifdef APSARA_UNIT_TEST_MAIN
     friend class ProcessEntityCollectorUnittest;
 #endif
@@ -16,12 +16,18 @@
 
 #include "models/SpanEvent.h"
 
+#include <algorithm>
+
 #include "constants/SpanConstants.h"
 
 using namespace std;
 
 namespace logtail {
 
+static vector<pair<StringView, StringView>>::const_iterator FindTag(const SizedVectorTags& tags, StringView key) {
+    return find_if(tags.mInner.begin(), tags.mInner.end(), [&key](const auto& p) { return p.first == key; });
+}
+
 void SpanEvent::SpanLink::SetTraceId(const string& traceId) {
     const StringBuffer& b = GetSourceBuffer()->CopyString(traceId);
     mTraceId = StringView(b.data, b.size);
@@ -38,7 +44,7 @@ void SpanEvent::SpanLink::SetTraceState(const string& traceState) {
 }
 
 StringView SpanEvent::SpanLink::GetTag(StringView key) const {
-    auto it = mTags.mInner.find(key);
+    auto it = FindTag(mTags, key);
     if (it != mTags.mInner.end()) {
         return it->second;
     }
@@ -46,7 +52,7 @@ StringView SpanEvent::SpanLink::GetTag(StringView key) const {
 }
 
 bool SpanEvent::SpanLink::HasTag(StringView key) const {
-    return mTags.mInner.find(key) != mTags.mInner.end();
+    return FindTag(mTags, key) != mTags.mInner.end();
 }
 
 void SpanEvent::SpanLink::SetTag(StringView key, StringView val) {
@@ -118,7 +124,7 @@ void SpanEvent::InnerEvent::SetName(const string& name) {
 }
 
 StringView SpanEvent::InnerEvent::GetTag(StringView key) const {
-    auto it = mTags.mInner.find(key);
+    auto it = FindTag(mTags, key);
     if (it != mTags.mInner.end()) {
         return it->second;
     }
@@ -126,7 +132,7 @@ StringView SpanEvent::InnerEvent::GetTag(StringView key) const {
 }
 
 bool SpanEvent::InnerEvent::HasTag(StringView key) const {
-    return mTags.mInner.find(key) != mTags.mInner.end();
+    return FindTag(mTags, key) != mTags.mInner.end();
 }
 
 void SpanEvent::InnerEvent::SetTag(StringView key, StringView val) {
@@ -236,7 +242,7 @@ void SpanEvent::SetName(const string& name) {
 }
 
 StringView SpanEvent::GetTag(StringView key) const {
-    auto it = mTags.mInner.find(key);
+    auto it = FindTag(mTags, key);
     if (it != mTags.mInner.end()) {
         return it->second;
     }
@@ -244,7 +250,7 @@ StringView SpanEvent::GetTag(StringView key) const {
 }
 
 bool SpanEvent::HasTag(StringView key) const {
-    return mTags.mInner.find(key) != mTags.mInner.end();
+    return FindTag(mTags, key) != mTags.mInner.end();
 }
 
 void SpanEvent::SetTag(StringView key, StringView val) {
@@ -280,7 +286,7 @@ SpanEvent::SpanLink* SpanEvent::AddLink() {
 }
 
 StringView SpanEvent::GetScopeTag(StringView key) const {
-    auto it = mScopeTags.mInner.find(key);
+    auto it = FindTag(mScopeTags, key);
     if (it != mScopeTags.mInner.end()) {
         return it->second;
     }
@@ -288,7 +294,7 @@ StringView SpanEvent::GetScopeTag(StringView key) const {
 }
 
 bool SpanEvent::HasScopeTag(StringView key) const {
-    return mScopeTags.mInner.find(key) != mScopeTags.mInner.end();
+    return FindTag(mScopeTags, key) != mScopeTags.mInner.end();
 }
 
 void SpanEvent::SetScopeTag(StringView key, StringView val) {
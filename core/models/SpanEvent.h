@@ -33,6 +33,8 @@ namespace logtail {
 // 2. Attributes value only supports string
 // 3. Field InstrumentedScope in ScopeSpan is stored in mScopeTags
 // Besides, PipelineEventGroup is equivalent to ResourceSpan in otlp, with Resource Attributes stored in mTags
+// Tags are kept in insertion order in flat vectors, since spans carry a few tags which are mostly written once and then
+// iterated by serializers.
 class SpanEvent : public PipelineEvent {
     friend class PipelineEventGroup;
     friend class EventPool;
@@ -61,8 +63,10 @@ public:
         void SetTagNoCopy(const StringBuffer& key, const StringBuffer& val);
         void SetTagNoCopy(StringView key, StringView val);
         void DelTag(StringView key);
-        std::map<StringView, StringView>::const_iterator TagsBegin() const { return mTags.mInner.begin(); }
-        std::map<StringView, StringView>::const_iterator TagsEnd() const { return mTags.mInner.end(); }
+        std::vector<std::pair<StringView, StringView>>::const_iterator TagsBegin() const {
+            return mTags.mInner.begin();
+        }
+        std::vector<std::pair<StringView, StringView>>::const_iterator TagsEnd() const { return mTags.mInner.end(); }
         size_t TagsSize() const { return mTags.mInner.size(); }
 
         std::shared_ptr<SourceBuffer>& GetSourceBuffer();
@@ -80,7 +84,7 @@ public:
         StringView mTraceId;
         StringView mSpanId;
         StringView mTraceState;
-        SizedMap mTags;
+        SizedVectorTags mTags;
         SpanEvent* mParent = nullptr;
     };
 
@@ -101,8 +105,10 @@ public:
         void SetTagNoCopy(const StringBuffer& key, const StringBuffer& val);
         void SetTagNoCopy(StringView key, StringView val);
         void DelTag(StringView key);
-        std::map<StringView, StringView>::const_iterator TagsBegin() const { return mTags.mInner.begin(); }
-        std::map<StringView, StringView>::const_iterator TagsEnd() const { return mTags.mInner.end(); }
+        std::vector<std::pair<StringView, StringView>>::const_iterator TagsBegin() const {
+            return mTags.mInner.begin();
+        }
+        std::vector<std::pair<StringView, StringView>>::const_iterator TagsEnd() const { return mTags.mInner.end(); }
         size_t TagsSize() const { return mTags.mInner.size(); }
 
         std::shared_ptr<SourceBuffer>& GetSourceBuffer();
@@ -119,7 +125,7 @@ public:
 
         uint64_t mTimestampNs = 0;
         StringView mName;
-        SizedMap mTags;
+        SizedVectorTags mTags;
         SpanEvent* mParent = nullptr;
     };
 
@@ -163,8 +169,8 @@ public:
     void SetTagNoCopy(const StringBuffer& key, const StringBuffer& val);
     void SetTagNoCopy(StringView key, StringView val);
     void DelTag(StringView key);
-    std::map<StringView, StringView>::const_iterator TagsBegin() const { return mTags.mInner.begin(); }
-    std::map<StringView, StringView>::const_iterator TagsEnd() const { return mTags.mInner.end(); }
+    std::vector<std::pair<StringView, StringView>>::const_iterator TagsBegin() const { return mTags.mInner.begin(); }
+    std::vector<std::pair<StringView, StringView>>::const_iterator TagsEnd() const { return mTags.mInner.end(); }
     size_t TagsSize() const { return mTags.mInner.size(); }
 
     const std::vector<InnerEvent>& GetEvents() const { return mEvents; }
@@ -183,8 +189,12 @@ public:
     void SetScopeTagNoCopy(const StringBuffer& key, const StringBuffer& val);
     void SetScopeTagNoCopy(StringView key, StringView val);
     void DelScopeTag(StringView key);
-    std::map<StringView, StringView>::const_iterator ScopeTagsBegin() const { return mScopeTags.mInner.begin(); }
-    std::map<StringView, StringView>::const_iterator ScopeTagsEnd() const { return mScopeTags.mInner.end(); }
+    std::vector<std::pair<StringView, StringView>>::const_iterator ScopeTagsBegin() const {
+        return mScopeTags.mInner.begin();
+    }
+    std::vector<std::pair<StringView, StringView>>::const_iterator ScopeTagsEnd() const {
+        return mScopeTags.mInner.end();
+    }
     size_t ScopeTagsSize() const { return mScopeTags.mInner.size(); }
 
     size_t DataSize() const override;
@@ -205,11 +215,11 @@ private:
     Kind mKind = Kind::Unspecified;
     uint64_t mStartTimeNs = 0; // required
     uint64_t mEndTimeNs = 0; // required
-    SizedMap mTags;
+    SizedVectorTags mTags;
     std::vector<InnerEvent> mEvents;
     std::vector<SpanLink> mLinks;
     StatusCode mStatus = StatusCode::Unset;
-    SizedMap mScopeTags; // store InstrumentedScope info in otlp
+    SizedVectorTags mScopeTags; // store InstrumentedScope info in otlp
 
 #ifdef APSARA_UNIT_TEST_MAIN
     friend class SpanEventUnittest;
@@ -27,6 +27,7 @@
 #include "app_config/AppConfig.h"
 #include "application/Application.h"
 #include "collection_pipeline/CollectionPipelineManager.h"
+#include "collection_pipeline/limiter/MemoryBudget.h"
 #include "common/DevInode.h"
 #include "common/ExceptionBase.h"
 #include "common/LogtailCommonFlags.h"
@@ -34,6 +35,7 @@
 #include "common/RuntimeUtil.h"
 #include "common/StringTools.h"
 #include "common/TimeUtil.h"
+#include "common/memory/ChunkPool.h"
 #include "common/version.h"
 #include "constants/Constants.h"
 #include "file_server/event_handler/LogInput.h"
@@ -182,6 +184,10 @@ void LogtailMonitor::Monitor() {
                 LoongCollectorMonitor::GetInstance()->SetAgentMemory(mMemStat.mRss);
                 CalCpuStat(curCpuStat, mCpuStat);
                 LoongCollectorMonitor::GetInstance()->SetAgentCpu(mCpuStat.mCpuUsage);
+                LoongCollectorMonitor::GetInstance()->SetAgentSourceBufferPoolStatus(
+                    ChunkPool::GetInstance()->GetAndResetReuseRatio(), ChunkPool::GetInstance()->GetPooledBytes());
+                LoongCollectorMonitor::GetInstance()->SetAgentPipelineMemoryStatus(
+                    MemoryBudget::GetInstance()->GetBudget(), MemoryBudget::GetInstance()->GetUsage());
                 if (CheckHardMemLimit()) {
                     LOG_ERROR(sLogger,
                               ("Resource used by program exceeds hard limit",
@@ -628,6 +634,11 @@ void LoongCollectorMonitor::Init() {
     mAgentGoRoutinesTotal = mMetricsRecordRef.CreateIntGauge(METRIC_AGENT_GO_ROUTINES_TOTAL);
     mAgentOpenFdTotal = mMetricsRecordRef.CreateIntGauge(METRIC_AGENT_OPEN_FD_TOTAL);
     mAgentConfigTotal = mMetricsRecordRef.CreateIntGauge(METRIC_AGENT_PIPELINE_CONFIG_TOTAL);
+    mAgentSourceBufferPoolReuseRatio
+        = mMetricsRecordRef.CreateDoubleGauge(METRIC_AGENT_SOURCE_BUFFER_POOL_REUSE_RATIO);
+    mAgentSourceBufferPoolSizeBytes = mMetricsRecordRef.CreateIntGauge(METRIC_AGENT_SOURCE_BUFFER_POOL_SIZE_BYTES);
+    mAgentPipelineMemoryBudgetBytes = mMetricsRecordRef.CreateIntGauge(METRIC_AGENT_PIPELINE_MEMORY_BUDGET_BYTES);
+    mAgentPipelineMemoryUsageBytes = mMetricsRecordRef.CreateIntGauge(METRIC_AGENT_PIPELINE_MEMORY_USAGE_BYTES);
 }
 
 void LoongCollectorMonitor::Stop() {
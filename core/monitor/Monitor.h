@@ -204,6 +204,14 @@ public:
         SET_GAUGE(mAgentOpenFdTotal, total);
 #endif
     }
+    void SetAgentSourceBufferPoolStatus(double reuseRatio, uint64_t pooledBytes) {
+        SET_GAUGE(mAgentSourceBufferPoolReuseRatio, reuseRatio);
+        SET_GAUGE(mAgentSourceBufferPoolSizeBytes, pooledBytes);
+    }
+    void SetAgentPipelineMemoryStatus(uint64_t budget, uint64_t usage) {
+        SET_GAUGE(mAgentPipelineMemoryBudgetBytes, budget);
+        SET_GAUGE(mAgentPipelineMemoryUsageBytes, usage);
+    }
     void SetAgentConfigTotal(uint64_t total) {
 #ifndef APSARA_UNIT_TEST_MAIN
         SET_GAUGE(mAgentConfigTotal, total);
@@ -240,6 +248,10 @@ private:
     IntGaugePtr mAgentGoRoutinesTotal;
     IntGaugePtr mAgentOpenFdTotal;
     IntGaugePtr mAgentConfigTotal;
+    DoubleGaugePtr mAgentSourceBufferPoolReuseRatio;
+    IntGaugePtr mAgentSourceBufferPoolSizeBytes;
+    IntGaugePtr mAgentPipelineMemoryBudgetBytes;
+    IntGaugePtr mAgentPipelineMemoryUsageBytes;
 };
 
 } // namespace logtail
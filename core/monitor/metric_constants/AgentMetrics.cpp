@@ -38,5 +38,9 @@ const string METRIC_AGENT_MEMORY = "memory_used_mb";
 const string METRIC_AGENT_MEMORY_GO = "go_memory_used_mb";
 const string METRIC_AGENT_OPEN_FD_TOTAL = "open_fd_total";
 const string METRIC_AGENT_PIPELINE_CONFIG_TOTAL = "pipeline_config_total";
+const string METRIC_AGENT_PIPELINE_MEMORY_BUDGET_BYTES = "pipeline_memory_budget_bytes";
+const string METRIC_AGENT_PIPELINE_MEMORY_USAGE_BYTES = "pipeline_memory_usage_bytes";
+const string METRIC_AGENT_SOURCE_BUFFER_POOL_REUSE_RATIO = "source_buffer_pool_reuse_ratio";
+const string METRIC_AGENT_SOURCE_BUFFER_POOL_SIZE_BYTES = "source_buffer_pool_size_bytes";
 
 } // namespace logtail
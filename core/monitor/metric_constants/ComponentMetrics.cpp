@@ -79,6 +79,9 @@ const string METRIC_COMPONENT_QUEUE_VALID_FETCH_TIMES_TOTAL = "valid_fetch_times
 const string METRIC_COMPONENT_QUEUE_FETCH_REJECTED_BY_REGION_LIMITER_TIMES_TOTAL = "region_reject_times_total";
 const string METRIC_COMPONENT_QUEUE_FETCH_REJECTED_BY_PROJECT_LIMITER_TIMES_TOTAL = "project_reject_times_total";
 const string METRIC_COMPONENT_QUEUE_FETCH_REJECTED_BY_LOGSTORE_LIMITER_TIMES_TOTAL = "logstore_reject_times_total";
+const string METRIC_COMPONENT_QUEUE_FETCH_REJECTED_BY_ENDPOINT_LIMITER_TIMES_TOTAL = "endpoint_reject_times_total";
 const string METRIC_COMPONENT_QUEUE_FETCH_REJECTED_BY_RATE_LIMITER_TIMES_TOTAL = "rate_reject_times_total";
+const string METRIC_COMPONENT_QUEUE_PUSH_REJECTED_BY_MEMORY_BUDGET_TIMES_TOTAL = "memory_budget_reject_times_total";
+const string METRIC_COMPONENT_QUEUE_OVER_CPU_SHARE_FLAG = "over_cpu_share_status";
 
 } // namespace logtail
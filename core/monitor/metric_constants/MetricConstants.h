@@ -42,6 +42,10 @@ extern const std::string METRIC_AGENT_MEMORY;
 extern const std::string METRIC_AGENT_MEMORY_GO;
 extern const std::string METRIC_AGENT_OPEN_FD_TOTAL;
 extern const std::string METRIC_AGENT_PIPELINE_CONFIG_TOTAL;
+extern const std::string METRIC_AGENT_PIPELINE_MEMORY_BUDGET_BYTES;
+extern const std::string METRIC_AGENT_PIPELINE_MEMORY_USAGE_BYTES;
+extern const std::string METRIC_AGENT_SOURCE_BUFFER_POOL_REUSE_RATIO;
+extern const std::string METRIC_AGENT_SOURCE_BUFFER_POOL_SIZE_BYTES;
 
 //////////////////////////////////////////////////////////////////////////
 // pipeline
@@ -57,10 +61,12 @@ extern const std::string METRIC_PIPELINE_PROCESSORS_IN_EVENTS_TOTAL;
 extern const std::string METRIC_PIPELINE_PROCESSORS_IN_EVENT_GROUPS_TOTAL;
 extern const std::string METRIC_PIPELINE_PROCESSORS_IN_SIZE_BYTES;
 extern const std::string METRIC_PIPELINE_PROCESSORS_TOTAL_PROCESS_TIME_MS;
+extern const std::string METRIC_PIPELINE_PROCESSORS_TOTAL_CPU_TIME_MS;
 extern const std::string METRIC_PIPELINE_FLUSHERS_IN_EVENTS_TOTAL;
 extern const std::string METRIC_PIPELINE_FLUSHERS_IN_EVENT_GROUPS_TOTAL;
 extern const std::string METRIC_PIPELINE_FLUSHERS_IN_SIZE_BYTES;
 extern const std::string METRIC_PIPELINE_FLUSHERS_TOTAL_PACKAGE_TIME_MS;
+extern const std::string METRIC_PIPELINE_FLUSHERS_TOTAL_CPU_TIME_MS;
 extern const std::string METRIC_PIPELINE_START_TIME;
 
 //////////////////////////////////////////////////////////////////////////
@@ -108,6 +114,7 @@ extern const std::string METRIC_PLUGIN_PROM_SUBSCRIBE_TOTAL;
 extern const std::string METRIC_PLUGIN_PROM_SUBSCRIBE_TIME_MS;
 extern const std::string METRIC_PLUGIN_PROM_SCRAPE_TIME_MS;
 extern const std::string METRIC_PLUGIN_PROM_SCRAPE_DELAY_TOTAL;
+extern const std::string METRIC_PLUGIN_PROM_SCRAPE_QUEUE_DELAY_MS;
 
 /**********************************************************
  *   input_ebpf
@@ -146,6 +153,7 @@ extern const std::string METRIC_PLUGIN_EBPF_NETWORK_OBSERVER_AGGREGATE_EVENTS_TO
 extern const std::string METRIC_PLUGIN_EBPF_NETWORK_OBSERVER_AGGREGATE_KEY_NUM;
 extern const std::string METRIC_PLUGIN_EBPF_PROCESS_CACHE_ENTRIES_NUM;
 extern const std::string METRIC_PLUGIN_EBPF_PROCESS_CACHE_MISS_TOTAL;
+extern const std::string METRIC_PLUGIN_EBPF_RING_DROP_EVENTS_TOTAL;
 
 /**********************************************************
  *   all processor （所有解析类的处理插件通用指标。Todo：目前统计还不全、不准确）
@@ -258,7 +266,10 @@ extern const std::string METRIC_COMPONENT_QUEUE_VALID_FETCH_TIMES_TOTAL;
 extern const std::string METRIC_COMPONENT_QUEUE_FETCH_REJECTED_BY_REGION_LIMITER_TIMES_TOTAL;
 extern const std::string METRIC_COMPONENT_QUEUE_FETCH_REJECTED_BY_PROJECT_LIMITER_TIMES_TOTAL;
 extern const std::string METRIC_COMPONENT_QUEUE_FETCH_REJECTED_BY_LOGSTORE_LIMITER_TIMES_TOTAL;
+extern const std::string METRIC_COMPONENT_QUEUE_FETCH_REJECTED_BY_ENDPOINT_LIMITER_TIMES_TOTAL;
 extern const std::string METRIC_COMPONENT_QUEUE_FETCH_REJECTED_BY_RATE_LIMITER_TIMES_TOTAL;
+extern const std::string METRIC_COMPONENT_QUEUE_PUSH_REJECTED_BY_MEMORY_BUDGET_TIMES_TOTAL;
+extern const std::string METRIC_COMPONENT_QUEUE_OVER_CPU_SHARE_FLAG;
 
 //////////////////////////////////////////////////////////////////////////
 // runner
@@ -274,6 +285,7 @@ extern const std::string METRIC_LABEL_VALUE_RUNNER_NAME_FLUSHER;
 extern const std::string METRIC_LABEL_VALUE_RUNNER_NAME_HTTP_SINK;
 extern const std::string METRIC_LABEL_VALUE_RUNNER_NAME_PROCESSOR;
 extern const std::string METRIC_LABEL_VALUE_RUNNER_NAME_PROMETHEUS;
+extern const std::string METRIC_LABEL_VALUE_RUNNER_NAME_PROMETHEUS_SCRAPE_EXECUTOR;
 extern const std::string METRIC_LABEL_VALUE_RUNNER_NAME_EBPF_SERVER;
 
 // metric keys
@@ -313,6 +325,9 @@ extern const std::string METRIC_RUNNER_FILE_ENABLE_FILE_INCLUDED_BY_MULTI_CONFIG
 extern const std::string METRIC_RUNNER_FILE_POLLING_MODIFY_CACHE_SIZE;
 extern const std::string METRIC_RUNNER_FILE_POLLING_DIR_CACHE_SIZE;
 extern const std::string METRIC_RUNNER_FILE_POLLING_FILE_CACHE_SIZE;
+extern const std::string METRIC_RUNNER_FILE_OPENED_FILES_TOTAL;
+extern const std::string METRIC_RUNNER_FILE_REOPENED_FILES_TOTAL;
+extern const std::string METRIC_RUNNER_FILE_EVICTED_FILES_TOTAL;
 
 /**********************************************************
  *   ebpf server
@@ -321,4 +336,13 @@ extern const std::string METRIC_RUNNER_EBPF_START_PLUGIN_TOTAL;
 extern const std::string METRIC_RUNNER_EBPF_STOP_PLUGIN_TOTAL;
 extern const std::string METRIC_RUNNER_EBPF_SUSPEND_PLUGIN_TOTAL;
 
+/**********************************************************
+ *   prometheus scrape executor
+ **********************************************************/
+extern const std::string METRIC_RUNNER_PROM_SCRAPE_IN_FLIGHT_TOTAL;
+extern const std::string METRIC_RUNNER_PROM_SCRAPE_IN_FLIGHT_SIZE_BYTES;
+extern const std::string METRIC_RUNNER_PROM_SCRAPE_WAITING_TOTAL;
+extern const std::string METRIC_RUNNER_PROM_SCRAPE_QUEUED_TOTAL;
+extern const std::string METRIC_RUNNER_PROM_SCRAPE_QUEUE_DELAY_MS;
+
 } // namespace logtail
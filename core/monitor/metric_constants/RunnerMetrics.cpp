@@ -29,6 +29,7 @@ const string METRIC_LABEL_VALUE_RUNNER_NAME_FLUSHER = "flusher_runner";
 const string METRIC_LABEL_VALUE_RUNNER_NAME_HTTP_SINK = "http_sink";
 const string METRIC_LABEL_VALUE_RUNNER_NAME_PROCESSOR = "processor_runner";
 const string METRIC_LABEL_VALUE_RUNNER_NAME_PROMETHEUS = "prometheus_runner";
+const string METRIC_LABEL_VALUE_RUNNER_NAME_PROMETHEUS_SCRAPE_EXECUTOR = "prometheus_scrape_executor";
 const string METRIC_LABEL_VALUE_RUNNER_NAME_EBPF_SERVER = "ebpf_server";
 
 // metric keys
@@ -68,6 +69,9 @@ const string METRIC_RUNNER_FILE_ENABLE_FILE_INCLUDED_BY_MULTI_CONFIGS_FLAG = "en
 const string METRIC_RUNNER_FILE_POLLING_MODIFY_CACHE_SIZE = "polling_modify_cache_size";
 const string METRIC_RUNNER_FILE_POLLING_DIR_CACHE_SIZE = "polling_dir_cache_size";
 const string METRIC_RUNNER_FILE_POLLING_FILE_CACHE_SIZE = "polling_file_cache_size";
+const string METRIC_RUNNER_FILE_OPENED_FILES_TOTAL = "opened_files_total";
+const string METRIC_RUNNER_FILE_REOPENED_FILES_TOTAL = "reopened_files_total";
+const string METRIC_RUNNER_FILE_EVICTED_FILES_TOTAL = "evicted_files_total";
 
 /**********************************************************
  *   ebpf server
@@ -76,4 +80,13 @@ const string METRIC_RUNNER_EBPF_START_PLUGIN_TOTAL = "start_plugin_total";
 const string METRIC_RUNNER_EBPF_STOP_PLUGIN_TOTAL = "stop_plugin_total";
 const string METRIC_RUNNER_EBPF_SUSPEND_PLUGIN_TOTAL = "suspend_plugin_total";
 
+/**********************************************************
+ *   prometheus scrape executor
+ **********************************************************/
+const string METRIC_RUNNER_PROM_SCRAPE_IN_FLIGHT_TOTAL = "scrape_in_flight_total";
+const string METRIC_RUNNER_PROM_SCRAPE_IN_FLIGHT_SIZE_BYTES = "scrape_in_flight_size_bytes";
+const string METRIC_RUNNER_PROM_SCRAPE_WAITING_TOTAL = "scrape_waiting_total";
+const string METRIC_RUNNER_PROM_SCRAPE_QUEUED_TOTAL = "scrape_queued_total";
+const string METRIC_RUNNER_PROM_SCRAPE_QUEUE_DELAY_MS = "scrape_queue_delay_ms";
+
 } // namespace logtail
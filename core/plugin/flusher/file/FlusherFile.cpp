@@ -46,19 +46,81 @@ bool FlusherFile::Init(const Json::Value& config, Json::Value& optionalGoPipelin
     // Pattern
     // GetMandatoryStringParam(config, "Pattern", mPattern, errorMsg);
     // MaxFileSize
-    // GetMandatoryUIntParam(config, "MaxFileSize", mMaxFileSize, errorMsg);
+    if (!GetOptionalUIntParam(config, "MaxFileSize", mMaxFileSize, errorMsg)) {
+        PARAM_WARNING_DEFAULT(mContext->GetLogger(),
+                              mContext->GetAlarm(),
+                              errorMsg,
+                              mMaxFileSize,
+                              sName,
+                              mContext->GetConfigName(),
+                              mContext->GetProjectName(),
+                              mContext->GetLogstoreName(),
+                              mContext->GetRegion());
+    }
     // MaxFiles
-    // GetMandatoryUIntParam(config, "MaxFiles", mMaxFileSize, errorMsg);
+    if (!GetOptionalUIntParam(config, "MaxFiles", mMaxFiles, errorMsg)) {
+        PARAM_WARNING_DEFAULT(mContext->GetLogger(),
+                              mContext->GetAlarm(),
+                              errorMsg,
+                              mMaxFiles,
+                              sName,
+                              mContext->GetConfigName(),
+                              mContext->GetProjectName(),
+                              mContext->GetLogstoreName(),
+                              mContext->GetRegion());
+    }
+    // EnableDirectWrite
+    if (!GetOptionalBoolParam(config, "EnableDirectWrite", mEnableDirectWrite, errorMsg)) {
+        PARAM_WARNING_DEFAULT(mContext->GetLogger(),
+                              mContext->GetAlarm(),
+                              errorMsg,
+                              mEnableDirectWrite,
+                              sName,
+                              mContext->GetConfigName(),
+                              mContext->GetProjectName(),
+                              mContext->GetLogstoreName(),
+                              mContext->GetRegion());
+    }
+#if !defined(__linux__)
+    if (mEnableDirectWrite) {
+        PARAM_WARNING_IGNORE(mContext->GetLogger(),
+                             mContext->GetAlarm(),
+                             "direct write is only supported on linux",
+                             sName,
+                             mContext->GetConfigName(),
+                             mContext->GetProjectName(),
+                             mContext->GetLogstoreName(),
+                             mContext->GetRegion());
+        mEnableDirectWrite = false;
+    }
+#endif
 
     // create file writer
-    auto file_sink = std::make_shared<spdlog::sinks::rotating_file_sink_mt>(mFilePath, mMaxFileSize, mMaxFiles, true);
-    mFileWriter = std::make_shared<spdlog::async_logger>(
-        sName, file_sink, spdlog::thread_pool(), spdlog::async_overflow_policy::block);
-    mFileWriter->set_pattern(mPattern);
+    if (mEnableDirectWrite) {
+        // serialized data is appended to the file with one write for each batch, on the thread calling Send or Flush
+        mDirectWriter = make_unique<RotatingFileWriter>(mFilePath, mMaxFileSize, mMaxFiles);
+        if (!mDirectWriter->Open()) {
+            PARAM_ERROR_RETURN(mContext->GetLogger(),
+                               mContext->GetAlarm(),
+                               "failed to open file for direct write: " + mFilePath,
+                               sName,
+                               mContext->GetConfigName(),
+                               mContext->GetProjectName(),
+                               mContext->GetLogstoreName(),
+                               mContext->GetRegion());
+        }
+    } else {
+        auto file_sink
+            = std::make_shared<spdlog::sinks::rotating_file_sink_mt>(mFilePath, mMaxFileSize, mMaxFiles, true);
+        mFileWriter = std::make_shared<spdlog::async_logger>(
+            sName, file_sink, spdlog::thread_pool(), spdlog::async_overflow_policy::block);
+        mFileWriter->set_pattern(mPattern);
+    }
 
     mBatcher.Init(Json::Value(), this, DefaultFlushStrategyOptions{});
     mGroupSerializer = make_unique<JsonEventGroupSerializer>(this);
     mSendCnt = GetMetricsRecordRef().CreateCounter(METRIC_PLUGIN_FLUSHER_OUT_EVENT_GROUPS_TOTAL);
+    mDiscardCnt = GetMetricsRecordRef().CreateCounter(METRIC_PLUGIN_FLUSHER_DISCARD_TOTAL);
     return true;
 }
 
@@ -92,27 +154,46 @@ bool FlusherFile::SerializeAndPush(PipelineEventGroup&& group) {
                     group.GetMetadata(EventGroupMetaKey::SOURCE_ID),
                     std::move(group.GetExactlyOnceCheckpoint()));
     mGroupSerializer->DoSerialize(move(g), serializedData, errorMsg);
-    if (errorMsg.empty()) {
-        mFileWriter->info(serializedData);
-    } else {
+    if (!errorMsg.empty()) {
         LOG_ERROR(sLogger, ("serialize pipeline event group error", errorMsg));
+    } else if (mDirectWriter) {
+        if (!mDirectWriter->Write(serializedData.data(), serializedData.size())) {
+            ADD_COUNTER(mDiscardCnt, 1);
+        }
+    } else {
+        mFileWriter->info(serializedData);
+    }
+    if (mFileWriter) {
+        mFileWriter->flush();
     }
-    mFileWriter->flush();
     return true;
 }
 
 bool FlusherFile::SerializeAndPush(BatchedEventsList&& groupList) {
-    string serializedData;
+    string serializedData, pendingData;
     for (auto& group : groupList) {
         string errorMsg;
         mGroupSerializer->DoSerialize(move(group), serializedData, errorMsg);
-        if (errorMsg.empty()) {
-            mFileWriter->info(serializedData);
-        } else {
+        if (!errorMsg.empty()) {
             LOG_ERROR(sLogger, ("serialize pipeline event group error", errorMsg));
+        } else if (mDirectWriter) {
+            // all groups in the list are written at once
+            if (pendingData.empty()) {
+                pendingData.swap(serializedData);
+            } else {
+                pendingData.append(serializedData);
+            }
+        } else {
+            mFileWriter->info(serializedData);
         }
     }
-    mFileWriter->flush();
+    if (mDirectWriter) {
+        if (!pendingData.empty() && !mDirectWriter->Write(pendingData.data(), pendingData.size())) {
+            ADD_COUNTER(mDiscardCnt, 1);
+        }
+    } else {
+        mFileWriter->flush();
+    }
     return true;
 }
 
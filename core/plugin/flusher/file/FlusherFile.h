@@ -23,6 +23,7 @@
 #include "collection_pipeline/batch/Batcher.h"
 #include "collection_pipeline/plugin/interface/Flusher.h"
 #include "collection_pipeline/serializer/JsonSerializer.h"
+#include "plugin/flusher/file/RotatingFileWriter.h"
 
 namespace logtail {
 
@@ -42,14 +43,23 @@ private:
     bool SerializeAndPush(std::vector<BatchedEventsList>&& groupLists);
 
     std::shared_ptr<spdlog::logger> mFileWriter;
+    // used instead of mFileWriter when EnableDirectWrite is set
+    std::unique_ptr<RotatingFileWriter> mDirectWriter;
     std::string mFilePath;
     std::string mPattern = "%v";
     uint32_t mMaxFileSize = 1024 * 1024 * 10;
     uint32_t mMaxFiles = 10;
+    bool mEnableDirectWrite = false;
     Batcher<EventBatchStatus> mBatcher;
     std::unique_ptr<EventGroupSerializer> mGroupSerializer;
 
     CounterPtr mSendCnt;
+    // batches which failed to be written by mDirectWriter
+    CounterPtr mDiscardCnt;
+
+#ifdef APSARA_UNIT_TEST_MAIN
+    friend class FlusherFileUnittest;
+#endif
 };
 
 } // namespace logtail
@@ -0,0 +1,142 @@
+// Copyright 2025 iLogtail Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "plugin/flusher/file/RotatingFileWriter.h"
+
+#if defined(__linux__)
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include <cerrno>
+
+#include <filesystem>
+
+#include "common/ErrorUtil.h"
+#include "logger/Logger.h"
+
+using namespace std;
+
+namespace logtail {
+
+RotatingFileWriter::~RotatingFileWriter() {
+    CloseFile();
+}
+
+bool RotatingFileWriter::Open() {
+    lock_guard<mutex> lock(mMux);
+    return OpenFile(false);
+}
+
+bool RotatingFileWriter::Write(const char* data, size_t size) {
+    lock_guard<mutex> lock(mMux);
+#if defined(__linux__)
+    if (mFd < 0 && !OpenFile(false)) {
+        return false;
+    }
+    if (mFileSize > 0 && mFileSize + size > mMaxFileSize && !Rotate()) {
+        return false;
+    }
+    while (size > 0) {
+        ssize_t n = write(mFd, data, size);
+        if (n < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            if (!mWriteFailed) {
+                LOG_WARNING(sLogger, ("failed to write file", mPath)("error", ErrnoToString(GetErrno())));
+                mWriteFailed = true;
+            }
+            // reopened on next write in case the file is removed or the disk is full
+            CloseFile();
+            return false;
+        }
+        data += n;
+        size -= n;
+        mFileSize += n;
+    }
+    mWriteFailed = false;
+    return true;
+#else
+    return false;
+#endif
+}
+
+string RotatingFileWriter::GetRotatedFilePath(const string& path, size_t index) {
+    if (index == 0) {
+        return path;
+    }
+    // extension is the part after the last dot of the file name, except for hidden files, e.g. .log
+    auto extPos = path.rfind('.');
+    auto sepPos = path.find_last_of("/\\");
+    if (extPos == string::npos || extPos == 0 || extPos == path.size() - 1
+        || (sepPos != string::npos && extPos <= sepPos + 1)) {
+        return path + "." + to_string(index);
+    }
+    return path.substr(0, extPos) + "." + to_string(index) + path.substr(extPos);
+}
+
+bool RotatingFileWriter::OpenFile(bool truncate) {
+#if defined(__linux__)
+    CloseFile();
+    int flags = O_WRONLY | O_CREAT | O_APPEND | O_CLOEXEC;
+    if (truncate) {
+        flags |= O_TRUNC;
+    }
+    mFd = open(mPath.c_str(), flags, 0644);
+    if (mFd < 0) {
+        LOG_WARNING(sLogger, ("failed to open file", mPath)("error", ErrnoToString(GetErrno())));
+        return false;
+    }
+    struct stat st;
+    mFileSize = fstat(mFd, &st) == 0 ? st.st_size : 0;
+    return true;
+#else
+    return false;
+#endif
+}
+
+void RotatingFileWriter::CloseFile() {
+#if defined(__linux__)
+    if (mFd >= 0) {
+        close(mFd);
+        mFd = -1;
+    }
+#endif
+    mFileSize = 0;
+}
+
+bool RotatingFileWriter::Rotate() {
+    CloseFile();
+    if (mMaxFiles == 0) {
+        return OpenFile(true);
+    }
+    for (size_t i = mMaxFiles; i > 0; --i) {
+        string src = GetRotatedFilePath(mPath, i - 1);
+        error_code ec;
+        if (!filesystem::exists(src, ec)) {
+            continue;
+        }
+        string target = GetRotatedFilePath(mPath, i);
+        filesystem::remove(target, ec);
+        filesystem::rename(src, target, ec);
+        if (ec) {
+            LOG_WARNING(sLogger, ("failed to rotate file", src)("target", target)("error", ec.message()));
+        }
+    }
+    return OpenFile(false);
+}
+
+} // namespace logtail
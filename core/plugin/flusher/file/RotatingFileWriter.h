@@ -0,0 +1,64 @@
+/*
+ * Copyright 2025 iLogtail Authors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cstddef>
+
+#include <mutex>
+#include <string>
+
+namespace logtail {
+
+// Appends data to a file opened with O_APPEND by a single write per call, without any intermediate buffer or thread.
+// The write, and the rename on rotation, are done under a mutex on the calling thread, i.e. the processor and timeout
+// flush threads for flusher_file, so callers are serialized on disk io. The file is rotated the same as
+// spdlog::sinks::rotating_file_sink, i.e. a.log is renamed to a.1.log, a.1.log to a.2.log and so on, and the one beyond
+// maxFiles is removed. Only supported on linux.
+class RotatingFileWriter {
+public:
+    RotatingFileWriter(const std::string& path, size_t maxFileSize, size_t maxFiles)
+        : mPath(path), mMaxFileSize(maxFileSize), mMaxFiles(maxFiles) {}
+    ~RotatingFileWriter();
+    RotatingFileWriter(const RotatingFileWriter&) = delete;
+    RotatingFileWriter& operator=(const RotatingFileWriter&) = delete;
+
+    bool Open();
+    // thread safe, and the file is rotated before data is written if it would exceed maxFileSize
+    bool Write(const char* data, size_t size);
+
+    static std::string GetRotatedFilePath(const std::string& path, size_t index);
+
+private:
+    bool OpenFile(bool truncate);
+    void CloseFile();
+    bool Rotate();
+
+    std::mutex mMux;
+    std::string mPath;
+    size_t mMaxFileSize = 0;
+    size_t mMaxFiles = 0;
+    int mFd = -1;
+    size_t mFileSize = 0;
+    // only the first failure of consecutive ones is logged
+    bool mWriteFailed = false;
+
+#ifdef APSARA_UNIT_TEST_MAIN
+    friend class FlusherFileUnittest;
+#endif
+};
+
+} // namespace logtail
@@ -0,0 +1,352 @@
+// Copyright 2025 iLogtail Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "plugin/flusher/otlp/FlusherOTLP.h"
+
+#include "app_config/AppConfig.h"
+#include "collection_pipeline/CollectionPipeline.h"
+#include "collection_pipeline/batch/FlushStrategy.h"
+#include "collection_pipeline/queue/SenderQueueManager.h"
+#include "common/Flags.h"
+#include "common/ParamExtractor.h"
+#include "common/StringTools.h"
+#include "common/compression/CompressorFactory.h"
+#include "common/http/Constant.h"
+#include "common/http/HttpRequest.h"
+
+using namespace std;
+
+DEFINE_FLAG_INT32(otlp_batch_send_interval, "batch send interval of otlp flusher (second)", 3);
+DEFINE_FLAG_INT32(otlp_batch_cnt_limit, "events in one otlp export request at most", 2000);
+DEFINE_FLAG_INT32(otlp_batch_size, "batch size of otlp flusher before compression (bytes)", 512 * 1024);
+DEFINE_FLAG_INT32(otlp_max_request_size, "max otlp export request size before compression (bytes)", 4 * 1024 * 1024);
+
+DECLARE_FLAG_INT32(discard_send_fail_interval);
+
+namespace logtail {
+
+const string FlusherOTLP::sName = "flusher_otlp";
+
+static const string OTLP_SIGNAL_PATHS[] = {"v1/logs", "v1/metrics", "v1/traces"};
+
+static const int ON_FAIL_LOG_WARNING_INTERVAL_SECOND = 10;
+
+mutex FlusherOTLP::sMux;
+unordered_map<string, weak_ptr<ConcurrencyLimiter>> FlusherOTLP::sEndpointConcurrencyLimiterMap;
+
+shared_ptr<ConcurrencyLimiter> FlusherOTLP::GetEndpointConcurrencyLimiter(const string& endpoint) {
+    lock_guard<mutex> lock(sMux);
+    auto& limiter = sEndpointConcurrencyLimiterMap[endpoint];
+    if (auto res = limiter.lock()) {
+        return res;
+    }
+    auto res = make_shared<ConcurrencyLimiter>(sName + "#network#endpoint#" + endpoint,
+                                               AppConfig::GetInstance()->GetSendRequestConcurrency());
+    limiter = res;
+    return res;
+}
+
+bool FlusherOTLP::Init(const Json::Value& config, Json::Value& optionalGoPipeline) {
+    string errorMsg;
+
+    // Endpoint
+    if (!GetMandatoryStringParam(config, "Endpoint", mEndpoint, errorMsg)) {
+        PARAM_ERROR_RETURN(mContext->GetLogger(),
+                           mContext->GetAlarm(),
+                           errorMsg,
+                           sName,
+                           mContext->GetConfigName(),
+                           mContext->GetProjectName(),
+                           mContext->GetLogstoreName(),
+                           mContext->GetRegion());
+    }
+    mEndpoint = TrimString(mEndpoint);
+    string basePath;
+    if (!ParseHttpUrl(mEndpoint, mHTTPSFlag, mHost, mPort, basePath)) {
+        PARAM_ERROR_RETURN(mContext->GetLogger(),
+                           mContext->GetAlarm(),
+                           "string param Endpoint is not a valid http or https url",
+                           sName,
+                           mContext->GetConfigName(),
+                           mContext->GetProjectName(),
+                           mContext->GetLogstoreName(),
+                           mContext->GetRegion());
+    }
+    if (basePath.back() != '/') {
+        basePath.push_back('/');
+    }
+    for (size_t i = 0; i < mPaths.size(); ++i) {
+        mPaths[i] = basePath + OTLP_SIGNAL_PATHS[i];
+    }
+
+    // Headers
+    if (!GetOptionalMapParam(config, "Headers", mHeaders, errorMsg)) {
+        PARAM_WARNING_IGNORE(mContext->GetLogger(),
+                             mContext->GetAlarm(),
+                             errorMsg,
+                             sName,
+                             mContext->GetConfigName(),
+                             mContext->GetProjectName(),
+                             mContext->GetLogstoreName(),
+                             mContext->GetRegion());
+    }
+
+    // Batch
+    const char* key = "Batch";
+    const Json::Value* itr = config.find(key, key + strlen(key));
+    if (itr && !itr->isObject()) {
+        PARAM_WARNING_IGNORE(mContext->GetLogger(),
+                             mContext->GetAlarm(),
+                             "param Batch is not of type object",
+                             sName,
+                             mContext->GetConfigName(),
+                             mContext->GetProjectName(),
+                             mContext->GetLogstoreName(),
+                             mContext->GetRegion());
+        itr = nullptr;
+    }
+    DefaultFlushStrategyOptions strategy{static_cast<uint32_t>(INT32_FLAG(otlp_max_request_size)),
+                                         static_cast<uint32_t>(INT32_FLAG(otlp_batch_size)),
+                                         static_cast<uint32_t>(INT32_FLAG(otlp_batch_cnt_limit)),
+                                         static_cast<uint32_t>(INT32_FLAG(otlp_batch_send_interval))};
+    // groups are batched as well, since groups with different tags are sent as different resources in one request
+    if (!mBatcher.Init(itr ? *itr : Json::Value(), this, strategy, true)) {
+        return false;
+    }
+
+    // CompressType
+    mCompressor = CompressorFactory::GetInstance()->Create(config, *mContext, sName, mPluginID, CompressType::GZIP);
+    if (mCompressor && mCompressor->GetCompressType() != CompressType::GZIP
+        && mCompressor->GetCompressType() != CompressType::ZSTD) {
+        // only gzip and zstd are known to otlp receivers
+        PARAM_WARNING_DEFAULT(mContext->GetLogger(),
+                              mContext->GetAlarm(),
+                              "string param CompressType is not valid",
+                              "gzip",
+                              sName,
+                              mContext->GetConfigName(),
+                              mContext->GetProjectName(),
+                              mContext->GetLogstoreName(),
+                              mContext->GetRegion());
+        mCompressor
+            = CompressorFactory::GetInstance()->Create(Json::Value(), *mContext, sName, mPluginID, CompressType::GZIP);
+    }
+
+    mGroupListSerializers[static_cast<size_t>(OTLPSignal::LOGS)]
+        = make_unique<OTLPEventGroupListSerializer>(this, OTLPSignal::LOGS);
+    mGroupListSerializers[static_cast<size_t>(OTLPSignal::METRICS)]
+        = make_unique<OTLPEventGroupListSerializer>(this, OTLPSignal::METRICS);
+    mGroupListSerializers[static_cast<size_t>(OTLPSignal::TRACES)]
+        = make_unique<OTLPEventGroupListSerializer>(this, OTLPSignal::TRACES);
+
+    mEndpointConcurrencyLimiter = GetEndpointConcurrencyLimiter(mHost + ":" + ToString(mPort));
+    GenerateQueueKey(mEndpoint);
+    SenderQueueManager::GetInstance()->CreateQueue(
+        mQueueKey, mPluginID, *mContext, {{"endpoint", mEndpointConcurrencyLimiter}});
+
+    mSendCnt = GetMetricsRecordRef().CreateCounter(METRIC_PLUGIN_FLUSHER_OUT_EVENT_GROUPS_TOTAL);
+    mSendDoneCnt = GetMetricsRecordRef().CreateCounter(METRIC_PLUGIN_FLUSHER_SEND_DONE_TOTAL);
+    mSuccessCnt = GetMetricsRecordRef().CreateCounter(METRIC_PLUGIN_FLUSHER_SUCCESS_TOTAL);
+    mDiscardCnt = GetMetricsRecordRef().CreateCounter(METRIC_PLUGIN_FLUSHER_DISCARD_TOTAL);
+    mNetworkErrorCnt = GetMetricsRecordRef().CreateCounter(METRIC_PLUGIN_FLUSHER_NETWORK_ERROR_TOTAL);
+    mServerErrorCnt = GetMetricsRecordRef().CreateCounter(METRIC_PLUGIN_FLUSHER_SERVER_ERROR_TOTAL);
+    mUnauthErrorCnt = GetMetricsRecordRef().CreateCounter(METRIC_PLUGIN_FLUSHER_UNAUTH_ERROR_TOTAL);
+    mParamsErrorCnt = GetMetricsRecordRef().CreateCounter(METRIC_PLUGIN_FLUSHER_PARAMS_ERROR_TOTAL);
+
+    return true;
+}
+
+bool FlusherOTLP::Send(PipelineEventGroup&& g) {
+    vector<BatchedEventsList> res;
+    mBatcher.Add(std::move(g), res);
+    return SerializeAndPush(std::move(res));
+}
+
+bool FlusherOTLP::Flush(size_t key) {
+    BatchedEventsList res;
+    mBatcher.FlushQueue(key, res);
+    return SerializeAndPush(std::move(res));
+}
+
+bool FlusherOTLP::FlushAll() {
+    vector<BatchedEventsList> res;
+    mBatcher.FlushAll(res);
+    return SerializeAndPush(std::move(res));
+}
+
+bool FlusherOTLP::BuildRequest(SenderQueueItem* item,
+                               unique_ptr<HttpSinkRequest>& req,
+                               bool* keepItem,
+                               string* errMsg) {
+    ADD_COUNTER(mSendCnt, 1);
+
+    map<string, string> header(mHeaders.begin(), mHeaders.end());
+    header[CONTENT_TYPE] = TYPE_LOG_PROTOBUF;
+    if (mCompressor) {
+        header[CONTENT_ENCODING] = CompressTypeToString(mCompressor->GetCompressType());
+    }
+    const auto& path = mPaths[static_cast<size_t>(static_cast<OTLPSenderQueueItem*>(item)->mSignal)];
+    req = make_unique<HttpSinkRequest>(HTTP_POST, mHTTPSFlag, mHost, mPort, path, "", header, item->mData, item);
+    return true;
+}
+
+void FlusherOTLP::OnSendDone(const HttpResponse& response, SenderQueueItem* item) {
+    ADD_COUNTER(mSendDoneCnt, 1);
+    auto curSystemTime = chrono::system_clock::now();
+    int32_t statusCode = response.GetStatusCode();
+    if (statusCode >= 200 && statusCode < 300) {
+        LOG_DEBUG(sLogger,
+                  ("send data to otlp endpoint succeeded, item address",
+                   item)("config", mContext->GetConfigName())("endpoint", mEndpoint)("try cnt", item->mTryCnt));
+        mEndpointConcurrencyLimiter->OnSuccess(curSystemTime);
+        SenderQueueManager::GetInstance()->DecreaseConcurrencyLimiterInSendingCnt(item->mQueueKey);
+        ADD_COUNTER(mSuccessCnt, 1);
+        DealSenderQueueItemAfterSend(item, false);
+        return;
+    }
+
+    // only network errors and the retryable status codes of otlp/http are retried, with concurrency to the endpoint
+    // backed off
+    bool retry = false;
+    string failDetail;
+    if (statusCode == 0) {
+        failDetail = "network error";
+        retry = true;
+        ADD_COUNTER(mNetworkErrorCnt, 1);
+    } else if (statusCode == 429 || statusCode == 502 || statusCode == 503 || statusCode == 504) {
+        failDetail = "server busy";
+        retry = true;
+        ADD_COUNTER(mServerErrorCnt, 1);
+    } else if (statusCode >= 500) {
+        failDetail = "server error";
+        ADD_COUNTER(mServerErrorCnt, 1);
+    } else if (statusCode == 401 || statusCode == 403) {
+        failDetail = "write unauthorized";
+        ADD_COUNTER(mUnauthErrorCnt, 1);
+    } else {
+        failDetail = "invalid request";
+        ADD_COUNTER(mParamsErrorCnt, 1);
+    }
+    if (retry) {
+        mEndpointConcurrencyLimiter->OnFail(curSystemTime);
+    } else {
+        mEndpointConcurrencyLimiter->OnSuccess(curSystemTime);
+    }
+    if (retry
+        && chrono::duration_cast<chrono::seconds>(curSystemTime - item->mFirstEnqueTime).count()
+            > INT32_FLAG(discard_send_fail_interval)) {
+        retry = false;
+    }
+
+    const string* body = response.GetBody<string>();
+    string errorMsg = statusCode == 0 ? response.GetNetworkStatus().mMessage : (body ? body->substr(0, 256) : "");
+#define LOG_PATTERN \
+    ("failed to send request", failDetail)("operation", retry ? "retry later" : "discard data")( \
+        "item address", item)("status code", statusCode)("errMsg", errorMsg)("config", mContext->GetConfigName())( \
+        "endpoint", mEndpoint)("try cnt", item->mTryCnt)
+
+    SenderQueueManager::GetInstance()->DecreaseConcurrencyLimiterInSendingCnt(item->mQueueKey);
+    if (retry) {
+        int32_t curTime = time(nullptr);
+        if (curTime - mLastLogWarningTime > ON_FAIL_LOG_WARNING_INTERVAL_SECOND) {
+            LOG_WARNING(sLogger, LOG_PATTERN);
+            mLastLogWarningTime = curTime;
+        }
+        DealSenderQueueItemAfterSend(item, true);
+    } else {
+        LOG_WARNING(sLogger, LOG_PATTERN);
+        mContext->GetAlarm().SendAlarm(SEND_DATA_FAIL_ALARM,
+                                       "failed to send request: " + failDetail + "\toperation: discard data"
+                                           + "\tstatusCode: " + ToString(statusCode) + "\terrorMessage: " + errorMsg
+                                           + "\tconfig: " + mContext->GetConfigName() + "\tendpoint: " + mEndpoint,
+                                       mContext->GetRegion(),
+                                       mContext->GetProjectName(),
+                                       mContext->GetConfigName(),
+                                       mContext->GetLogstoreName());
+        ADD_COUNTER(mDiscardCnt, 1);
+        DealSenderQueueItemAfterSend(item, false);
+    }
+#undef LOG_PATTERN
+}
+
+bool FlusherOTLP::SerializeAndPush(BatchedEventsList&& groupList, OTLPSignal signal) {
+    string serializedData, compressedData, errorMsg;
+    if (!mGroupListSerializers[static_cast<size_t>(signal)]->DoSerialize(
+            std::move(groupList), serializedData, errorMsg)) {
+        LOG_WARNING(mContext->GetLogger(),
+                    ("failed to serialize event group",
+                     errorMsg)("action", "discard data")("plugin", sName)("config", mContext->GetConfigName()));
+        mContext->GetAlarm().SendAlarm(SERIALIZE_FAIL_ALARM,
+                                       "failed to serialize event group: " + errorMsg
+                                           + "\taction: discard data\tplugin: " + sName
+                                           + "\tconfig: " + mContext->GetConfigName(),
+                                       mContext->GetRegion(),
+                                       mContext->GetProjectName(),
+                                       mContext->GetConfigName(),
+                                       mContext->GetLogstoreName());
+        return false;
+    }
+    if (!mCompressor) {
+        compressedData = serializedData;
+    } else if (!mCompressor->DoCompress(serializedData, compressedData, errorMsg)) {
+        LOG_WARNING(mContext->GetLogger(),
+                    ("failed to compress event group",
+                     errorMsg)("action", "discard data")("plugin", sName)("config", mContext->GetConfigName()));
+        mContext->GetAlarm().SendAlarm(COMPRESS_FAIL_ALARM,
+                                       "failed to compress event group: " + errorMsg
+                                           + "\taction: discard data\tplugin: " + sName
+                                           + "\tconfig: " + mContext->GetConfigName(),
+                                       mContext->GetRegion(),
+                                       mContext->GetProjectName(),
+                                       mContext->GetConfigName(),
+                                       mContext->GetLogstoreName());
+        return false;
+    }
+    return Flusher::PushToQueue(make_unique<OTLPSenderQueueItem>(
+        std::move(compressedData), serializedData.size(), this, mQueueKey, signal));
+}
+
+bool FlusherOTLP::SerializeAndPush(BatchedEventsList&& groupList) {
+    if (groupList.empty()) {
+        return true;
+    }
+    // each signal is exported by a separate request
+    array<BatchedEventsList, 3> signalLists;
+    for (auto& group : groupList) {
+        if (group.mEvents.empty()) {
+            continue;
+        }
+        // events of unknown types are discarded by the serializer of logs
+        OTLPSignal signal = OTLPSignal::LOGS;
+        GetOTLPSignal(group.mEvents[0]->GetType(), signal);
+        signalLists[static_cast<size_t>(signal)].emplace_back(std::move(group));
+    }
+    bool allSucceeded = true;
+    for (size_t i = 0; i < signalLists.size(); ++i) {
+        if (!signalLists[i].empty()) {
+            allSucceeded = SerializeAndPush(std::move(signalLists[i]), static_cast<OTLPSignal>(i)) && allSucceeded;
+        }
+    }
+    return allSucceeded;
+}
+
+bool FlusherOTLP::SerializeAndPush(vector<BatchedEventsList>&& groupLists) {
+    bool allSucceeded = true;
+    for (auto& groupList : groupLists) {
+        allSucceeded = SerializeAndPush(std::move(groupList)) && allSucceeded;
+    }
+    return allSucceeded;
+}
+
+} // namespace logtail
@@ -0,0 +1,302 @@
+// Copyright 2025 iLogtail Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "plugin/flusher/prometheus/FlusherPrometheusRemoteWrite.h"
+
+#include "app_config/AppConfig.h"
+#include "collection_pipeline/CollectionPipeline.h"
+#include "collection_pipeline/batch/FlushStrategy.h"
+#include "collection_pipeline/queue/SenderQueueManager.h"
+#include "collection_pipeline/serializer/RemoteWriteSerializer.h"
+#include "common/Flags.h"
+#include "common/ParamExtractor.h"
+#include "common/StringTools.h"
+#include "common/compression/CompressorFactory.h"
+#include "common/http/Constant.h"
+#include "common/http/HttpRequest.h"
+
+using namespace std;
+
+DEFINE_FLAG_INT32(prom_remote_write_batch_send_interval, "batch send interval of prometheus remote write (second)", 3);
+DEFINE_FLAG_INT32(prom_remote_write_batch_cnt_limit, "events in one prometheus remote write request at most", 2000);
+DEFINE_FLAG_INT32(prom_remote_write_batch_size,
+                  "batch size of prometheus remote write before compression (bytes)",
+                  512 * 1024);
+DEFINE_FLAG_INT32(prom_remote_write_max_request_size,
+                  "max prometheus remote write request size before compression (bytes)",
+                  4 * 1024 * 1024);
+
+DECLARE_FLAG_INT32(discard_send_fail_interval);
+
+namespace logtail {
+
+const string FlusherPrometheusRemoteWrite::sName = "flusher_prometheus_remote_write";
+
+static const string REMOTE_WRITE_VERSION_HEADER = "X-Prometheus-Remote-Write-Version";
+static const string REMOTE_WRITE_VERSION = "0.1.0";
+static const string REMOTE_WRITE_ENCODING = "snappy";
+
+static const int ON_FAIL_LOG_WARNING_INTERVAL_SECOND = 10;
+
+mutex FlusherPrometheusRemoteWrite::sMux;
+unordered_map<string, weak_ptr<ConcurrencyLimiter>> FlusherPrometheusRemoteWrite::sEndpointConcurrencyLimiterMap;
+
+shared_ptr<ConcurrencyLimiter> FlusherPrometheusRemoteWrite::GetEndpointConcurrencyLimiter(const string& endpoint) {
+    lock_guard<mutex> lock(sMux);
+    auto& limiter = sEndpointConcurrencyLimiterMap[endpoint];
+    if (auto res = limiter.lock()) {
+        return res;
+    }
+    auto res = make_shared<ConcurrencyLimiter>(sName + "#network#endpoint#" + endpoint,
+                                               AppConfig::GetInstance()->GetSendRequestConcurrency());
+    limiter = res;
+    return res;
+}
+
+bool FlusherPrometheusRemoteWrite::Init(const Json::Value& config, Json::Value& optionalGoPipeline) {
+    string errorMsg;
+
+    // Endpoint
+    if (!GetMandatoryStringParam(config, "Endpoint", mEndpoint, errorMsg)) {
+        PARAM_ERROR_RETURN(mContext->GetLogger(),
+                           mContext->GetAlarm(),
+                           errorMsg,
+                           sName,
+                           mContext->GetConfigName(),
+                           mContext->GetProjectName(),
+                           mContext->GetLogstoreName(),
+                           mContext->GetRegion());
+    }
+    mEndpoint = TrimString(mEndpoint);
+    if (!ParseHttpUrl(mEndpoint, mHTTPSFlag, mHost, mPort, mPath)) {
+        PARAM_ERROR_RETURN(mContext->GetLogger(),
+                           mContext->GetAlarm(),
+                           "string param Endpoint is not a valid http or https url",
+                           sName,
+                           mContext->GetConfigName(),
+                           mContext->GetProjectName(),
+                           mContext->GetLogstoreName(),
+                           mContext->GetRegion());
+    }
+
+    // Headers
+    if (!GetOptionalMapParam(config, "Headers", mHeaders, errorMsg)) {
+        PARAM_WARNING_IGNORE(mContext->GetLogger(),
+                             mContext->GetAlarm(),
+                             errorMsg,
+                             sName,
+                             mContext->GetConfigName(),
+                             mContext->GetProjectName(),
+                             mContext->GetLogstoreName(),
+                             mContext->GetRegion());
+    }
+
+    // Batch
+    const char* key = "Batch";
+    const Json::Value* itr = config.find(key, key + strlen(key));
+    if (itr && !itr->isObject()) {
+        PARAM_WARNING_IGNORE(mContext->GetLogger(),
+                             mContext->GetAlarm(),
+                             "param Batch is not of type object",
+                             sName,
+                             mContext->GetConfigName(),
+                             mContext->GetProjectName(),
+                             mContext->GetLogstoreName(),
+                             mContext->GetRegion());
+        itr = nullptr;
+    }
+    DefaultFlushStrategyOptions strategy{static_cast<uint32_t>(INT32_FLAG(prom_remote_write_max_request_size)),
+                                         static_cast<uint32_t>(INT32_FLAG(prom_remote_write_batch_size)),
+                                         static_cast<uint32_t>(INT32_FLAG(prom_remote_write_batch_cnt_limit)),
+                                         static_cast<uint32_t>(INT32_FLAG(prom_remote_write_batch_send_interval))};
+    // groups are batched as well, since a remote write request is not bound to any group tags
+    if (!mBatcher.Init(itr ? *itr : Json::Value(), this, strategy, true)) {
+        return false;
+    }
+
+    // snappy is the only encoding allowed by remote write 1.0
+    mCompressor
+        = CompressorFactory::GetInstance()->Create(Json::Value(), *mContext, sName, mPluginID, CompressType::SNAPPY);
+    mGroupListSerializer = make_unique<RemoteWriteEventGroupListSerializer>(this);
+
+    mEndpointConcurrencyLimiter = GetEndpointConcurrencyLimiter(mHost + ":" + ToString(mPort));
+    GenerateQueueKey(mEndpoint);
+    SenderQueueManager::GetInstance()->CreateQueue(
+        mQueueKey, mPluginID, *mContext, {{"endpoint", mEndpointConcurrencyLimiter}});
+
+    mSendCnt = GetMetricsRecordRef().CreateCounter(METRIC_PLUGIN_FLUSHER_OUT_EVENT_GROUPS_TOTAL);
+    mSendDoneCnt = GetMetricsRecordRef().CreateCounter(METRIC_PLUGIN_FLUSHER_SEND_DONE_TOTAL);
+    mSuccessCnt = GetMetricsRecordRef().CreateCounter(METRIC_PLUGIN_FLUSHER_SUCCESS_TOTAL);
+    mDiscardCnt = GetMetricsRecordRef().CreateCounter(METRIC_PLUGIN_FLUSHER_DISCARD_TOTAL);
+    mNetworkErrorCnt = GetMetricsRecordRef().CreateCounter(METRIC_PLUGIN_FLUSHER_NETWORK_ERROR_TOTAL);
+    mServerErrorCnt = GetMetricsRecordRef().CreateCounter(METRIC_PLUGIN_FLUSHER_SERVER_ERROR_TOTAL);
+    mUnauthErrorCnt = GetMetricsRecordRef().CreateCounter(METRIC_PLUGIN_FLUSHER_UNAUTH_ERROR_TOTAL);
+    mParamsErrorCnt = GetMetricsRecordRef().CreateCounter(METRIC_PLUGIN_FLUSHER_PARAMS_ERROR_TOTAL);
+
+    return true;
+}
+
+bool FlusherPrometheusRemoteWrite::Send(PipelineEventGroup&& g) {
+    vector<BatchedEventsList> res;
+    mBatcher.Add(std::move(g), res);
+    return SerializeAndPush(std::move(res));
+}
+
+bool FlusherPrometheusRemoteWrite::Flush(size_t key) {
+    BatchedEventsList res;
+    mBatcher.FlushQueue(key, res);
+    return SerializeAndPush(std::move(res));
+}
+
+bool FlusherPrometheusRemoteWrite::FlushAll() {
+    vector<BatchedEventsList> res;
+    mBatcher.FlushAll(res);
+    return SerializeAndPush(std::move(res));
+}
+
+bool FlusherPrometheusRemoteWrite::BuildRequest(SenderQueueItem* item,
+                                                unique_ptr<HttpSinkRequest>& req,
+                                                bool* keepItem,
+                                                string* errMsg) {
+    ADD_COUNTER(mSendCnt, 1);
+
+    map<string, string> header(mHeaders.begin(), mHeaders.end());
+    header[CONTENT_TYPE] = TYPE_LOG_PROTOBUF;
+    header[CONTENT_ENCODING] = REMOTE_WRITE_ENCODING;
+    header[REMOTE_WRITE_VERSION_HEADER] = REMOTE_WRITE_VERSION;
+    req = make_unique<HttpSinkRequest>(HTTP_POST, mHTTPSFlag, mHost, mPort, mPath, "", header, item->mData, item);
+    return true;
+}
+
+void FlusherPrometheusRemoteWrite::OnSendDone(const HttpResponse& response, SenderQueueItem* item) {
+    ADD_COUNTER(mSendDoneCnt, 1);
+    auto curSystemTime = chrono::system_clock::now();
+    int32_t statusCode = response.GetStatusCode();
+    if (statusCode >= 200 && statusCode < 300) {
+        LOG_DEBUG(sLogger,
+                  ("send data to prometheus remote write endpoint succeeded, item address",
+                   item)("config", mContext->GetConfigName())("endpoint", mEndpoint)("try cnt", item->mTryCnt));
+        mEndpointConcurrencyLimiter->OnSuccess(curSystemTime);
+        SenderQueueManager::GetInstance()->DecreaseConcurrencyLimiterInSendingCnt(item->mQueueKey);
+        ADD_COUNTER(mSuccessCnt, 1);
+        DealSenderQueueItemAfterSend(item, false);
+        return;
+    }
+
+    // as prometheus does, only network errors, 5xx and 429 are retried, with concurrency to the endpoint backed off
+    bool retry = false;
+    string failDetail;
+    if (statusCode == 0) {
+        failDetail = "network error";
+        retry = true;
+        ADD_COUNTER(mNetworkErrorCnt, 1);
+    } else if (statusCode >= 500 || statusCode == 429) {
+        failDetail = "server error";
+        retry = true;
+        ADD_COUNTER(mServerErrorCnt, 1);
+    } else if (statusCode == 401 || statusCode == 403) {
+        failDetail = "write unauthorized";
+        ADD_COUNTER(mUnauthErrorCnt, 1);
+    } else {
+        failDetail = "invalid request";
+        ADD_COUNTER(mParamsErrorCnt, 1);
+    }
+    if (retry) {
+        mEndpointConcurrencyLimiter->OnFail(curSystemTime);
+    } else {
+        mEndpointConcurrencyLimiter->OnSuccess(curSystemTime);
+    }
+    if (retry
+        && chrono::duration_cast<chrono::seconds>(curSystemTime - item->mFirstEnqueTime).count()
+            > INT32_FLAG(discard_send_fail_interval)) {
+        retry = false;
+    }
+
+    const string* body = response.GetBody<string>();
+    string errorMsg = statusCode == 0 ? response.GetNetworkStatus().mMessage : (body ? body->substr(0, 256) : "");
+#define LOG_PATTERN \
+    ("failed to send request", failDetail)("operation", retry ? "retry later" : "discard data")( \
+        "item address", item)("status code", statusCode)("errMsg", errorMsg)("config", mContext->GetConfigName())( \
+        "endpoint", mEndpoint)("try cnt", item->mTryCnt)
+
+    SenderQueueManager::GetInstance()->DecreaseConcurrencyLimiterInSendingCnt(item->mQueueKey);
+    if (retry) {
+        int32_t curTime = time(nullptr);
+        if (curTime - mLastLogWarningTime > ON_FAIL_LOG_WARNING_INTERVAL_SECOND) {
+            LOG_WARNING(sLogger, LOG_PATTERN);
+            mLastLogWarningTime = curTime;
+        }
+        DealSenderQueueItemAfterSend(item, true);
+    } else {
+        LOG_WARNING(sLogger, LOG_PATTERN);
+        mContext->GetAlarm().SendAlarm(SEND_DATA_FAIL_ALARM,
+                                       "failed to send request: " + failDetail + "\toperation: discard data"
+                                           + "\tstatusCode: " + ToString(statusCode) + "\terrorMessage: " + errorMsg
+                                           + "\tconfig: " + mContext->GetConfigName() + "\tendpoint: " + mEndpoint,
+                                       mContext->GetRegion(),
+                                       mContext->GetProjectName(),
+                                       mContext->GetConfigName(),
+                                       mContext->GetLogstoreName());
+        ADD_COUNTER(mDiscardCnt, 1);
+        DealSenderQueueItemAfterSend(item, false);
+    }
+#undef LOG_PATTERN
+}
+
+bool FlusherPrometheusRemoteWrite::SerializeAndPush(BatchedEventsList&& groupList) {
+    if (groupList.empty()) {
+        return true;
+    }
+    string serializedData, compressedData, errorMsg;
+    if (!mGroupListSerializer->DoSerialize(std::move(groupList), serializedData, errorMsg)) {
+        LOG_WARNING(mContext->GetLogger(),
+                    ("failed to serialize event group",
+                     errorMsg)("action", "discard data")("plugin", sName)("config", mContext->GetConfigName()));
+        mContext->GetAlarm().SendAlarm(SERIALIZE_FAIL_ALARM,
+                                       "failed to serialize event group: " + errorMsg
+                                           + "\taction: discard data\tplugin: " + sName
+                                           + "\tconfig: " + mContext->GetConfigName(),
+                                       mContext->GetRegion(),
+                                       mContext->GetProjectName(),
+                                       mContext->GetConfigName(),
+                                       mContext->GetLogstoreName());
+        return false;
+    }
+    if (!mCompressor->DoCompress(serializedData, compressedData, errorMsg)) {
+        LOG_WARNING(mContext->GetLogger(),
+                    ("failed to compress event group",
+                     errorMsg)("action", "discard data")("plugin", sName)("config", mContext->GetConfigName()));
+        mContext->GetAlarm().SendAlarm(COMPRESS_FAIL_ALARM,
+                                       "failed to compress event group: " + errorMsg
+                                           + "\taction: discard data\tplugin: " + sName
+                                           + "\tconfig: " + mContext->GetConfigName(),
+                                       mContext->GetRegion(),
+                                       mContext->GetProjectName(),
+                                       mContext->GetConfigName(),
+                                       mContext->GetLogstoreName());
+        return false;
+    }
+    return Flusher::PushToQueue(
+        make_unique<SenderQueueItem>(std::move(compressedData), serializedData.size(), this, mQueueKey));
+}
+
+bool FlusherPrometheusRemoteWrite::SerializeAndPush(vector<BatchedEventsList>&& groupLists) {
+    bool allSucceeded = true;
+    for (auto& groupList : groupLists) {
+        allSucceeded = SerializeAndPush(std::move(groupList)) && allSucceeded;
+    }
+    return allSucceeded;
+}
+
+} // namespace logtail
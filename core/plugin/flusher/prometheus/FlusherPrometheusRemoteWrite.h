@@ -0,0 +1,92 @@
+/*
+ * Copyright 2025 iLogtail Authors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cstdint>
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "json/json.h"
+
+#include "collection_pipeline/batch/Batcher.h"
+#include "collection_pipeline/limiter/ConcurrencyLimiter.h"
+#include "collection_pipeline/plugin/interface/HttpFlusher.h"
+#include "collection_pipeline/serializer/Serializer.h"
+#include "common/compression/Compressor.h"
+#include "models/PipelineEventGroup.h"
+
+namespace logtail {
+
+// Sends metric events to a prometheus remote write 1.0 endpoint, i.e. snappy compressed prometheus.WriteRequest.
+class FlusherPrometheusRemoteWrite : public HttpFlusher {
+public:
+    static std::shared_ptr<ConcurrencyLimiter> GetEndpointConcurrencyLimiter(const std::string& endpoint);
+
+    static const std::string sName;
+
+    const std::string& Name() const override { return sName; }
+    bool Init(const Json::Value& config, Json::Value& optionalGoPipeline) override;
+    bool Send(PipelineEventGroup&& g) override;
+    bool Flush(size_t key) override;
+    bool FlushAll() override;
+    bool BuildRequest(SenderQueueItem* item,
+                      std::unique_ptr<HttpSinkRequest>& req,
+                      bool* keepItem,
+                      std::string* errMsg) override;
+    void OnSendDone(const HttpResponse& response, SenderQueueItem* item) override;
+
+    std::string mEndpoint;
+    std::unordered_map<std::string, std::string> mHeaders;
+
+private:
+    static std::mutex sMux;
+    static std::unordered_map<std::string, std::weak_ptr<ConcurrencyLimiter>> sEndpointConcurrencyLimiterMap;
+
+    bool SerializeAndPush(std::vector<BatchedEventsList>&& groupLists);
+    bool SerializeAndPush(BatchedEventsList&& groupList);
+
+    bool mHTTPSFlag = false;
+    std::string mHost;
+    int32_t mPort = 0;
+    std::string mPath;
+    std::shared_ptr<ConcurrencyLimiter> mEndpointConcurrencyLimiter;
+    std::atomic_int32_t mLastLogWarningTime = 0;
+
+    Batcher<> mBatcher;
+    std::unique_ptr<EventGroupListSerializer> mGroupListSerializer;
+    std::unique_ptr<Compressor> mCompressor;
+
+    CounterPtr mSendCnt;
+    CounterPtr mSendDoneCnt;
+    CounterPtr mSuccessCnt;
+    CounterPtr mDiscardCnt;
+    CounterPtr mNetworkErrorCnt;
+    CounterPtr mServerErrorCnt;
+    CounterPtr mUnauthErrorCnt;
+    CounterPtr mParamsErrorCnt;
+
+#ifdef APSARA_UNIT_TEST_MAIN
+    friend class FlusherPrometheusRemoteWriteUnittest;
+#endif
+};
+
+} // namespace logtail
@@ -59,6 +59,9 @@ DEFINE_FLAG_INT32(profile_data_send_retrytimes, "how many times should retry if
 DEFINE_FLAG_INT32(unknow_error_try_max, "discard data when try times > this value", 5);
 DEFINE_FLAG_BOOL(enable_metricstore_channel, "only works for metrics data for enhance metrics query performance", true);
 DEFINE_FLAG_INT32(max_send_log_group_size, "bytes", 10 * 1024 * 1024);
+DEFINE_FLAG_INT32(go_pipeline_send_package_size,
+                  "raw bytes of log groups from go pipeline packed into one request at most(default 512KB)",
+                  512 * 1024);
 DEFINE_FLAG_DOUBLE(sls_serialize_size_expansion_ratio, "", 1.2);
 DEFINE_FLAG_INT32(sls_request_dscp, "set dscp for sls request, from 0 to 63", -1);
 
@@ -514,6 +517,22 @@ bool FlusherSLS::Init(const Json::Value& config, Json::Value& optionalGoPipeline
     // CompressType
     if (BOOL_FLAG(sls_client_send_compress)) {
         mCompressor = CompressorFactory::GetInstance()->Create(config, *mContext, sName, mPluginID, CompressType::LZ4);
+        if (mCompressor
+            && (mCompressor->GetCompressType() == CompressType::SNAPPY
+                || mCompressor->GetCompressType() == CompressType::GZIP)) {
+            // not supported by sls
+            PARAM_WARNING_DEFAULT(mContext->GetLogger(),
+                                  mContext->GetAlarm(),
+                                  "string param CompressType is not valid",
+                                  "lz4",
+                                  sName,
+                                  mContext->GetConfigName(),
+                                  mContext->GetProjectName(),
+                                  mContext->GetLogstoreName(),
+                                  mContext->GetRegion());
+            mCompressor = CompressorFactory::GetInstance()->Create(
+                Json::Value(), *mContext, sName, mPluginID, CompressType::LZ4);
+        }
     }
 
     mGroupSerializer = make_unique<SLSEventGroupSerializer>(this);
@@ -906,43 +925,55 @@ void FlusherSLS::OnSendDone(const HttpResponse& response, SenderQueueItem* item)
 
 bool FlusherSLS::Send(string&& data, const string& shardHashKey, const string& logstore) {
     string compressedData;
-    if (mCompressor) {
-        string errorMsg;
-        if (!mCompressor->DoCompress(data, compressedData, errorMsg)) {
-            LOG_WARNING(mContext->GetLogger(),
-                        ("failed to compress data",
-                         errorMsg)("action", "discard data")("plugin", sName)("config", mContext->GetConfigName()));
-            mContext->GetAlarm().SendAlarm(COMPRESS_FAIL_ALARM,
-                                           "failed to compress data: " + errorMsg + "\taction: discard data\tplugin: "
-                                               + sName + "\tconfig: " + mContext->GetConfigName(),
-                                           mContext->GetRegion(),
-                                           mContext->GetProjectName(),
-                                           mContext->GetConfigName(),
-                                           mContext->GetLogstoreName());
-            return false;
-        }
-    } else {
-        compressedData = data;
-    }
-
-    QueueKey key = mQueueKey;
-    if (!HasContext()) {
-        key = QueueKeyManager::GetInstance()->GetKey(mProject + "-" + mLogstore);
-        if (SenderQueueManager::GetInstance()->GetQueue(key) == nullptr) {
-            CollectionPipelineContext ctx;
-            SenderQueueManager::GetInstance()->CreateQueue(
-                key, "", ctx, std::unordered_map<std::string, std::shared_ptr<ConcurrencyLimiter>>());
-        }
+    if (!CompressGoPipelineData(data, compressedData)) {
+        return false;
     }
     return Flusher::PushToQueue(make_unique<SLSSenderQueueItem>(std::move(compressedData),
                                                                 data.size(),
                                                                 this,
-                                                                key,
+                                                                GetGoPipelineQueueKey(),
                                                                 logstore.empty() ? mLogstore : logstore,
                                                                 RawDataType::EVENT_GROUP,
                                                                 shardHashKey));
 }
 
+bool FlusherSLS::SendBatch(
+    const char* data, const int32_t* sizes, size_t count, const string& shardHashKey, const string& logstore) {
+    bool allSucceeded = true;
+    if (!mCompressor || !mGroupListSerializer) {
+        for (size_t i = 0; i < count; data += sizes[i++]) {
+            allSucceeded = Send(string(data, sizes[i]), shardHashKey, logstore) && allSucceeded;
+        }
+        return allSucceeded;
+    }
+
+    // log groups are compressed one by one and packed into size-bounded package lists, the same as those from the
+    // native batcher, so that tiny log groups from go pipeline do not end up in tiny requests
+    vector<CompressedLogGroup> package;
+    size_t packageSize = 0;
+    string rawData, compressedData;
+    for (size_t i = 0; i < count; data += sizes[i++]) {
+        rawData.assign(data, sizes[i]);
+        if (!CompressGoPipelineData(rawData, compressedData)) {
+            allSucceeded = false;
+            continue;
+        }
+        if (!package.empty()
+            && packageSize + rawData.size() > static_cast<size_t>(INT32_FLAG(go_pipeline_send_package_size))) {
+            allSucceeded
+                = PushGoPipelinePackage(std::move(package), packageSize, shardHashKey, logstore) && allSucceeded;
+            package.clear();
+            packageSize = 0;
+        }
+        packageSize += rawData.size();
+        package.emplace_back(std::move(compressedData), rawData.size());
+    }
+    if (!package.empty()) {
+        allSucceeded = PushGoPipelinePackage(std::move(package), packageSize, shardHashKey, logstore) && allSucceeded;
+    }
+    return allSucceeded;
+}
+
 void FlusherSLS::GenerateGoPlugin(const Json::Value& config, Json::Value& res) const {
     Json::Value detail(Json::objectValue);
     for (auto itr = config.begin(); itr != config.end(); ++itr) {
@@ -959,6 +990,78 @@ void FlusherSLS::GenerateGoPlugin(const Json::Value& config, Json::Value& res) c
     }
 }
 
+bool FlusherSLS::CompressGoPipelineData(const string& data, string& compressedData) {
+    if (!mCompressor) {
+        compressedData = data;
+        return true;
+    }
+    string errorMsg;
+    if (!mCompressor->DoCompress(data, compressedData, errorMsg)) {
+        LOG_WARNING(mContext->GetLogger(),
+                    ("failed to compress data",
+                     errorMsg)("action", "discard data")("plugin", sName)("config", mContext->GetConfigName()));
+        mContext->GetAlarm().SendAlarm(COMPRESS_FAIL_ALARM,
+                                       "failed to compress data: " + errorMsg + "\taction: discard data\tplugin: "
+                                           + sName + "\tconfig: " + mContext->GetConfigName(),
+                                       mContext->GetRegion(),
+                                       mContext->GetProjectName(),
+                                       mContext->GetConfigName(),
+                                       mContext->GetLogstoreName());
+        return false;
+    }
+    return true;
+}
+
+QueueKey FlusherSLS::GetGoPipelineQueueKey() {
+    if (HasContext()) {
+        return mQueueKey;
+    }
+    QueueKey key = QueueKeyManager::GetInstance()->GetKey(mProject + "-" + mLogstore);
+    if (SenderQueueManager::GetInstance()->GetQueue(key) == nullptr) {
+        CollectionPipelineContext ctx;
+        SenderQueueManager::GetInstance()->CreateQueue(
+            key, "", ctx, std::unordered_map<std::string, std::shared_ptr<ConcurrencyLimiter>>());
+    }
+    return key;
+}
+
+bool FlusherSLS::PushGoPipelinePackage(vector<CompressedLogGroup>&& package,
+                                       size_t packageSize,
+                                       const string& shardHashKey,
+                                       const string& logstore) {
+    if (package.size() == 1) {
+        return Flusher::PushToQueue(make_unique<SLSSenderQueueItem>(std::move(package[0].mData),
+                                                                    package[0].mRawSize,
+                                                                    this,
+                                                                    GetGoPipelineQueueKey(),
+                                                                    logstore.empty() ? mLogstore : logstore,
+                                                                    RawDataType::EVENT_GROUP,
+                                                                    shardHashKey));
+    }
+    string serializedData, errorMsg;
+    if (!mGroupListSerializer->DoSerialize(std::move(package), serializedData, errorMsg)) {
+        LOG_WARNING(mContext->GetLogger(),
+                    ("failed to serialize event group list",
+                     errorMsg)("action", "discard data")("plugin", sName)("config", mContext->GetConfigName()));
+        mContext->GetAlarm().SendAlarm(SERIALIZE_FAIL_ALARM,
+                                       "failed to serialize event group list: " + errorMsg
+                                           + "\taction: discard data\tplugin: " + sName
+                                           + "\tconfig: " + mContext->GetConfigName(),
+                                       mContext->GetRegion(),
+                                       mContext->GetProjectName(),
+                                       mContext->GetConfigName(),
+                                       mContext->GetLogstoreName());
+        return false;
+    }
+    return Flusher::PushToQueue(make_unique<SLSSenderQueueItem>(std::move(serializedData),
+                                                                packageSize,
+                                                                this,
+                                                                GetGoPipelineQueueKey(),
+                                                                logstore.empty() ? mLogstore : logstore,
+                                                                RawDataType::EVENT_GROUP_LIST,
+                                                                shardHashKey));
+}
+
 bool FlusherSLS::SerializeAndPush(PipelineEventGroup&& group) {
     string serializedData, compressedData;
     BatchedEvents g(std::move(group.MutableEvents()),
@@ -78,6 +78,12 @@ public:
 
     // for use of Go pipeline and shennong
     bool Send(std::string&& data, const std::string& shardHashKey, const std::string& logstore = "");
+    // for use of Go pipeline, data holds count serialized log groups in sequence, which are packed into requests
+    bool SendBatch(const char* data,
+                   const int32_t* sizes,
+                   size_t count,
+                   const std::string& shardHashKey,
+                   const std::string& logstore = "");
 
     std::string GetSubpath() const { return mSubpath; }
 
@@ -117,6 +123,12 @@ private:
     static bool sIsResourceInited;
 
     void GenerateGoPlugin(const Json::Value& config, Json::Value& res) const;
+    bool CompressGoPipelineData(const std::string& data, std::string& compressedData);
+    QueueKey GetGoPipelineQueueKey();
+    bool PushGoPipelinePackage(std::vector<CompressedLogGroup>&& package,
+                               size_t packageSize,
+                               const std::string& shardHashKey,
+                               const std::string& logstore);
     bool SerializeAndPush(std::vector<BatchedEventsList>&& groupLists);
     bool SerializeAndPush(BatchedEventsList&& groupList);
     bool SerializeAndPush(PipelineEventGroup&& g); // for exactly once only
@@ -43,6 +43,7 @@ bool InputProcessSecurity::Init(const Json::Value& config, Json::Value& optional
         {METRIC_PLUGIN_EBPF_LOSS_KERNEL_EVENTS_TOTAL, MetricType::METRIC_TYPE_COUNTER},
         {METRIC_PLUGIN_EBPF_PROCESS_CACHE_ENTRIES_NUM, MetricType::METRIC_TYPE_INT_GAUGE},
         {METRIC_PLUGIN_EBPF_PROCESS_CACHE_MISS_TOTAL, MetricType::METRIC_TYPE_COUNTER},
+        {METRIC_PLUGIN_EBPF_RING_DROP_EVENTS_TOTAL, MetricType::METRIC_TYPE_COUNTER},
     };
 
     mPluginMgr = std::make_shared<PluginMetricManager>(
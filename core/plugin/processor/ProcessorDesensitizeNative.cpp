@@ -15,6 +15,11 @@
  */
 #include "plugin/processor/ProcessorDesensitizeNative.h"
 
+#include <cctype>
+#include <cstring>
+
+#include <string_view>
+
 #include "collection_pipeline/plugin/instance/ProcessorInstance.h"
 #include "common/HashUtil.h"
 #include "common/ParamExtractor.h"
@@ -26,6 +31,30 @@ namespace logtail {
 
 const std::string ProcessorDesensitizeNative::sName = "processor_desensitize_native";
 
+static const size_t kMD5HexSize = 32;
+
+// @return false if pattern is not a literal
+static bool GetRegexLiteral(const std::string& pattern, std::string& literal) {
+    literal.clear();
+    for (size_t i = 0; i < pattern.size(); ++i) {
+        char c = pattern[i];
+        if (strchr("^$.|?*+()[]{}", c) != nullptr) {
+            literal.clear();
+            return false;
+        }
+        if (c == '\\') {
+            // only escaped punctuations are literals, others like \d or \x41 are not handled
+            if (i + 1 == pattern.size() || isalnum(static_cast<unsigned char>(pattern[i + 1]))) {
+                literal.clear();
+                return false;
+            }
+            c = pattern[++i];
+        }
+        literal.push_back(c);
+    }
+    return true;
+}
+
 bool ProcessorDesensitizeNative::Init(const Json::Value& config) {
     std::string errorMsg;
 
@@ -81,6 +110,8 @@ bool ProcessorDesensitizeNative::Init(const Json::Value& config) {
                                mContext->GetRegion());
         }
     }
+    mLiteralReplacingString = mReplacingString;
+    mIsLiteralReplacingString = mReplacingString.find('\\') == std::string::npos;
     mReplacingString = std::string("\\1") + mReplacingString;
 
     // ContentPatternBeforeReplacedString
@@ -123,6 +154,12 @@ bool ProcessorDesensitizeNative::Init(const Json::Value& config) {
                            mContext->GetRegion());
     }
 
+    // every match contains ContentPatternBeforeReplacedString if it is a literal and there is no alternation in
+    // ReplacedContentPattern which may make it optional
+    if (mReplacedContentPattern.find('|') == std::string::npos) {
+        GetRegexLiteral(mContentPatternBeforeReplacedString, mRequiredLiteral);
+    }
+
     // ReplacingAll
     if (!GetOptionalBoolParam(config, "ReplacingAll", mReplacingAll, errorMsg)) {
         PARAM_WARNING_DEFAULT(mContext->GetLogger(),
@@ -179,10 +216,16 @@ void ProcessorDesensitizeNative::ProcessEvent(PipelineEventPtr& e) {
         if (item.second.empty()) {
             continue;
         }
-        std::string value = item.second.to_string();
-        CastOneSensitiveWord(&value);
-        StringBuffer valueBuffer = sourceEvent.GetSourceBuffer()->CopyString(value);
-        sourceEvent.SetContentNoCopy(item.first, StringView(valueBuffer.data, valueBuffer.size));
+        StringView result;
+        bool fallback = false;
+        if (DesensitizeValue(item.second, *sourceEvent.GetSourceBuffer(), result, fallback)) {
+            sourceEvent.SetContentNoCopy(item.first, result);
+        } else if (fallback) {
+            std::string value = item.second.to_string();
+            CastOneSensitiveWord(&value);
+            StringBuffer valueBuffer = sourceEvent.GetSourceBuffer()->CopyString(value);
+            sourceEvent.SetContentNoCopy(item.first, StringView(valueBuffer.data, valueBuffer.size));
+        }
         processed = true;
     }
     if (processed) {
@@ -196,6 +239,107 @@ void ProcessorDesensitizeNative::ProcessEvent(PipelineEventPtr& e) {
     }
 }
 
+bool ProcessorDesensitizeNative::DesensitizeValue(StringView value,
+                                                  SourceBuffer& sourceBuffer,
+                                                  StringView& result,
+                                                  bool& fallback) const {
+    if (!mRequiredLiteral.empty()
+        && std::string_view(value.data(), value.size()).find(mRequiredLiteral) == std::string_view::npos) {
+        return false;
+    }
+    // reused by all values processed by the thread
+    static thread_local std::vector<SensitiveMatch> sMatches;
+    sMatches.clear();
+    if (mMethod == DesensitizeMethod::CONST_OPTION) {
+        if (!mIsLiteralReplacingString) {
+            fallback = true;
+            return false;
+        }
+        if (!FindConstMatches(value, sMatches, fallback)) {
+            return false;
+        }
+    } else if (!FindMD5Matches(value, sMatches)) {
+        return false;
+    }
+
+    const size_t replacingSize
+        = mMethod == DesensitizeMethod::CONST_OPTION ? mLiteralReplacingString.size() : kMD5HexSize;
+    size_t size = value.size() - sMatches.back().mEnd;
+    for (const auto& match : sMatches) {
+        size += match.mPrefixEnd - match.mBegin + replacingSize;
+    }
+    StringBuffer buffer = sourceBuffer.AllocateStringBuffer(size);
+    char* out = buffer.data;
+    for (const auto& match : sMatches) {
+        memcpy(out, value.data() + match.mBegin, match.mPrefixEnd - match.mBegin);
+        out += match.mPrefixEnd - match.mBegin;
+        if (mMethod == DesensitizeMethod::CONST_OPTION) {
+            memcpy(out, mLiteralReplacingString.data(), replacingSize);
+        } else {
+            CalcMD5(value.data() + match.mPrefixEnd, match.mEnd - match.mPrefixEnd, out);
+        }
+        out += replacingSize;
+    }
+    memcpy(out, value.data() + sMatches.back().mEnd, value.size() - sMatches.back().mEnd);
+    result = StringView(buffer.data, size);
+    return true;
+}
+
+// Same as RE2::GlobalReplace (or RE2::Replace if not mReplacingAll) with rewrite \\1ReplacingString, except that
+// empty matches, which need special skipping, are left to CastOneSensitiveWord.
+bool ProcessorDesensitizeNative::FindConstMatches(StringView value,
+                                                  std::vector<SensitiveMatch>& matches,
+                                                  bool& fallback) const {
+    re2::StringPiece text(value.data(), value.size());
+    re2::StringPiece groups[2];
+    size_t pos = 0;
+    while (pos <= value.size()) {
+        if (!mRegex->Match(text, pos, text.size(), RE2::UNANCHORED, groups, 2)) {
+            break;
+        }
+        if (groups[0].empty()) {
+            fallback = true;
+            return false;
+        }
+        size_t begin = groups[0].data() - value.data();
+        size_t end = begin + groups[0].size();
+        // the prefix group does not participate in the match if there is alternation
+        size_t prefixEnd = groups[1].data() == nullptr ? begin : groups[1].data() + groups[1].size() - value.data();
+        matches.push_back({pos, prefixEnd, end});
+        pos = end;
+        if (!mReplacingAll) {
+            break;
+        }
+    }
+    return !matches.empty();
+}
+
+// Same as the RE2::FindAndConsume loop in CastOneSensitiveWord, the value is not changed if any match is invalid.
+bool ProcessorDesensitizeNative::FindMD5Matches(StringView value, std::vector<SensitiveMatch>& matches) const {
+    re2::StringPiece groups[2];
+    size_t pos = 0;
+    do {
+        re2::StringPiece remaining(value.data() + pos, value.size() - pos);
+        if (!mRegex->Match(remaining, 0, remaining.size(), RE2::UNANCHORED, groups, 2)) {
+            break;
+        }
+        if (groups[1].data() == nullptr) {
+            return false;
+        }
+        size_t prefixEnd = groups[1].data() + groups[1].size() - value.data();
+        size_t end = groups[0].data() + groups[0].size() - value.data();
+        if (prefixEnd < pos || end <= pos) {
+            return false;
+        }
+        matches.push_back({pos, prefixEnd, end});
+        pos = end;
+        if (end >= value.size()) {
+            break;
+        }
+    } while (mReplacingAll);
+    return !matches.empty();
+}
+
 void ProcessorDesensitizeNative::CastOneSensitiveWord(std::string* value) {
     std::string* pVal = value;
     bool rst = false;
@@ -16,6 +16,8 @@
 
 #pragma once
 
+#include <vector>
+
 #include "re2/re2.h"
 
 #include "collection_pipeline/plugin/interface/Processor.h"
@@ -51,10 +53,28 @@ protected:
     bool IsSupportedEvent(const PipelineEventPtr& e) const override;
 
 private:
+    // a sensitive content found in the value, offsets are relative to the value
+    struct SensitiveMatch {
+        size_t mBegin; // begin of the kept part, i.e. end of the last match
+        size_t mPrefixEnd; // end of ContentPatternBeforeReplacedString, the kept part ends here
+        size_t mEnd; // end of the sensitive content
+    };
+
     void ProcessEvent(PipelineEventPtr& e);
+    // Desensitize value in one pass: all matches are found first, then the result is written directly into a string
+    // allocated from sourceBuffer, with md5 of each sensitive content computed in place.
+    // @return false if value is not changed, or the value can only be handled by CastOneSensitiveWord
+    bool DesensitizeValue(StringView value, SourceBuffer& sourceBuffer, StringView& result, bool& fallback) const;
+    bool FindConstMatches(StringView value, std::vector<SensitiveMatch>& matches, bool& fallback) const;
+    bool FindMD5Matches(StringView value, std::vector<SensitiveMatch>& matches) const;
     void CastOneSensitiveWord(std::string* value);
 
     std::shared_ptr<re2::RE2> mRegex;
+    // literal which every match must contain, values without it are skipped without running the regex
+    std::string mRequiredLiteral;
+    // ReplacingString as is, valid only if it has no rewrite escape like \\1, otherwise RE2 rewrite is needed
+    std::string mLiteralReplacingString;
+    bool mIsLiteralReplacingString = false;
 
     CounterPtr mDiscardedEventsTotal;
     CounterPtr mOutFailedEventsTotal;
@@ -63,6 +83,7 @@ private:
 
 #ifdef APSARA_UNIT_TEST_MAIN
     friend class ProcessorParseApsaraNativeUnittest;
+    friend class ProcessorDesensitizeNativeUnittest;
 #endif
 };
 
@@ -16,41 +16,93 @@
 
 #include "plugin/processor/ProcessorParseJsonNative.h"
 
+#include <cstring>
+
 #include "rapidjson/document.h"
 #include "rapidjson/stringbuffer.h"
 #include "rapidjson/writer.h"
 
 #include "collection_pipeline/plugin/instance/ProcessorInstance.h"
 #include "common/ParamExtractor.h"
+#include "common/SimdJsonUtil.h"
 #include "models/LogEvent.h"
 #include "monitor/metric_constants/MetricConstants.h"
 
 namespace logtail {
 
-static std::string RapidjsonValueToString(const rapidjson::Value& value) {
-    if (value.IsString())
-        return std::string(value.GetString(), value.GetStringLength());
-    else if (value.IsBool())
-        return ToString(value.GetBool());
-    else if (value.IsInt())
-        return ToString(value.GetInt());
-    else if (value.IsUint())
-        return ToString(value.GetUint());
-    else if (value.IsInt64())
-        return ToString(value.GetInt64());
-    else if (value.IsUint64())
-        return ToString(value.GetUint64());
-    else if (value.IsDouble())
-        return ToString(value.GetDouble());
-    else if (value.IsNull())
-        return "";
-    else // if (value.IsObject() || value.IsArray())
-    {
-        rapidjson::StringBuffer buffer;
+namespace {
+
+// Rapidjson document whose values and parse stack live in thread-local buffers reused across events, so that parsing
+// an event does not allocate unless it is larger than the buffers.
+class JsonParseBuffer {
+public:
+    using Document = rapidjson::
+        GenericDocument<rapidjson::UTF8<>, rapidjson::MemoryPoolAllocator<>, rapidjson::MemoryPoolAllocator<>>;
+
+    static JsonParseBuffer& GetInstance() {
+        static thread_local JsonParseBuffer sBuffer;
+        return sBuffer;
+    }
+
+    rapidjson::MemoryPoolAllocator<>& GetValueAllocator() { return mValueAllocator; }
+    rapidjson::MemoryPoolAllocator<>& GetStackAllocator() { return mStackAllocator; }
+    rapidjson::StringBuffer& GetWriterBuffer() {
+        mWriterBuffer.Clear();
+        return mWriterBuffer;
+    }
+    // should be called after the document is destructed
+    void Reset() {
+        mValueAllocator.Clear();
+        mStackAllocator.Clear();
+    }
+
+    static constexpr size_t kStackBufferSize = 4 * 1024;
+
+private:
+    JsonParseBuffer()
+        : mValueAllocator(mValueBuffer, sizeof(mValueBuffer)), mStackAllocator(mStackBuffer, sizeof(mStackBuffer)) {}
+
+    char mValueBuffer[32 * 1024];
+    char mStackBuffer[kStackBufferSize];
+    rapidjson::MemoryPoolAllocator<> mValueAllocator;
+    rapidjson::MemoryPoolAllocator<> mStackAllocator;
+    rapidjson::StringBuffer mWriterBuffer;
+};
+
+} // namespace
+
+// strings are returned as they are, since they are already in the source buffer after in situ parsing
+template <typename ValueType>
+static StringView RapidjsonValueToStringView(const ValueType& value, SourceBuffer& sourceBuffer) {
+    if (value.IsString()) {
+        return StringView(value.GetString(), value.GetStringLength());
+    }
+    if (value.IsBool()) {
+        return value.GetBool() ? StringView("true") : StringView("false");
+    }
+    if (value.IsNull()) {
+        return StringView();
+    }
+    std::string res;
+    if (value.IsInt()) {
+        res = ToString(value.GetInt());
+    } else if (value.IsUint()) {
+        res = ToString(value.GetUint());
+    } else if (value.IsInt64()) {
+        res = ToString(value.GetInt64());
+    } else if (value.IsUint64()) {
+        res = ToString(value.GetUint64());
+    } else if (value.IsDouble()) {
+        res = ToString(value.GetDouble());
+    } else { // if (value.IsObject() || value.IsArray())
+        auto& buffer = JsonParseBuffer::GetInstance().GetWriterBuffer();
         rapidjson::Writer<rapidjson::StringBuffer> writer(buffer);
         value.Accept(writer);
-        return std::string(buffer.GetString(), buffer.GetLength());
+        StringBuffer b = sourceBuffer.CopyString(buffer.GetString(), buffer.GetLength());
+        return StringView(b.data, b.size);
     }
+    StringBuffer b = sourceBuffer.CopyString(res);
+    return StringView(b.data, b.size);
 }
 
 const std::string ProcessorParseJsonNative::sName = "processor_parse_json_native";
@@ -146,9 +198,92 @@ bool ProcessorParseJsonNative::JsonLogLineParser(LogEvent& sourceEvent,
     if (buffer.empty())
         return false;
 
-    bool parseSuccess = true;
+    // the raw content may still be needed after parsing, so it is copied once into the source buffer to be parsed in
+    // situ, then keys and string values can be used without copy. Content with null byte cannot be parsed in situ.
+    if (memchr(buffer.data(), '\0', buffer.size()) != nullptr) {
+        return JsonLogLineParserWithCopy(sourceEvent, logPath, buffer, sourceKeyOverwritten);
+    }
+    if (IsSimdJsonEnabled() && SimdJsonLogLineParser(sourceEvent, buffer, sourceKeyOverwritten)) {
+        return true;
+    }
+    StringBuffer insituBuffer = sourceEvent.GetSourceBuffer()->CopyString(buffer);
+
+    auto& parseBuffer = JsonParseBuffer::GetInstance();
+    bool parseSuccess = false;
+    {
+        JsonParseBuffer::Document doc(&parseBuffer.GetValueAllocator(),
+                                      JsonParseBuffer::kStackBufferSize,
+                                      &parseBuffer.GetStackAllocator());
+        doc.ParseInsitu(insituBuffer.data);
+        if (CheckParseResult(doc, buffer, logPath)) {
+            parseSuccess = true;
+            for (auto itr = doc.MemberBegin(); itr != doc.MemberEnd(); ++itr) {
+                StringView contentKey(itr->name.GetString(), itr->name.GetStringLength());
+                if (contentKey == mSourceKey) {
+                    sourceKeyOverwritten = true;
+                }
+                AddLog(contentKey, RapidjsonValueToStringView(itr->value, *sourceEvent.GetSourceBuffer()), sourceEvent);
+            }
+        }
+    }
+    parseBuffer.Reset();
+    return parseSuccess;
+}
+
+bool ProcessorParseJsonNative::SimdJsonLogLineParser(LogEvent& sourceEvent,
+                                                     const StringView& buffer,
+                                                     bool& sourceKeyOverwritten) {
+    static thread_local std::vector<std::pair<StringView, StringView>> sMembers;
+
+    // simdjson reads beyond the end of json, and the copy is dropped along with the source buffer if parsing fails,
+    // which is left to rapidjson for the same error handling as before
+    StringBuffer insituBuffer = sourceEvent.GetSourceBuffer()->AllocateStringBuffer(buffer.size() + kSimdJsonPadding);
+    memcpy(insituBuffer.data, buffer.data(), buffer.size());
+    if (!ParseJsonObjectInPlace(insituBuffer.data, buffer.size(), *sourceEvent.GetSourceBuffer(), sMembers)) {
+        return false;
+    }
+    for (const auto& member : sMembers) {
+        if (member.first == mSourceKey) {
+            sourceKeyOverwritten = true;
+        }
+        AddLog(member.first, member.second, sourceEvent);
+    }
+    return true;
+}
+
+bool ProcessorParseJsonNative::JsonLogLineParserWithCopy(LogEvent& sourceEvent,
+                                                         const StringView& logPath,
+                                                         const StringView& buffer,
+                                                         bool& sourceKeyOverwritten) {
     rapidjson::Document doc;
     doc.Parse(buffer.data(), buffer.size());
+    if (!CheckParseResult(doc, buffer, logPath)) {
+        return false;
+    }
+    for (rapidjson::Value::ConstMemberIterator itr = doc.MemberBegin(); itr != doc.MemberEnd(); ++itr) {
+        StringBuffer contentKeyBuffer
+            = sourceEvent.GetSourceBuffer()->CopyString(itr->name.GetString(), itr->name.GetStringLength());
+        StringView contentKey(contentKeyBuffer.data, contentKeyBuffer.size);
+        StringView contentValue;
+        if (itr->value.IsString()) {
+            StringBuffer contentValueBuffer
+                = sourceEvent.GetSourceBuffer()->CopyString(itr->value.GetString(), itr->value.GetStringLength());
+            contentValue = StringView(contentValueBuffer.data, contentValueBuffer.size);
+        } else {
+            contentValue = RapidjsonValueToStringView(itr->value, *sourceEvent.GetSourceBuffer());
+        }
+        if (contentKey == mSourceKey) {
+            sourceKeyOverwritten = true;
+        }
+        AddLog(contentKey, contentValue, sourceEvent);
+    }
+    return true;
+}
+
+template <typename DocumentType>
+bool ProcessorParseJsonNative::CheckParseResult(const DocumentType& doc,
+                                                const StringView& buffer,
+                                                const StringView& logPath) {
     if (doc.HasParseError()) {
         if (AlarmManager::GetInstance()->IsLowLevelAlarmValid()) {
             LOG_WARNING(sLogger,
@@ -163,8 +298,9 @@ bool ProcessorParseJsonNative::JsonLogLineParser(LogEvent& sourceEvent,
                                                    GetContext().GetLogstoreName());
         }
         ADD_COUNTER(mOutFailedEventsTotal, 1);
-        parseSuccess = false;
-    } else if (!doc.IsObject()) {
+        return false;
+    }
+    if (!doc.IsObject()) {
         if (AlarmManager::GetInstance()->IsLowLevelAlarmValid()) {
             LOG_WARNING(sLogger,
                         ("invalid json object, log", buffer)("project", GetContext().GetProjectName())(
@@ -177,27 +313,8 @@ bool ProcessorParseJsonNative::JsonLogLineParser(LogEvent& sourceEvent,
                                                    GetContext().GetLogstoreName());
         }
         ADD_COUNTER(mOutFailedEventsTotal, 1);
-        parseSuccess = false;
-    }
-    if (!parseSuccess) {
         return false;
     }
-
-    for (rapidjson::Value::ConstMemberIterator itr = doc.MemberBegin(); itr != doc.MemberEnd(); ++itr) {
-        std::string contentKey = RapidjsonValueToString(itr->name);
-        std::string contentValue = RapidjsonValueToString(itr->value);
-
-        StringBuffer contentKeyBuffer = sourceEvent.GetSourceBuffer()->CopyString(contentKey);
-        StringBuffer contentValueBuffer = sourceEvent.GetSourceBuffer()->CopyString(contentValue);
-
-        if (contentKey.c_str() == mSourceKey) {
-            sourceKeyOverwritten = true;
-        }
-
-        AddLog(StringView(contentKeyBuffer.data, contentKeyBuffer.size),
-               StringView(contentValueBuffer.data, contentValueBuffer.size),
-               sourceEvent);
-    }
     return true;
 }
 
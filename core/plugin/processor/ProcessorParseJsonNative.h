@@ -41,6 +41,13 @@ private:
                            const StringView& logPath,
                            PipelineEventPtr& e,
                            bool& sourceKeyOverwritten);
+    bool SimdJsonLogLineParser(LogEvent& sourceEvent, const StringView& buffer, bool& sourceKeyOverwritten);
+    bool JsonLogLineParserWithCopy(LogEvent& sourceEvent,
+                                   const StringView& logPath,
+                                   const StringView& buffer,
+                                   bool& sourceKeyOverwritten);
+    template <typename DocumentType>
+    bool CheckParseResult(const DocumentType& doc, const StringView& buffer, const StringView& logPath);
     void AddLog(const StringView& key, const StringView& value, LogEvent& targetEvent, bool overwritten = true);
     bool ProcessEvent(const StringView& logPath, PipelineEventPtr& e, const GroupMetadata& metadata);
 
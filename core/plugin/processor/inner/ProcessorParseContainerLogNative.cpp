@@ -20,6 +20,7 @@
 
 #include "common/JsonUtil.h"
 #include "common/ParamExtractor.h"
+#include "common/SimdJsonUtil.h"
 #include "models/LogEvent.h"
 #include "monitor/metric_constants/MetricConstants.h"
 #include "plugin/processor/inner/ProcessorMergeMultilineLogNative.h"
@@ -464,7 +465,12 @@ bool ProcessorParseContainerLogNative::ParseDockerJsonLogLine(LogEvent& sourceEv
 
     char* data = const_cast<char*>(buffer.data());
 
-    if (ParseDockerLog(data, buffer.size(), entry)) {
+    DockerJsonFileFields fields;
+    if (IsSimdJsonEnabled() && ParseDockerJsonFileLineInPlace(data, buffer.size(), fields)) {
+        timeValue = fields.time;
+        content = fields.log;
+        sourceValue = fields.stream;
+    } else if (ParseDockerLog(data, buffer.size(), entry)) {
         timeValue = entry.time;
         content = entry.log;
         sourceValue = entry.stream;
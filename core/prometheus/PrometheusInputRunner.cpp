@@ -32,6 +32,7 @@
 #include "monitor/metric_constants/MetricConstants.h"
 #include "prometheus/Constants.h"
 #include "prometheus/Utils.h"
+#include "prometheus/component/ScrapeExecutor.h"
 
 using namespace std;
 
@@ -212,6 +213,7 @@ void PrometheusInputRunner::Stop() {
         WriteLock lock(mSubscriberMapRWLock);
         mTargetSubscriberSchedulerMap.clear();
     }
+    ScrapeExecutor::GetInstance()->Clear();
 
     // only unregister when operator exist
     if (!mServiceHost.empty()) {
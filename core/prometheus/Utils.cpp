@@ -150,6 +150,13 @@ uint64_t GetRandSleepMilliSec(const std::string& key, uint64_t intervalSeconds,
     return randSleep;
 }
 
+uint64_t GetRandSpreadMilliSec(const std::string& key, uint64_t windowMilliSec) {
+    if (windowMilliSec == 0) {
+        return 0;
+    }
+    return XXH64(key.c_str(), key.length(), 1) % windowMilliSec;
+}
+
 namespace prom {
 
 std::string NetworkCodeToState(NetworkCode code) {
@@ -20,6 +20,8 @@ void SplitStringView(const std::string& s, char delimiter, std::vector<StringVie
 bool IsNumber(const std::string& str);
 
 uint64_t GetRandSleepMilliSec(const std::string& key, uint64_t intervalSeconds, uint64_t currentMilliSeconds);
+// a stable offset in [0, windowMilliSec) of the key, uncorrelated with the one of GetRandSleepMilliSec
+uint64_t GetRandSpreadMilliSec(const std::string& key, uint64_t windowMilliSec);
 
 namespace prom {
 std::string NetworkCodeToState(NetworkCode code);
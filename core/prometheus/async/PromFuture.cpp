@@ -30,6 +30,13 @@ template <typename... Args>
 void PromFuture<Args...>::Cancel() {
     WriteLock lock(mStateRWLock);
     mState = PromFutureState::Done;
+    mCancelled = true;
+}
+
+template <typename... Args>
+bool PromFuture<Args...>::IsCancelled() {
+    ReadLock lock(mStateRWLock);
+    return mCancelled;
 }
 
 template class PromFuture<HttpResponse&, uint64_t>;
@@ -19,8 +19,11 @@ public:
 
     void Cancel();
 
+    bool IsCancelled();
+
 protected:
     PromFutureState mState = {PromFutureState::New};
+    bool mCancelled = false;
     ReadWriteLock mStateRWLock;
 
     std::vector<CallbackSignature> mDoneCallbacks;
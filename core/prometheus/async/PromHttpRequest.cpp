@@ -7,6 +7,7 @@
 #include <utility>
 
 #include "common/http/HttpRequest.h"
+#include "prometheus/component/ScrapeExecutor.h"
 
 namespace logtail {
 
@@ -47,6 +48,10 @@ void PromHttpRequest::OnSendDone(HttpResponse& response) {
         mFuture->Process(
             response, std::chrono::duration_cast<std::chrono::milliseconds>(mLastSendTime.time_since_epoch()).count());
     }
+    if (mStartedByExecutor) {
+        mStartedByExecutor = false;
+        ScrapeExecutor::GetInstance()->OnScrapeDone(mEstimatedSize);
+    }
 }
 
 [[nodiscard]] bool PromHttpRequest::IsContextValid() const {
@@ -56,4 +61,13 @@ void PromHttpRequest::OnSendDone(HttpResponse& response) {
     return true;
 }
 
+[[nodiscard]] bool PromHttpRequest::IsCancelled() const {
+    return mFuture != nullptr && mFuture->IsCancelled();
+}
+
+void PromHttpRequest::SetScrapeStat(uint64_t estimatedSize, CounterPtr queueDelayMs) {
+    mEstimatedSize = estimatedSize;
+    mQueueDelayMs = std::move(queueDelayMs);
+}
+
 } // namespace logtail
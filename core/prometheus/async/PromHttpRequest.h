@@ -5,6 +5,7 @@
 #include <string>
 
 #include "common/http/HttpRequest.h"
+#include "monitor/metric_models/MetricTypes.h"
 #include "prometheus/async/PromFuture.h"
 
 namespace logtail {
@@ -31,12 +32,24 @@ public:
 
     void OnSendDone(HttpResponse& response) override;
     [[nodiscard]] bool IsContextValid() const override;
+    // whether the scheduler of the request has been cancelled
+    [[nodiscard]] bool IsCancelled() const;
+
+    // for ScrapeExecutor, the estimated response size is the one of the last scrape of the target
+    void SetScrapeStat(uint64_t estimatedSize, CounterPtr queueDelayMs);
 
 private:
     void SetNextExecTime(std::chrono::steady_clock::time_point execTime);
 
     std::shared_ptr<PromFuture<HttpResponse&, uint64_t>> mFuture;
     std::shared_ptr<PromFuture<>> mIsContextValidFuture;
+
+    uint64_t mEstimatedSize = 0;
+    CounterPtr mQueueDelayMs;
+    // whether the request is started by ScrapeExecutor, which should be notified once it is done
+    bool mStartedByExecutor = false;
+
+    friend class ScrapeExecutor;
 };
 
 } // namespace logtail
@@ -0,0 +1,129 @@
+// Copyright 2025 iLogtail Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "prometheus/component/ScrapeExecutor.h"
+
+#include <vector>
+
+#include "common/Flags.h"
+#include "common/http/AsynCurlRunner.h"
+#include "monitor/metric_constants/MetricConstants.h"
+
+DEFINE_FLAG_INT32(prom_scrape_max_in_flight, "max number of prometheus scrapes in flight, 0 means unlimited", 256);
+DEFINE_FLAG_INT64(prom_scrape_max_in_flight_bytes,
+                  "max estimated response bytes of prometheus scrapes in flight, 0 means unlimited",
+                  256 * 1024 * 1024);
+
+using namespace std;
+
+namespace logtail {
+
+ScrapeExecutor::ScrapeExecutor() {
+    WriteMetrics::GetInstance()->PrepareMetricsRecordRef(
+        mMetricsRecordRef,
+        MetricCategory::METRIC_CATEGORY_RUNNER,
+        {{METRIC_LABEL_KEY_RUNNER_NAME, METRIC_LABEL_VALUE_RUNNER_NAME_PROMETHEUS_SCRAPE_EXECUTOR}});
+    mInFlightTotal = mMetricsRecordRef.CreateIntGauge(METRIC_RUNNER_PROM_SCRAPE_IN_FLIGHT_TOTAL);
+    mInFlightSizeBytes = mMetricsRecordRef.CreateIntGauge(METRIC_RUNNER_PROM_SCRAPE_IN_FLIGHT_SIZE_BYTES);
+    mWaitingTotal = mMetricsRecordRef.CreateIntGauge(METRIC_RUNNER_PROM_SCRAPE_WAITING_TOTAL);
+    mQueuedTotal = mMetricsRecordRef.CreateCounter(METRIC_RUNNER_PROM_SCRAPE_QUEUED_TOTAL);
+    mQueueDelayMs = mMetricsRecordRef.CreateCounter(METRIC_RUNNER_PROM_SCRAPE_QUEUE_DELAY_MS);
+}
+
+void ScrapeExecutor::Submit(unique_ptr<PromHttpRequest>&& request) {
+    {
+        lock_guard<mutex> lock(mMux);
+        // keep FIFO, so that a large scrape waiting for bytes is not starved by small ones
+        if (!mWaitingQueue.empty() || !CanStart(request->mEstimatedSize)) {
+            mWaitingQueue.emplace_back(chrono::steady_clock::now(), std::move(request));
+            ADD_COUNTER(mQueuedTotal, 1);
+            UpdateGauges();
+            return;
+        }
+        ++mInFlightCnt;
+        mInFlightSize += request->mEstimatedSize;
+        UpdateGauges();
+    }
+    Start(std::move(request));
+}
+
+void ScrapeExecutor::OnScrapeDone(uint64_t estimatedSize) {
+    vector<unique_ptr<PromHttpRequest>> toStart;
+    {
+        lock_guard<mutex> lock(mMux);
+        if (mInFlightCnt > 0) {
+            --mInFlightCnt;
+            mInFlightSize -= min(mInFlightSize, estimatedSize);
+        }
+        auto now = chrono::steady_clock::now();
+        while (!mWaitingQueue.empty()) {
+            auto& [enqueTime, request] = mWaitingQueue.front();
+            // the scheduler may have been cancelled while the request was waiting, and the context of the request has
+            // already been checked by the timer before it was submitted
+            if (request->IsCancelled()) {
+                mWaitingQueue.pop_front();
+                continue;
+            }
+            if (!CanStart(request->mEstimatedSize)) {
+                break;
+            }
+            auto delayMs = chrono::duration_cast<chrono::milliseconds>(now - enqueTime).count();
+            ADD_COUNTER(mQueueDelayMs, delayMs);
+            ADD_COUNTER(request->mQueueDelayMs, delayMs);
+            ++mInFlightCnt;
+            mInFlightSize += request->mEstimatedSize;
+            toStart.push_back(std::move(request));
+            mWaitingQueue.pop_front();
+        }
+        UpdateGauges();
+    }
+    for (auto& request : toStart) {
+        Start(std::move(request));
+    }
+}
+
+void ScrapeExecutor::Clear() {
+    lock_guard<mutex> lock(mMux);
+    // requests in flight still call OnScrapeDone when they are done, so the in flight counters are kept
+    mWaitingQueue.clear();
+    UpdateGauges();
+}
+
+bool ScrapeExecutor::CanStart(uint64_t estimatedSize) const {
+    if (mInFlightCnt == 0) {
+        return true;
+    }
+    if (INT32_FLAG(prom_scrape_max_in_flight) > 0
+        && mInFlightCnt >= static_cast<size_t>(INT32_FLAG(prom_scrape_max_in_flight))) {
+        return false;
+    }
+    if (INT64_FLAG(prom_scrape_max_in_flight_bytes) > 0
+        && mInFlightSize + estimatedSize > static_cast<uint64_t>(INT64_FLAG(prom_scrape_max_in_flight_bytes))) {
+        return false;
+    }
+    return true;
+}
+
+void ScrapeExecutor::Start(unique_ptr<PromHttpRequest>&& request) {
+    request->mStartedByExecutor = true;
+    AsynCurlRunner::GetInstance()->AddRequest(std::move(request));
+}
+
+void ScrapeExecutor::UpdateGauges() {
+    SET_GAUGE(mInFlightTotal, mInFlightCnt);
+    SET_GAUGE(mInFlightSizeBytes, mInFlightSize);
+    SET_GAUGE(mWaitingTotal, mWaitingQueue.size());
+}
+
+} // namespace logtail
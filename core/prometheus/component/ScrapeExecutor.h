@@ -0,0 +1,75 @@
+/*
+ * Copyright 2025 iLogtail Authors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <utility>
+
+#include "monitor/MetricManager.h"
+#include "prometheus/async/PromHttpRequest.h"
+
+namespace logtail {
+
+// ScrapeExecutor caps the number and the estimated response bytes of scrapes in flight over all targets. A scrape due
+// when either cap is reached waits in a FIFO queue until a running one is done, so that targets clustering in time do
+// not start all at once. A scrape is always started when nothing is in flight, however large it is. A waiting scrape
+// whose scheduler has been cancelled is dropped instead of being started.
+class ScrapeExecutor {
+public:
+    ScrapeExecutor(const ScrapeExecutor&) = delete;
+    ScrapeExecutor& operator=(const ScrapeExecutor&) = delete;
+
+    static ScrapeExecutor* GetInstance() {
+        static ScrapeExecutor instance;
+        return &instance;
+    }
+
+    void Submit(std::unique_ptr<PromHttpRequest>&& request);
+    // called by a started request once it is done, which may start the waiting ones
+    void OnScrapeDone(uint64_t estimatedSize);
+    void Clear();
+
+private:
+    ScrapeExecutor();
+    ~ScrapeExecutor() = default;
+
+    bool CanStart(uint64_t estimatedSize) const;
+    void Start(std::unique_ptr<PromHttpRequest>&& request);
+    void UpdateGauges();
+
+    mutable std::mutex mMux;
+    std::deque<std::pair<std::chrono::steady_clock::time_point, std::unique_ptr<PromHttpRequest>>> mWaitingQueue;
+    size_t mInFlightCnt = 0;
+    uint64_t mInFlightSize = 0;
+
+    MetricsRecordRef mMetricsRecordRef;
+    IntGaugePtr mInFlightTotal;
+    IntGaugePtr mInFlightSizeBytes;
+    IntGaugePtr mWaitingTotal;
+    CounterPtr mQueuedTotal;
+    CounterPtr mQueueDelayMs;
+
+#ifdef APSARA_UNIT_TEST_MAIN
+    friend class ScrapeExecutorUnittest;
+#endif
+};
+
+} // namespace logtail
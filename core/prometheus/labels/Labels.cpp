@@ -72,7 +72,8 @@ std::string Labels::Get(const string& name) {
 
 void Labels::Reset(MetricEvent* metricEvent) {
     mMetricEventPtr = metricEvent;
-    Set(prometheus::NAME, metricEvent->GetName().to_string());
+    // both the key and the name outlive the tag, no need to copy
+    mMetricEventPtr->SetTagNoCopy(StringView(prometheus::NAME), metricEvent->GetName());
 }
 
 void Labels::Set(const string& k, const string& v) {
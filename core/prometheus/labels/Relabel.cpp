@@ -24,11 +24,16 @@
 #include <string>
 #include <vector>
 
+#include "common/Flags.h"
 #include "common/ParamExtractor.h"
 #include "common/StringTools.h"
 #include "logger/Logger.h"
 #include "prometheus/Constants.h"
 
+DEFINE_FLAG_BOOL(enable_prom_relabel_fast_path,
+                 "lower simple relabel regexes to string operations and fuse keep/drop relabel configs",
+                 true);
+
 using namespace std;
 
 #define ENUM_TO_STRING_CASE(EnumValue) {Action::EnumValue, ToLowerCaseString(#EnumValue)}
@@ -79,8 +84,165 @@ const std::string& ActionToString(Action action) {
     }
     return sUndefined;
 }
-RelabelConfig::RelabelConfig() : mSeparator(";"), mReplacement("$1"), mAction(Action::REPLACE) {
-    mRegex = boost::regex("().*");
+namespace {
+
+bool IsRegexMetaChar(char c) {
+    switch (c) {
+        case '.':
+        case '^':
+        case '$':
+        case '|':
+        case '(':
+        case ')':
+        case '[':
+        case ']':
+        case '{':
+        case '}':
+        case '*':
+        case '+':
+        case '?':
+        case '\\':
+            return true;
+        default:
+            return false;
+    }
+}
+
+// unescape re into literal, return false if re is not a literal
+bool ParseRegexLiteral(StringView re, string& literal) {
+    literal.clear();
+    for (size_t i = 0; i < re.size(); ++i) {
+        char c = re[i];
+        if (c == '\\') {
+            // \d, \w, back references and so on are not literals
+            if (i + 1 == re.size() || isalnum(static_cast<unsigned char>(re[i + 1]))) {
+                return false;
+            }
+            literal.push_back(re[++i]);
+        } else if (IsRegexMetaChar(c)) {
+            return false;
+        } else {
+            literal.push_back(c);
+        }
+    }
+    return true;
+}
+
+// strip the group enclosing the whole regex, e.g. "(a|b)" or "(?:a|b)" but not "(a)|(b)"
+StringView StripRegexGroup(StringView re) {
+    if (re.size() < 2 || re.front() != '(' || re.back() != ')') {
+        return re;
+    }
+    int depth = 0;
+    for (size_t i = 0; i + 1 < re.size(); ++i) {
+        if (re[i] == '\\') {
+            ++i;
+        } else if (re[i] == '(') {
+            ++depth;
+        } else if (re[i] == ')' && --depth == 0) {
+            return re;
+        }
+    }
+    StringView inner = re.substr(1, re.size() - 2);
+    if (inner.starts_with("?:")) {
+        return inner.substr(2);
+    }
+    // other groups like lookaheads are left to boost::regex
+    return inner.starts_with("?") ? re : inner;
+}
+
+// split re by the unescaped '|'
+void SplitRegexAlternatives(StringView re, vector<StringView>& alternatives) {
+    size_t begin = 0;
+    for (size_t i = 0; i < re.size(); ++i) {
+        if (re[i] == '\\') {
+            ++i;
+        } else if (re[i] == '|') {
+            alternatives.push_back(re.substr(begin, i - begin));
+            begin = i + 1;
+        }
+    }
+    alternatives.push_back(re.substr(begin));
+}
+
+bool IsFilterAction(Action action) {
+    switch (action) {
+        case Action::KEEP:
+        case Action::DROP:
+        case Action::KEEPEQUAL:
+        case Action::DROPEQUAL:
+        case Action::DROPMETRIC:
+            return true;
+        default:
+            return false;
+    }
+}
+
+} // namespace
+
+void RegexMatcher::Compile(const string& re) {
+    mType = Type::REGEX;
+    // "().*" is the default regex of relabel configs
+    StringView inner = re == "().*" ? StringView(".*") : StripRegexGroup(re);
+    if (inner == ".*") {
+        mType = Type::ALL;
+        return;
+    }
+    if (inner.ends_with(".*") && ParseRegexLiteral(inner.substr(0, inner.size() - 2), mLiteral)) {
+        mType = Type::PREFIX;
+        return;
+    }
+    vector<StringView> alternatives;
+    SplitRegexAlternatives(inner, alternatives);
+    auto storage = make_shared<vector<string>>(alternatives.size());
+    for (size_t i = 0; i < alternatives.size(); ++i) {
+        if (!ParseRegexLiteral(alternatives[i], (*storage)[i])) {
+            return;
+        }
+    }
+    if (storage->size() == 1) {
+        mLiteral = std::move(storage->front());
+        mType = Type::LITERAL;
+        return;
+    }
+    mAlternativeStorage = std::move(storage);
+    mAlternatives.clear();
+    for (const auto& item : *mAlternativeStorage) {
+        mAlternatives.emplace(item);
+    }
+    mType = Type::ALTERNATION;
+}
+
+void RegexMatcher::CompileFromList(const set<string>& list) {
+    mAlternativeStorage = make_shared<vector<string>>(list.begin(), list.end());
+    mAlternatives.clear();
+    for (const auto& item : *mAlternativeStorage) {
+        mAlternatives.emplace(item);
+    }
+    mType = Type::ALTERNATION;
+}
+
+bool RegexMatcher::Match(StringView s) const {
+    switch (mType) {
+        case Type::ALL:
+            return true;
+        case Type::LITERAL:
+            return s == mLiteral;
+        case Type::PREFIX:
+            return s.starts_with(mLiteral);
+        case Type::ALTERNATION:
+            return mAlternatives.find(s) != mAlternatives.end();
+        default:
+            return false;
+    }
+}
+
+RelabelConfig::RelabelConfig()
+    : mSeparator(";"), mReplacement("$1"), mAction(Action::REPLACE), mRegexString("().*") {
+    mRegex = boost::regex(mRegexString);
+    if (BOOL_FLAG(enable_prom_relabel_fast_path)) {
+        mMatcher.Compile(mRegexString);
+    }
 }
 bool RelabelConfig::Init(const Json::Value& config) {
     string errorMsg;
@@ -98,8 +260,11 @@ bool RelabelConfig::Init(const Json::Value& config) {
     }
 
     if (config.isMember(prometheus::REGEX) && config[prometheus::REGEX].isString()) {
-        string re = config[prometheus::REGEX].asString();
-        mRegex = boost::regex(re);
+        mRegexString = config[prometheus::REGEX].asString();
+        mRegex = boost::regex(mRegexString);
+        if (BOOL_FLAG(enable_prom_relabel_fast_path)) {
+            mMatcher.Compile(mRegexString);
+        }
     }
 
     if (config.isMember(prometheus::REPLACEMENT) && config[prometheus::REPLACEMENT].isString()) {
@@ -134,9 +299,20 @@ bool RelabelConfig::Init(const Json::Value& config) {
     if (config.isMember(prometheus::MODULUS) && config[prometheus::MODULUS].isUInt64()) {
         mModulus = config[prometheus::MODULUS].asUInt64();
     }
+
+    auto isLiteralFormat = [](const string& format) { return format.find_first_of("$\\") == string::npos; };
+    mSimpleReplace = BOOL_FLAG(enable_prom_relabel_fast_path) && mAction == Action::REPLACE && mRegexString == "(.*)"
+        && isLiteralFormat(mTargetLabel) && (mReplacement == "$1" || mReplacement == "${1}");
     return true;
 }
 
+bool RelabelConfig::Match(StringView s) const {
+    if (mMatcher.GetType() != RegexMatcher::Type::REGEX) {
+        return mMatcher.Match(s);
+    }
+    return boost::regex_match(s.begin(), s.end(), mRegex);
+}
+
 bool RelabelConfig::Process(Labels& l) const {
     vector<string> values;
     values.reserve(mSourceLabels.size());
@@ -146,13 +322,13 @@ bool RelabelConfig::Process(Labels& l) const {
     string val = boost::algorithm::join(values, mSeparator);
     switch (mAction) {
         case Action::DROP: {
-            if (boost::regex_match(val, mRegex)) {
+            if (Match(val)) {
                 return false;
             }
             break;
         }
         case Action::KEEP: {
-            if (!boost::regex_match(val, mRegex)) {
+            if (!Match(val)) {
                 return false;
             }
             break;
@@ -170,6 +346,14 @@ bool RelabelConfig::Process(Labels& l) const {
             break;
         }
         case Action::REPLACE: {
+            if (mSimpleReplace) {
+                if (val.empty()) {
+                    l.Del(mTargetLabel);
+                } else {
+                    l.Set(mTargetLabel, val);
+                }
+                break;
+            }
             bool indexes = boost::regex_search(val, mRegex);
             // If there is no match no replacement must take place.
             if (!indexes) {
@@ -206,7 +390,7 @@ bool RelabelConfig::Process(Labels& l) const {
         }
         case Action::LABELMAP: {
             l.Range([&](const string& key, const string& value) {
-                if (boost::regex_match(key, mRegex)) {
+                if (Match(key)) {
                     string res
                         = boost::regex_replace(key, mRegex, mReplacement, boost::match_default | boost::format_all);
                     l.Set(res, value);
@@ -217,7 +401,7 @@ bool RelabelConfig::Process(Labels& l) const {
         case Action::LABELDROP: {
             vector<string> toDel;
             l.Range([&](const string& key, const string& value) {
-                if (boost::regex_match(key, mRegex)) {
+                if (Match(key)) {
                     toDel.push_back(key);
                 }
             });
@@ -229,7 +413,7 @@ bool RelabelConfig::Process(Labels& l) const {
         case Action::LABELKEEP: {
             vector<string> toDel;
             l.Range([&](const string& key, const string& value) {
-                if (!boost::regex_match(key, mRegex)) {
+                if (!Match(key)) {
                     toDel.push_back(key);
                 }
             });
@@ -264,6 +448,88 @@ bool RelabelConfigList::Init(const Json::Value& relabelConfigs) {
             return false;
         }
     }
+    Compile();
+    return true;
+}
+
+void RelabelConfigList::Compile() {
+    mSteps.clear();
+    for (size_t i = 0; i < mRelabelConfigs.size(); ++i) {
+        auto& cfg = mRelabelConfigs[i];
+        if (!BOOL_FLAG(enable_prom_relabel_fast_path) || !IsFilterAction(cfg.mAction)) {
+            mSteps.emplace_back();
+            mSteps.back().mConfigIndexes.push_back(i);
+            continue;
+        }
+        if (cfg.mAction == Action::DROPMETRIC) {
+            cfg.mMatcher.CompileFromList(cfg.mMatchList);
+        }
+        if (mSteps.empty() || !mSteps.back().mIsFilter) {
+            mSteps.emplace_back();
+            mSteps.back().mIsFilter = true;
+        }
+        mSteps.back().mConfigIndexes.push_back(i);
+    }
+    // a metric is kept only if it passes all rules of a filter, so the order of the rules does not matter
+    auto cost = [this](size_t index) {
+        const auto& cfg = mRelabelConfigs[index];
+        bool useRegex = (cfg.mAction == Action::KEEP || cfg.mAction == Action::DROP)
+            && cfg.mMatcher.GetType() == RegexMatcher::Type::REGEX;
+        return useRegex ? 1 : 0;
+    };
+    for (auto& step : mSteps) {
+        if (step.mIsFilter) {
+            stable_sort(step.mConfigIndexes.begin(), step.mConfigIndexes.end(), [&cost](size_t lhs, size_t rhs) {
+                return cost(lhs) < cost(rhs);
+            });
+        }
+    }
+}
+
+bool RelabelConfigList::Filter(const RelabelStep& step, const MetricEvent& event) const {
+    string joined;
+    for (auto index : step.mConfigIndexes) {
+        const auto& cfg = mRelabelConfigs[index];
+        StringView val;
+        if (cfg.mSourceLabels.size() == 1) {
+            val = event.GetTag(cfg.mSourceLabels[0]);
+        } else {
+            joined.clear();
+            for (size_t i = 0; i < cfg.mSourceLabels.size(); ++i) {
+                if (i > 0) {
+                    joined.append(cfg.mSeparator);
+                }
+                auto tag = event.GetTag(cfg.mSourceLabels[i]);
+                joined.append(tag.data(), tag.size());
+            }
+            val = joined;
+        }
+        switch (cfg.mAction) {
+            case Action::KEEP:
+                if (!cfg.Match(val)) {
+                    return false;
+                }
+                break;
+            case Action::DROP:
+            case Action::DROPMETRIC:
+                if (cfg.Match(val)) {
+                    return false;
+                }
+                break;
+            case Action::KEEPEQUAL:
+                if (event.GetTag(cfg.mTargetLabel) != val) {
+                    return false;
+                }
+                break;
+            case Action::DROPEQUAL:
+                if (event.GetTag(cfg.mTargetLabel) == val) {
+                    return false;
+                }
+                break;
+            default:
+                break;
+        }
+    }
     return true;
 }
 
@@ -279,7 +545,16 @@ bool RelabelConfigList::Process(Labels& l) const {
 bool RelabelConfigList::Process(MetricEvent& event) const {
     Labels labels;
     labels.Reset(&event);
-    return Process(labels);
+    for (const auto& step : mSteps) {
+        if (step.mIsFilter) {
+            if (!Filter(step, event)) {
+                return false;
+            }
+        } else if (!mRelabelConfigs[step.mConfigIndexes[0]].Process(labels)) {
+            return false;
+        }
+    }
+    return true;
 }
 
 bool RelabelConfigList::Empty() const {
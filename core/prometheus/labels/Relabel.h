@@ -18,8 +18,15 @@
 #include <json/json.h>
 
 #include <boost/regex.hpp>
+#include <functional>
+#include <memory>
+#include <set>
 #include <string>
+#include <string_view>
+#include <unordered_set>
+#include <vector>
 
+#include "models/StringView.h"
 #include "prometheus/labels/Labels.h"
 
 namespace logtail {
@@ -43,11 +50,39 @@ enum class Action {
 const std::string& ActionToString(Action action);
 Action StringToAction(const std::string& action);
 
+// RegexMatcher lowers the regexes commonly seen in relabel configs to plain string operations, i.e. ".*", literals,
+// prefixes like "kube_pod_.*" and alternations of literals like "kube-system|monitoring", so that boost::regex is only
+// needed for the others. Like boost::regex_match, the whole string is matched.
+class RegexMatcher {
+public:
+    enum class Type { ALL, LITERAL, PREFIX, ALTERNATION, REGEX };
+
+    void Compile(const std::string& re);
+    void CompileFromList(const std::set<std::string>& list);
+
+    Type GetType() const { return mType; }
+    // should not be called if the type is REGEX
+    bool Match(StringView s) const;
+
+private:
+    struct StringViewHash {
+        size_t operator()(StringView s) const { return std::hash<std::string_view>()({s.data(), s.size()}); }
+    };
+
+    Type mType = Type::REGEX;
+    std::string mLiteral;
+    // views into mAlternativeStorage, which is shared by the copies of the matcher
+    std::shared_ptr<const std::vector<std::string>> mAlternativeStorage;
+    std::unordered_set<StringView, StringViewHash> mAlternatives;
+};
+
 class RelabelConfig {
 public:
     RelabelConfig();
     bool Init(const Json::Value&);
     bool Process(Labels&) const;
+    // match the whole string against mRegex
+    bool Match(StringView s) const;
 
     // A list of labels from which values are taken and concatenated
     // with the configured separator in order.
@@ -69,6 +104,15 @@ public:
     std::set<std::string> mMatchList;
 
 private:
+    std::string mRegexString;
+    RegexMatcher mMatcher;
+    // replace by "(.*)" with a literal target label and "$1" as the replacement, i.e. a copy of the value
+    bool mSimpleReplace = false;
+
+    friend class RelabelConfigList;
+#ifdef APSARA_UNIT_TEST_MAIN
+    friend class RelabelConfigUnittest;
+#endif
 };
 
 class RelabelConfigList {
@@ -80,7 +124,19 @@ public:
     [[nodiscard]] bool Empty() const;
 
 private:
+    // consecutive keep/drop style configs only look at the labels, so they are fused into one filter step, which runs
+    // the rules cheapest first directly over the tags of the metric event
+    struct RelabelStep {
+        // the configs of a filter, otherwise a single config processed on Labels
+        std::vector<size_t> mConfigIndexes;
+        bool mIsFilter = false;
+    };
+
+    void Compile();
+    bool Filter(const RelabelStep& step, const MetricEvent& event) const;
+
     std::vector<RelabelConfig> mRelabelConfigs;
+    std::vector<RelabelStep> mSteps;
 
 #ifdef APSARA_UNIT_TEST_MAIN
     friend class RelabelConfigUnittest;
@@ -18,6 +18,7 @@
 
 #include <cstddef>
 
+#include <algorithm>
 #include <chrono>
 #include <memory>
 #include <string>
@@ -28,12 +29,12 @@
 #include "common/StringTools.h"
 #include "common/TimeUtil.h"
 #include "common/http/Constant.h"
-#include "common/timer/HttpRequestTimerEvent.h"
 #include "logger/Logger.h"
 #include "prometheus/Constants.h"
 #include "prometheus/Utils.h"
 #include "prometheus/async/PromFuture.h"
 #include "prometheus/async/PromHttpRequest.h"
+#include "prometheus/async/ScrapeTimerEvent.h"
 #include "prometheus/component/StreamScraper.h"
 
 using namespace std;
@@ -104,7 +105,7 @@ void ScrapeScheduler::OnMetricResult(HttpResponse& response, uint64_t) {
     }
     streamScraper->SetAutoMetricMeta(scrapeDurationSeconds, upState, scrapeState);
     streamScraper->SendMetrics();
-    mScrapeResponseSizeBytes = streamScraper->mRawSize;
+    mScrapeResponseSizeBytes = static_cast<int64_t>(streamScraper->mRawSize);
     streamScraper->Reset();
 
     ADD_COUNTER(mPluginTotalDelayMs, scrapeDurationMilliSeconds);
@@ -205,8 +206,10 @@ std::unique_ptr<TimerEvent> ScrapeScheduler::BuildScrapeTimerEvent(std::chrono::
         this->mIsContextValidFuture,
         mScrapeConfigPtr->mFollowRedirects,
         mScrapeConfigPtr->mEnableTLS ? std::optional<CurlTLS>(mScrapeConfigPtr->mTLS) : std::nullopt);
+    const uint64_t lastScrapeSize = std::max<int64_t>(mScrapeResponseSizeBytes, 0);
+    request->SetScrapeStat(lastScrapeSize, mPromQueueDelayMs);
 
-    auto timerEvent = std::make_unique<HttpRequestTimerEvent>(execTime, std::move(request));
+    auto timerEvent = std::make_unique<ScrapeTimerEvent>(execTime, std::move(request));
     return timerEvent;
 }
 
@@ -238,6 +241,7 @@ void ScrapeScheduler::InitSelfMonitor(const MetricLabels& defaultLabels) {
     WriteMetrics::GetInstance()->PrepareMetricsRecordRef(
         mMetricsRecordRef, MetricCategory::METRIC_CATEGORY_PLUGIN_SOURCE, std::move(labels));
     mPromDelayTotal = mMetricsRecordRef.CreateCounter(METRIC_PLUGIN_PROM_SCRAPE_DELAY_TOTAL);
+    mPromQueueDelayMs = mMetricsRecordRef.CreateCounter(METRIC_PLUGIN_PROM_SCRAPE_QUEUE_DELAY_MS);
     mPluginTotalDelayMs = mMetricsRecordRef.CreateCounter(METRIC_PLUGIN_TOTAL_DELAY_MS);
 }
 
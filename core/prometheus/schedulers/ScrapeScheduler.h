@@ -87,12 +87,14 @@ private:
     size_t mInputIndex;
 
     // auto metrics
-    std::atomic_int mScrapeResponseSizeBytes;
+    std::atomic_int64_t mScrapeResponseSizeBytes;
 
     // self monitor
     std::shared_ptr<PromSelfMonitorUnsafe> mSelfMonitor;
     MetricsRecordRef mMetricsRecordRef;
     CounterPtr mPromDelayTotal;
+    // time waiting in ScrapeExecutor for in-flight scrapes to finish
+    CounterPtr mPromQueueDelayMs;
     CounterPtr mPluginTotalDelayMs;
 #ifdef APSARA_UNIT_TEST_MAIN
     friend class ProcessorParsePrometheusMetricUnittest;
@@ -130,9 +130,13 @@ void TargetSubscriberScheduler::UpdateScrapeScheduler(
                             > v->GetReBalanceMs())
                         && (tmpCurrentMilliSeconds + tmpRandSleepMilliSec - v->GetScrapeIntervalSeconds() * 1000 * 2
                             < v->GetReBalanceMs()))) {
-                    // scrape once just now
-                    LOG_INFO(sLogger, ("scrape zero cost", ToString(tmpCurrentMilliSeconds)));
-                    v->SetScrapeOnceTime(chrono::steady_clock::now(), chrono::system_clock::now());
+                    // scrape once before the first scheduled scrape, spread by the target hash so that the targets
+                    // taken over by a rebalance are not scraped all at once
+                    auto spreadMilliSec = GetRandSpreadMilliSec(v->GetId(), tmpRandSleepMilliSec / 2);
+                    LOG_INFO(sLogger,
+                             ("scrape zero cost", ToString(tmpCurrentMilliSeconds))("spread ms", spreadMilliSec));
+                    v->SetScrapeOnceTime(chrono::steady_clock::now() + chrono::milliseconds(spreadMilliSec),
+                                         chrono::system_clock::now() + chrono::milliseconds(spreadMilliSec));
                 }
                 v->ScheduleNext();
             }
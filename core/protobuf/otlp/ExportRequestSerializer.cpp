@@ -0,0 +1,126 @@
+// Copyright 2025 iLogtail Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "protobuf/otlp/ExportRequestSerializer.h"
+
+#include <cstring>
+
+using namespace std;
+
+namespace logtail {
+
+enum WireType : uint32_t { VARINT = 0, FIXED64 = 1, LENGTH_DELIMITED = 2 };
+
+static inline size_t varint_size(uint64_t v) {
+    size_t res = 1;
+    while (v >= 0x80) {
+        v >>= 7;
+        ++res;
+    }
+    return res;
+}
+
+static inline void varint_pack(uint64_t value, string& output) {
+    while (value >= 0x80) {
+        output.push_back(static_cast<char>(value | 0x80));
+        value >>= 7;
+    }
+    output.push_back(static_cast<char>(value));
+}
+
+static inline void varint_pack(uint64_t value, char* output) {
+    while (value >= 0x80) {
+        *output++ = static_cast<char>(value | 0x80);
+        value >>= 7;
+    }
+    *output = static_cast<char>(value);
+}
+
+static inline void fixed64_pack(uint64_t value, string& output) {
+    for (size_t i = 0; i < 8; ++i) {
+        output.push_back(static_cast<char>(value & 0xFF));
+        value >>= 8;
+    }
+}
+
+void ExportRequestSerializer::Prepare(size_t size) {
+    mRes.clear();
+    mRes.reserve(size);
+    mMessageStarts.clear();
+}
+
+void ExportRequestSerializer::StartMessage(uint32_t field) {
+    AddTag(field, LENGTH_DELIMITED);
+    // one byte is reserved for the length, which is enough for most messages at the bottom, e.g. KeyValue
+    mMessageStarts.push_back(mRes.size());
+    mRes.push_back(0);
+}
+
+void ExportRequestSerializer::EndMessage() {
+    size_t start = mMessageStarts.back();
+    mMessageStarts.pop_back();
+    size_t len = mRes.size() - start - 1;
+    size_t lenSize = varint_size(len);
+    if (lenSize > 1) {
+        mRes.insert(start + 1, lenSize - 1, '\0');
+    }
+    varint_pack(len, &mRes[start]);
+}
+
+void ExportRequestSerializer::AddString(uint32_t field, StringView value) {
+    AddTag(field, LENGTH_DELIMITED);
+    varint_pack(value.size(), mRes);
+    mRes.append(value.data(), value.size());
+}
+
+void ExportRequestSerializer::AddBytes(uint32_t field, const uint8_t* data, size_t size) {
+    AddString(field, StringView(reinterpret_cast<const char*>(data), size));
+}
+
+void ExportRequestSerializer::AddVarint(uint32_t field, uint64_t value) {
+    AddTag(field, VARINT);
+    varint_pack(value, mRes);
+}
+
+void ExportRequestSerializer::AddFixed64(uint32_t field, uint64_t value) {
+    AddTag(field, FIXED64);
+    fixed64_pack(value, mRes);
+}
+
+void ExportRequestSerializer::AddDouble(uint32_t field, double value) {
+    uint64_t bits = 0;
+    memcpy(&bits, &value, sizeof(bits));
+    AddFixed64(field, bits);
+}
+
+void ExportRequestSerializer::AddStringKeyValue(uint32_t field, StringView key, StringView value) {
+    StartMessage(field);
+    // Key
+    // field = 1, wire_type = 2
+    AddString(1, key);
+    // Value, i.e. AnyValue
+    // field = 2, wire_type = 2
+    StartMessage(2);
+    // StringValue
+    // field = 1, wire_type = 2
+    AddString(1, value);
+    EndMessage();
+    EndMessage();
+}
+
+void ExportRequestSerializer::AddTag(uint32_t field, uint32_t wireType) {
+    varint_pack((static_cast<uint64_t>(field) << 3) | wireType, mRes);
+}
+
+} // namespace logtail
@@ -0,0 +1,56 @@
+/*
+ * Copyright 2025 iLogtail Authors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cstdint>
+
+#include <string>
+#include <vector>
+
+#include "models/StringView.h"
+
+namespace logtail {
+
+// Encodes otlp Export{Logs,Metrics,Trace}ServiceRequest without generated code. Since messages are deeply nested in
+// otlp, the length of a message is filled in when it ends rather than computed beforehand, and its fields are moved
+// only if the length takes more than one byte.
+// see for detail: https://github.com/open-telemetry/opentelemetry-proto/tree/main/opentelemetry/proto
+class ExportRequestSerializer {
+public:
+    void Prepare(size_t size);
+    // messages can be nested, and must be ended in the reverse order
+    void StartMessage(uint32_t field);
+    void EndMessage();
+    // string or bytes
+    void AddString(uint32_t field, StringView value);
+    void AddBytes(uint32_t field, const uint8_t* data, size_t size);
+    void AddVarint(uint32_t field, uint64_t value);
+    void AddFixed64(uint32_t field, uint64_t value);
+    void AddDouble(uint32_t field, double value);
+    // KeyValue with string value, i.e. {key: key, value: {string_value: value}}
+    void AddStringKeyValue(uint32_t field, StringView key, StringView value);
+    std::string& GetResult() { return mRes; }
+
+private:
+    void AddTag(uint32_t field, uint32_t wireType);
+
+    std::string mRes;
+    // offsets of the length of messages not ended yet
+    std::vector<size_t> mMessageStarts;
+};
+
+} // namespace logtail
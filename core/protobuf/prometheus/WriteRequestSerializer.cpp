@@ -0,0 +1,119 @@
+// Copyright 2025 iLogtail Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "protobuf/prometheus/WriteRequestSerializer.h"
+
+#include <cstring>
+
+using namespace std;
+
+namespace logtail {
+
+static inline size_t varint_size(uint64_t v) {
+    size_t res = 1;
+    while (v >= 0x80) {
+        v >>= 7;
+        ++res;
+    }
+    return res;
+}
+
+static inline void varint_pack(uint64_t value, string& output) {
+    while (value >= 0x80) {
+        output.push_back(static_cast<char>(value | 0x80));
+        value >>= 7;
+    }
+    output.push_back(static_cast<char>(value));
+}
+
+static inline void fixed64_pack(uint64_t value, string& output) {
+    for (size_t i = 0; i < 8; ++i) {
+        output.push_back(static_cast<char>(value & 0xFF));
+        value >>= 8;
+    }
+}
+
+static inline size_t GetStringFieldSize(size_t size) {
+    return 1 + varint_size(size) + size;
+}
+
+static inline size_t GetSampleContentSize(int64_t timestampMs) {
+    // Value, fixed64 size is always 8
+    // Timestamp, negative int64 is encoded as 10 bytes varint
+    return 1 + 8 + 1 + varint_size(static_cast<uint64_t>(timestampMs));
+}
+
+void WriteRequestSerializer::Prepare(size_t size) {
+    mRes.clear();
+    mRes.reserve(size);
+}
+
+void WriteRequestSerializer::StartToAddTimeSeries(size_t size) {
+    // Timeseries
+    // field = 1, wire_type = 2
+    mRes.push_back(0x0A);
+    varint_pack(size, mRes);
+}
+
+void WriteRequestSerializer::AddLabel(StringView name, StringView value) {
+    // Labels
+    // field = 1, wire_type = 2
+    mRes.push_back(0x0A);
+    varint_pack(GetStringFieldSize(name.size()) + GetStringFieldSize(value.size()), mRes);
+    // Name
+    // field = 1, wire_type = 2
+    mRes.push_back(0x0A);
+    varint_pack(name.size(), mRes);
+    mRes.append(name.data(), name.size());
+    // Value
+    // field = 2, wire_type = 2
+    mRes.push_back(0x12);
+    varint_pack(value.size(), mRes);
+    mRes.append(value.data(), value.size());
+}
+
+void WriteRequestSerializer::AddSample(double value, int64_t timestampMs) {
+    // Samples
+    // field = 2, wire_type = 2
+    mRes.push_back(0x12);
+    varint_pack(GetSampleContentSize(timestampMs), mRes);
+    // Value
+    // field = 1, wire_type = 1
+    mRes.push_back(0x09);
+    uint64_t bits = 0;
+    memcpy(&bits, &value, sizeof(bits));
+    fixed64_pack(bits, mRes);
+    // Timestamp
+    // field = 2, wire_type = 0
+    mRes.push_back(0x10);
+    varint_pack(static_cast<uint64_t>(timestampMs), mRes);
+}
+
+size_t GetLabelSize(size_t nameSZ, size_t valueSZ) {
+    size_t res = GetStringFieldSize(nameSZ) + GetStringFieldSize(valueSZ);
+    res += 1 + varint_size(res);
+    return res;
+}
+
+size_t GetSampleSize(int64_t timestampMs) {
+    size_t res = GetSampleContentSize(timestampMs);
+    res += 1 + varint_size(res);
+    return res;
+}
+
+size_t GetTimeSeriesSize(size_t contentSZ) {
+    return 1 + varint_size(contentSZ) + contentSZ;
+}
+
+} // namespace logtail
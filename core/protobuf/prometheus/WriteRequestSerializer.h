@@ -0,0 +1,46 @@
+/*
+ * Copyright 2025 iLogtail Authors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cstdint>
+
+#include <string>
+
+#include "models/StringView.h"
+
+namespace logtail {
+
+// Encodes prometheus.WriteRequest of remote write 1.0 without generated code, where sizes of nested messages must be
+// computed beforehand with the following Get*Size functions.
+// see for detail: https://github.com/prometheus/prometheus/blob/main/prompb/remote.proto
+class WriteRequestSerializer {
+public:
+    void Prepare(size_t size);
+    void StartToAddTimeSeries(size_t size);
+    void AddLabel(StringView name, StringView value);
+    void AddSample(double value, int64_t timestampMs);
+    std::string& GetResult() { return mRes; }
+
+private:
+    std::string mRes;
+};
+
+size_t GetLabelSize(size_t nameSZ, size_t valueSZ);
+size_t GetSampleSize(int64_t timestampMs);
+size_t GetTimeSeriesSize(size_t contentSZ);
+
+} // namespace logtail
@@ -0,0 +1,237 @@
+// Copyright 2025 iLogtail Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "protobuf/sls/LogGroupDeserializer.h"
+
+#include <optional>
+
+#include "constants/TagConstants.h"
+#include "models/LogEvent.h"
+
+using namespace std;
+
+namespace logtail {
+
+namespace {
+
+enum WireType : uint32_t { VARINT = 0, FIXED64 = 1, LENGTH_DELIMITED = 2, FIXED32 = 5 };
+
+class WireReader {
+public:
+    WireReader(const char* begin, const char* end) : mCur(begin), mEnd(end) {}
+
+    bool AtEnd() const { return mCur == mEnd; }
+
+    bool ReadVarint(uint64_t& value) {
+        value = 0;
+        for (uint32_t shift = 0; shift < 64; shift += 7) {
+            if (mCur == mEnd) {
+                return false;
+            }
+            uint8_t byte = static_cast<uint8_t>(*mCur++);
+            value |= static_cast<uint64_t>(byte & 0x7F) << shift;
+            if ((byte & 0x80) == 0) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    bool ReadTag(uint32_t& field, uint32_t& wireType) {
+        uint64_t tag = 0;
+        if (!ReadVarint(tag)) {
+            return false;
+        }
+        field = static_cast<uint32_t>(tag >> 3);
+        wireType = static_cast<uint32_t>(tag & 0x07);
+        return field != 0;
+    }
+
+    bool ReadFixed32(uint32_t& value) {
+        if (mEnd - mCur < 4) {
+            return false;
+        }
+        value = 0;
+        for (size_t i = 0; i < 4; ++i) {
+            value |= static_cast<uint32_t>(static_cast<uint8_t>(mCur[i])) << (8 * i);
+        }
+        mCur += 4;
+        return true;
+    }
+
+    bool ReadLengthDelimited(StringView& value) {
+        uint64_t len = 0;
+        if (!ReadVarint(len) || len > static_cast<uint64_t>(mEnd - mCur)) {
+            return false;
+        }
+        value = StringView(mCur, len);
+        mCur += len;
+        return true;
+    }
+
+    bool Skip(uint32_t wireType) {
+        switch (wireType) {
+            case VARINT: {
+                uint64_t value = 0;
+                return ReadVarint(value);
+            }
+            case FIXED64:
+                if (mEnd - mCur < 8) {
+                    return false;
+                }
+                mCur += 8;
+                return true;
+            case LENGTH_DELIMITED: {
+                StringView value;
+                return ReadLengthDelimited(value);
+            }
+            case FIXED32: {
+                uint32_t value = 0;
+                return ReadFixed32(value);
+            }
+            default:
+                return false;
+        }
+    }
+
+private:
+    const char* mCur;
+    const char* mEnd;
+};
+
+// Key = 1, Value = 2, which is shared by Log.Content and LogTag
+bool ParseKeyValue(StringView data, StringView& key, StringView& value) {
+    WireReader reader(data.data(), data.data() + data.size());
+    uint32_t field = 0, wireType = 0;
+    while (!reader.AtEnd()) {
+        if (!reader.ReadTag(field, wireType)) {
+            return false;
+        }
+        if (field == 1 && wireType == LENGTH_DELIMITED) {
+            if (!reader.ReadLengthDelimited(key)) {
+                return false;
+            }
+        } else if (field == 2 && wireType == LENGTH_DELIMITED) {
+            if (!reader.ReadLengthDelimited(value)) {
+                return false;
+            }
+        } else if (!reader.Skip(wireType)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool ParseLog(StringView data, LogEvent& e) {
+    WireReader reader(data.data(), data.data() + data.size());
+    uint32_t field = 0, wireType = 0;
+    uint64_t time = 0;
+    optional<uint32_t> timeNs;
+    while (!reader.AtEnd()) {
+        if (!reader.ReadTag(field, wireType)) {
+            return false;
+        }
+        if (field == 1 && wireType == VARINT) {
+            // Time
+            if (!reader.ReadVarint(time)) {
+                return false;
+            }
+        } else if (field == 2 && wireType == LENGTH_DELIMITED) {
+            // Contents
+            StringView content, key, value;
+            if (!reader.ReadLengthDelimited(content) || !ParseKeyValue(content, key, value)) {
+                return false;
+            }
+            e.SetContentNoCopy(key, value);
+        } else if (field == 4 && wireType == FIXED32) {
+            // Time_ns
+            uint32_t ns = 0;
+            if (!reader.ReadFixed32(ns)) {
+                return false;
+            }
+            timeNs = ns;
+        } else if (!reader.Skip(wireType)) {
+            return false;
+        }
+    }
+    e.SetTimestamp(static_cast<time_t>(static_cast<uint32_t>(time)), timeNs);
+    return true;
+}
+
+} // namespace
+
+bool LogGroupDeserializer::Deserialize(const char* data, size_t size, PipelineEventGroup& group, string& errorMsg) {
+    StringBuffer buffer = group.GetSourceBuffer()->CopyString(data, size);
+    return DeserializeNoCopy(StringView(buffer.data, buffer.size), group, errorMsg);
+}
+
+bool LogGroupDeserializer::DeserializeNoCopy(StringView data, PipelineEventGroup& group, string& errorMsg) {
+    WireReader reader(data.data(), data.data() + data.size());
+    uint32_t field = 0, wireType = 0;
+    while (!reader.AtEnd()) {
+        if (!reader.ReadTag(field, wireType)) {
+            errorMsg = "invalid field tag";
+            return false;
+        }
+        if (wireType != LENGTH_DELIMITED) {
+            if (!reader.Skip(wireType)) {
+                errorMsg = "invalid field of wire type " + to_string(wireType);
+                return false;
+            }
+            continue;
+        }
+        StringView value;
+        if (!reader.ReadLengthDelimited(value)) {
+            errorMsg = "invalid length of field " + to_string(field);
+            return false;
+        }
+        switch (field) {
+            case 1:
+                // Logs
+                if (!ParseLog(value, *group.AddLogEvent())) {
+                    errorMsg = "invalid log";
+                    return false;
+                }
+                break;
+            case 3:
+                // Topic
+                group.SetTagNoCopy(LOG_RESERVED_KEY_TOPIC, value);
+                break;
+            case 4:
+                // Source
+                group.SetTagNoCopy(LOG_RESERVED_KEY_SOURCE, value);
+                break;
+            case 5:
+                // MachineUUID
+                group.SetTagNoCopy(LOG_RESERVED_KEY_MACHINE_UUID, value);
+                break;
+            case 6: {
+                // LogTags
+                StringView key, tagValue;
+                if (!ParseKeyValue(value, key, tagValue)) {
+                    errorMsg = "invalid log tag";
+                    return false;
+                }
+                group.SetTagNoCopy(key, tagValue);
+                break;
+            }
+            default:
+                // Category is given by the caller, and unknown fields are ignored
+                break;
+        }
+    }
+    return true;
+}
+
+} // namespace logtail
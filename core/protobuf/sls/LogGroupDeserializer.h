@@ -0,0 +1,40 @@
+/*
+ * Copyright 2025 iLogtail Authors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cstdint>
+
+#include <string>
+
+#include "models/PipelineEventGroup.h"
+#include "models/StringView.h"
+
+namespace logtail {
+
+// Decodes the wire format of sls_logs::LogGroup into log events without copying any string, i.e. keys and values in the
+// group are views of the serialized data. Topic, source and machine uuid are restored as the reserved tags, which are
+// serialized back into the same fields by the SLS serializer.
+// see for detail: https://protobuf.dev/programming-guides/encoding/
+class LogGroupDeserializer {
+public:
+    // data is copied once into the source buffer of group
+    static bool Deserialize(const char* data, size_t size, PipelineEventGroup& group, std::string& errorMsg);
+    // data must live as long as group, e.g. allocated from its source buffer
+    static bool DeserializeNoCopy(StringView data, PipelineEventGroup& group, std::string& errorMsg);
+};
+
+} // namespace logtail
@@ -92,6 +92,7 @@ void FlusherRunner::UpdateSendFlowControl() {
 
 void FlusherRunner::Stop() {
     mIsFlush = true;
+    mHttpSendingCond.notify_all();
     SenderQueueManager::GetInstance()->Trigger();
     if (!mThreadRes.valid()) {
         return;
@@ -105,15 +106,27 @@ void FlusherRunner::Stop() {
 }
 
 void FlusherRunner::DecreaseHttpSendingCnt() {
-    --mHttpSendingCnt;
+    {
+        // decrease under the lock, so that the dispatcher cannot miss the notification between its check and wait
+        lock_guard<mutex> lock(mHttpSendingMux);
+        --mHttpSendingCnt;
+    }
+    mHttpSendingCond.notify_one();
     SenderQueueManager::GetInstance()->Trigger();
 }
 
+void FlusherRunner::WaitForHttpSendingSlot() {
+    unique_lock<mutex> lock(mHttpSendingMux);
+    while (!Application::GetInstance()->IsExiting()
+           && mHttpSendingCnt.load() >= AppConfig::GetInstance()->GetSendRequestGlobalConcurrency()) {
+        // released slots wake the dispatcher directly, the timeout only covers exiting and concurrency changes
+        mHttpSendingCond.wait_for(lock, chrono::milliseconds(100));
+    }
+}
+
 void FlusherRunner::PushToHttpSink(SenderQueueItem* item, bool withLimit) {
-    // TODO: use semaphore instead
-    while (withLimit && !Application::GetInstance()->IsExiting()
-           && GetSendingBufferCount() >= AppConfig::GetInstance()->GetSendRequestGlobalConcurrency()) {
-        this_thread::sleep_for(chrono::milliseconds(10));
+    if (withLimit) {
+        WaitForHttpSendingSlot();
     }
 
     unique_ptr<HttpSinkRequest> req;
@@ -143,7 +156,11 @@ void FlusherRunner::PushToHttpSink(SenderQueueItem* item, bool withLimit) {
               ("send item to http sink, item address", item)("config-flusher-dst",
                                                              QueueKeyManager::GetInstance()->GetName(item->mQueueKey))(
                   "sending cnt", ToString(mHttpSendingCnt.load() + 1)));
-    HttpSink::GetInstance()->AddRequest(std::move(req));
+    if (!HttpSink::GetInstance()->AddRequest(std::move(req))) {
+        item->mStatus = SendingStatus::IDLE;
+        SenderQueueManager::GetInstance()->DecreaseConcurrencyLimiterInSendingCnt(item->mQueueKey);
+        return;
+    }
     ++mHttpSendingCnt;
 }
 
@@ -19,7 +19,9 @@
 #include <cstdint>
 
 #include <atomic>
+#include <condition_variable>
 #include <future>
+#include <mutex>
 
 #include "collection_pipeline/plugin/interface/Flusher.h"
 #include "collection_pipeline/queue/SenderQueueItem.h"
@@ -54,6 +56,8 @@ private:
 
     void Run();
     void Dispatch(SenderQueueItem* item);
+    // block until the number of sending requests is below the global concurrency, or the process is exiting
+    void WaitForHttpSendingSlot();
     bool LoadModuleConfig(bool isInit);
     void UpdateSendFlowControl();
 
@@ -63,6 +67,9 @@ private:
     std::atomic_bool mIsFlush = false;
 
     std::atomic_int32_t mHttpSendingCnt{0};
+    // counting semaphore of the global send concurrency, released by http sink once a request is done
+    std::mutex mHttpSendingMux;
+    std::condition_variable mHttpSendingCond;
 
     // TODO: temporarily here
     int32_t mLastCheckSendClientTime = 0;
@@ -18,6 +18,7 @@
 #include "batch/TimeoutFlushManager.h"
 #include "collection_pipeline/CollectionPipelineManager.h"
 #include "common/Flags.h"
+#include "common/TimeUtil.h"
 #include "go_pipeline/LogtailPlugin.h"
 #include "models/EventPool.h"
 #include "monitor/AlarmManager.h"
@@ -136,6 +137,7 @@ void ProcessorRunner::Run(uint32_t threadNo) {
 
         bool isLog = !item->mEventGroup.GetEvents().empty() && item->mEventGroup.GetEvents()[0].Is<LogEvent>();
 
+        auto cpuBefore = GetCurrentThreadCpuTime();
         vector<PipelineEventGroup> eventGroupList;
         eventGroupList.emplace_back(std::move(item->mEventGroup));
         pipeline->Process(eventGroupList, item->mInputIndex);
@@ -184,6 +186,8 @@ void ProcessorRunner::Run(uint32_t threadNo) {
         } else {
             pipeline->Send(std::move(eventGroupList));
         }
+        ProcessQueueManager::GetInstance()->AddCpuTime(pipeline->GetContext().GetProcessQueueKey(),
+                                                       GetCurrentThreadCpuTime() - cpuBefore);
         pipeline->SubInProcessCnt();
 
         gThreadedEventPool.CheckGC();
@@ -21,6 +21,7 @@
 #include "collection_pipeline/queue/QueueKeyManager.h"
 #include "collection_pipeline/queue/SenderQueueItem.h"
 #include "common/Flags.h"
+#include "common/HashUtil.h"
 #include "common/StringTools.h"
 #include "common/http/Curl.h"
 #include "logger/Logger.h"
@@ -31,6 +32,7 @@
 #endif
 
 DEFINE_FLAG_INT32(http_sink_exit_timeout_sec, "", 5);
+DEFINE_FLAG_INT32(http_sink_thread_count, "number of http sink threads, requests are sharded by destination", 1);
 
 using namespace std;
 
@@ -46,10 +48,18 @@ HttpSink* HttpSink::GetInstance() {
 }
 
 bool HttpSink::Init() {
-    mClient = curl_multi_init();
-    if (mClient == nullptr) {
-        LOG_ERROR(sLogger, ("failed to init http sink", "failed to init curl multi client"));
-        return false;
+    uint32_t shardCnt = static_cast<uint32_t>(max(INT32_FLAG(http_sink_thread_count), 1));
+    for (uint32_t shardNo = 0; shardNo < shardCnt; ++shardNo) {
+        mShards.push_back(make_unique<Shard>());
+        mShards.back()->mShardNo = shardNo;
+    }
+    for (auto& shard : mShards) {
+        shard->mClient = curl_multi_init();
+        if (shard->mClient == nullptr) {
+            LOG_ERROR(sLogger,
+                      ("failed to init http sink", "failed to init curl multi client")("shard no", shard->mShardNo));
+            return false;
+        }
     }
 
     WriteMetrics::GetInstance()->PrepareMetricsRecordRef(
@@ -70,30 +80,64 @@ bool HttpSink::Init() {
     // TODO: should be dynamic
     SET_GAUGE(mSendConcurrency, AppConfig::GetInstance()->GetSendRequestGlobalConcurrency());
 
-    mThreadRes = async(launch::async, &HttpSink::Run, this);
+    for (auto& shard : mShards) {
+        // sending items and running curl handlers of each shard
+        WriteMetrics::GetInstance()->PrepareMetricsRecordRef(
+            shard->mMetricsRecordRef,
+            MetricCategory::METRIC_CATEGORY_RUNNER,
+            {{METRIC_LABEL_KEY_RUNNER_NAME, METRIC_LABEL_VALUE_RUNNER_NAME_HTTP_SINK},
+             {METRIC_LABEL_KEY_THREAD_NO, ToString(shard->mShardNo)}});
+        shard->mSendingItemsTotal = shard->mMetricsRecordRef.CreateIntGauge(METRIC_RUNNER_SINK_SENDING_ITEMS_TOTAL);
+        shard->mSendConcurrency = shard->mMetricsRecordRef.CreateIntGauge(METRIC_RUNNER_SINK_SEND_CONCURRENCY);
+        shard->mThreadRes = async(launch::async, &HttpSink::Run, this, ref(*shard));
+    }
     return true;
 }
 
 void HttpSink::Stop() {
     mIsFlush = true;
-    if (!mThreadRes.valid()) {
-        return;
+    auto deadline = chrono::steady_clock::now() + chrono::seconds(INT32_FLAG(http_sink_exit_timeout_sec));
+    for (auto& shard : mShards) {
+        if (!shard->mThreadRes.valid()) {
+            continue;
+        }
+        future_status s = shard->mThreadRes.wait_until(deadline);
+        if (s == future_status::ready) {
+            LOG_INFO(sLogger, ("http sink", "stopped successfully")("shard no", shard->mShardNo));
+        } else {
+            LOG_WARNING(sLogger, ("http sink", "forced to stopped")("shard no", shard->mShardNo));
+        }
     }
-    future_status s = mThreadRes.wait_for(chrono::seconds(INT32_FLAG(http_sink_exit_timeout_sec)));
-    if (s == future_status::ready) {
-        LOG_INFO(sLogger, ("http sink", "stopped successfully"));
-    } else {
-        LOG_WARNING(sLogger, ("http sink", "forced to stopped"));
+}
+
+bool HttpSink::AddRequest(unique_ptr<HttpSinkRequest>&& request) {
+    if (mShards.empty()) {
+        // not initialized yet
+        LOG_WARNING(sLogger, ("failed to add request to http sink", "http sink is not initialized"));
+        return false;
+    }
+    mShards[GetShardIndex(*request)]->mQueue.Push(std::move(request));
+    return true;
+}
+
+size_t HttpSink::GetShardIndex(const HttpSinkRequest& request) const {
+    if (mShards.size() == 1) {
+        return 0;
     }
+    // requests of the same flusher to the same host always go to the same shard, so that connections are reused,
+    // while different flushers sending to one busy host are still spread over shards
+    size_t seed = hash<string>()(request.mHost);
+    HashCombine(seed, static_cast<size_t>(request.mItem->mQueueKey));
+    return seed % mShards.size();
 }
 
-void HttpSink::Run() {
-    LOG_INFO(sLogger, ("http sink", "started"));
+void HttpSink::Run(Shard& shard) {
+    LOG_INFO(sLogger, ("http sink", "started")("shard no", shard.mShardNo));
     while (true) {
         SET_GAUGE(mLastRunTime,
                   chrono::duration_cast<chrono::seconds>(chrono::system_clock::now().time_since_epoch()).count());
         unique_ptr<HttpSinkRequest> request;
-        if (mQueue.WaitAndPop(request, 500)) {
+        if (shard.mQueue.WaitAndPop(request, 500)) {
             ADD_COUNTER(mInItemsTotal, 1);
             LOG_DEBUG(sLogger,
                       ("got item from flusher runner, item address", request->mItem)(
@@ -101,25 +145,26 @@ void HttpSink::Run() {
                           "wait time",
                           ToString(chrono::duration_cast<chrono::milliseconds>(chrono::system_clock::now()
                                                                                - request->mEnqueTime)
-                                       .count()))("try cnt", ToString(request->mTryCnt)));
-            if (!AddRequestToClient(std::move(request))) {
+                                       .count()))("try cnt", ToString(request->mTryCnt))("shard no", shard.mShardNo));
+            if (!AddRequestToClient(shard, std::move(request))) {
                 continue;
             }
             ADD_GAUGE(mSendingItemsTotal, 1);
-        } else if (mIsFlush && mQueue.Empty()) {
+            ADD_GAUGE(shard.mSendingItemsTotal, 1);
+        } else if (mIsFlush && shard.mQueue.Empty()) {
             break;
         } else {
             continue;
         }
-        DoRun();
+        DoRun(shard);
     }
-    auto mc = curl_multi_cleanup(mClient);
+    auto mc = curl_multi_cleanup(shard.mClient);
     if (mc != CURLM_OK) {
         LOG_ERROR(sLogger, ("failed to cleanup curl multi handle", "exit anyway")("errMsg", curl_multi_strerror(mc)));
     }
 }
 
-bool HttpSink::AddRequestToClient(unique_ptr<HttpSinkRequest>&& request) {
+bool HttpSink::AddRequestToClient(Shard& shard, unique_ptr<HttpSinkRequest>&& request) {
     curl_slist* headers = nullptr;
     CURL* curl = CreateCurlHandler(request->mMethod,
                                    request->mHTTPSFlag,
@@ -154,7 +199,7 @@ bool HttpSink::AddRequestToClient(unique_ptr<HttpSinkRequest>&& request) {
     curl_easy_setopt(curl, CURLOPT_PRIVATE, request.get());
     request->mLastSendTime = chrono::system_clock::now();
 
-    auto res = curl_multi_add_handle(mClient, curl);
+    auto res = curl_multi_add_handle(shard.mClient, curl);
     if (res != CURLM_OK) {
         request->mItem->mStatus = SendingStatus::IDLE;
         request->mResponse.SetNetworkStatus(NetworkCode::Other, "failed to add the easy curl handle to multi_handle");
@@ -174,24 +219,25 @@ bool HttpSink::AddRequestToClient(unique_ptr<HttpSinkRequest>&& request) {
     return true;
 }
 
-void HttpSink::DoRun() {
+void HttpSink::DoRun(Shard& shard) {
     CURLMcode mc;
     int runningHandlers = 1;
     while (runningHandlers) {
         auto curTime = chrono::system_clock::now();
         SET_GAUGE(mLastRunTime, chrono::duration_cast<chrono::seconds>(curTime.time_since_epoch()).count());
-        if ((mc = curl_multi_perform(mClient, &runningHandlers)) != CURLM_OK) {
+        if ((mc = curl_multi_perform(shard.mClient, &runningHandlers)) != CURLM_OK) {
             LOG_ERROR(
                 sLogger,
                 ("failed to call curl_multi_perform", "sleep 100ms and retry")("errMsg", curl_multi_strerror(mc)));
             this_thread::sleep_for(chrono::milliseconds(100));
             continue;
         }
-        HandleCompletedRequests(runningHandlers);
+        HandleCompletedRequests(shard, runningHandlers);
+        SET_GAUGE(shard.mSendConcurrency, runningHandlers);
 
         unique_ptr<HttpSinkRequest> request;
         bool hasRequest = false;
-        while (mQueue.TryPop(request)) {
+        while (shard.mQueue.TryPop(request)) {
             ADD_COUNTER(mInItemsTotal, 1);
             LOG_DEBUG(sLogger,
                       ("got item from flusher runner, item address", request->mItem)(
@@ -200,9 +246,10 @@ void HttpSink::DoRun() {
                           ToString(chrono::duration_cast<chrono::milliseconds>(chrono::system_clock::now()
                                                                                - request->mEnqueTime)
                                        .count()))("try cnt", ToString(request->mTryCnt)));
-            if (AddRequestToClient(std::move(request))) {
+            if (AddRequestToClient(shard, std::move(request))) {
                 ++runningHandlers;
                 ADD_GAUGE(mSendingItemsTotal, 1);
+                ADD_GAUGE(shard.mSendingItemsTotal, 1);
                 hasRequest = true;
             }
         }
@@ -214,7 +261,7 @@ void HttpSink::DoRun() {
             1, 0
         };
         long curlTimeout = -1;
-        if ((mc = curl_multi_timeout(mClient, &curlTimeout)) != CURLM_OK) {
+        if ((mc = curl_multi_timeout(shard.mClient, &curlTimeout)) != CURLM_OK) {
             LOG_WARNING(
                 sLogger,
                 ("failed to call curl_multi_timeout", "use default timeout 1s")("errMsg", curl_multi_strerror(mc)));
@@ -235,7 +282,7 @@ void HttpSink::DoRun() {
         FD_ZERO(&fdread);
         FD_ZERO(&fdwrite);
         FD_ZERO(&fdexcep);
-        if ((mc = curl_multi_fdset(mClient, &fdread, &fdwrite, &fdexcep, &maxfd)) != CURLM_OK) {
+        if ((mc = curl_multi_fdset(shard.mClient, &fdread, &fdwrite, &fdexcep, &maxfd)) != CURLM_OK) {
             LOG_ERROR(sLogger, ("failed to call curl_multi_fdset", "sleep 100ms")("errMsg", curl_multi_strerror(mc)));
         }
         if (maxfd == -1) {
@@ -248,9 +295,9 @@ void HttpSink::DoRun() {
     }
 }
 
-void HttpSink::HandleCompletedRequests(int& runningHandlers) {
+void HttpSink::HandleCompletedRequests(Shard& shard, int& runningHandlers) {
     int msgsLeft = 0;
-    CURLMsg* msg = curl_multi_info_read(mClient, &msgsLeft);
+    CURLMsg* msg = curl_multi_info_read(shard.mClient, &msgsLeft);
     while (msg) {
         if (msg->msg == CURLMSG_DONE) {
             bool requestReused = false;
@@ -279,6 +326,7 @@ void HttpSink::HandleCompletedRequests(int& runningHandlers) {
                     ADD_COUNTER(mOutSuccessfulItemsTotal, 1);
                     ADD_COUNTER(mSuccessfulItemTotalResponseTimeMs, responseTime);
                     SUB_GAUGE(mSendingItemsTotal, 1);
+                    SUB_GAUGE(shard.mSendingItemsTotal, 1);
                     break;
                 }
                 default:
@@ -295,9 +343,10 @@ void HttpSink::HandleCompletedRequests(int& runningHandlers) {
                             request->mPrivateData = nullptr;
                         }
                         ++request->mTryCnt;
-                        AddRequestToClient(unique_ptr<HttpSinkRequest>(request));
+                        AddRequestToClient(shard, unique_ptr<HttpSinkRequest>(request));
                         ++runningHandlers;
                         ADD_GAUGE(mSendingItemsTotal, 1);
+                        ADD_GAUGE(shard.mSendingItemsTotal, 1);
                         requestReused = true;
                     } else {
                         auto errMsg = curl_easy_strerror(msg->data.result);
@@ -316,9 +365,10 @@ void HttpSink::HandleCompletedRequests(int& runningHandlers) {
                     ADD_COUNTER(mOutFailedItemsTotal, 1);
                     ADD_COUNTER(mFailedItemTotalResponseTimeMs, responseTime);
                     SUB_GAUGE(mSendingItemsTotal, 1);
+                    SUB_GAUGE(shard.mSendingItemsTotal, 1);
                     break;
             }
-            curl_multi_remove_handle(mClient, handler);
+            curl_multi_remove_handle(shard.mClient, handler);
             curl_easy_cleanup(handler);
             if (!requestReused) {
                 if (request->mPrivateData) {
@@ -327,7 +377,7 @@ void HttpSink::HandleCompletedRequests(int& runningHandlers) {
                 delete request;
             }
         }
-        msg = curl_multi_info_read(mClient, &msgsLeft);
+        msg = curl_multi_info_read(shard.mClient, &msgsLeft);
     }
 }
 
@@ -20,6 +20,7 @@
 #include <condition_variable>
 #include <future>
 #include <mutex>
+#include <vector>
 
 #include "curl/multi.h"
 
@@ -39,18 +40,33 @@ public:
     bool Init() override;
     void Stop() override;
 
+    // requests are sharded by destination, so that connections to the same host are reused within one shard
+    bool AddRequest(std::unique_ptr<HttpSinkRequest>&& request) override;
+
 private:
+    // Each shard runs its own thread and curl multi client, so that TLS and completion handling of different
+    // destinations are spread over several threads.
+    struct Shard {
+        uint32_t mShardNo = 0;
+        CURLM* mClient = nullptr;
+        SafeQueue<std::unique_ptr<HttpSinkRequest>> mQueue;
+        std::future<void> mThreadRes;
+
+        MetricsRecordRef mMetricsRecordRef;
+        IntGaugePtr mSendingItemsTotal;
+        IntGaugePtr mSendConcurrency;
+    };
+
     HttpSink() = default;
     ~HttpSink() = default;
 
-    void Run();
-    bool AddRequestToClient(std::unique_ptr<HttpSinkRequest>&& request);
-    void DoRun();
-    void HandleCompletedRequests(int& runningHandlers);
-
-    CURLM* mClient = nullptr;
+    size_t GetShardIndex(const HttpSinkRequest& request) const;
+    void Run(Shard& shard);
+    bool AddRequestToClient(Shard& shard, std::unique_ptr<HttpSinkRequest>&& request);
+    void DoRun(Shard& shard);
+    void HandleCompletedRequests(Shard& shard, int& runningHandlers);
 
-    std::future<void> mThreadRes;
+    std::vector<std::unique_ptr<Shard>> mShards;
     std::atomic_bool mIsFlush = false;
 
     mutable MetricsRecordRef mMetricsRecordRef;
@@ -66,6 +82,7 @@ private:
 #ifdef APSARA_UNIT_TEST_MAIN
     friend class FlusherRunnerUnittest;
     friend class HttpSinkMock;
+    friend class HttpSinkUnittest;
 #endif
 };
 
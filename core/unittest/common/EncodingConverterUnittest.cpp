@@ -13,19 +13,30 @@
 // limitations under the License.
 
 #include "common/EncodingConverter.h"
+#include "common/Flags.h"
 #include "unittest/Unittest.h"
 #if defined(__linux__)
 #include "unittest/UnittestHelper.h"
 #endif
 
+DECLARE_FLAG_BOOL(enable_native_gbk_converter);
+
 namespace logtail {
 
 class EncodingConverterUnittest : public ::testing::Test {
 public:
     void ConvertGbk2Utf8();
+    void ConvertGbk2Utf8WithInvalidLine();
+    void ConvertGbk2Utf8ByTableAndIconv();
+    void ConvertGbk2Utf8WithEuroSign();
 };
 
 APSARA_UNIT_TEST_CASE(EncodingConverterUnittest, ConvertGbk2Utf8, 0);
+#if defined(__linux__)
+APSARA_UNIT_TEST_CASE(EncodingConverterUnittest, ConvertGbk2Utf8WithInvalidLine, 0);
+APSARA_UNIT_TEST_CASE(EncodingConverterUnittest, ConvertGbk2Utf8ByTableAndIconv, 0);
+APSARA_UNIT_TEST_CASE(EncodingConverterUnittest, ConvertGbk2Utf8WithEuroSign, 0);
+#endif
 
 void EncodingConverterUnittest::ConvertGbk2Utf8() {
     char gbkStr[] = "ilogtail\xbf\xc9\xb9\xdb\xb2\xe2\xd0\xd4\xb2\xc9\xbc\xaf\xc6\xf7";
@@ -41,6 +52,76 @@ void EncodingConverterUnittest::ConvertGbk2Utf8() {
     APSARA_TEST_STREQ("ilogtail可观测性采集器", destChar.get());
 }
 
+void EncodingConverterUnittest::ConvertGbk2Utf8WithInvalidLine() {
+    // the second line ends with an incomplete GBK character
+    std::string gbkStr = "ilogtail\xbf\xc9\xb9\xdb\nabc\xbf\nlast\xb2\xe2\n";
+    std::vector<long> linePosVec = {12, 17, 24};
+    size_t srcLen = gbkStr.size();
+    size_t requireSize
+        = EncodingConverter::GetInstance()->ConvertGbk2Utf8(gbkStr.data(), &srcLen, nullptr, 0, linePosVec) + 1;
+    std::unique_ptr<char[]> destChar(new char[requireSize]);
+    srcLen = gbkStr.size();
+    size_t actualSize = EncodingConverter::GetInstance()->ConvertGbk2Utf8(
+        gbkStr.data(), &srcLen, destChar.get(), requireSize, linePosVec);
+    APSARA_TEST_EQUAL(std::string("ilogtail可观\nabc\xbf\nlast测\n"), std::string(destChar.get(), actualSize));
+}
+
+void EncodingConverterUnittest::ConvertGbk2Utf8ByTableAndIconv() {
+    std::string gbkStr;
+    std::vector<long> linePosVec;
+    for (int lead = 0x81; lead <= 0xFE; ++lead) {
+        gbkStr += "line ";
+        for (int trail = 0x40; trail <= 0xFE; ++trail) {
+            if (trail != 0x7F) {
+                gbkStr.push_back(static_cast<char>(lead));
+                gbkStr.push_back(static_cast<char>(trail));
+            }
+        }
+        gbkStr.push_back('\n');
+        linePosVec.push_back(gbkStr.size() - 1);
+    }
+    std::string results[2];
+    for (int i = 0; i < 2; ++i) {
+        BOOL_FLAG(enable_native_gbk_converter) = i == 0;
+        size_t srcLen = gbkStr.size();
+        size_t requireSize
+            = EncodingConverter::GetInstance()->ConvertGbk2Utf8(gbkStr.data(), &srcLen, nullptr, 0, linePosVec) + 1;
+        std::unique_ptr<char[]> destChar(new char[requireSize]);
+        size_t actualSize = EncodingConverter::GetInstance()->ConvertGbk2Utf8(
+            gbkStr.data(), &srcLen, destChar.get(), requireSize, linePosVec);
+        results[i].assign(destChar.get(), actualSize);
+    }
+    BOOL_FLAG(enable_native_gbk_converter) = true;
+    APSARA_TEST_EQUAL(results[1], results[0]);
+}
+
+void EncodingConverterUnittest::ConvertGbk2Utf8WithEuroSign() {
+    // 0x80 is converted to 3 UTF-8 bytes, and the buffer is large enough to be converted in parallel
+    std::string gbkStr, expected;
+    std::vector<long> linePosVec;
+    for (int i = 0; i < 4096; ++i) {
+        gbkStr.append(100, '\x80');
+        gbkStr.push_back('\n');
+        linePosVec.push_back(gbkStr.size() - 1);
+        for (int j = 0; j < 100; ++j) {
+            expected += "\xe2\x82\xac";
+        }
+        expected.push_back('\n');
+    }
+    for (int i = 0; i < 2; ++i) {
+        BOOL_FLAG(enable_native_gbk_converter) = i == 0;
+        size_t srcLen = gbkStr.size();
+        size_t requireSize
+            = EncodingConverter::GetInstance()->ConvertGbk2Utf8(gbkStr.data(), &srcLen, nullptr, 0, linePosVec) + 1;
+        APSARA_TEST_TRUE(requireSize > expected.size());
+        std::unique_ptr<char[]> destChar(new char[requireSize]);
+        size_t actualSize = EncodingConverter::GetInstance()->ConvertGbk2Utf8(
+            gbkStr.data(), &srcLen, destChar.get(), requireSize, linePosVec);
+        APSARA_TEST_EQUAL(expected, std::string(destChar.get(), actualSize));
+    }
+    BOOL_FLAG(enable_native_gbk_converter) = true;
+}
+
 } // namespace logtail
 
 int main(int argc, char** argv) {
@@ -52,6 +52,7 @@ public:
     void TestTell();
     void TestClose();
     void TestFuseTruncate();
+    void TestPreadBatch();
 };
 
 APSARA_UNIT_TEST_CASE(LogFileOperatorUnittest, TestCons, 0);
@@ -63,6 +64,7 @@ APSARA_UNIT_TEST_CASE(LogFileOperatorUnittest, TestSkipHoleRead, 5);
 APSARA_UNIT_TEST_CASE(LogFileOperatorUnittest, TestTell, 6);
 APSARA_UNIT_TEST_CASE(LogFileOperatorUnittest, TestClose, 7);
 APSARA_UNIT_TEST_CASE(LogFileOperatorUnittest, TestFuseTruncate, 8);
+APSARA_UNIT_TEST_CASE(LogFileOperatorUnittest, TestPreadBatch, 9);
 
 std::string LogFileOperatorUnittest::gRootDir = "";
 
@@ -554,6 +556,47 @@ void LogFileOperatorUnittest::TestFuseTruncate() {
 #endif
 }
 
+void LogFileOperatorUnittest::TestPreadBatch() {
+    const size_t fileCount = 100;
+    std::vector<std::string> contents;
+    std::vector<std::unique_ptr<LogFileOperator>> ops;
+    for (size_t i = 0; i < fileCount; ++i) {
+        std::string file = gRootDir + PATH_SEPARATOR + "batch_" + std::to_string(i) + ".txt";
+        contents.emplace_back(GenerateData(i + 1, 100));
+        { std::ofstream(file, std::ios_base::binary) << contents.back(); }
+        ops.emplace_back(new LogFileOperator());
+        APSARA_TEST_TRUE(ops.back()->Open(file.c_str()) >= 0);
+    }
+    // one more request than the ring entries to cover chunked submission, and a closed file
+    LogFileOperator closedOp;
+    std::vector<std::unique_ptr<char[]>> bufs;
+    std::vector<PreadRequest> requests;
+    for (size_t i = 0; i < fileCount; ++i) {
+        bufs.emplace_back(new char[contents[i].size()]);
+        PreadRequest req;
+        req.op = ops[i].get();
+        req.buf = bufs.back().get();
+        req.size = contents[i].size();
+        // skip the first line for odd files
+        req.offset = (i % 2 == 1) ? 101 : 0;
+        requests.emplace_back(req);
+    }
+    char closedBuf[16];
+    PreadRequest closedReq;
+    closedReq.op = &closedOp;
+    closedReq.buf = closedBuf;
+    closedReq.size = sizeof(closedBuf);
+    requests.emplace_back(closedReq);
+
+    LogFileOperator::PreadBatch(requests);
+    for (size_t i = 0; i < fileCount; ++i) {
+        size_t offset = static_cast<size_t>(requests[i].offset);
+        APSARA_TEST_EQUAL(static_cast<int64_t>(contents[i].size() - offset), requests[i].result);
+        APSARA_TEST_EQUAL(contents[i].substr(offset), std::string(bufs[i].get(), requests[i].result));
+    }
+    APSARA_TEST_EQUAL(0, requests.back().result);
+}
+
 } // namespace logtail
 
 int main(int argc, char** argv) {
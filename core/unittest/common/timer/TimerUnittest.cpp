@@ -12,9 +12,16 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <atomic>
+#include <memory>
+#include <thread>
+
+#include "common/Flags.h"
 #include "common/timer/Timer.h"
 #include "unittest/Unittest.h"
 
+DECLARE_FLAG_BOOL(enable_timer_timing_wheel);
+
 using namespace std;
 
 namespace logtail {
@@ -23,14 +30,19 @@ struct TimerEventMock : public TimerEvent {
     TimerEventMock(const chrono::steady_clock::time_point& execTime) : TimerEvent(execTime) {}
 
     bool IsValid() const override { return mIsValid; }
-    bool Execute() { return true; }
+    bool Execute() {
+        ++*mExecutedCnt;
+        return true;
+    }
 
     bool mIsValid = false;
+    std::shared_ptr<std::atomic_int> mExecutedCnt = std::make_shared<std::atomic_int>(0);
 };
 
 class TimerUnittest : public ::testing::Test {
 public:
     void TestPushEvent();
+    void TestTimingWheel();
 };
 
 void TimerUnittest::TestPushEvent() {
@@ -49,7 +61,42 @@ void TimerUnittest::TestPushEvent() {
     timer.mQueue.pop();
 }
 
+void TimerUnittest::TestTimingWheel() {
+    BOOL_FLAG(enable_timer_timing_wheel) = true;
+    auto now = chrono::steady_clock::now();
+    auto executedCnt = make_shared<atomic_int>(0);
+    Timer timer;
+    // pushed before init
+    auto e1 = make_unique<TimerEventMock>(now + chrono::milliseconds(100));
+    e1->mIsValid = true;
+    e1->mExecutedCnt = executedCnt;
+    timer.PushEvent(std::move(e1));
+    timer.Init();
+    APSARA_TEST_NOT_EQUAL(nullptr, timer.mWheel);
+    APSARA_TEST_TRUE(timer.mQueue.empty());
+
+    auto e2 = make_unique<TimerEventMock>(now + chrono::milliseconds(50));
+    e2->mIsValid = true;
+    e2->mExecutedCnt = executedCnt;
+    timer.PushEvent(std::move(e2));
+    // invalid event is not executed
+    auto e3 = make_unique<TimerEventMock>(now + chrono::milliseconds(50));
+    e3->mExecutedCnt = executedCnt;
+    timer.PushEvent(std::move(e3));
+    timer.PushEvent(make_unique<TimerEventMock>(now + chrono::hours(1)));
+
+    this_thread::sleep_for(chrono::milliseconds(500));
+    APSARA_TEST_EQUAL(2, executedCnt->load());
+    timer.Stop();
+    {
+        lock_guard<mutex> lock(timer.mQueueMux);
+        APSARA_TEST_EQUAL(1U, timer.mWheel->Size());
+    }
+    BOOL_FLAG(enable_timer_timing_wheel) = false;
+}
+
 UNIT_TEST_CASE(TimerUnittest, TestPushEvent)
+UNIT_TEST_CASE(TimerUnittest, TestTimingWheel)
 
 } // namespace logtail
 
@@ -0,0 +1,149 @@
+// Copyright 2025 iLogtail Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <cstdlib>
+
+#include "common/timer/TimingWheel.h"
+#include "unittest/Unittest.h"
+
+using namespace std;
+
+namespace logtail {
+
+struct TimingWheelEventMock : public TimerEvent {
+    TimingWheelEventMock(const chrono::steady_clock::time_point& execTime) : TimerEvent(execTime) {}
+
+    bool IsValid() const override { return true; }
+    bool Execute() override { return true; }
+};
+
+class TimingWheelUnittest : public ::testing::Test {
+public:
+    void TestAdvance();
+    void TestCascade();
+    void TestNextExpireTime();
+    void TestRandomEvents();
+
+protected:
+    void SetUp() override { mStart = chrono::steady_clock::now(); }
+
+private:
+    chrono::steady_clock::time_point mStart;
+};
+
+void TimingWheelUnittest::TestAdvance() {
+    TimingWheel wheel(mStart, chrono::milliseconds(10));
+    wheel.Add(make_unique<TimingWheelEventMock>(mStart + chrono::milliseconds(25)));
+    wheel.Add(make_unique<TimingWheelEventMock>(mStart + chrono::milliseconds(21)));
+    wheel.Add(make_unique<TimingWheelEventMock>(mStart + chrono::milliseconds(45)));
+    // already due
+    wheel.Add(make_unique<TimingWheelEventMock>(mStart - chrono::seconds(1)));
+    APSARA_TEST_EQUAL(4U, wheel.Size());
+
+    vector<unique_ptr<TimerEvent>> due;
+    wheel.Advance(mStart, due);
+    APSARA_TEST_EQUAL_FATAL(1U, due.size());
+    APSARA_TEST_EQUAL(mStart - chrono::seconds(1), due[0]->GetExecTime());
+
+    // never fired before exec time
+    due.clear();
+    wheel.Advance(mStart + chrono::milliseconds(29), due);
+    APSARA_TEST_TRUE(due.empty());
+
+    // fired together at the tick, in the order of exec time
+    wheel.Advance(mStart + chrono::milliseconds(30), due);
+    APSARA_TEST_EQUAL_FATAL(2U, due.size());
+    APSARA_TEST_EQUAL(mStart + chrono::milliseconds(21), due[0]->GetExecTime());
+    APSARA_TEST_EQUAL(mStart + chrono::milliseconds(25), due[1]->GetExecTime());
+    APSARA_TEST_EQUAL(1U, wheel.Size());
+
+    due.clear();
+    wheel.Advance(mStart + chrono::seconds(1), due);
+    APSARA_TEST_EQUAL(1U, due.size());
+    APSARA_TEST_TRUE(wheel.Empty());
+
+    // idle ticks are skipped, and late events are fired at the next advance
+    wheel.Add(make_unique<TimingWheelEventMock>(mStart + chrono::milliseconds(500)));
+    due.clear();
+    wheel.Advance(mStart + chrono::hours(1), due);
+    APSARA_TEST_EQUAL(1U, due.size());
+}
+
+void TimingWheelUnittest::TestCascade() {
+    TimingWheel wheel(mStart, chrono::milliseconds(10));
+    // level 1, level 2, level 3 and beyond the wheel
+    vector<chrono::steady_clock::duration> delays{
+        chrono::seconds(3), chrono::minutes(5), chrono::hours(5), chrono::hours(24 * 600)};
+    for (auto delay : delays) {
+        wheel.Add(make_unique<TimingWheelEventMock>(mStart + delay));
+    }
+    APSARA_TEST_EQUAL(1U, wheel.mLevelSizes[1]);
+    APSARA_TEST_EQUAL(1U, wheel.mLevelSizes[2]);
+    APSARA_TEST_EQUAL(2U, wheel.mLevelSizes[3]);
+
+    for (auto delay : delays) {
+        vector<unique_ptr<TimerEvent>> due;
+        wheel.Advance(mStart + delay - chrono::milliseconds(1), due);
+        APSARA_TEST_TRUE(due.empty());
+        wheel.Advance(mStart + delay, due);
+        APSARA_TEST_EQUAL_FATAL(1U, due.size());
+        APSARA_TEST_EQUAL(mStart + delay, due[0]->GetExecTime());
+    }
+    APSARA_TEST_TRUE(wheel.Empty());
+}
+
+void TimingWheelUnittest::TestNextExpireTime() {
+    TimingWheel wheel(mStart, chrono::milliseconds(10));
+    APSARA_TEST_EQUAL(chrono::steady_clock::time_point::max(), wheel.NextExpireTime());
+
+    wheel.Add(make_unique<TimingWheelEventMock>(mStart + chrono::milliseconds(55)));
+    APSARA_TEST_EQUAL(mStart + chrono::milliseconds(60), wheel.NextExpireTime());
+
+    // events of upper levels wake up the timer at the end of the rotation of level 0 to be cascaded
+    wheel.Clear();
+    wheel.Add(make_unique<TimingWheelEventMock>(mStart + chrono::seconds(10)));
+    vector<unique_ptr<TimerEvent>> due;
+    wheel.Advance(mStart + chrono::milliseconds(5), due);
+    APSARA_TEST_EQUAL(mStart + chrono::milliseconds(2560), wheel.NextExpireTime());
+}
+
+void TimingWheelUnittest::TestRandomEvents() {
+    TimingWheel wheel(mStart, chrono::milliseconds(10));
+    srand(0);
+    const size_t kEventCnt = 10000;
+    for (size_t i = 0; i < kEventCnt; ++i) {
+        wheel.Add(make_unique<TimingWheelEventMock>(mStart + chrono::milliseconds(rand() % 3600000)));
+    }
+    size_t firedCnt = 0;
+    vector<unique_ptr<TimerEvent>> due;
+    for (auto now = mStart; !wheel.Empty(); now = max(now + chrono::milliseconds(1), wheel.NextExpireTime())) {
+        due.clear();
+        wheel.Advance(now, due);
+        for (const auto& e : due) {
+            APSARA_TEST_TRUE_FATAL(e->GetExecTime() <= now);
+            APSARA_TEST_TRUE_FATAL(now - e->GetExecTime() < chrono::milliseconds(10));
+        }
+        firedCnt += due.size();
+    }
+    APSARA_TEST_EQUAL(kEventCnt, firedCnt);
+}
+
+UNIT_TEST_CASE(TimingWheelUnittest, TestAdvance)
+UNIT_TEST_CASE(TimingWheelUnittest, TestCascade)
+UNIT_TEST_CASE(TimingWheelUnittest, TestNextExpireTime)
+UNIT_TEST_CASE(TimingWheelUnittest, TestRandomEvents)
+
+} // namespace logtail
+
+UNIT_TEST_MAIN
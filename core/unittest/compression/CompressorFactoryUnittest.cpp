@@ -60,6 +60,22 @@ void CompressorFactoryUnittest::TestCreate() {
             = CompressorFactory::GetInstance()->Create(config, mCtx, "test_plugin", mFlusherId, CompressType::LZ4);
         APSARA_TEST_EQUAL(CompressType::ZSTD, compressor->GetCompressType());
     }
+    {
+        // snappy
+        Json::Value config;
+        config["CompressType"] = "snappy";
+        auto compressor
+            = CompressorFactory::GetInstance()->Create(config, mCtx, "test_plugin", mFlusherId, CompressType::LZ4);
+        APSARA_TEST_EQUAL(CompressType::SNAPPY, compressor->GetCompressType());
+    }
+    {
+        // gzip
+        Json::Value config;
+        config["CompressType"] = "gzip";
+        auto compressor
+            = CompressorFactory::GetInstance()->Create(config, mCtx, "test_plugin", mFlusherId, CompressType::LZ4);
+        APSARA_TEST_EQUAL(CompressType::GZIP, compressor->GetCompressType());
+    }
     {
         // none
         Json::Value config;
@@ -89,6 +105,8 @@ void CompressorFactoryUnittest::TestCreate() {
 void CompressorFactoryUnittest::TestCompressTypeToString() {
     APSARA_TEST_STREQ("lz4", CompressTypeToString(CompressType::LZ4).data());
     APSARA_TEST_STREQ("zstd", CompressTypeToString(CompressType::ZSTD).data());
+    APSARA_TEST_STREQ("snappy", CompressTypeToString(CompressType::SNAPPY).data());
+    APSARA_TEST_STREQ("gzip", CompressTypeToString(CompressType::GZIP).data());
     APSARA_TEST_STREQ("none", CompressTypeToString(CompressType::NONE).data());
 }
 
@@ -0,0 +1,47 @@
+// Copyright 2025 iLogtail Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "common/StringTools.h"
+#include "common/compression/GzipCompressor.h"
+#include "unittest/Unittest.h"
+
+using namespace std;
+
+namespace logtail {
+
+class GzipCompressorUnittest : public ::testing::Test {
+public:
+    void TestCompress();
+};
+
+void GzipCompressorUnittest::TestCompress() {
+    GzipCompressor compressor(CompressType::GZIP);
+    string input = "hello world";
+    for (size_t i = 0; i < 1000; ++i) {
+        input += ToString(i);
+    }
+    string output;
+    string errorMsg;
+    APSARA_TEST_TRUE(compressor.DoCompress(input, output, errorMsg));
+    string decompressed;
+    APSARA_TEST_TRUE(compressor.UnCompress(output, decompressed, errorMsg));
+    APSARA_TEST_EQUAL(input, decompressed);
+    APSARA_TEST_FALSE(compressor.UnCompress("invalid", decompressed, errorMsg));
+}
+
+UNIT_TEST_CASE(GzipCompressorUnittest, TestCompress)
+
+} // namespace logtail
+
+UNIT_TEST_MAIN
@@ -0,0 +1,199 @@
+// Copyright 2025 iLogtail Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <atomic>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "collection_pipeline/CollectionPipelineContext.h"
+#include "collection_pipeline/queue/ProcessQueueManager.h"
+#include "collection_pipeline/queue/QueueKeyManager.h"
+#include "common/Flags.h"
+#include "ebpf/handler/EventRing.h"
+#include "ebpf/handler/SecurityHandler.h"
+#include "models/LogEvent.h"
+#include "unittest/Unittest.h"
+
+DECLARE_FLAG_INT32(ebpf_event_ring_size);
+DECLARE_FLAG_INT32(ebpf_event_group_size);
+
+using namespace std;
+
+namespace logtail {
+namespace ebpf {
+
+class EventRingUnittest : public testing::Test {
+public:
+    void TestPushAndPop();
+    void TestMultiProducers();
+    void TestSecurityHandler();
+    void TestSecurityHandlerDrop();
+
+protected:
+    void SetUp() override {
+        mCtx.SetConfigName("test_config");
+        mKey = QueueKeyManager::GetInstance()->GetKey("test_config");
+    }
+
+    void TearDown() override {
+        ProcessQueueManager::GetInstance()->DeleteQueue(mKey);
+        QueueKeyManager::GetInstance()->Clear();
+    }
+
+private:
+    static vector<unique_ptr<AbstractSecurityEvent>> GenerateEvents(size_t cnt) {
+        vector<unique_ptr<AbstractSecurityEvent>> events;
+        for (size_t i = 0; i < cnt; ++i) {
+            vector<pair<string, string>> tags{{"call_name", "execve"}, {"pid", to_string(i)}};
+            events.emplace_back(make_unique<AbstractSecurityEvent>(
+                std::move(tags), SecureEventType::SECURE_EVENT_TYPE_PROCESS_SECURE, 1700000000000000000ULL + i));
+        }
+        return events;
+    }
+
+    CollectionPipelineContext mCtx;
+    QueueKey mKey = 0;
+};
+
+void EventRingUnittest::TestPushAndPop() {
+    EventRing<unique_ptr<int>> ring(5);
+    APSARA_TEST_EQUAL(8U, ring.Capacity());
+    unique_ptr<int> item;
+    APSARA_TEST_FALSE(ring.TryPop(item));
+
+    // wraps around several rounds
+    for (int round = 0; round < 3; ++round) {
+        for (int i = 0; i < 8; ++i) {
+            APSARA_TEST_TRUE(ring.TryPush(make_unique<int>(round * 8 + i)));
+        }
+        // item is kept by the caller when the ring is full
+        auto extra = make_unique<int>(-1);
+        APSARA_TEST_FALSE(ring.TryPush(std::move(extra)));
+        APSARA_TEST_NOT_EQUAL(nullptr, extra);
+        for (int i = 0; i < 8; ++i) {
+            APSARA_TEST_TRUE(ring.TryPop(item));
+            APSARA_TEST_EQUAL(round * 8 + i, *item);
+        }
+        APSARA_TEST_FALSE(ring.TryPop(item));
+    }
+}
+
+void EventRingUnittest::TestMultiProducers() {
+    const size_t producerCnt = 4, itemCnt = 100000;
+    EventRing<uint64_t> ring(1024);
+    atomic_size_t droppedCnt = 0;
+    atomic_size_t finishedCnt = 0;
+    vector<thread> producers;
+    for (size_t p = 0; p < producerCnt; ++p) {
+        producers.emplace_back([&, p]() {
+            for (uint64_t i = 0; i < itemCnt; ++i) {
+                uint64_t item = (p << 32) | i;
+                if (!ring.TryPush(std::move(item))) {
+                    ++droppedCnt;
+                }
+            }
+            ++finishedCnt;
+        });
+    }
+
+    // items of the same producer are popped in order
+    vector<int64_t> last(producerCnt, -1);
+    size_t poppedCnt = 0;
+    bool ordered = true;
+    uint64_t item = 0;
+    while (true) {
+        bool finished = finishedCnt == producerCnt;
+        while (ring.TryPop(item)) {
+            size_t p = item >> 32;
+            auto i = static_cast<int64_t>(item & 0xFFFFFFFF);
+            ordered = ordered && i > last[p];
+            last[p] = i;
+            ++poppedCnt;
+        }
+        if (finished) {
+            break;
+        }
+    }
+    for (auto& t : producers) {
+        t.join();
+    }
+    APSARA_TEST_TRUE(ordered);
+    APSARA_TEST_EQUAL(producerCnt * itemCnt, poppedCnt + droppedCnt);
+}
+
+void EventRingUnittest::TestSecurityHandler() {
+    SecurityHandler handler(&mCtx, mKey, 1);
+    auto events = GenerateEvents(10);
+    handler.handle(events);
+    APSARA_TEST_EQUAL(10U, handler.mProcessTotalCnt);
+    // events are left in the ring until the process queue is created
+    handler.ConsumeEvents();
+    APSARA_TEST_TRUE(ProcessQueueManager::GetInstance()->IsAllQueueEmpty());
+
+    APSARA_TEST_TRUE(ProcessQueueManager::GetInstance()->CreateOrUpdateBoundedQueue(mKey, 0, mCtx));
+    ProcessQueueManager::GetInstance()->EnablePop("test_config");
+    INT32_FLAG(ebpf_event_group_size) = 6;
+    handler.ConsumeEvents();
+    INT32_FLAG(ebpf_event_group_size) = 1024;
+    APSARA_TEST_EQUAL(0U, handler.FetchDroppedCnt());
+
+    unique_ptr<ProcessQueueItem> item;
+    string configName;
+    APSARA_TEST_TRUE(ProcessQueueManager::GetInstance()->PopItem(0, item, configName));
+    APSARA_TEST_EQUAL(1U, item->mInputIndex);
+    const auto& group = item->mEventGroup;
+    APSARA_TEST_EQUAL(6U, group.GetEvents().size());
+    const auto& first = group.GetEvents()[0].Cast<LogEvent>();
+    const auto& second = group.GetEvents()[1].Cast<LogEvent>();
+    APSARA_TEST_EQUAL("execve", first.GetContent("call_name").to_string());
+    APSARA_TEST_EQUAL("0", first.GetContent("pid").to_string());
+    APSARA_TEST_EQUAL("1", second.GetContent("pid").to_string());
+    // keys are interned by the handler rather than copied for each event
+    APSARA_TEST_EQUAL(first.begin()->first.data(), second.begin()->first.data());
+
+    APSARA_TEST_TRUE(ProcessQueueManager::GetInstance()->PopItem(0, item, configName));
+    APSARA_TEST_EQUAL(4U, item->mEventGroup.GetEvents().size());
+    APSARA_TEST_FALSE(ProcessQueueManager::GetInstance()->PopItem(0, item, configName));
+}
+
+void EventRingUnittest::TestSecurityHandlerDrop() {
+    INT32_FLAG(ebpf_event_ring_size) = 4;
+    SecurityHandler handler(&mCtx, mKey, 0);
+    INT32_FLAG(ebpf_event_ring_size) = 8192;
+    auto events = GenerateEvents(10);
+    handler.handle(events);
+    APSARA_TEST_EQUAL(10U, handler.mProcessTotalCnt);
+    APSARA_TEST_EQUAL(6U, handler.FetchDroppedCnt());
+    APSARA_TEST_EQUAL(0U, handler.FetchDroppedCnt());
+
+    APSARA_TEST_TRUE(ProcessQueueManager::GetInstance()->CreateOrUpdateBoundedQueue(mKey, 0, mCtx));
+    ProcessQueueManager::GetInstance()->EnablePop("test_config");
+    handler.ConsumeEvents();
+    unique_ptr<ProcessQueueItem> item;
+    string configName;
+    APSARA_TEST_TRUE(ProcessQueueManager::GetInstance()->PopItem(0, item, configName));
+    APSARA_TEST_EQUAL(4U, item->mEventGroup.GetEvents().size());
+}
+
+UNIT_TEST_CASE(EventRingUnittest, TestPushAndPop)
+UNIT_TEST_CASE(EventRingUnittest, TestMultiProducers)
+UNIT_TEST_CASE(EventRingUnittest, TestSecurityHandler)
+UNIT_TEST_CASE(EventRingUnittest, TestSecurityHandlerDrop)
+
+} // namespace ebpf
+} // namespace logtail
+
+UNIT_TEST_MAIN
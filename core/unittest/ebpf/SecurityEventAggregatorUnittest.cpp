@@ -0,0 +1,206 @@
+// Copyright 2025 iLogtail Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <chrono>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "collection_pipeline/CollectionPipelineContext.h"
+#include "collection_pipeline/queue/ProcessQueueManager.h"
+#include "collection_pipeline/queue/QueueKeyManager.h"
+#include "ebpf/handler/SecurityEventAggregator.h"
+#include "ebpf/handler/SecurityHandler.h"
+#include "models/LogEvent.h"
+#include "unittest/Unittest.h"
+
+using namespace std;
+
+namespace logtail {
+namespace ebpf {
+
+class SecurityEventAggregatorUnittest : public testing::Test {
+public:
+    void TestAggregateByAllTags();
+    void TestAggregateByKeys();
+    void TestWindow();
+    void TestFull();
+    void TestSecurityHandler();
+
+protected:
+    void TearDown() override {
+        ProcessQueueManager::GetInstance()->DeleteQueue(QueueKeyManager::GetInstance()->GetKey("test_config"));
+        QueueKeyManager::GetInstance()->Clear();
+    }
+
+private:
+    static unique_ptr<AbstractSecurityEvent> GenerateEvent(const string& pid, const string& path, uint64_t ts) {
+        vector<pair<string, string>> tags{{"call_name", "security_file_permission"}, {"pid", pid}, {"path", path}};
+        return make_unique<AbstractSecurityEvent>(std::move(tags), SecureEventType::SECURE_EVENT_TYPE_FILE_SECURE, ts);
+    }
+};
+
+void SecurityEventAggregatorUnittest::TestAggregateByAllTags() {
+    SecurityAggregateOption option;
+    option.mWindowSecs = 10;
+    SecurityEventAggregator aggregator(option, 100);
+    APSARA_TEST_TRUE(aggregator.Empty());
+    aggregator.Add(*GenerateEvent("1", "/etc/passwd", 1700000000100000000ULL));
+    aggregator.Add(*GenerateEvent("1", "/etc/passwd", 1700000001200000000ULL));
+    // earlier event from another cpu
+    aggregator.Add(*GenerateEvent("1", "/etc/passwd", 1700000000000000000ULL));
+    aggregator.Add(*GenerateEvent("2", "/etc/passwd", 1700000000500000000ULL));
+    aggregator.Add(*GenerateEvent("1", "/etc/shadow", 1700000000600000000ULL));
+    APSARA_TEST_EQUAL(3U, aggregator.mEntries.size());
+
+    vector<PipelineEventGroup> groups;
+    aggregator.Flush(groups, 1024);
+    APSARA_TEST_TRUE(aggregator.Empty());
+    APSARA_TEST_EQUAL(1U, groups.size());
+    const auto& events = groups[0].GetEvents();
+    APSARA_TEST_EQUAL(3U, events.size());
+    const auto& first = events[0].Cast<LogEvent>();
+    APSARA_TEST_EQUAL("security_file_permission", first.GetContent("call_name").to_string());
+    APSARA_TEST_EQUAL("1", first.GetContent("pid").to_string());
+    APSARA_TEST_EQUAL("/etc/passwd", first.GetContent("path").to_string());
+    APSARA_TEST_EQUAL("3", first.GetContent(SecurityEventAggregator::kEventCountKey).to_string());
+    APSARA_TEST_EQUAL("1700000000000000000",
+                      first.GetContent(SecurityEventAggregator::kFirstEventTimeKey).to_string());
+    APSARA_TEST_EQUAL("1700000001200000000", first.GetContent(SecurityEventAggregator::kLastEventTimeKey).to_string());
+    APSARA_TEST_EQUAL(1700000000, first.GetTimestamp());
+    APSARA_TEST_EQUAL(0U, first.GetTimestampNanosecond().value());
+    APSARA_TEST_EQUAL("2", events[1].Cast<LogEvent>().GetContent("pid").to_string());
+    APSARA_TEST_EQUAL("1", events[1].Cast<LogEvent>().GetContent(SecurityEventAggregator::kEventCountKey).to_string());
+    APSARA_TEST_EQUAL("/etc/shadow", events[2].Cast<LogEvent>().GetContent("path").to_string());
+    APSARA_TEST_EQUAL(1700000000, events[2]->GetTimestamp());
+    APSARA_TEST_EQUAL(600000000U, events[2]->GetTimestampNanosecond().value());
+}
+
+void SecurityEventAggregatorUnittest::TestAggregateByKeys() {
+    SecurityAggregateOption option;
+    option.mWindowSecs = 10;
+    option.mKeys = {"path", "comm"};
+    SecurityEventAggregator aggregator(option, 100);
+    aggregator.Add(*GenerateEvent("1", "/etc/passwd", 1700000000000000000ULL));
+    aggregator.Add(*GenerateEvent("2", "/etc/passwd", 1700000001000000000ULL));
+    aggregator.Add(*GenerateEvent("3", "/etc/shadow", 1700000002000000000ULL));
+    // missing tag is different from an empty one
+    vector<pair<string, string>> tags{{"path", "/etc/shadow"}, {"comm", ""}};
+    aggregator.Add(AbstractSecurityEvent(std::move(tags), SecureEventType::SECURE_EVENT_TYPE_FILE_SECURE, 0));
+    APSARA_TEST_EQUAL(3U, aggregator.mEntries.size());
+
+    vector<PipelineEventGroup> groups;
+    aggregator.Flush(groups, 2);
+    APSARA_TEST_EQUAL(2U, groups.size());
+    APSARA_TEST_EQUAL(2U, groups[0].GetEvents().size());
+    APSARA_TEST_EQUAL(1U, groups[1].GetEvents().size());
+    // tags of the first event are kept
+    const auto& first = groups[0].GetEvents()[0].Cast<LogEvent>();
+    APSARA_TEST_EQUAL("1", first.GetContent("pid").to_string());
+    APSARA_TEST_EQUAL("2", first.GetContent(SecurityEventAggregator::kEventCountKey).to_string());
+    // groups may be processed by different threads, so they never share a source buffer
+    APSARA_TEST_NOT_EQUAL(groups[0].GetSourceBuffer(), groups[1].GetSourceBuffer());
+}
+
+void SecurityEventAggregatorUnittest::TestWindow() {
+    SecurityAggregateOption option;
+    option.mWindowSecs = 5;
+    SecurityEventAggregator aggregator(option, 100);
+    auto now = chrono::steady_clock::now();
+    APSARA_TEST_FALSE(aggregator.ShouldFlush(now + chrono::seconds(10)));
+    aggregator.Add(*GenerateEvent("1", "/etc/passwd", 1700000000000000000ULL));
+    APSARA_TEST_FALSE(aggregator.ShouldFlush(now));
+    APSARA_TEST_TRUE(aggregator.ShouldFlush(now + chrono::seconds(10)));
+
+    vector<PipelineEventGroup> groups;
+    aggregator.Flush(groups, 1024);
+    APSARA_TEST_FALSE(aggregator.ShouldFlush(now + chrono::seconds(10)));
+    // strings of the flushed window are still valid
+    aggregator.Add(*GenerateEvent("2", "/etc/shadow", 1700000000000000000ULL));
+    APSARA_TEST_EQUAL("/etc/passwd", groups[0].GetEvents()[0].Cast<LogEvent>().GetContent("path").to_string());
+}
+
+void SecurityEventAggregatorUnittest::TestFull() {
+    SecurityAggregateOption option;
+    option.mWindowSecs = 10;
+    SecurityEventAggregator aggregator(option, 3);
+    APSARA_TEST_EQUAL(16U, aggregator.mSlots.size());
+    for (size_t i = 0; i < 3; ++i) {
+        APSARA_TEST_FALSE(aggregator.IsFull());
+        aggregator.Add(*GenerateEvent(to_string(i), "/etc/passwd", 1700000000000000000ULL));
+    }
+    APSARA_TEST_TRUE(aggregator.IsFull());
+    vector<PipelineEventGroup> groups;
+    aggregator.Flush(groups, 1024);
+    APSARA_TEST_FALSE(aggregator.IsFull());
+    APSARA_TEST_EQUAL(3U, groups[0].GetEvents().size());
+}
+
+void SecurityEventAggregatorUnittest::TestSecurityHandler() {
+    CollectionPipelineContext ctx;
+    ctx.SetConfigName("test_config");
+    QueueKey key = QueueKeyManager::GetInstance()->GetKey("test_config");
+    SecurityHandler handler(&ctx, key, 0);
+    SecurityAggregateOption option;
+    option.mWindowSecs = 3600;
+    option.mKeys = {"path"};
+    handler.UpdateAggregateOption(option);
+
+    vector<unique_ptr<AbstractSecurityEvent>> events;
+    for (size_t i = 0; i < 100; ++i) {
+        events.emplace_back(GenerateEvent(to_string(i), i % 2 ? "/etc/passwd" : "/etc/shadow", 1700000000000000000ULL));
+    }
+    handler.handle(events);
+    // events are aggregated until the window expires
+    handler.ConsumeEvents();
+    APSARA_TEST_TRUE(ProcessQueueManager::GetInstance()->IsAllQueueEmpty());
+
+    // kept when the queue does not exist
+    handler.FlushAggregatedEvents();
+    APSARA_TEST_FALSE(handler.mAggregator->Empty());
+
+    APSARA_TEST_TRUE(ProcessQueueManager::GetInstance()->CreateOrUpdateBoundedQueue(key, 0, ctx));
+    ProcessQueueManager::GetInstance()->EnablePop("test_config");
+    handler.FlushAggregatedEvents();
+    APSARA_TEST_TRUE(handler.mAggregator->Empty());
+    unique_ptr<ProcessQueueItem> item;
+    string configName;
+    APSARA_TEST_TRUE(ProcessQueueManager::GetInstance()->PopItem(0, item, configName));
+    const auto& group = item->mEventGroup;
+    APSARA_TEST_EQUAL(2U, group.GetEvents().size());
+    const auto& event = group.GetEvents()[0].Cast<LogEvent>();
+    APSARA_TEST_EQUAL("50", event.GetContent(SecurityEventAggregator::kEventCountKey).to_string());
+
+    // aggregation is disabled
+    handler.UpdateAggregateOption(SecurityAggregateOption());
+    APSARA_TEST_EQUAL(nullptr, handler.mAggregator);
+    events.clear();
+    events.emplace_back(GenerateEvent("1", "/etc/passwd", 1700000000000000000ULL));
+    events.emplace_back(GenerateEvent("1", "/etc/passwd", 1700000000000000000ULL));
+    handler.handle(events);
+    handler.ConsumeEvents();
+    APSARA_TEST_TRUE(ProcessQueueManager::GetInstance()->PopItem(0, item, configName));
+    APSARA_TEST_EQUAL(2U, item->mEventGroup.GetEvents().size());
+}
+
+UNIT_TEST_CASE(SecurityEventAggregatorUnittest, TestAggregateByAllTags)
+UNIT_TEST_CASE(SecurityEventAggregatorUnittest, TestAggregateByKeys)
+UNIT_TEST_CASE(SecurityEventAggregatorUnittest, TestWindow)
+UNIT_TEST_CASE(SecurityEventAggregatorUnittest, TestFull)
+UNIT_TEST_CASE(SecurityEventAggregatorUnittest, TestSecurityHandler)
+
+} // namespace ebpf
+} // namespace logtail
+
+UNIT_TEST_MAIN
@@ -35,7 +35,7 @@ protected:
     void SetUp() override {}
     void TearDown() override {
         LogInput::GetInstance()->mModifyEventSet.clear();
-        std::queue<Event*> empty;
+        std::deque<Event*> empty;
         std::swap(LogInput::GetInstance()->mInotifyEventQueue, empty);
     }
 
@@ -20,11 +20,13 @@
 #include <string>
 
 #include "collection_pipeline/CollectionPipeline.h"
+#include "checkpoint/CheckPointManager.h"
 #include "collection_pipeline/queue/ProcessQueueManager.h"
 #include "common/FileSystemUtil.h"
 #include "common/Flags.h"
 #include "common/JsonUtil.h"
 #include "config/CollectionConfig.h"
+#include "file_server/EventDispatcher.h"
 #include "file_server/FileServer.h"
 #include "file_server/event/Event.h"
 #include "file_server/event_handler/EventHandler.h"
@@ -35,6 +37,8 @@ using namespace std;
 
 DECLARE_FLAG_STRING(ilogtail_config);
 DECLARE_FLAG_INT32(default_tail_limit_kb);
+DECLARE_FLAG_INT32(reader_coalesce_max_latency_ms);
+DECLARE_FLAG_INT32(reader_coalesce_max_bytes);
 
 namespace logtail {
 class ModifyHandlerUnittest : public ::testing::Test {
@@ -50,6 +54,7 @@ public:
     void TestHandleModifyEventWhenContainerRestartCase5();
     void TestHandleModifyEventWhenContainerRestartCase6();
     void TestHandleModifyEvnetWhenContainerStopTwice();
+    void TestCoalesceEventGroup();
 
 protected:
     static void SetUpTestCase() {
@@ -229,6 +234,7 @@ UNIT_TEST_CASE(ModifyHandlerUnittest, TestHandleModifyEventWhenContainerRestartC
 UNIT_TEST_CASE(ModifyHandlerUnittest, TestHandleModifyEventWhenContainerRestartCase5);
 UNIT_TEST_CASE(ModifyHandlerUnittest, TestHandleModifyEventWhenContainerRestartCase6);
 UNIT_TEST_CASE(ModifyHandlerUnittest, TestHandleModifyEvnetWhenContainerStopTwice);
+UNIT_TEST_CASE(ModifyHandlerUnittest, TestCoalesceEventGroup);
 
 void ModifyHandlerUnittest::TestHandleContainerStoppedEventWhenReadToEnd() {
     LOG_INFO(sLogger, ("TestHandleContainerStoppedEventWhenReadToEnd() begin", time(NULL)));
@@ -531,6 +537,85 @@ void ModifyHandlerUnittest::TestHandleModifyEvnetWhenContainerStopTwice() {
     APSARA_TEST_EQUAL_FATAL(mReaderPtr->mContainerID, "2");
 }
 
+void ModifyHandlerUnittest::TestCoalesceEventGroup() {
+    LOG_INFO(sLogger, ("TestCoalesceEventGroup() begin", time(NULL)));
+    INT32_FLAG(reader_coalesce_max_latency_ms) = 3600 * 1000;
+    INT32_FLAG(reader_coalesce_max_bytes) = 30;
+    std::string logPath = gRootDir + PATH_SEPARATOR + gLogName;
+    Event event(gRootDir, gLogName, EVENT_MODIFY, 0, 0, mReaderPtr->mDevInode.dev, mReaderPtr->mDevInode.inode);
+    event.SetContainerID("1");
+    auto getCheckpointOffset = [&]() -> int64_t {
+        mReaderPtr->DumpMetaToMem();
+        CheckPointPtr checkpoint;
+        if (!CheckPointManager::Instance()->GetCheckPoint(
+                mReaderPtr->GetDevInode(), mReaderPtr->GetConfigName(), checkpoint)) {
+            return -1;
+        }
+        return checkpoint->mOffset;
+    };
+    // register the handler to the dispatcher, which is flushed by LogInput on a short timer
+    EventDispatcher* dispatcher = EventDispatcher::GetInstance();
+    DirInfo dirInfo(gRootDir, 0, false, mHandlerPtr.get());
+    dispatcher->mWdDirInfoMap[0] = &dirInfo;
+
+    // the first read is held in the pending group
+    mHandlerPtr->Handle(event);
+    APSARA_TEST_NOT_EQUAL(nullptr, mReaderPtr->GetPendingEventGroup());
+    APSARA_TEST_EQUAL(1U, mReaderPtr->GetPendingEventGroup()->GetEvents().size());
+    APSARA_TEST_TRUE(ProcessQueueManager::GetInstance()->IsAllQueueEmpty());
+    APSARA_TEST_EQUAL(13, mReaderPtr->GetLastFilePos());
+    // checkpoint never goes beyond the pending data
+    APSARA_TEST_EQUAL(0, getCheckpointOffset());
+
+    // following read is coalesced into the pending group
+    writeLog(logPath, "second log\n");
+    mHandlerPtr->Handle(event);
+    const auto& events = mReaderPtr->GetPendingEventGroup()->GetEvents();
+    APSARA_TEST_EQUAL(2U, events.size());
+    APSARA_TEST_EQUAL("a sample log", events[0].Cast<LogEvent>().GetContent(DEFAULT_CONTENT_KEY).to_string());
+    APSARA_TEST_EQUAL("second log", events[1].Cast<LogEvent>().GetContent(DEFAULT_CONTENT_KEY).to_string());
+    APSARA_TEST_EQUAL(13U, events[1].Cast<LogEvent>().GetPosition().first);
+    APSARA_TEST_TRUE(ProcessQueueManager::GetInstance()->IsAllQueueEmpty());
+    APSARA_TEST_EQUAL(0, getCheckpointOffset());
+
+    // size limit exceeded, the pending group is pushed and the read starts a new one
+    writeLog(logPath, "the third log\n");
+    mHandlerPtr->Handle(event);
+    APSARA_TEST_FALSE(ProcessQueueManager::GetInstance()->IsAllQueueEmpty());
+    APSARA_TEST_EQUAL(1U, mReaderPtr->GetPendingEventGroup()->GetEvents().size());
+    APSARA_TEST_EQUAL(24, getCheckpointOffset());
+
+    // latency limit not reached
+    dispatcher->FlushPendingEventGroups();
+    APSARA_TEST_NOT_EQUAL(nullptr, mReaderPtr->GetPendingEventGroup());
+
+    // latency limit reached
+    mReaderPtr->mPendingEventGroupBeginTime = 0;
+    dispatcher->FlushPendingEventGroups();
+    APSARA_TEST_EQUAL(nullptr, mReaderPtr->GetPendingEventGroup());
+    APSARA_TEST_EQUAL(38, getCheckpointOffset());
+    dispatcher->mWdDirInfoMap.erase(0);
+
+    // the pending group is pushed before the reader is removed on timeout
+    writeLog(logPath, "the fourth log\n");
+    mHandlerPtr->Handle(event);
+    APSARA_TEST_NOT_EQUAL(nullptr, mReaderPtr->GetPendingEventGroup());
+    mReaderPtr->mLastUpdateTime = 0;
+    mHandlerPtr->HandleTimeOut();
+    APSARA_TEST_TRUE(mHandlerPtr->mDevInodeReaderMap.empty());
+    APSARA_TEST_EQUAL(nullptr, mReaderPtr->GetPendingEventGroup());
+    APSARA_TEST_EQUAL(53, getCheckpointOffset());
+
+    // disabled
+    INT32_FLAG(reader_coalesce_max_latency_ms) = 0;
+    writeLog(logPath, "the fifth log\n");
+    LogBuffer logbuf;
+    mReaderPtr->ReadLog(logbuf, &event);
+    mHandlerPtr->PushLogToProcessor(mReaderPtr, &logbuf);
+    APSARA_TEST_EQUAL(nullptr, mReaderPtr->GetPendingEventGroup());
+    INT32_FLAG(reader_coalesce_max_bytes) = 512 * 1024;
+}
+
 } // end of namespace logtail
 
 int main(int argc, char** argv) {
@@ -0,0 +1,143 @@
+// Copyright 2025 iLogtail Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <string>
+#include <vector>
+
+#include "file_server/ContainerInfoIndex.h"
+#include "unittest/Unittest.h"
+
+using namespace std;
+
+namespace logtail {
+
+class ContainerInfoIndexUnittest : public testing::Test {
+public:
+    void TestFindByPath();
+    void TestUpdate();
+    void TestDelete();
+    void TestBuild();
+
+private:
+    static ContainerInfo GenerateContainer(const string& id, const string& realBaseDir) {
+        ContainerInfo info;
+        info.mID = id;
+        info.mRealBaseDir = realBaseDir;
+        return info;
+    }
+
+    // positions in index should always be consistent with infos
+    static void CheckConsistency(const ContainerInfoIndex& index, const vector<ContainerInfo>& infos) {
+        APSARA_TEST_EQUAL(infos.size(), index.Size());
+        for (size_t i = 0; i < infos.size(); ++i) {
+            APSARA_TEST_EQUAL(static_cast<int64_t>(i), index.FindByID(infos[i].mID));
+            vector<size_t> res;
+            index.FindAllByPath(infos[i].mRealBaseDir, res);
+            APSARA_TEST_TRUE(find(res.begin(), res.end(), i) != res.end());
+        }
+    }
+};
+
+void ContainerInfoIndexUnittest::TestFindByPath() {
+    ContainerInfoIndex index;
+    vector<ContainerInfo> infos;
+    APSARA_TEST_EQUAL(-1, index.FindByPath("/logtail_host/a/b"));
+    APSARA_TEST_TRUE(index.AddOrUpdate(infos, GenerateContainer("1", "/logtail_host/var/lib/docker/1/merged/log")));
+    APSARA_TEST_TRUE(index.AddOrUpdate(infos, GenerateContainer("2", "/logtail_host/var/lib/docker/2/merged/log")));
+    APSARA_TEST_TRUE(index.AddOrUpdate(infos, GenerateContainer("3", "/logtail_host/var/lib/docker/1/merged")));
+
+    APSARA_TEST_EQUAL(1, index.FindByPath("/logtail_host/var/lib/docker/2/merged/log"));
+    APSARA_TEST_EQUAL(1, index.FindByPath("/logtail_host/var/lib/docker/2/merged/log/app"));
+    // sub path only
+    APSARA_TEST_EQUAL(-1, index.FindByPath("/logtail_host/var/lib/docker/2/merged/logs"));
+    APSARA_TEST_EQUAL(-1, index.FindByPath("/logtail_host/var/lib/docker/2/merged"));
+    APSARA_TEST_EQUAL(-1, index.FindByPath("/logtail_host/var/lib/docker"));
+    // the latest container is returned if more than one matches
+    APSARA_TEST_EQUAL(2, index.FindByPath("/logtail_host/var/lib/docker/1/merged/log/app"));
+    APSARA_TEST_EQUAL(2, index.FindByPath("/logtail_host/var/lib/docker/1/merged/logs"));
+    vector<size_t> res;
+    index.FindAllByPath("/logtail_host/var/lib/docker/1/merged/log/app", res);
+    APSARA_TEST_EQUAL(vector<size_t>({2, 0}), res);
+
+    // containers with the same real base dir
+    APSARA_TEST_TRUE(index.AddOrUpdate(infos, GenerateContainer("4", "/logtail_host/var/lib/docker/2/merged/log")));
+    APSARA_TEST_EQUAL(3, index.FindByPath("/logtail_host/var/lib/docker/2/merged/log/app"));
+    CheckConsistency(index, infos);
+}
+
+void ContainerInfoIndexUnittest::TestUpdate() {
+    ContainerInfoIndex index;
+    vector<ContainerInfo> infos;
+    index.AddOrUpdate(infos, GenerateContainer("1", "/host/1/log"));
+    index.AddOrUpdate(infos, GenerateContainer("2", "/host/2/log"));
+    auto info = GenerateContainer("1", "/host/1/log");
+    info.mStopped = true;
+    APSARA_TEST_FALSE(index.AddOrUpdate(infos, info));
+    APSARA_TEST_EQUAL(2U, infos.size());
+    APSARA_TEST_TRUE(infos[0].mStopped);
+
+    // real base dir changed
+    APSARA_TEST_FALSE(index.AddOrUpdate(infos, GenerateContainer("1", "/host/3/log")));
+    APSARA_TEST_EQUAL(-1, index.FindByPath("/host/1/log"));
+    APSARA_TEST_EQUAL(0, index.FindByPath("/host/3/log"));
+    // order of containers added is kept
+    index.AddOrUpdate(infos, GenerateContainer("3", "/host"));
+    APSARA_TEST_EQUAL(2, index.FindByPath("/host/3/log"));
+    CheckConsistency(index, infos);
+}
+
+void ContainerInfoIndexUnittest::TestDelete() {
+    ContainerInfoIndex index;
+    vector<ContainerInfo> infos;
+    for (size_t i = 0; i < 5; ++i) {
+        index.AddOrUpdate(infos, GenerateContainer(to_string(i), "/host/" + to_string(i) + "/log"));
+    }
+    APSARA_TEST_FALSE(index.Delete(infos, "unknown"));
+    // the last one is moved
+    APSARA_TEST_TRUE(index.Delete(infos, "1"));
+    APSARA_TEST_EQUAL(4U, infos.size());
+    APSARA_TEST_EQUAL("4", infos[1].mID);
+    APSARA_TEST_EQUAL(1, index.FindByPath("/host/4/log/a"));
+    APSARA_TEST_EQUAL(-1, index.FindByPath("/host/1/log/a"));
+    CheckConsistency(index, infos);
+
+    APSARA_TEST_TRUE(index.Delete(infos, "4"));
+    APSARA_TEST_TRUE(index.Delete(infos, "2"));
+    APSARA_TEST_TRUE(index.Delete(infos, "0"));
+    CheckConsistency(index, infos);
+    APSARA_TEST_TRUE(index.Delete(infos, "3"));
+    APSARA_TEST_TRUE(infos.empty());
+    // nodes are all pruned
+    APSARA_TEST_TRUE(index.mRoot.mChildren.empty());
+}
+
+void ContainerInfoIndexUnittest::TestBuild() {
+    vector<ContainerInfo> infos{GenerateContainer("1", "/host/1/log"), GenerateContainer("2", "/host/1")};
+    ContainerInfoIndex index;
+    index.AddOrUpdate(infos, GenerateContainer("3", "/host/3/log"));
+    index.Build(infos);
+    APSARA_TEST_EQUAL(3U, infos.size());
+    CheckConsistency(index, infos);
+    APSARA_TEST_EQUAL(2, index.FindByPath("/host/3/log"));
+    APSARA_TEST_EQUAL(1, index.FindByPath("/host/1/log"));
+}
+
+UNIT_TEST_CASE(ContainerInfoIndexUnittest, TestFindByPath)
+UNIT_TEST_CASE(ContainerInfoIndexUnittest, TestUpdate)
+UNIT_TEST_CASE(ContainerInfoIndexUnittest, TestDelete)
+UNIT_TEST_CASE(ContainerInfoIndexUnittest, TestBuild)
+
+} // namespace logtail
+
+UNIT_TEST_MAIN
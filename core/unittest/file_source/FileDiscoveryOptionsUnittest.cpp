@@ -32,6 +32,7 @@ public:
     void OnSuccessfulInit() const;
     void OnFailedInit() const;
     void TestFilePaths() const;
+    void TestContainerInfo() const;
 
 private:
     const string pluginType = "test";
@@ -282,9 +283,61 @@ void FileDiscoveryOptionsUnittest::TestFilePaths() const {
     APSARA_TEST_EQUAL("*.log", config->GetFilePattern());
 }
 
+void FileDiscoveryOptionsUnittest::TestContainerInfo() const {
+    FileDiscoveryOptions config;
+    config.SetEnableContainerDiscoveryFlag(true);
+    config.SetDeduceAndSetContainerBaseDirFunc(
+        [](ContainerInfo& info, const CollectionPipelineContext*, const FileDiscoveryOptions*) {
+            info.mRealBaseDir = "/logtail_host" + info.mUpperDir;
+            return true;
+        });
+    config.SetContainerInfo(make_shared<vector<ContainerInfo>>());
+    Json::Value paramsJson;
+    string errorMsg;
+
+    // add
+    for (const auto& id : {"1", "2", "3"}) {
+        APSARA_TEST_TRUE(ParseJsonTable(
+            string(R"({"ID": ")") + id + R"(", "UpperDir": "/upper/)" + id + R"("})", paramsJson, errorMsg));
+        APSARA_TEST_FALSE(config.IsSameContainerInfo(paramsJson, &ctx));
+        APSARA_TEST_TRUE(config.UpdateContainerInfo(paramsJson, &ctx));
+        APSARA_TEST_TRUE(config.IsSameContainerInfo(paramsJson, &ctx));
+    }
+    APSARA_TEST_EQUAL(3U, config.GetContainerInfo()->size());
+    APSARA_TEST_EQUAL("2", config.GetContainerPathByLogPath("/logtail_host/upper/2/log")->mID);
+    APSARA_TEST_EQUAL(nullptr, config.GetContainerPathByLogPath("/logtail_host/upper/4/log"));
+    APSARA_TEST_EQUAL("/logtail_host/upper/3", config.GetContainerInfoByID("3")->mRealBaseDir);
+
+    // delete
+    APSARA_TEST_TRUE(ParseJsonTable(R"({"ID": "1"})", paramsJson, errorMsg));
+    APSARA_TEST_TRUE(config.DeleteContainerInfo(paramsJson));
+    APSARA_TEST_EQUAL(2U, config.GetContainerInfo()->size());
+    APSARA_TEST_EQUAL(nullptr, config.GetContainerPathByLogPath("/logtail_host/upper/1/log"));
+    APSARA_TEST_EQUAL("3", config.GetContainerPathByLogPath("/logtail_host/upper/3/log")->mID);
+
+    // all
+    APSARA_TEST_TRUE(ParseJsonTable(
+        R"({"AllCmd": [{"ID": "2", "UpperDir": "/upper/2"}, {"ID": "4", "UpperDir": "/upper/4"}]})",
+        paramsJson,
+        errorMsg));
+    APSARA_TEST_FALSE(config.IsSameContainerInfo(paramsJson, &ctx));
+    APSARA_TEST_TRUE(config.UpdateContainerInfo(paramsJson, &ctx));
+    APSARA_TEST_TRUE(config.IsSameContainerInfo(paramsJson, &ctx));
+    APSARA_TEST_EQUAL(2U, config.GetContainerInfo()->size());
+    APSARA_TEST_EQUAL(nullptr, config.GetContainerInfoByID("3"));
+    APSARA_TEST_EQUAL("2", config.GetContainerPathByLogPath("/logtail_host/upper/2/log")->mID);
+    APSARA_TEST_EQUAL("4", config.GetContainerPathByLogPath("/logtail_host/upper/4/log")->mID);
+
+    // index is rebuilt when container info is carried over
+    FileDiscoveryOptions newConfig;
+    newConfig.SetContainerInfo(config.GetContainerInfo());
+    APSARA_TEST_EQUAL("4", newConfig.GetContainerPathByLogPath("/logtail_host/upper/4/log")->mID);
+}
+
 UNIT_TEST_CASE(FileDiscoveryOptionsUnittest, OnSuccessfulInit)
 UNIT_TEST_CASE(FileDiscoveryOptionsUnittest, OnFailedInit)
 UNIT_TEST_CASE(FileDiscoveryOptionsUnittest, TestFilePaths)
+UNIT_TEST_CASE(FileDiscoveryOptionsUnittest, TestContainerInfo)
 
 } // namespace logtail
 
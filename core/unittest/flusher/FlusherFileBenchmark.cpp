@@ -0,0 +1,196 @@
+// Copyright 2025 iLogtail Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <cstdio>
+
+#include <chrono>
+#include <filesystem>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "json/json.h"
+#include "spdlog/async.h"
+#include "spdlog/sinks/rotating_file_sink.h"
+
+#include "collection_pipeline/serializer/JsonSerializer.h"
+#include "plugin/flusher/file/FlusherFile.h"
+#include "plugin/flusher/file/RotatingFileWriter.h"
+
+using namespace std;
+
+namespace logtail {
+
+// Compare serializing log groups of 1k events with 10 contents each by Json::Value and Json::writeString per event as
+// before and by the streaming serializer, and writing the results to a file through the async spdlog logger as before
+// and through RotatingFileWriter.
+class FlusherFileBenchmark {
+public:
+    FlusherFileBenchmark(size_t groupCnt, size_t eventCnt) : mGroupCnt(groupCnt), mEventCnt(eventCnt) {}
+
+    void SetUp();
+    void TearDown();
+    void TestJsonValueSerializer();
+    void TestStreamingSerializer();
+    void TestSpdlogWriter();
+    void TestDirectWriter();
+
+private:
+    BatchedEvents CreateBatchedEvents() const;
+    void PrintResult(const char* name, chrono::steady_clock::duration cost, size_t bytes) const;
+
+    size_t mGroupCnt;
+    size_t mEventCnt;
+    CollectionPipelineContext mCtx;
+    unique_ptr<FlusherFile> mFlusher;
+    vector<string> mSerialized;
+    filesystem::path mDir;
+};
+
+void FlusherFileBenchmark::SetUp() {
+    mCtx.SetConfigName("test_config");
+    mFlusher = make_unique<FlusherFile>();
+    mFlusher->SetContext(mCtx);
+    mFlusher->SetMetricsRecordRef(FlusherFile::sName, "1");
+    mDir = filesystem::temp_directory_path() / "flusher_file_benchmark";
+    filesystem::remove_all(mDir);
+    filesystem::create_directories(mDir);
+}
+
+void FlusherFileBenchmark::TearDown() {
+    filesystem::remove_all(mDir);
+}
+
+BatchedEvents FlusherFileBenchmark::CreateBatchedEvents() const {
+    PipelineEventGroup group(make_shared<SourceBuffer>());
+    group.SetTag(string("__hostname__"), string("test-host"));
+    group.SetTag(string("__path__"), string("/var/log/app/test.log"));
+    for (size_t i = 0; i < mEventCnt; ++i) {
+        auto e = group.AddLogEvent();
+        e->SetTimestamp(1234567890);
+        for (size_t j = 0; j < 10; ++j) {
+            e->SetContent("key_" + to_string(j), "value \"" + to_string(i) + "\" of content\t" + to_string(j));
+        }
+    }
+    BatchedEvents batch(std::move(group.MutableEvents()),
+                        std::move(group.GetSizedTags()),
+                        std::move(group.GetSourceBuffer()),
+                        group.GetMetadata(EventGroupMetaKey::SOURCE_ID),
+                        std::move(group.GetExactlyOnceCheckpoint()));
+    return batch;
+}
+
+void FlusherFileBenchmark::PrintResult(const char* name, chrono::steady_clock::duration cost, size_t bytes) const {
+    auto ms = chrono::duration_cast<chrono::milliseconds>(cost).count();
+    printf("%s: groups %lu, events %lu, bytes %lu, cost %ldms, %.1fMB/s\n",
+           name,
+           mGroupCnt,
+           mGroupCnt * mEventCnt,
+           bytes,
+           ms,
+           ms == 0 ? 0.0 : bytes / 1024.0 / 1024.0 * 1000 / ms);
+}
+
+void FlusherFileBenchmark::TestJsonValueSerializer() {
+    vector<BatchedEvents> groups;
+    for (size_t i = 0; i < mGroupCnt; ++i) {
+        groups.push_back(CreateBatchedEvents());
+    }
+    size_t bytes = 0;
+    auto before = chrono::steady_clock::now();
+    for (auto& group : groups) {
+        Json::Value groupTags;
+        for (const auto& tag : group.mTags.mInner) {
+            groupTags[tag.first.to_string()] = tag.second.to_string();
+        }
+        ostringstream oss;
+        for (const auto& item : group.mEvents) {
+            const auto& e = item.Cast<LogEvent>();
+            Json::Value eventJson;
+            eventJson.copy(groupTags);
+            eventJson["__time__"] = e.GetTimestamp();
+            for (const auto& kv : e) {
+                eventJson[kv.first.to_string()] = kv.second.to_string();
+            }
+            Json::StreamWriterBuilder writer;
+            writer["indentation"] = "";
+            oss << Json::writeString(writer, eventJson) << endl;
+        }
+        bytes += oss.str().size();
+    }
+    PrintResult("json value serializer", chrono::steady_clock::now() - before, bytes);
+}
+
+void FlusherFileBenchmark::TestStreamingSerializer() {
+    vector<BatchedEvents> groups;
+    for (size_t i = 0; i < mGroupCnt; ++i) {
+        groups.push_back(CreateBatchedEvents());
+    }
+    JsonEventGroupSerializer serializer(mFlusher.get());
+    mSerialized.clear();
+    size_t bytes = 0;
+    auto before = chrono::steady_clock::now();
+    for (auto& group : groups) {
+        string res, errorMsg;
+        serializer.DoSerialize(std::move(group), res, errorMsg);
+        bytes += res.size();
+        mSerialized.push_back(std::move(res));
+    }
+    PrintResult("streaming serializer", chrono::steady_clock::now() - before, bytes);
+}
+
+void FlusherFileBenchmark::TestSpdlogWriter() {
+    auto threadPool = make_shared<spdlog::details::thread_pool>(8192, 1);
+    auto sink = make_shared<spdlog::sinks::rotating_file_sink_mt>(
+        (mDir / "spdlog.log").string(), 1024 * 1024 * 10, 10, true);
+    auto logger = make_shared<spdlog::async_logger>(
+        "flusher_file_benchmark", sink, threadPool, spdlog::async_overflow_policy::block);
+    logger->set_pattern("%v");
+    size_t bytes = 0;
+    auto before = chrono::steady_clock::now();
+    for (const auto& data : mSerialized) {
+        logger->info(data);
+        logger->flush();
+        bytes += data.size();
+    }
+    // all queued messages are written before the thread pool is destructed
+    logger.reset();
+    threadPool.reset();
+    PrintResult("spdlog writer", chrono::steady_clock::now() - before, bytes);
+}
+
+void FlusherFileBenchmark::TestDirectWriter() {
+    RotatingFileWriter writer((mDir / "direct.log").string(), 1024 * 1024 * 10, 10);
+    writer.Open();
+    size_t bytes = 0;
+    auto before = chrono::steady_clock::now();
+    for (const auto& data : mSerialized) {
+        writer.Write(data.data(), data.size());
+        bytes += data.size();
+    }
+    PrintResult("direct writer", chrono::steady_clock::now() - before, bytes);
+}
+
+} // namespace logtail
+
+int main(int argc, char* argv[]) {
+    logtail::FlusherFileBenchmark benchmark(200, 1000);
+    benchmark.SetUp();
+    benchmark.TestJsonValueSerializer();
+    benchmark.TestStreamingSerializer();
+    benchmark.TestSpdlogWriter();
+    benchmark.TestDirectWriter();
+    benchmark.TearDown();
+    return 0;
+}
@@ -0,0 +1,133 @@
+// Copyright 2025 iLogtail Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <filesystem>
+
+#include "collection_pipeline/queue/QueueKeyManager.h"
+#include "collection_pipeline/queue/SenderQueueManager.h"
+#include "common/FileSystemUtil.h"
+#include "common/JsonUtil.h"
+#include "plugin/flusher/file/FlusherFile.h"
+#include "unittest/Unittest.h"
+
+using namespace std;
+
+namespace logtail {
+
+class FlusherFileUnittest : public testing::Test {
+public:
+    void TestRotatedFilePath();
+    void TestRotatingFileWriter();
+    void TestDirectWrite();
+
+protected:
+    void SetUp() override {
+        ctx.SetConfigName("test_config");
+        mDir = filesystem::temp_directory_path() / "flusher_file_unittest";
+        filesystem::remove_all(mDir);
+        filesystem::create_directories(mDir);
+    }
+
+    void TearDown() override {
+        QueueKeyManager::GetInstance()->Clear();
+        SenderQueueManager::GetInstance()->Clear();
+        filesystem::remove_all(mDir);
+    }
+
+private:
+    CollectionPipelineContext ctx;
+    filesystem::path mDir;
+};
+
+void FlusherFileUnittest::TestRotatedFilePath() {
+    APSARA_TEST_EQUAL("/tmp/a.log", RotatingFileWriter::GetRotatedFilePath("/tmp/a.log", 0));
+    APSARA_TEST_EQUAL("/tmp/a.1.log", RotatingFileWriter::GetRotatedFilePath("/tmp/a.log", 1));
+    APSARA_TEST_EQUAL("/tmp/a.2", RotatingFileWriter::GetRotatedFilePath("/tmp/a", 2));
+    APSARA_TEST_EQUAL("/tmp/.a.1", RotatingFileWriter::GetRotatedFilePath("/tmp/.a", 1));
+    APSARA_TEST_EQUAL("/tmp.d/a.1", RotatingFileWriter::GetRotatedFilePath("/tmp.d/a", 1));
+}
+
+void FlusherFileUnittest::TestRotatingFileWriter() {
+    string path = (mDir / "test.log").string();
+    RotatingFileWriter writer(path, 10, 2);
+    APSARA_TEST_TRUE(writer.Open());
+    APSARA_TEST_TRUE(writer.Write("01234", 5));
+    APSARA_TEST_TRUE(writer.Write("56789", 5));
+    // rotated before written
+    APSARA_TEST_TRUE(writer.Write("abc", 3));
+    APSARA_TEST_TRUE(writer.Write("defghijklmn", 11));
+    APSARA_TEST_TRUE(writer.Write("o", 1));
+
+    string content;
+    APSARA_TEST_TRUE(ReadFile(path, content));
+    APSARA_TEST_EQUAL("o", content);
+    APSARA_TEST_TRUE(ReadFile((mDir / "test.1.log").string(), content));
+    APSARA_TEST_EQUAL("defghijklmn", content);
+    APSARA_TEST_TRUE(ReadFile((mDir / "test.2.log").string(), content));
+    APSARA_TEST_EQUAL("abc", content);
+    APSARA_TEST_FALSE(filesystem::exists(mDir / "test.3.log"));
+
+    // existing file is appended
+    RotatingFileWriter writer2(path, 10, 2);
+    APSARA_TEST_TRUE(writer2.Open());
+    APSARA_TEST_EQUAL(1U, writer2.mFileSize);
+    APSARA_TEST_TRUE(writer2.Write("p", 1));
+    APSARA_TEST_TRUE(ReadFile(path, content));
+    APSARA_TEST_EQUAL("op", content);
+}
+
+void FlusherFileUnittest::TestDirectWrite() {
+    string path = (mDir / "test.log").string();
+    Json::Value configJson, optionalGoPipeline;
+    configJson["Type"] = "flusher_file";
+    configJson["FilePath"] = path;
+    configJson["EnableDirectWrite"] = true;
+    FlusherFile flusher;
+    flusher.SetContext(ctx);
+    flusher.SetMetricsRecordRef(FlusherFile::sName, "1");
+    APSARA_TEST_TRUE(flusher.Init(configJson, optionalGoPipeline));
+    APSARA_TEST_NOT_EQUAL(nullptr, flusher.mDirectWriter);
+    APSARA_TEST_EQUAL(nullptr, flusher.mFileWriter);
+
+    PipelineEventGroup group(make_shared<SourceBuffer>());
+    group.SetTag(string("tag"), string("value"));
+    for (size_t i = 0; i < 2; ++i) {
+        auto e = group.AddLogEvent();
+        e->SetContent(string("key"), to_string(i));
+        e->SetTimestamp(1234567890);
+    }
+    APSARA_TEST_TRUE(flusher.Send(std::move(group)));
+    APSARA_TEST_TRUE(flusher.FlushAll());
+
+    string content;
+    APSARA_TEST_TRUE(ReadFile(path, content));
+    APSARA_TEST_EQUAL("{\"tag\":\"value\",\"__time__\":1234567890,\"key\":\"0\"}\n"
+                      "{\"tag\":\"value\",\"__time__\":1234567890,\"key\":\"1\"}\n",
+                      content);
+
+    // file cannot be opened
+    configJson["FilePath"] = (mDir / "not_exist" / "test.log").string();
+    FlusherFile flusher2;
+    flusher2.SetContext(ctx);
+    flusher2.SetMetricsRecordRef(FlusherFile::sName, "2");
+    APSARA_TEST_FALSE(flusher2.Init(configJson, optionalGoPipeline));
+}
+
+UNIT_TEST_CASE(FlusherFileUnittest, TestRotatedFilePath)
+UNIT_TEST_CASE(FlusherFileUnittest, TestRotatingFileWriter)
+UNIT_TEST_CASE(FlusherFileUnittest, TestDirectWrite)
+
+} // namespace logtail
+
+UNIT_TEST_MAIN
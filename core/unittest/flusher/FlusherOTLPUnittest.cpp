@@ -0,0 +1,320 @@
+// Copyright 2025 iLogtail Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "json/json.h"
+
+#include "collection_pipeline/CollectionPipeline.h"
+#include "collection_pipeline/CollectionPipelineContext.h"
+#include "collection_pipeline/queue/QueueKeyManager.h"
+#include "collection_pipeline/queue/SenderQueueManager.h"
+#include "common/JsonUtil.h"
+#include "common/StringTools.h"
+#include "common/compression/GzipCompressor.h"
+#include "common/http/Curl.h"
+#include "plugin/flusher/otlp/FlusherOTLP.h"
+#include "unittest/Unittest.h"
+#include "unittest/flusher/StubHttpServer.h"
+
+DECLARE_FLAG_INT32(discard_send_fail_interval);
+
+using namespace std;
+
+namespace logtail {
+
+class FlusherOTLPUnittest : public testing::Test {
+public:
+    void OnSuccessfulInit();
+    void OnFailedInit();
+    void TestSend();
+    void TestRetry();
+    void TestDiscard();
+
+protected:
+    void SetUp() override {
+        ctx.SetConfigName("test_config");
+        ctx.SetPipeline(pipeline);
+        APSARA_TEST_TRUE(mServer.Start());
+    }
+
+    void TearDown() override {
+        mServer.Stop();
+        QueueKeyManager::GetInstance()->Clear();
+        SenderQueueManager::GetInstance()->Clear();
+    }
+
+private:
+    unique_ptr<FlusherOTLP> CreateFlusher() {
+        Json::Value configJson, optionalGoPipeline;
+        configJson["Type"] = FlusherOTLP::sName;
+        configJson["Endpoint"] = "http://127.0.0.1:" + ToString(mServer.GetPort()) + "/otlp";
+        configJson["Headers"]["X-Scope-OrgID"] = "tenant";
+        auto flusher = make_unique<FlusherOTLP>();
+        flusher->SetContext(ctx);
+        flusher->SetMetricsRecordRef(FlusherOTLP::sName, "1");
+        APSARA_TEST_TRUE(flusher->Init(configJson, optionalGoPipeline));
+        return flusher;
+    }
+
+    vector<SenderQueueItem*> SendGroups(FlusherOTLP& flusher, vector<PipelineEventGroup>&& groups) {
+        for (auto& group : groups) {
+            APSARA_TEST_TRUE(flusher.Send(std::move(group)));
+        }
+        APSARA_TEST_TRUE(flusher.FlushAll());
+
+        vector<SenderQueueItem*> items;
+        SenderQueueManager::GetInstance()->GetAvailableItems(items, 80);
+        return items;
+    }
+
+    SenderQueueItem* SendOneGroup(FlusherOTLP& flusher) {
+        vector<PipelineEventGroup> groups;
+        groups.emplace_back(CreateLogGroup());
+        auto items = SendGroups(flusher, std::move(groups));
+        APSARA_TEST_EQUAL(1U, items.size());
+        return items.empty() ? nullptr : items[0];
+    }
+
+    void DoSend(FlusherOTLP& flusher, SenderQueueItem* item) {
+        unique_ptr<HttpSinkRequest> req;
+        bool keepItem = false;
+        string errMsg;
+        APSARA_TEST_TRUE(flusher.BuildRequest(item, req, &keepItem, &errMsg));
+        HttpResponse response;
+        SendHttpRequest(unique_ptr<HttpRequest>(req.release()), response);
+        flusher.OnSendDone(response, item);
+    }
+
+    static PipelineEventGroup CreateLogGroup() {
+        PipelineEventGroup group(make_shared<SourceBuffer>());
+        group.SetTag(string("host.name"), string("host_1"));
+        auto e = group.AddLogEvent();
+        e->SetTimestamp(1700000000);
+        e->SetContent(string("content"), string("hello"));
+        return group;
+    }
+
+    CollectionPipeline pipeline;
+    CollectionPipelineContext ctx;
+    StubHttpServer mServer;
+};
+
+void FlusherOTLPUnittest::OnSuccessfulInit() {
+    unique_ptr<FlusherOTLP> flusher;
+    Json::Value configJson, optionalGoPipeline;
+    string configStr, errorMsg;
+
+    configStr = R"(
+        {
+            "Type": "flusher_otlp",
+            "Endpoint": "https://otlp.example.com/otlp/",
+            "Headers": {
+                "Authorization": "Bearer token"
+            },
+            "Batch": {
+                "MinCnt": 100
+            },
+            "CompressType": "zstd"
+        }
+    )";
+    APSARA_TEST_TRUE(ParseJsonTable(configStr, configJson, errorMsg));
+    flusher.reset(new FlusherOTLP());
+    flusher->SetContext(ctx);
+    flusher->SetMetricsRecordRef(FlusherOTLP::sName, "1");
+    APSARA_TEST_TRUE(flusher->Init(configJson, optionalGoPipeline));
+    APSARA_TEST_TRUE(optionalGoPipeline.isNull());
+    APSARA_TEST_TRUE(flusher->mHTTPSFlag);
+    APSARA_TEST_EQUAL("otlp.example.com", flusher->mHost);
+    APSARA_TEST_EQUAL(443, flusher->mPort);
+    APSARA_TEST_EQUAL("/otlp/v1/logs", flusher->mPaths[static_cast<size_t>(OTLPSignal::LOGS)]);
+    APSARA_TEST_EQUAL("/otlp/v1/metrics", flusher->mPaths[static_cast<size_t>(OTLPSignal::METRICS)]);
+    APSARA_TEST_EQUAL("/otlp/v1/traces", flusher->mPaths[static_cast<size_t>(OTLPSignal::TRACES)]);
+    APSARA_TEST_EQUAL("Bearer token", flusher->mHeaders["Authorization"]);
+    APSARA_TEST_EQUAL(100U, flusher->mBatcher.GetEventFlushStrategy().GetMinCnt());
+    APSARA_TEST_TRUE(flusher->mBatcher.GetGroupFlushStrategy().has_value());
+    APSARA_TEST_EQUAL(CompressType::ZSTD, flusher->mCompressor->GetCompressType());
+    APSARA_TEST_NOT_EQUAL(nullptr, SenderQueueManager::GetInstance()->GetQueue(flusher->GetQueueKey()));
+
+    // flushers to the same host share the concurrency limiter
+    configJson["Endpoint"] = "https://otlp.example.com:443";
+    unique_ptr<FlusherOTLP> flusher2(new FlusherOTLP());
+    flusher2->SetContext(ctx);
+    flusher2->SetMetricsRecordRef(FlusherOTLP::sName, "2");
+    APSARA_TEST_TRUE(flusher2->Init(configJson, optionalGoPipeline));
+    APSARA_TEST_EQUAL(flusher->mEndpointConcurrencyLimiter, flusher2->mEndpointConcurrencyLimiter);
+    APSARA_TEST_EQUAL("/v1/logs", flusher2->mPaths[static_cast<size_t>(OTLPSignal::LOGS)]);
+
+    // invalid optional param
+    configStr = R"(
+        {
+            "Type": "flusher_otlp",
+            "Endpoint": "http://127.0.0.1:4318",
+            "Headers": true,
+            "Batch": "invalid",
+            "CompressType": "lz4"
+        }
+    )";
+    APSARA_TEST_TRUE(ParseJsonTable(configStr, configJson, errorMsg));
+    flusher.reset(new FlusherOTLP());
+    flusher->SetContext(ctx);
+    flusher->SetMetricsRecordRef(FlusherOTLP::sName, "3");
+    APSARA_TEST_TRUE(flusher->Init(configJson, optionalGoPipeline));
+    APSARA_TEST_FALSE(flusher->mHTTPSFlag);
+    APSARA_TEST_EQUAL(4318, flusher->mPort);
+    APSARA_TEST_TRUE(flusher->mHeaders.empty());
+    APSARA_TEST_EQUAL(CompressType::GZIP, flusher->mCompressor->GetCompressType());
+
+    // no compression
+    configJson["CompressType"] = "none";
+    flusher.reset(new FlusherOTLP());
+    flusher->SetContext(ctx);
+    flusher->SetMetricsRecordRef(FlusherOTLP::sName, "4");
+    APSARA_TEST_TRUE(flusher->Init(configJson, optionalGoPipeline));
+    APSARA_TEST_EQUAL(nullptr, flusher->mCompressor);
+}
+
+void FlusherOTLPUnittest::OnFailedInit() {
+    Json::Value configJson, optionalGoPipeline;
+    for (const auto& endpoint : {"", "127.0.0.1:4318", "grpc://127.0.0.1", "http://:4318"}) {
+        configJson["Endpoint"] = endpoint;
+        FlusherOTLP flusher;
+        flusher.SetContext(ctx);
+        flusher.SetMetricsRecordRef(FlusherOTLP::sName, "1");
+        APSARA_TEST_FALSE(flusher.Init(configJson, optionalGoPipeline));
+    }
+    configJson.removeMember("Endpoint");
+    FlusherOTLP flusher;
+    flusher.SetContext(ctx);
+    flusher.SetMetricsRecordRef(FlusherOTLP::sName, "1");
+    APSARA_TEST_FALSE(flusher.Init(configJson, optionalGoPipeline));
+}
+
+void FlusherOTLPUnittest::TestSend() {
+    auto flusher = CreateFlusher();
+    vector<PipelineEventGroup> groups;
+    groups.emplace_back(CreateLogGroup());
+    {
+        PipelineEventGroup group(make_shared<SourceBuffer>());
+        auto e = group.AddSpanEvent();
+        e->SetTraceId("0102030405060708090a0b0c0d0e0f10");
+        e->SetSpanId("a1a2a3a4a5a6a7a8");
+        e->SetName("span_name");
+        groups.emplace_back(std::move(group));
+    }
+    // events of different signals are sent in different requests
+    auto items = SendGroups(*flusher, std::move(groups));
+    APSARA_TEST_EQUAL(2U, items.size());
+
+    vector<string> paths, bodies;
+    for (auto* item : items) {
+        DoSend(*flusher, item);
+        APSARA_TEST_EQUAL("gzip", mServer.GetHeader("Content-Encoding"));
+        APSARA_TEST_EQUAL("application/x-protobuf", mServer.GetHeader("Content-Type"));
+        APSARA_TEST_EQUAL("tenant", mServer.GetHeader("X-Scope-OrgID"));
+        paths.emplace_back(mServer.GetPath());
+        GzipCompressor compressor(CompressType::GZIP);
+        string raw, errorMsg;
+        APSARA_TEST_TRUE(compressor.UnCompress(mServer.GetBody(), raw, errorMsg));
+        bodies.emplace_back(std::move(raw));
+    }
+    APSARA_TEST_EQUAL(2, mServer.GetRequestCnt());
+    if (paths.size() == 2 && paths[0] != "/otlp/v1/logs") {
+        swap(paths[0], paths[1]);
+        swap(bodies[0], bodies[1]);
+    }
+    APSARA_TEST_EQUAL("/otlp/v1/logs", paths[0]);
+    APSARA_TEST_NOT_EQUAL(string::npos, bodies[0].find("host_1"));
+    APSARA_TEST_NOT_EQUAL(string::npos, bodies[0].find("hello"));
+    APSARA_TEST_EQUAL("/otlp/v1/traces", paths[1]);
+    APSARA_TEST_NOT_EQUAL(string::npos, bodies[1].find("span_name"));
+
+    APSARA_TEST_EQUAL(2U, flusher->mSuccessCnt->GetValue());
+    APSARA_TEST_TRUE(SenderQueueManager::GetInstance()->IsAllQueueEmpty());
+}
+
+void FlusherOTLPUnittest::TestRetry() {
+    auto flusher = CreateFlusher();
+    auto item = SendOneGroup(*flusher);
+    APSARA_TEST_NOT_EQUAL(nullptr, item);
+
+    // server busy
+    mServer.SetStatusCode(503);
+    DoSend(*flusher, item);
+    APSARA_TEST_EQUAL(1U, flusher->mServerErrorCnt->GetValue());
+    APSARA_TEST_EQUAL(SendingStatus::IDLE, item->mStatus.load());
+    APSARA_TEST_EQUAL(2U, item->mTryCnt);
+
+    // too many requests
+    mServer.SetStatusCode(429);
+    DoSend(*flusher, item);
+    APSARA_TEST_EQUAL(2U, flusher->mServerErrorCnt->GetValue());
+    APSARA_TEST_EQUAL(3U, item->mTryCnt);
+
+    // network error
+    mServer.Stop();
+    DoSend(*flusher, item);
+    APSARA_TEST_EQUAL(1U, flusher->mNetworkErrorCnt->GetValue());
+    APSARA_TEST_EQUAL(4U, item->mTryCnt);
+    APSARA_TEST_FALSE(SenderQueueManager::GetInstance()->IsAllQueueEmpty());
+
+    // retried for too long
+    INT32_FLAG(discard_send_fail_interval) = 0;
+    item->mFirstEnqueTime -= chrono::seconds(1);
+    DoSend(*flusher, item);
+    APSARA_TEST_EQUAL(1U, flusher->mDiscardCnt->GetValue());
+    APSARA_TEST_TRUE(SenderQueueManager::GetInstance()->IsAllQueueEmpty());
+    INT32_FLAG(discard_send_fail_interval) = 6 * 3600;
+}
+
+void FlusherOTLPUnittest::TestDiscard() {
+    auto flusher = CreateFlusher();
+    {
+        mServer.SetStatusCode(400);
+        auto item = SendOneGroup(*flusher);
+        DoSend(*flusher, item);
+        APSARA_TEST_EQUAL(1U, flusher->mParamsErrorCnt->GetValue());
+        APSARA_TEST_EQUAL(1U, flusher->mDiscardCnt->GetValue());
+        APSARA_TEST_TRUE(SenderQueueManager::GetInstance()->IsAllQueueEmpty());
+    }
+    {
+        mServer.SetStatusCode(403);
+        auto item = SendOneGroup(*flusher);
+        DoSend(*flusher, item);
+        APSARA_TEST_EQUAL(1U, flusher->mUnauthErrorCnt->GetValue());
+        APSARA_TEST_EQUAL(2U, flusher->mDiscardCnt->GetValue());
+        APSARA_TEST_TRUE(SenderQueueManager::GetInstance()->IsAllQueueEmpty());
+    }
+    {
+        // not retryable in otlp/http
+        mServer.SetStatusCode(500);
+        auto item = SendOneGroup(*flusher);
+        DoSend(*flusher, item);
+        APSARA_TEST_EQUAL(1U, flusher->mServerErrorCnt->GetValue());
+        APSARA_TEST_EQUAL(3U, flusher->mDiscardCnt->GetValue());
+        APSARA_TEST_TRUE(SenderQueueManager::GetInstance()->IsAllQueueEmpty());
+    }
+}
+
+UNIT_TEST_CASE(FlusherOTLPUnittest, OnSuccessfulInit)
+UNIT_TEST_CASE(FlusherOTLPUnittest, OnFailedInit)
+UNIT_TEST_CASE(FlusherOTLPUnittest, TestSend)
+UNIT_TEST_CASE(FlusherOTLPUnittest, TestRetry)
+UNIT_TEST_CASE(FlusherOTLPUnittest, TestDiscard)
+
+} // namespace logtail
+
+UNIT_TEST_MAIN
@@ -0,0 +1,268 @@
+// Copyright 2025 iLogtail Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <memory>
+#include <string>
+
+#include "json/json.h"
+
+#include "collection_pipeline/CollectionPipeline.h"
+#include "collection_pipeline/CollectionPipelineContext.h"
+#include "collection_pipeline/queue/QueueKeyManager.h"
+#include "collection_pipeline/queue/SenderQueueManager.h"
+#include "common/JsonUtil.h"
+#include "common/StringTools.h"
+#include "common/compression/SnappyCompressor.h"
+#include "common/http/Curl.h"
+#include "plugin/flusher/prometheus/FlusherPrometheusRemoteWrite.h"
+#include "unittest/Unittest.h"
+#include "unittest/flusher/StubHttpServer.h"
+
+DECLARE_FLAG_INT32(discard_send_fail_interval);
+
+using namespace std;
+
+namespace logtail {
+
+class FlusherPrometheusRemoteWriteUnittest : public testing::Test {
+public:
+    void OnSuccessfulInit();
+    void OnFailedInit();
+    void TestSend();
+    void TestRetry();
+    void TestDiscard();
+
+protected:
+    void SetUp() override {
+        ctx.SetConfigName("test_config");
+        ctx.SetPipeline(pipeline);
+        APSARA_TEST_TRUE(mServer.Start());
+    }
+
+    void TearDown() override {
+        mServer.Stop();
+        QueueKeyManager::GetInstance()->Clear();
+        SenderQueueManager::GetInstance()->Clear();
+    }
+
+private:
+    unique_ptr<FlusherPrometheusRemoteWrite> CreateFlusher() {
+        Json::Value configJson, optionalGoPipeline;
+        configJson["Type"] = FlusherPrometheusRemoteWrite::sName;
+        configJson["Endpoint"] = "http://127.0.0.1:" + ToString(mServer.GetPort()) + "/api/v1/write";
+        configJson["Headers"]["X-Scope-OrgID"] = "tenant";
+        auto flusher = make_unique<FlusherPrometheusRemoteWrite>();
+        flusher->SetContext(ctx);
+        flusher->SetMetricsRecordRef(FlusherPrometheusRemoteWrite::sName, "1");
+        APSARA_TEST_TRUE(flusher->Init(configJson, optionalGoPipeline));
+        return flusher;
+    }
+
+    SenderQueueItem* SendOneGroup(FlusherPrometheusRemoteWrite& flusher) {
+        PipelineEventGroup group(make_shared<SourceBuffer>());
+        group.SetTag(string("instance"), string("127.0.0.1:9100"));
+        auto e = group.AddMetricEvent();
+        e->SetName("up");
+        e->SetTimestamp(1700000000);
+        e->SetValue<UntypedSingleValue>(1.0);
+        APSARA_TEST_TRUE(flusher.Send(std::move(group)));
+        APSARA_TEST_TRUE(flusher.FlushAll());
+
+        vector<SenderQueueItem*> items;
+        SenderQueueManager::GetInstance()->GetAvailableItems(items, 80);
+        APSARA_TEST_EQUAL(1U, items.size());
+        return items.empty() ? nullptr : items[0];
+    }
+
+    void DoSend(FlusherPrometheusRemoteWrite& flusher, SenderQueueItem* item) {
+        unique_ptr<HttpSinkRequest> req;
+        bool keepItem = false;
+        string errMsg;
+        APSARA_TEST_TRUE(flusher.BuildRequest(item, req, &keepItem, &errMsg));
+        HttpResponse response;
+        SendHttpRequest(unique_ptr<HttpRequest>(req.release()), response);
+        flusher.OnSendDone(response, item);
+    }
+
+    CollectionPipeline pipeline;
+    CollectionPipelineContext ctx;
+    StubHttpServer mServer;
+};
+
+void FlusherPrometheusRemoteWriteUnittest::OnSuccessfulInit() {
+    unique_ptr<FlusherPrometheusRemoteWrite> flusher;
+    Json::Value configJson, optionalGoPipeline;
+    string configStr, errorMsg;
+
+    configStr = R"(
+        {
+            "Type": "flusher_prometheus_remote_write",
+            "Endpoint": "https://remote.example.com/api/v1/write",
+            "Headers": {
+                "Authorization": "Bearer token"
+            },
+            "Batch": {
+                "MinCnt": 100
+            }
+        }
+    )";
+    APSARA_TEST_TRUE(ParseJsonTable(configStr, configJson, errorMsg));
+    flusher.reset(new FlusherPrometheusRemoteWrite());
+    flusher->SetContext(ctx);
+    flusher->SetMetricsRecordRef(FlusherPrometheusRemoteWrite::sName, "1");
+    APSARA_TEST_TRUE(flusher->Init(configJson, optionalGoPipeline));
+    APSARA_TEST_TRUE(optionalGoPipeline.isNull());
+    APSARA_TEST_TRUE(flusher->mHTTPSFlag);
+    APSARA_TEST_EQUAL("remote.example.com", flusher->mHost);
+    APSARA_TEST_EQUAL(443, flusher->mPort);
+    APSARA_TEST_EQUAL("/api/v1/write", flusher->mPath);
+    APSARA_TEST_EQUAL("Bearer token", flusher->mHeaders["Authorization"]);
+    APSARA_TEST_EQUAL(100U, flusher->mBatcher.GetEventFlushStrategy().GetMinCnt());
+    APSARA_TEST_TRUE(flusher->mBatcher.GetGroupFlushStrategy().has_value());
+    APSARA_TEST_EQUAL(CompressType::SNAPPY, flusher->mCompressor->GetCompressType());
+    APSARA_TEST_NOT_EQUAL(nullptr, SenderQueueManager::GetInstance()->GetQueue(flusher->GetQueueKey()));
+
+    // flushers to the same host share the concurrency limiter
+    configJson["Endpoint"] = "https://remote.example.com:443/other";
+    unique_ptr<FlusherPrometheusRemoteWrite> flusher2(new FlusherPrometheusRemoteWrite());
+    flusher2->SetContext(ctx);
+    flusher2->SetMetricsRecordRef(FlusherPrometheusRemoteWrite::sName, "2");
+    APSARA_TEST_TRUE(flusher2->Init(configJson, optionalGoPipeline));
+    APSARA_TEST_EQUAL(flusher->mEndpointConcurrencyLimiter, flusher2->mEndpointConcurrencyLimiter);
+
+    // invalid optional param
+    configStr = R"(
+        {
+            "Type": "flusher_prometheus_remote_write",
+            "Endpoint": "http://127.0.0.1:9090",
+            "Headers": true,
+            "Batch": "invalid"
+        }
+    )";
+    APSARA_TEST_TRUE(ParseJsonTable(configStr, configJson, errorMsg));
+    flusher.reset(new FlusherPrometheusRemoteWrite());
+    flusher->SetContext(ctx);
+    flusher->SetMetricsRecordRef(FlusherPrometheusRemoteWrite::sName, "3");
+    APSARA_TEST_TRUE(flusher->Init(configJson, optionalGoPipeline));
+    APSARA_TEST_FALSE(flusher->mHTTPSFlag);
+    APSARA_TEST_EQUAL(9090, flusher->mPort);
+    APSARA_TEST_EQUAL("/", flusher->mPath);
+    APSARA_TEST_TRUE(flusher->mHeaders.empty());
+}
+
+void FlusherPrometheusRemoteWriteUnittest::OnFailedInit() {
+    Json::Value configJson, optionalGoPipeline;
+    for (const auto& endpoint : {"", "127.0.0.1:9090", "ftp://127.0.0.1", "http://:9090", "http://127.0.0.1:abc"}) {
+        configJson["Endpoint"] = endpoint;
+        FlusherPrometheusRemoteWrite flusher;
+        flusher.SetContext(ctx);
+        flusher.SetMetricsRecordRef(FlusherPrometheusRemoteWrite::sName, "1");
+        APSARA_TEST_FALSE(flusher.Init(configJson, optionalGoPipeline));
+    }
+    configJson.removeMember("Endpoint");
+    FlusherPrometheusRemoteWrite flusher;
+    flusher.SetContext(ctx);
+    flusher.SetMetricsRecordRef(FlusherPrometheusRemoteWrite::sName, "1");
+    APSARA_TEST_FALSE(flusher.Init(configJson, optionalGoPipeline));
+}
+
+void FlusherPrometheusRemoteWriteUnittest::TestSend() {
+    auto flusher = CreateFlusher();
+    auto item = SendOneGroup(*flusher);
+    APSARA_TEST_NOT_EQUAL(nullptr, item);
+    string data = item->mData;
+    DoSend(*flusher, item);
+
+    APSARA_TEST_EQUAL(1, mServer.GetRequestCnt());
+    APSARA_TEST_EQUAL("snappy", mServer.GetHeader("Content-Encoding"));
+    APSARA_TEST_EQUAL("application/x-protobuf", mServer.GetHeader("Content-Type"));
+    APSARA_TEST_EQUAL("0.1.0", mServer.GetHeader("X-Prometheus-Remote-Write-Version"));
+    APSARA_TEST_EQUAL("tenant", mServer.GetHeader("X-Scope-OrgID"));
+    APSARA_TEST_EQUAL(data, mServer.GetBody());
+
+    SnappyCompressor compressor(CompressType::SNAPPY);
+    string raw, errorMsg;
+    APSARA_TEST_TRUE(compressor.UnCompress(mServer.GetBody(), raw, errorMsg));
+    APSARA_TEST_NOT_EQUAL(string::npos, raw.find("127.0.0.1:9100"));
+
+    APSARA_TEST_EQUAL(1U, flusher->mSuccessCnt->GetValue());
+    vector<SenderQueueItem*> items;
+    SenderQueueManager::GetInstance()->GetAvailableItems(items, 80);
+    APSARA_TEST_TRUE(items.empty());
+    APSARA_TEST_TRUE(SenderQueueManager::GetInstance()->IsAllQueueEmpty());
+}
+
+void FlusherPrometheusRemoteWriteUnittest::TestRetry() {
+    auto flusher = CreateFlusher();
+    auto item = SendOneGroup(*flusher);
+    APSARA_TEST_NOT_EQUAL(nullptr, item);
+
+    // server error
+    mServer.SetStatusCode(503);
+    DoSend(*flusher, item);
+    APSARA_TEST_EQUAL(1U, flusher->mServerErrorCnt->GetValue());
+    APSARA_TEST_EQUAL(SendingStatus::IDLE, item->mStatus.load());
+    APSARA_TEST_EQUAL(2U, item->mTryCnt);
+
+    // too many requests
+    mServer.SetStatusCode(429);
+    DoSend(*flusher, item);
+    APSARA_TEST_EQUAL(2U, flusher->mServerErrorCnt->GetValue());
+    APSARA_TEST_EQUAL(3U, item->mTryCnt);
+
+    // network error
+    mServer.Stop();
+    DoSend(*flusher, item);
+    APSARA_TEST_EQUAL(1U, flusher->mNetworkErrorCnt->GetValue());
+    APSARA_TEST_EQUAL(4U, item->mTryCnt);
+    APSARA_TEST_FALSE(SenderQueueManager::GetInstance()->IsAllQueueEmpty());
+
+    // retried for too long
+    INT32_FLAG(discard_send_fail_interval) = 0;
+    item->mFirstEnqueTime -= chrono::seconds(1);
+    DoSend(*flusher, item);
+    APSARA_TEST_EQUAL(1U, flusher->mDiscardCnt->GetValue());
+    APSARA_TEST_TRUE(SenderQueueManager::GetInstance()->IsAllQueueEmpty());
+    INT32_FLAG(discard_send_fail_interval) = 6 * 3600;
+}
+
+void FlusherPrometheusRemoteWriteUnittest::TestDiscard() {
+    auto flusher = CreateFlusher();
+    {
+        mServer.SetStatusCode(400);
+        auto item = SendOneGroup(*flusher);
+        DoSend(*flusher, item);
+        APSARA_TEST_EQUAL(1U, flusher->mParamsErrorCnt->GetValue());
+        APSARA_TEST_EQUAL(1U, flusher->mDiscardCnt->GetValue());
+        APSARA_TEST_TRUE(SenderQueueManager::GetInstance()->IsAllQueueEmpty());
+    }
+    {
+        mServer.SetStatusCode(401);
+        auto item = SendOneGroup(*flusher);
+        DoSend(*flusher, item);
+        APSARA_TEST_EQUAL(1U, flusher->mUnauthErrorCnt->GetValue());
+        APSARA_TEST_EQUAL(2U, flusher->mDiscardCnt->GetValue());
+        APSARA_TEST_TRUE(SenderQueueManager::GetInstance()->IsAllQueueEmpty());
+    }
+}
+
+UNIT_TEST_CASE(FlusherPrometheusRemoteWriteUnittest, OnSuccessfulInit)
+UNIT_TEST_CASE(FlusherPrometheusRemoteWriteUnittest, OnFailedInit)
+UNIT_TEST_CASE(FlusherPrometheusRemoteWriteUnittest, TestSend)
+UNIT_TEST_CASE(FlusherPrometheusRemoteWriteUnittest, TestRetry)
+UNIT_TEST_CASE(FlusherPrometheusRemoteWriteUnittest, TestDiscard)
+
+} // namespace logtail
+
+UNIT_TEST_MAIN
@@ -45,6 +45,7 @@ DECLARE_FLAG_INT32(batch_send_interval);
 DECLARE_FLAG_INT32(merge_log_count_limit);
 DECLARE_FLAG_INT32(batch_send_metric_size);
 DECLARE_FLAG_INT32(max_send_log_group_size);
+DECLARE_FLAG_INT32(go_pipeline_send_package_size);
 DECLARE_FLAG_DOUBLE(sls_serialize_size_expansion_ratio);
 DECLARE_FLAG_BOOL(send_prefer_real_ip);
 DECLARE_FLAG_STRING(default_access_key_id);
@@ -1905,6 +1906,48 @@ void FlusherSLSUnittest::OnGoPipelineSend() {
             auto item = static_cast<SLSSenderQueueItem*>(res[0]);
             APSARA_TEST_EQUAL("test_logstore", item->mLogstore);
         }
+        {
+            // batch
+            INT32_FLAG(go_pipeline_send_package_size) = 10;
+            string data = "content1content2content3";
+            vector<int32_t> sizes = {8, 8, 8};
+            APSARA_TEST_TRUE(flusher.SendBatch(data.data(), sizes.data(), sizes.size(), "shardhash_key", "other"));
+            INT32_FLAG(go_pipeline_send_package_size) = 512 * 1024;
+
+            vector<SenderQueueItem*> res;
+            SenderQueueManager::GetInstance()->GetAvailableItems(res, 80);
+            APSARA_TEST_EQUAL(3U, res.size());
+            for (size_t i = 0; i < 3; ++i) {
+                auto item = static_cast<SLSSenderQueueItem*>(res[i]);
+                APSARA_TEST_EQUAL(RawDataType::EVENT_GROUP, item->mType);
+                APSARA_TEST_EQUAL("shardhash_key", item->mShardHashKey);
+                APSARA_TEST_EQUAL("other", item->mLogstore);
+                APSARA_TEST_EQUAL(8U, item->mRawSize);
+            }
+
+            APSARA_TEST_TRUE(flusher.SendBatch(data.data(), sizes.data(), sizes.size(), "", ""));
+            res.clear();
+            SenderQueueManager::GetInstance()->GetAvailableItems(res, 80);
+            APSARA_TEST_EQUAL(1U, res.size());
+            auto item = static_cast<SLSSenderQueueItem*>(res[0]);
+            APSARA_TEST_EQUAL(RawDataType::EVENT_GROUP_LIST, item->mType);
+            APSARA_TEST_EQUAL(flusher.mQueueKey, item->mQueueKey);
+            APSARA_TEST_EQUAL("", item->mShardHashKey);
+            APSARA_TEST_EQUAL("test_logstore", item->mLogstore);
+            APSARA_TEST_EQUAL(24U, item->mRawSize);
+
+            auto compressor
+                = CompressorFactory::GetInstance()->Create(Json::Value(), ctx, "flusher_sls", "1", CompressType::LZ4);
+            sls_logs::SlsLogPackageList packageList;
+            APSARA_TEST_TRUE(packageList.ParseFromString(item->mData));
+            APSARA_TEST_EQUAL(3, packageList.packages_size());
+            for (int i = 0; i < 3; ++i) {
+                string output;
+                output.resize(packageList.packages(i).uncompress_size());
+                APSARA_TEST_TRUE(compressor->UnCompress(packageList.packages(i).data(), output, errorMsg));
+                APSARA_TEST_EQUAL(data.substr(i * 8, 8), output);
+            }
+        }
     }
     {
         // go profile flusher has no context
@@ -0,0 +1,158 @@
+/*
+ * Copyright 2025 iLogtail Authors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <atomic>
+#include <map>
+#include <mutex>
+#include <string>
+#include <thread>
+
+#include "common/StringTools.h"
+
+namespace logtail {
+
+// A minimal http receiver on 127.0.0.1, which records the last request and replies with the given status.
+class StubHttpServer {
+public:
+    bool Start() {
+        mFd = socket(AF_INET, SOCK_STREAM, 0);
+        sockaddr_in addr{};
+        addr.sin_family = AF_INET;
+        addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+        addr.sin_port = 0;
+        socklen_t len = sizeof(addr);
+        if (mFd < 0 || bind(mFd, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)) != 0 || listen(mFd, 16) != 0
+            || getsockname(mFd, reinterpret_cast<sockaddr*>(&addr), &len) != 0) {
+            return false;
+        }
+        mPort = ntohs(addr.sin_port);
+        mThread = std::thread([this]() { Run(); });
+        return true;
+    }
+
+    void Stop() {
+        if (mFd >= 0) {
+            shutdown(mFd, SHUT_RDWR);
+            close(mFd);
+            mFd = -1;
+        }
+        if (mThread.joinable()) {
+            mThread.join();
+        }
+    }
+
+    int32_t GetPort() const { return mPort; }
+    void SetStatusCode(int32_t code) { mStatusCode = code; }
+    int32_t GetRequestCnt() const { return mRequestCnt; }
+
+    std::string GetHeader(const std::string& key) {
+        std::lock_guard<std::mutex> lock(mMux);
+        auto it = mHeaders.find(ToLowerCaseString(key));
+        return it == mHeaders.end() ? "" : it->second;
+    }
+
+    std::string GetBody() {
+        std::lock_guard<std::mutex> lock(mMux);
+        return mBody;
+    }
+
+    std::string GetPath() {
+        std::lock_guard<std::mutex> lock(mMux);
+        return mPath;
+    }
+
+private:
+    void Run() {
+        while (true) {
+            int conn = accept(mFd, nullptr, nullptr);
+            if (conn < 0) {
+                return;
+            }
+            Serve(conn);
+            close(conn);
+        }
+    }
+
+    void Serve(int conn) {
+        std::string data;
+        char buf[4096];
+        size_t headerEnd = std::string::npos;
+        while ((headerEnd = data.find("\r\n\r\n")) == std::string::npos) {
+            auto n = recv(conn, buf, sizeof(buf), 0);
+            if (n <= 0) {
+                return;
+            }
+            data.append(buf, n);
+        }
+        // request line, e.g. POST /v1/logs HTTP/1.1
+        std::string requestLine = data.substr(0, data.find("\r\n"));
+        auto pathStart = requestLine.find(' ') + 1;
+        std::string path = requestLine.substr(pathStart, requestLine.find(' ', pathStart) - pathStart);
+        std::map<std::string, std::string> headers;
+        size_t pos = data.find("\r\n") + 2;
+        while (pos < headerEnd) {
+            auto lineEnd = data.find("\r\n", pos);
+            auto line = data.substr(pos, lineEnd - pos);
+            auto colon = line.find(':');
+            if (colon != std::string::npos) {
+                headers[ToLowerCaseString(line.substr(0, colon))] = TrimString(line.substr(colon + 1));
+            }
+            pos = lineEnd + 2;
+        }
+        if (headers["expect"] == "100-continue") {
+            std::string cont = "HTTP/1.1 100 Continue\r\n\r\n";
+            send(conn, cont.data(), cont.size(), MSG_NOSIGNAL);
+        }
+        size_t contentLength = headers.count("content-length") ? StringTo<size_t>(headers["content-length"]) : 0;
+        std::string body = data.substr(headerEnd + 4);
+        while (body.size() < contentLength) {
+            auto n = recv(conn, buf, sizeof(buf), 0);
+            if (n <= 0) {
+                return;
+            }
+            body.append(buf, n);
+        }
+        {
+            std::lock_guard<std::mutex> lock(mMux);
+            mPath = std::move(path);
+            mHeaders = std::move(headers);
+            mBody = std::move(body);
+        }
+        ++mRequestCnt;
+        std::string resp
+            = "HTTP/1.1 " + ToString(mStatusCode.load()) + " Stub\r\nContent-Length: 0\r\nConnection: close\r\n\r\n";
+        send(conn, resp.data(), resp.size(), MSG_NOSIGNAL);
+    }
+
+    int mFd = -1;
+    int32_t mPort = 0;
+    std::thread mThread;
+    std::atomic_int32_t mStatusCode = 200;
+    std::atomic_int32_t mRequestCnt = 0;
+    std::mutex mMux;
+    std::string mPath;
+    std::map<std::string, std::string> mHeaders;
+    std::string mBody;
+};
+
+} // namespace logtail
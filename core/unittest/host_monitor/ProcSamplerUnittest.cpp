@@ -0,0 +1,161 @@
+// Copyright 2025 iLogtail Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <fstream>
+#include <map>
+#include <string>
+
+#include "boost/filesystem/operations.hpp"
+
+#include "host_monitor/Constants.h"
+#include "host_monitor/ProcSampler.h"
+#include "unittest/Unittest.h"
+
+using namespace std;
+
+namespace logtail {
+
+class ProcSamplerUnittest : public testing::Test {
+public:
+    void TestReadProcFile() const;
+    void TestWalkProcess() const;
+    void TestShareSnapshotInSameTick() const;
+    void TestParseProcField() const;
+
+protected:
+    void SetUp() override {
+        bfs::remove_all(mRoot);
+        bfs::create_directories(mRoot + "/1");
+        bfs::create_directories(mRoot + "/23");
+        bfs::create_directories(mRoot + "/self");
+        ofstream(mRoot + "/1/stat") << "1 (systemd) S 0 1 1";
+        ofstream(mRoot + "/23/stat") << "23 (a b) R 1 23 23";
+        ofstream(mRoot + "/self/stat") << "self";
+        // a process exiting during the walk
+        bfs::create_directories(mRoot + "/45");
+        ofstream(mRoot + "/stat") << "cpu  1 2 3 4\nbtime 1731142542\n";
+        PROCESS_DIR = mRoot;
+    }
+
+    void TearDown() override {
+        PROCESS_DIR = "/proc";
+        bfs::remove_all(mRoot);
+    }
+
+private:
+    const string mRoot = "./proc_sampler";
+};
+
+void ProcSamplerUnittest::TestReadProcFile() const {
+    string content = "prefix";
+    APSARA_TEST_TRUE(ProcSampler::GetInstance()->ReadProcFile("stat", content));
+    APSARA_TEST_EQUAL("prefixcpu  1 2 3 4\nbtime 1731142542\n", content);
+
+    // larger than one read chunk
+    string large(5000, 'a');
+    ofstream(mRoot + "/large") << large;
+    content.clear();
+    APSARA_TEST_TRUE(ProcSampler::GetInstance()->ReadProcFile("large", content));
+    APSARA_TEST_EQUAL(large, content);
+
+    string errorMessage;
+    content = "prefix";
+    APSARA_TEST_FALSE(ProcSampler::GetInstance()->ReadProcFile("not_exist", content, &errorMessage));
+    APSARA_TEST_EQUAL("prefix", content);
+    APSARA_TEST_FALSE(errorMessage.empty());
+}
+
+void ProcSamplerUnittest::TestWalkProcess() const {
+    auto snapshot = ProcSampler::GetInstance()->GetSnapshot();
+    const vector<ProcSnapshot::ProcessStatItem>* items = nullptr;
+    string errorMessage;
+    APSARA_TEST_TRUE(snapshot->GetProcessStats(items, errorMessage));
+    APSARA_TEST_EQUAL_FATAL(2U, items->size());
+    map<pid_t, string> stats;
+    for (const auto& item : *items) {
+        stats[item.mPid] = item.mStat.to_string();
+    }
+    APSARA_TEST_EQUAL("1 (systemd) S 0 1 1", stats[1]);
+    APSARA_TEST_EQUAL("23 (a b) R 1 23 23", stats[23]);
+
+    PROCESS_DIR = mRoot + "/not_exist";
+    snapshot = ProcSampler::GetInstance()->GetSnapshot();
+    APSARA_TEST_FALSE(snapshot->GetProcessStats(items, errorMessage));
+    APSARA_TEST_FALSE(errorMessage.empty());
+}
+
+void ProcSamplerUnittest::TestShareSnapshotInSameTick() const {
+    auto tick = chrono::steady_clock::now();
+    auto snapshot1 = ProcSampler::GetInstance()->GetSnapshot(tick);
+    auto snapshot2 = ProcSampler::GetInstance()->GetSnapshot(tick);
+    APSARA_TEST_EQUAL(snapshot1.get(), snapshot2.get());
+    StringView content;
+    string errorMessage;
+    APSARA_TEST_TRUE(snapshot1->GetSystemStat(content, errorMessage));
+
+    // content is not read again in the same tick
+    ofstream(mRoot + "/stat") << "cpu  5 6 7 8\n";
+    APSARA_TEST_TRUE(snapshot2->GetSystemStat(content, errorMessage));
+    APSARA_TEST_EQUAL("cpu  1 2 3 4\nbtime 1731142542\n", content.to_string());
+
+    // snapshot of the last tick is still in use
+    auto snapshot3 = ProcSampler::GetInstance()->GetSnapshot(tick + chrono::seconds(1));
+    APSARA_TEST_NOT_EQUAL(snapshot1.get(), snapshot3.get());
+    APSARA_TEST_TRUE(snapshot3->GetSystemStat(content, errorMessage));
+    APSARA_TEST_EQUAL("cpu  5 6 7 8\n", content.to_string());
+
+    // snapshot of the last tick is reused
+    ProcSnapshot* ptr = snapshot3.get();
+    snapshot3.reset();
+    auto snapshot4 = ProcSampler::GetInstance()->GetSnapshot(tick + chrono::seconds(2));
+    APSARA_TEST_EQUAL(ptr, snapshot4.get());
+    ofstream(mRoot + "/stat") << "cpu  9 10 11 12\n";
+    APSARA_TEST_TRUE(snapshot4->GetSystemStat(content, errorMessage));
+    APSARA_TEST_EQUAL("cpu  9 10 11 12\n", content.to_string());
+
+    // a default tick is never shared
+    APSARA_TEST_NOT_EQUAL(ProcSampler::GetInstance()->GetSnapshot().get(),
+                          ProcSampler::GetInstance()->GetSnapshot().get());
+}
+
+void ProcSamplerUnittest::TestParseProcField() const {
+    StringView line = "cpu0  12 -3 abc\n";
+    size_t pos = 0;
+    StringView field;
+    APSARA_TEST_TRUE(NextProcField(line, pos, field));
+    APSARA_TEST_EQUAL("cpu0", field.to_string());
+    APSARA_TEST_TRUE(NextProcField(line, pos, field));
+    uint64_t u = 0;
+    APSARA_TEST_TRUE(ParseProcNumber(field, u));
+    APSARA_TEST_EQUAL(12U, u);
+    APSARA_TEST_TRUE(NextProcField(line, pos, field));
+    int64_t i = 0;
+    APSARA_TEST_TRUE(ParseProcNumber(field, i));
+    APSARA_TEST_EQUAL(-3, i);
+    APSARA_TEST_TRUE(NextProcField(line, pos, field));
+    APSARA_TEST_FALSE(ParseProcNumber(field, i));
+    APSARA_TEST_EQUAL(-3, i);
+    APSARA_TEST_FALSE(NextProcField(line, pos, field));
+    APSARA_TEST_FALSE(ParseProcNumber(StringView("-"), i));
+    APSARA_TEST_FALSE(ParseProcNumber(StringView(""), i));
+}
+
+UNIT_TEST_CASE(ProcSamplerUnittest, TestReadProcFile);
+UNIT_TEST_CASE(ProcSamplerUnittest, TestWalkProcess);
+UNIT_TEST_CASE(ProcSamplerUnittest, TestShareSnapshotInSameTick);
+UNIT_TEST_CASE(ProcSamplerUnittest, TestParseProcField);
+
+} // namespace logtail
+
+UNIT_TEST_MAIN
@@ -118,6 +118,35 @@ void InputFileSecurityUnittest::OnSuccessfulInit() {
     APSARA_TEST_EQUAL("/etc/passwd", thisFilter2.mFilePathList[0]);
     APSARA_TEST_EQUAL("/etc/shadow", thisFilter2.mFilePathList[1]);
     APSARA_TEST_EQUAL("/bin", thisFilter2.mFilePathList[2]);
+    // not aggregated by default
+    APSARA_TEST_EQUAL(0U, input->mSecurityOptions.mAggregateOption.mWindowSecs);
+
+    // aggregation
+    configStr = R"(
+        {
+            "Type": "input_file_security",
+            "Aggregation": {
+                "WindowSecs": 10,
+                "Keys": [
+                    "path",
+                    "call_name"
+                ]
+            },
+            "ProbeConfig": 
+            {
+                "FilePathFilter": [
+                    "/etc"
+                ]
+            }
+        }
+    )";
+    APSARA_TEST_TRUE(ParseJsonTable(configStr, configJson, errorMsg));
+    input.reset(new InputFileSecurity());
+    input->SetContext(ctx);
+    input->SetMetricsRecordRef("test", "1");
+    APSARA_TEST_TRUE(input->Init(configJson, optionalGoPipeline));
+    APSARA_TEST_EQUAL(10U, input->mSecurityOptions.mAggregateOption.mWindowSecs);
+    APSARA_TEST_EQUAL(vector<string>({"path", "call_name"}), input->mSecurityOptions.mAggregateOption.mKeys);
 }
 
 void InputFileSecurityUnittest::OnFailedInit() {
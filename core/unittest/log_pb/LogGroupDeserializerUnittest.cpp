@@ -0,0 +1,160 @@
+// Copyright 2025 iLogtail Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "constants/TagConstants.h"
+#include "models/LogEvent.h"
+#include "protobuf/sls/LogGroupDeserializer.h"
+#include "protobuf/sls/sls_logs.pb.h"
+#include "unittest/Unittest.h"
+
+using namespace std;
+
+namespace logtail {
+
+class LogGroupDeserializerUnittest : public ::testing::Test {
+public:
+    void TestDeserialize();
+    void TestUnknownFields();
+    void TestInvalidData();
+};
+
+void LogGroupDeserializerUnittest::TestDeserialize() {
+    sls_logs::LogGroup logGroupPb;
+    {
+        auto log = logGroupPb.add_logs();
+        log->set_time(1234567890);
+        log->set_time_ns(135792468);
+        auto content = log->add_contents();
+        content->set_key("key_1");
+        content->set_value("value_1");
+        content = log->add_contents();
+        content->set_key("key_2");
+        content->set_value("");
+    }
+    {
+        auto log = logGroupPb.add_logs();
+        log->set_time(123456789);
+        auto content = log->add_contents();
+        content->set_key("key_3");
+        content->set_value(string("value\0_3", 8));
+    }
+    logGroupPb.set_category("category");
+    logGroupPb.set_topic("topic");
+    logGroupPb.set_source("source");
+    logGroupPb.set_machineuuid("machine_uuid");
+    auto tag = logGroupPb.add_logtags();
+    tag->set_key("key_4");
+    tag->set_value("value_4");
+    string data = logGroupPb.SerializeAsString();
+
+    PipelineEventGroup group(make_shared<SourceBuffer>());
+    string errorMsg;
+    APSARA_TEST_TRUE(LogGroupDeserializer::Deserialize(data.data(), data.size(), group, errorMsg));
+    // data is copied into the source buffer
+    data.assign(data.size(), '\0');
+
+    APSARA_TEST_EQUAL(2U, group.GetEvents().size());
+    {
+        const auto& log = group.GetEvents()[0].Cast<LogEvent>();
+        APSARA_TEST_EQUAL(1234567890, log.GetTimestamp());
+        APSARA_TEST_TRUE(log.GetTimestampNanosecond().has_value());
+        APSARA_TEST_EQUAL(135792468U, log.GetTimestampNanosecond().value());
+        APSARA_TEST_EQUAL(2U, log.Size());
+        APSARA_TEST_EQUAL("value_1", log.GetContent("key_1"));
+        APSARA_TEST_TRUE(log.HasContent("key_2"));
+        APSARA_TEST_EQUAL("", log.GetContent("key_2"));
+    }
+    {
+        const auto& log = group.GetEvents()[1].Cast<LogEvent>();
+        APSARA_TEST_EQUAL(123456789, log.GetTimestamp());
+        APSARA_TEST_FALSE(log.GetTimestampNanosecond().has_value());
+        APSARA_TEST_EQUAL(1U, log.Size());
+        APSARA_TEST_EQUAL(string("value\0_3", 8), log.GetContent("key_3").to_string());
+    }
+    APSARA_TEST_EQUAL(4U, group.GetTags().size());
+    APSARA_TEST_EQUAL("topic", group.GetTag(LOG_RESERVED_KEY_TOPIC));
+    APSARA_TEST_EQUAL("source", group.GetTag(LOG_RESERVED_KEY_SOURCE));
+    APSARA_TEST_EQUAL("machine_uuid", group.GetTag(LOG_RESERVED_KEY_MACHINE_UUID));
+    APSARA_TEST_EQUAL("value_4", group.GetTag("key_4"));
+}
+
+void LogGroupDeserializerUnittest::TestUnknownFields() {
+    sls_logs::LogGroup logGroupPb;
+    auto log = logGroupPb.add_logs();
+    log->set_time(1234567890);
+    auto content = log->add_contents();
+    content->set_key("key");
+    content->set_value("value");
+    string data = logGroupPb.SerializeAsString();
+    // field 15 of every wire type appended to the group
+    data.append("\x78\x01", 2);
+    data.append("\x79\x01\x02\x03\x04\x05\x06\x07\x08", 9);
+    data.append("\x7a\x02\x01\x02", 4);
+    data.append("\x7d\x01\x02\x03\x04", 5);
+
+    PipelineEventGroup group(make_shared<SourceBuffer>());
+    string errorMsg;
+    APSARA_TEST_TRUE(LogGroupDeserializer::Deserialize(data.data(), data.size(), group, errorMsg));
+    APSARA_TEST_EQUAL(1U, group.GetEvents().size());
+    APSARA_TEST_EQUAL("value", group.GetEvents()[0].Cast<LogEvent>().GetContent("key"));
+    APSARA_TEST_TRUE(group.GetTags().empty());
+}
+
+void LogGroupDeserializerUnittest::TestInvalidData() {
+    sls_logs::LogGroup logGroupPb;
+    auto log = logGroupPb.add_logs();
+    log->set_time(1234567890);
+    auto content = log->add_contents();
+    content->set_key("key");
+    content->set_value("value");
+    string data = logGroupPb.SerializeAsString();
+    {
+        // truncated
+        PipelineEventGroup group(make_shared<SourceBuffer>());
+        string errorMsg;
+        APSARA_TEST_FALSE(LogGroupDeserializer::Deserialize(data.data(), data.size() - 1, group, errorMsg));
+        APSARA_TEST_FALSE(errorMsg.empty());
+    }
+    {
+        // unsupported wire type
+        string invalid = data + "\x7b";
+        PipelineEventGroup group(make_shared<SourceBuffer>());
+        string errorMsg;
+        APSARA_TEST_FALSE(LogGroupDeserializer::Deserialize(invalid.data(), invalid.size(), group, errorMsg));
+        APSARA_TEST_FALSE(errorMsg.empty());
+    }
+    {
+        // field number 0
+        string invalid = data + string("\x02\x00", 2);
+        PipelineEventGroup group(make_shared<SourceBuffer>());
+        string errorMsg;
+        APSARA_TEST_FALSE(LogGroupDeserializer::Deserialize(invalid.data(), invalid.size(), group, errorMsg));
+        APSARA_TEST_FALSE(errorMsg.empty());
+    }
+    {
+        // empty group
+        PipelineEventGroup group(make_shared<SourceBuffer>());
+        string errorMsg;
+        APSARA_TEST_TRUE(LogGroupDeserializer::Deserialize("", 0, group, errorMsg));
+        APSARA_TEST_TRUE(group.GetEvents().empty());
+    }
+}
+
+UNIT_TEST_CASE(LogGroupDeserializerUnittest, TestDeserialize)
+UNIT_TEST_CASE(LogGroupDeserializerUnittest, TestUnknownFields)
+UNIT_TEST_CASE(LogGroupDeserializerUnittest, TestInvalidData)
+
+} // namespace logtail
+
+UNIT_TEST_MAIN
@@ -49,6 +49,8 @@ void GlobalConfigUnittest::OnSuccessfulInit() const {
     APSARA_TEST_EQUAL(GlobalConfig::TopicType::NONE, config->mTopicType);
     APSARA_TEST_EQUAL("", config->mTopicFormat);
     APSARA_TEST_EQUAL(1U, config->mPriority);
+    APSARA_TEST_EQUAL(1U, config->mMemoryWeight);
+    APSARA_TEST_EQUAL(1U, config->mCpuWeight);
     APSARA_TEST_FALSE(config->mEnableTimestampNanosecond);
     APSARA_TEST_FALSE(config->mUsingOldContentTag);
 
@@ -58,6 +60,8 @@ void GlobalConfigUnittest::OnSuccessfulInit() const {
             "TopicType": "custom",
             "TopicFormat": "test_topic",
             "Priority": 1,
+            "MemoryWeight": 3,
+            "CpuWeight": 2,
             "EnableTimestampNanosecond": true,
             "UsingOldContentTag": true
         }
@@ -69,6 +73,8 @@ void GlobalConfigUnittest::OnSuccessfulInit() const {
     APSARA_TEST_EQUAL(GlobalConfig::TopicType::CUSTOM, config->mTopicType);
     APSARA_TEST_EQUAL("test_topic", config->mTopicFormat);
     APSARA_TEST_EQUAL(1U, config->mPriority);
+    APSARA_TEST_EQUAL(3U, config->mMemoryWeight);
+    APSARA_TEST_EQUAL(2U, config->mCpuWeight);
     APSARA_TEST_TRUE(config->mEnableTimestampNanosecond);
     APSARA_TEST_TRUE(config->mUsingOldContentTag);
 
@@ -78,6 +84,8 @@ void GlobalConfigUnittest::OnSuccessfulInit() const {
             "TopicType": true,
             "TopicFormat": true,
             "Priority": "1",
+            "MemoryWeight": "3",
+            "CpuWeight": "2",
             "EnableTimestampNanosecond": "true",
             "UsingOldContentTag": "true"
         }
@@ -89,6 +97,8 @@ void GlobalConfigUnittest::OnSuccessfulInit() const {
     APSARA_TEST_EQUAL(GlobalConfig::TopicType::NONE, config->mTopicType);
     APSARA_TEST_EQUAL("", config->mTopicFormat);
     APSARA_TEST_EQUAL(1U, config->mPriority);
+    APSARA_TEST_EQUAL(1U, config->mMemoryWeight);
+    APSARA_TEST_EQUAL(1U, config->mCpuWeight);
     APSARA_TEST_FALSE(config->mEnableTimestampNanosecond);
     APSARA_TEST_FALSE(config->mUsingOldContentTag);
 
@@ -197,6 +207,31 @@ void GlobalConfigUnittest::OnSuccessfulInit() const {
     APSARA_TEST_TRUE(config->Init(configJson, ctx, extendedParams));
     APSARA_TEST_EQUAL(2U, config->mPriority);
 
+    // MemoryWeight and CpuWeight
+    configStr = R"(
+        {
+            "MemoryWeight": 0,
+            "CpuWeight": 0
+        }
+    )";
+    APSARA_TEST_TRUE(ParseJsonTable(configStr, configJson, errorMsg));
+    config.reset(new GlobalConfig());
+    APSARA_TEST_TRUE(config->Init(configJson, ctx, extendedParams));
+    APSARA_TEST_EQUAL(1U, config->mMemoryWeight);
+    APSARA_TEST_EQUAL(1U, config->mCpuWeight);
+
+    configStr = R"(
+        {
+            "MemoryWeight": 2,
+            "CpuWeight": 0
+        }
+    )";
+    APSARA_TEST_TRUE(ParseJsonTable(configStr, configJson, errorMsg));
+    config.reset(new GlobalConfig());
+    APSARA_TEST_TRUE(config->Init(configJson, ctx, extendedParams));
+    APSARA_TEST_EQUAL(2U, config->mMemoryWeight);
+    APSARA_TEST_EQUAL(1U, config->mCpuWeight);
+
     // extendedParam
     configStr = R"(
         {
@@ -41,6 +41,12 @@ public:
         return true;
     }
 
+    // all requests are handled by the single mock thread
+    bool AddRequest(std::unique_ptr<HttpSinkRequest>&& request) override {
+        mQueue.Push(std::move(request));
+        return true;
+    }
+
     void Stop() override {
         mIsFlush = true;
         if (!mThreadRes.valid()) {
@@ -94,6 +100,7 @@ private:
     HttpSinkMock() = default;
     ~HttpSinkMock() = default;
 
+    std::future<void> mThreadRes;
     std::atomic_bool mIsFlush = false;
     mutable std::mutex mMutex;
     std::vector<SenderQueueItem> mRequests;
@@ -0,0 +1,246 @@
+// Copyright 2025 iLogtail Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <memory>
+
+#include "collection_pipeline/limiter/MemoryBudget.h"
+#include "collection_pipeline/queue/BoundedProcessQueue.h"
+#include "collection_pipeline/queue/SenderQueue.h"
+#include "models/PipelineEventGroup.h"
+#include "unittest/Unittest.h"
+#include "unittest/queue/FeedbackInterfaceMock.h"
+
+using namespace std;
+
+namespace logtail {
+
+class MemoryBudgetUnittest : public testing::Test {
+public:
+    void TestQuota();
+    void TestAcquire();
+    void TestFeedback();
+    void TestReservation();
+    void TestProcessQueue();
+    void TestSenderQueue();
+
+protected:
+    static void SetUpTestCase() { sCtx.SetConfigName("test_config"); }
+
+    void SetUp() override { MemoryBudget::GetInstance()->SetBudget(1000); }
+
+    void TearDown() override { MemoryBudget::GetInstance()->SetBudget(0); }
+
+private:
+    static CollectionPipelineContext sCtx;
+};
+
+CollectionPipelineContext MemoryBudgetUnittest::sCtx;
+
+void MemoryBudgetUnittest::TestQuota() {
+    auto budget = MemoryBudget::GetInstance();
+    auto quota1 = budget->GetQuota("config_1", 1);
+    APSARA_TEST_EQUAL(1000U, quota1->GetQuota());
+    {
+        auto quota2 = budget->GetQuota("config_2", 3);
+        APSARA_TEST_EQUAL(250U, quota1->GetQuota());
+        APSARA_TEST_EQUAL(750U, quota2->GetQuota());
+
+        // same config shares the same quota, with weight updated
+        auto quota3 = budget->GetQuota("config_2", 0);
+        APSARA_TEST_EQUAL(quota2, quota3);
+        APSARA_TEST_EQUAL(1U, quota2->GetWeight());
+        APSARA_TEST_EQUAL(500U, quota1->GetQuota());
+        APSARA_TEST_EQUAL(500U, quota2->GetQuota());
+    }
+    // quota is given back when no pipeline holds it
+    APSARA_TEST_EQUAL(1000U, quota1->GetQuota());
+    APSARA_TEST_EQUAL(1U, budget->mQuotas.size());
+
+    budget->SetBudget(2000);
+    APSARA_TEST_EQUAL(2000U, quota1->GetQuota());
+}
+
+void MemoryBudgetUnittest::TestAcquire() {
+    auto budget = MemoryBudget::GetInstance();
+    auto quota1 = budget->GetQuota("config_1", 1);
+    auto quota2 = budget->GetQuota("config_2", 1);
+
+    // a pipeline holding nothing is always admitted
+    APSARA_TEST_TRUE(quota1->TryAcquire(800));
+    APSARA_TEST_EQUAL(800U, quota1->GetUsage());
+    APSARA_TEST_EQUAL(800U, budget->GetUsage());
+    // beyond quota, idle budget can be borrowed
+    APSARA_TEST_TRUE(quota1->TryAcquire(100));
+    // no idle budget left
+    APSARA_TEST_FALSE(quota1->TryAcquire(200));
+    // guaranteed quota is still available to other pipelines
+    APSARA_TEST_TRUE(quota2->TryAcquire(300));
+    APSARA_TEST_TRUE(quota2->TryAcquire(200));
+    APSARA_TEST_FALSE(quota2->TryAcquire(100));
+    APSARA_TEST_FALSE(quota1->IsValidToPush());
+    APSARA_TEST_FALSE(quota2->IsValidToPush());
+
+    // data in pipeline is always accepted
+    quota2->Acquire(100, true);
+    APSARA_TEST_EQUAL(600U, quota2->GetUsage());
+    APSARA_TEST_EQUAL(100U, quota2->GetSendingUsage());
+    APSARA_TEST_TRUE(quota2->IsValidToProcess());
+    quota2->Acquire(500, true);
+    APSARA_TEST_FALSE(quota2->IsValidToProcess());
+    quota2->Release(500, true);
+    APSARA_TEST_TRUE(quota2->IsValidToProcess());
+
+    quota1->Release(900, false);
+    quota2->Release(100, true);
+    quota2->Release(500, false);
+    APSARA_TEST_EQUAL(0U, budget->GetUsage());
+
+    // unlimited
+    budget->SetBudget(0);
+    APSARA_TEST_TRUE(quota1->TryAcquire(5000));
+    APSARA_TEST_TRUE(quota1->TryAcquire(5000));
+    quota1->Release(10000, false);
+}
+
+void MemoryBudgetUnittest::TestFeedback() {
+    auto budget = MemoryBudget::GetInstance();
+    auto quota = budget->GetQuota("config_1", 1);
+    FeedbackInterfaceMock feedback;
+    quota->SetFeedbacks(1, vector<FeedbackInterface*>{&feedback, nullptr});
+
+    APSARA_TEST_TRUE(quota->TryAcquire(1000));
+    APSARA_TEST_FALSE(quota->TryAcquire(1));
+    APSARA_TEST_FALSE(quota->TryAcquire(1));
+    APSARA_TEST_EQUAL(1U, budget->mBlockedQuotas.size());
+
+    quota->Release(1, false);
+    APSARA_TEST_TRUE(feedback.HasFeedback(1));
+    APSARA_TEST_TRUE(budget->mBlockedQuotas.empty());
+    APSARA_TEST_FALSE(budget->mHasBlockedQuota);
+
+    // no feedback when not blocked
+    feedback.Clear();
+    quota->Release(999, false);
+    APSARA_TEST_FALSE(feedback.HasFeedback(1));
+
+    // blocked quota is removed when destructed
+    APSARA_TEST_TRUE(quota->TryAcquire(1000));
+    APSARA_TEST_FALSE(quota->TryAcquire(1));
+    APSARA_TEST_EQUAL(1U, budget->mBlockedQuotas.size());
+    quota->mUsage = 0;
+    budget->mUsage = 0;
+    quota.reset();
+    APSARA_TEST_TRUE(budget->mBlockedQuotas.empty());
+    APSARA_TEST_TRUE(budget->mQuotas.empty());
+}
+
+void MemoryBudgetUnittest::TestReservation() {
+    auto quota = MemoryBudget::GetInstance()->GetQuota("config_1", 1);
+    quota->Acquire(100, true);
+    {
+        MemoryReservation reservation(quota, 100, true);
+        APSARA_TEST_EQUAL(100U, reservation.GetSize());
+
+        MemoryReservation moved(std::move(reservation));
+        APSARA_TEST_EQUAL(0U, reservation.GetSize());
+        APSARA_TEST_EQUAL(100U, moved.GetSize());
+        APSARA_TEST_EQUAL(100U, quota->GetUsage());
+
+        quota->Acquire(50, false);
+        moved = MemoryReservation(quota, 50, false);
+        APSARA_TEST_EQUAL(50U, quota->GetUsage());
+        APSARA_TEST_EQUAL(0U, quota->GetSendingUsage());
+    }
+    APSARA_TEST_EQUAL(0U, quota->GetUsage());
+    APSARA_TEST_EQUAL(0U, MemoryBudget::GetInstance()->GetUsage());
+}
+
+void MemoryBudgetUnittest::TestProcessQueue() {
+    auto quota = MemoryBudget::GetInstance()->GetQuota("test_config", 1);
+    BoundedProcessQueue queue(100, 20, 80, 0, 1, sCtx);
+    SenderQueue senderQueue(10, 0, 10, 0, "", sCtx);
+    queue.SetDownStreamQueues(vector<BoundedSenderQueueInterface*>{&senderQueue});
+    queue.SetMemoryQuota(quota);
+    queue.EnablePop();
+
+    auto generateItem = []() {
+        PipelineEventGroup g(make_shared<SourceBuffer>());
+        g.AddLogEvent()->SetContent(string("key"), string(300, 'a'));
+        return make_unique<ProcessQueueItem>(std::move(g), 0);
+    };
+    size_t size = generateItem()->mEventGroup.DataSize();
+    size_t cnt = 0;
+    while (queue.Push(generateItem())) {
+        ++cnt;
+    }
+    APSARA_TEST_EQUAL(1000 / size, cnt);
+    APSARA_TEST_EQUAL(cnt * size, quota->GetUsage());
+    APSARA_TEST_EQUAL(1U, queue.mMemoryBudgetRejectTimesTotal->GetValue());
+
+    // reservation goes with the item until the item is destructed
+    unique_ptr<ProcessQueueItem> item;
+    APSARA_TEST_TRUE(queue.Pop(item));
+    APSARA_TEST_EQUAL(cnt * size, quota->GetUsage());
+    item.reset();
+    APSARA_TEST_EQUAL((cnt - 1) * size, quota->GetUsage());
+    APSARA_TEST_TRUE(queue.Push(generateItem()));
+
+    // data waiting to be sent over quota stops processing
+    quota->Acquire(1001, true);
+    APSARA_TEST_FALSE(queue.Pop(item));
+    quota->Release(1001, true);
+    APSARA_TEST_TRUE(queue.Pop(item));
+}
+
+void MemoryBudgetUnittest::TestSenderQueue() {
+    auto quota = MemoryBudget::GetInstance()->GetQuota("test_config", 1);
+    SenderQueue queue(2, 0, 2, 0, "", sCtx);
+    queue.SetMemoryQuota(quota);
+
+    // always accepted, even in extra buffer
+    for (size_t i = 0; i < 3; ++i) {
+        APSARA_TEST_TRUE(queue.Push(make_unique<SenderQueueItem>(string(600, 'a'), 600, nullptr, 0)));
+    }
+    APSARA_TEST_EQUAL(1800U, quota->GetUsage());
+    APSARA_TEST_EQUAL(1800U, quota->GetSendingUsage());
+    APSARA_TEST_FALSE(quota->IsValidToProcess());
+    APSARA_TEST_FALSE(queue.IsMemoryQuotaValidToPush());
+
+    vector<SenderQueueItem*> items;
+    queue.GetAvailableItems(items, -1);
+    APSARA_TEST_EQUAL(2U, items.size());
+    queue.Remove(items[0]);
+    // item moved from extra buffer still holds its reservation
+    APSARA_TEST_EQUAL(1200U, quota->GetUsage());
+    queue.Remove(items[1]);
+    APSARA_TEST_TRUE(quota->IsValidToProcess());
+
+    items.clear();
+    queue.GetAvailableItems(items, -1);
+    APSARA_TEST_EQUAL(1U, items.size());
+    queue.Remove(items[0]);
+    APSARA_TEST_EQUAL(0U, quota->GetUsage());
+    APSARA_TEST_EQUAL(0U, quota->GetSendingUsage());
+}
+
+UNIT_TEST_CASE(MemoryBudgetUnittest, TestQuota)
+UNIT_TEST_CASE(MemoryBudgetUnittest, TestAcquire)
+UNIT_TEST_CASE(MemoryBudgetUnittest, TestFeedback)
+UNIT_TEST_CASE(MemoryBudgetUnittest, TestReservation)
+UNIT_TEST_CASE(MemoryBudgetUnittest, TestProcessQueue)
+UNIT_TEST_CASE(MemoryBudgetUnittest, TestSenderQueue)
+
+} // namespace logtail
+
+UNIT_TEST_MAIN
@@ -52,6 +52,7 @@ public:
     void TestInProcessingCount() const;
     void TestWaitAllItemsInProcessFinished() const;
     void TestMultiFlusherAndRouter() const;
+    void TestRouteGoPipelineData() const;
 
 protected:
     static void SetUpTestCase() {
@@ -3041,6 +3042,136 @@ void PipelineUnittest::TestMultiFlusherAndRouter() const {
     APSARA_TEST_TRUE(pipeline->Init(std::move(*config)));
 }
 
+void PipelineUnittest::TestRouteGoPipelineData() const {
+    unique_ptr<Json::Value> configJson;
+    string configStr, errorMsg;
+    unique_ptr<CollectionConfig> config;
+    unique_ptr<CollectionPipeline> pipeline;
+    // single flusher_sls, sent directly
+    configStr = R"(
+        {
+            "inputs": [
+                {
+                    "Type": "input_file",
+                    "FilePaths": [
+                        "/home/test.log"
+                    ]
+                }
+            ],
+            "processors": [
+                {
+                    "Type": "processor_regex"
+                }
+            ],
+            "flushers": [
+                {
+                    "Type": "flusher_sls",
+                    "Project": "test_project",
+                    "Logstore": "test_logstore",
+                    "Region": "test_region",
+                    "Endpoint": "test_endpoint"
+                }
+            ]
+        }
+    )";
+    configJson.reset(new Json::Value());
+    APSARA_TEST_TRUE(ParseJsonTable(configStr, *configJson, errorMsg));
+    config.reset(new CollectionConfig(configName, std::move(configJson)));
+    APSARA_TEST_TRUE(config->Parse());
+    pipeline.reset(new CollectionPipeline());
+    APSARA_TEST_TRUE(pipeline->Init(std::move(*config)));
+    APSARA_TEST_FALSE(pipeline->IsRoutingGoPipelineData());
+    APSARA_TEST_EQUAL(1U, pipeline->mGoPipelineWithoutInput["flushers"].size());
+
+    // multiple native flushers with route
+    configStr = R"(
+        {
+            "inputs": [
+                {
+                    "Type": "input_file",
+                    "FilePaths": [
+                        "/home/test.log"
+                    ]
+                }
+            ],
+            "processors": [
+                {
+                    "Type": "processor_regex"
+                }
+            ],
+            "flushers": [
+                {
+                    "Type": "flusher_sls",
+                    "Project": "test_project",
+                    "Logstore": "test_logstore",
+                    "Region": "test_region",
+                    "Endpoint": "test_endpoint",
+                    "Match": {
+                        "Type": "tag",
+                        "Key": "data_type",
+                        "Value": "log"
+                    }
+                },
+                {
+                    "Type": "flusher_mock"
+                }
+            ]
+        }
+    )";
+    configJson.reset(new Json::Value());
+    APSARA_TEST_TRUE(ParseJsonTable(configStr, *configJson, errorMsg));
+    config.reset(new CollectionConfig(configName, std::move(configJson)));
+    APSARA_TEST_TRUE(config->Parse());
+    APSARA_TEST_EQUAL(2U, config->mRouter.size());
+    pipeline.reset(new CollectionPipeline());
+    APSARA_TEST_TRUE(pipeline->Init(std::move(*config)));
+    APSARA_TEST_TRUE(pipeline->IsRoutingGoPipelineData());
+    // the default flusher_sls in go pipeline returns the data unchanged
+    APSARA_TEST_TRUE(pipeline->mGoPipelineWithoutInput["flushers"].isNull());
+    APSARA_TEST_EQUAL(1U, pipeline->mRouter.mConditions.size());
+    APSARA_TEST_EQUAL(1U, pipeline->mRouter.mAlwaysMatchedFlusherIdx.size());
+
+    // route is not supported with extended flushers
+    configStr = R"(
+        {
+            "inputs": [
+                {
+                    "Type": "input_file",
+                    "FilePaths": [
+                        "/home/test.log"
+                    ]
+                }
+            ],
+            "processors": [
+                {
+                    "Type": "processor_regex"
+                }
+            ],
+            "flushers": [
+                {
+                    "Type": "flusher_sls",
+                    "Project": "test_project",
+                    "Logstore": "test_logstore",
+                    "Region": "test_region",
+                    "Endpoint": "test_endpoint",
+                    "Match": {
+                        "Type": "tag",
+                        "Key": "data_type",
+                        "Value": "log"
+                    }
+                },
+                {
+                    "Type": "flusher_http"
+                }
+            ]
+        }
+    )";
+    configJson.reset(new Json::Value());
+    APSARA_TEST_TRUE(ParseJsonTable(configStr, *configJson, errorMsg));
+    config.reset(new CollectionConfig(configName, std::move(configJson)));
+    APSARA_TEST_FALSE(config->Parse());
+}
+
 UNIT_TEST_CASE(PipelineUnittest, OnSuccessfulInit)
 UNIT_TEST_CASE(PipelineUnittest, OnFailedInit)
 UNIT_TEST_CASE(PipelineUnittest, TestProcessQueue)
@@ -3053,6 +3184,7 @@ UNIT_TEST_CASE(PipelineUnittest, TestFlushBatch)
 UNIT_TEST_CASE(PipelineUnittest, TestInProcessingCount)
 UNIT_TEST_CASE(PipelineUnittest, TestWaitAllItemsInProcessFinished)
 UNIT_TEST_CASE(PipelineUnittest, TestMultiFlusherAndRouter)
+UNIT_TEST_CASE(PipelineUnittest, TestRouteGoPipelineData)
 
 
 } // namespace logtail
@@ -19,11 +19,14 @@
 #include <sstream>
 
 #include "collection_pipeline/plugin/instance/ProcessorInstance.h"
+#include "common/Flags.h"
+#include "common/SimdJsonUtil.h"
 #include "config/CollectionConfig.h"
 #include "models/LogEvent.h"
 #include "plugin/processor/inner/ProcessorParseContainerLogNative.h"
 #include "unittest/Unittest.h"
 
+DECLARE_FLAG_BOOL(enable_simdjson_parser);
 
 using namespace logtail;
 
@@ -276,6 +279,12 @@ int main(int argc, char** argv) {
 #endif
     std::cout << "docker json" << std::endl;
     BM_DockerJson(512, 100);
+    BOOL_FLAG(enable_simdjson_parser) = true;
+    if (IsSimdJsonEnabled()) {
+        std::cout << "docker json with simdjson " << GetSimdJsonImplementation() << std::endl;
+        BM_DockerJson(512, 100);
+    }
+    BOOL_FLAG(enable_simdjson_parser) = false;
     std::cout << "containerdText" << std::endl;
     BM_ContainerdText(512, 100);
     return 0;
@@ -23,7 +23,9 @@
 
 #include "boost/utility/string_view.hpp"
 
+#include "common/Flags.h"
 #include "common/JsonUtil.h"
+#include "common/SimdJsonUtil.h"
 #include "config/CollectionConfig.h"
 #include "constants/Constants.h"
 #include "models/LogEvent.h"
@@ -31,6 +33,9 @@
 #include "plugin/processor/inner/ProcessorParseContainerLogNative.h"
 #include "plugin/processor/inner/ProcessorSplitLogStringNative.h"
 #include "unittest/Unittest.h"
+
+DECLARE_FLAG_BOOL(enable_simdjson_parser);
+
 namespace logtail {
 
 const std::string LOG_BEGIN_STRING = "Exception in thread 'main' java.lang.NullPointerException";
@@ -54,6 +59,7 @@ public:
     void TestDockerJsonLogLineParser();
     void TestKeepingSourceWhenParseFail();
     void TestParseDockerLog();
+    void TestDockerJsonLogLineParserWithSimdJson();
 
     CollectionPipelineContext mContext;
 };
@@ -66,6 +72,7 @@ UNIT_TEST_CASE(ProcessorParseContainerLogNativeUnittest, TestDockerJsonLogLinePa
 UNIT_TEST_CASE(ProcessorParseContainerLogNativeUnittest, TestDockerJsonLogLineParser);
 UNIT_TEST_CASE(ProcessorParseContainerLogNativeUnittest, TestKeepingSourceWhenParseFail);
 UNIT_TEST_CASE(ProcessorParseContainerLogNativeUnittest, TestParseDockerLog);
+UNIT_TEST_CASE(ProcessorParseContainerLogNativeUnittest, TestDockerJsonLogLineParserWithSimdJson);
 // UNIT_TEST_CASE(ProcessorParseContainerLogNativeUnittest, TestFindAndSearchPerformance);
 
 // 生成一个随机字符串
@@ -2260,6 +2267,40 @@ void ProcessorParseContainerLogNativeUnittest::TestParseDockerLog() {
     }
 }
 
+void ProcessorParseContainerLogNativeUnittest::TestDockerJsonLogLineParserWithSimdJson() {
+    Json::Value config;
+    config["IgnoringStdout"] = false;
+    config["IgnoringStderr"] = false;
+    config["KeepingSourceWhenParseFail"] = true;
+    ProcessorParseContainerLogNative processor;
+    processor.SetContext(mContext);
+    processor.SetMetricsRecordRef(ProcessorParseContainerLogNative::sName, "1");
+    APSARA_TEST_TRUE_FATAL(processor.Init(config));
+
+    const std::vector<std::string> logs = {
+        R"({"log":"Hello, world\n","stream":"stdout","time":"2021-12-01T00:00:00.000Z"})",
+        R"({"time":"2021-12-01T00:00:00.000Z","stream":"stderr","log":"\"quoted\"\t\u4e2d\u6587\n"})",
+        R"({"log":"Hello, world\n","attrs":{"tag":"a"},"stream":"stdout","time":"2021-12-01T00:00:00.000Z"})",
+        R"({"log":"","stream":"stdout","time":"2021-12-01T00:00:00.000Z"})",
+        R"({"log":"Hello, world\n","stream":"stdout"})",
+        R"({"log":"Hello, world\n","stream":"stdin","time":"2021-12-01T00:00:00.000Z"})",
+        R"({"log":"Hello, wor)",
+    };
+    auto process = [&](bool simd) {
+        BOOL_FLAG(enable_simdjson_parser) = simd;
+        PipelineEventGroup eventGroup(std::make_shared<SourceBuffer>());
+        eventGroup.SetMetadata(EventGroupMetaKey::LOG_FORMAT, ProcessorParseContainerLogNative::DOCKER_JSON_FILE);
+        for (const auto& log : logs) {
+            eventGroup.AddLogEvent()->SetContent(DEFAULT_CONTENT_KEY, log);
+        }
+        processor.Process(eventGroup);
+        BOOL_FLAG(enable_simdjson_parser) = false;
+        return eventGroup.ToJsonString();
+    };
+    // results should be the same no matter whether simdjson is supported or not
+    APSARA_TEST_EQUAL(process(false), process(true));
+}
+
 } // namespace logtail
 
 UNIT_TEST_MAIN
@@ -11,16 +11,22 @@
 // WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
 // See the License for the specific language governing permissions and
 // limitations under the License.
+#include <chrono>
 #include <cstdlib>
+#include <iostream>
 
 #include "collection_pipeline/plugin/instance/ProcessorInstance.h"
+#include "common/Flags.h"
 #include "common/JsonUtil.h"
+#include "common/SimdJsonUtil.h"
 #include "config/CollectionConfig.h"
 #include "models/LogEvent.h"
 #include "plugin/processor/ProcessorParseJsonNative.h"
 #include "plugin/processor/inner/ProcessorSplitLogStringNative.h"
 #include "unittest/Unittest.h"
 
+DECLARE_FLAG_BOOL(enable_simdjson_parser);
+
 namespace logtail {
 
 class ProcessorParseJsonNativeUnittest : public ::testing::Test {
@@ -36,6 +42,9 @@ public:
     void TestProcessJsonContent();
     void TestProcessJsonRaw();
     void TestMultipleLines();
+    void TestProcessJsonNullByteInRaw();
+    void TestProcessJsonThroughput();
+    void TestProcessJsonWithSimdJson();
 
     CollectionPipelineContext mContext;
 };
@@ -58,6 +67,12 @@ UNIT_TEST_CASE(ProcessorParseJsonNativeUnittest, TestProcessJsonRaw);
 
 UNIT_TEST_CASE(ProcessorParseJsonNativeUnittest, TestMultipleLines);
 
+UNIT_TEST_CASE(ProcessorParseJsonNativeUnittest, TestProcessJsonNullByteInRaw);
+
+UNIT_TEST_CASE(ProcessorParseJsonNativeUnittest, TestProcessJsonThroughput);
+
+UNIT_TEST_CASE(ProcessorParseJsonNativeUnittest, TestProcessJsonWithSimdJson);
+
 PluginInstance::PluginMeta getPluginMeta() {
     PluginInstance::PluginMeta pluginMeta{"1"};
     return pluginMeta;
@@ -689,6 +704,103 @@ void ProcessorParseJsonNativeUnittest::TestProcessEventDiscardUnmatch() {
     APSARA_TEST_GE_FATAL(processorInstance.mTotalProcessTimeMs->GetValue(), uint64_t(0));
 }
 
+void ProcessorParseJsonNativeUnittest::TestProcessJsonNullByteInRaw() {
+    Json::Value config;
+    config["SourceKey"] = "content";
+    config["KeepingSourceWhenParseFail"] = true;
+    ProcessorParseJsonNative& processor = *(new ProcessorParseJsonNative);
+    ProcessorInstance processorInstance(&processor, getPluginMeta());
+    APSARA_TEST_TRUE_FATAL(processorInstance.Init(config, mContext));
+
+    // content with null byte cannot be parsed in situ, and trailing data after null byte is not ignored
+    PipelineEventGroup eventGroup(std::make_shared<SourceBuffer>());
+    {
+        auto e = eventGroup.AddLogEvent();
+        e->SetContent(std::string("content"), std::string("{\"key\":\"value\"}\0{}", 18));
+    }
+    {
+        auto e = eventGroup.AddLogEvent();
+        e->SetContent(std::string("content"), std::string("{\"key\":\"value\"}"));
+    }
+    processor.Process(eventGroup);
+    const auto& events = eventGroup.GetEvents();
+    APSARA_TEST_EQUAL_FATAL(2U, events.size());
+    APSARA_TEST_FALSE(events[0].Cast<LogEvent>().HasContent("key"));
+    APSARA_TEST_EQUAL(18U, events[0].Cast<LogEvent>().GetContent("content").size());
+    APSARA_TEST_EQUAL("value", events[1].Cast<LogEvent>().GetContent("key").to_string());
+    APSARA_TEST_FALSE(events[1].Cast<LogEvent>().HasContent("content"));
+}
+
+void ProcessorParseJsonNativeUnittest::TestProcessJsonThroughput() {
+    Json::Value config;
+    config["SourceKey"] = "content";
+    config["KeepingSourceWhenParseFail"] = true;
+    ProcessorParseJsonNative& processor = *(new ProcessorParseJsonNative);
+    ProcessorInstance processorInstance(&processor, getPluginMeta());
+    APSARA_TEST_TRUE_FATAL(processorInstance.Init(config, mContext));
+
+    const std::string log
+        = R"({"time":"2024-01-01T00:00:00.000Z","level":"INFO","method":"POST","url":"/PutData?Category=Account",)"
+          R"("status":200,"latency":0.0123,"size":10240,"success":true,"client":{"ip":"10.0.0.1","port":54321},)"
+          R"("tags":["a","b","c"],"msg":"request \"processed\" successfully"})";
+    const size_t groupCnt = 100;
+    const size_t eventCnt = 1000;
+    std::chrono::nanoseconds cost(0);
+    for (size_t i = 0; i < groupCnt; ++i) {
+        PipelineEventGroup eventGroup(std::make_shared<SourceBuffer>());
+        for (size_t j = 0; j < eventCnt; ++j) {
+            eventGroup.AddLogEvent()->SetContent(std::string("content"), log);
+        }
+        auto start = std::chrono::steady_clock::now();
+        processor.Process(eventGroup);
+        cost += std::chrono::steady_clock::now() - start;
+
+        APSARA_TEST_EQUAL_FATAL(eventCnt, eventGroup.GetEvents().size());
+        const auto& e = eventGroup.GetEvents()[0].Cast<LogEvent>();
+        APSARA_TEST_EQUAL("200", e.GetContent("status").to_string());
+        APSARA_TEST_EQUAL("{\"ip\":\"10.0.0.1\",\"port\":54321}", e.GetContent("client").to_string());
+        APSARA_TEST_EQUAL("request \"processed\" successfully", e.GetContent("msg").to_string());
+    }
+    double seconds = std::chrono::duration<double>(cost).count();
+    std::cout << "parse json: " << groupCnt * eventCnt / seconds << " events/s, "
+              << groupCnt * eventCnt * log.size() / seconds / 1024 / 1024 << " MB/s" << std::endl;
+}
+
+void ProcessorParseJsonNativeUnittest::TestProcessJsonWithSimdJson() {
+    Json::Value config;
+    config["SourceKey"] = "content";
+    config["KeepingSourceWhenParseFail"] = true;
+    config["KeepingSourceWhenParseSucceed"] = true;
+    ProcessorParseJsonNative& processor = *(new ProcessorParseJsonNative);
+    ProcessorInstance processorInstance(&processor, getPluginMeta());
+    APSARA_TEST_TRUE_FATAL(processorInstance.Init(config, mContext));
+
+    const std::vector<std::string> logs = {
+        R"({"url":"POST /PutData?Category=YunOsAccountOpLog HTTP/1.1","time":"07/Jul/2022:10:30:28"})",
+        R"({"k\"1":"v\"1\n\u4e2d\u6587","k2":"a\/b","content":"overwritten"})",
+        R"({"int":-12,"uint":18446744073709551615,"double":1.5e3,"zero":-0,"big":123456789012345678901234567890})",
+        R"({"true":true,"false":false,"null":null,"empty":""})",
+        R"({"object":{"a":[1, 2.0, "3"],"b":{}}, "array":[ ]})",
+        R"({"key":"value"} )",
+        R"({"key":"value"}{})",
+        R"({"key":"value",})",
+        R"(["value"])",
+        R"("value")",
+    };
+    auto process = [&](bool simd) {
+        BOOL_FLAG(enable_simdjson_parser) = simd;
+        PipelineEventGroup eventGroup(std::make_shared<SourceBuffer>());
+        for (const auto& log : logs) {
+            eventGroup.AddLogEvent()->SetContent(std::string("content"), log);
+        }
+        processor.Process(eventGroup);
+        BOOL_FLAG(enable_simdjson_parser) = false;
+        return eventGroup.ToJsonString();
+    };
+    // results should be the same no matter whether simdjson is supported or not
+    APSARA_TEST_EQUAL(process(false), process(true));
+}
+
 } // namespace logtail
 
 UNIT_TEST_MAIN
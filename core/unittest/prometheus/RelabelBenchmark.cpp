@@ -0,0 +1,134 @@
+/*
+ * Copyright 2025 iLogtail Authors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <json/json.h>
+
+#include <chrono>
+#include <string>
+#include <vector>
+
+#include "common/Flags.h"
+#include "common/JsonUtil.h"
+#include "models/PipelineEventGroup.h"
+#include "prometheus/labels/Relabel.h"
+#include "unittest/Unittest.h"
+
+DECLARE_FLAG_BOOL(enable_prom_relabel_fast_path);
+
+using namespace std;
+
+namespace logtail {
+
+// Relabel the series of kube-state-metrics with a typical metric_relabel_configs, which keeps some metrics by name,
+// drops system namespaces and some churning series, and trims labels, with and without the fast path.
+class RelabelBenchmark : public testing::Test {
+public:
+    void TestKubeStateMetrics();
+
+protected:
+    void SetUp() override {
+        mNames = {"kube_pod_info",
+                  "kube_pod_status_phase",
+                  "kube_pod_status_ready",
+                  "kube_pod_container_status_restarts_total",
+                  "kube_pod_container_resource_requests",
+                  "kube_pod_container_resource_limits",
+                  "kube_pod_labels",
+                  "kube_pod_created",
+                  "kube_pod_owner",
+                  "kube_pod_start_time",
+                  "kube_deployment_status_replicas",
+                  "kube_deployment_spec_replicas",
+                  "kube_replicaset_owner",
+                  "kube_node_status_condition",
+                  "kube_service_info",
+                  "kube_configmap_info"};
+        mNamespaces = {"default", "kube-system", "monitoring", "app-prod", "app-staging", "batch-jobs"};
+    }
+
+private:
+    double Run(bool fastPath, size_t& kept);
+
+    vector<string> mNames;
+    vector<string> mNamespaces;
+    size_t mSeriesCnt = 100000;
+    size_t mRounds = 10;
+    string mConfig = R"JSON(
+        [
+            {
+                "action": "keep",
+                "source_labels": ["__name__"],
+                "regex": "kube_pod_info|kube_pod_status_phase|kube_pod_status_ready|kube_pod_container_status_restarts_total|kube_pod_container_resource_requests|kube_pod_container_resource_limits|kube_pod_labels|kube_pod_owner|kube_pod_created|kube_deployment_status_replicas|kube_deployment_spec_replicas|kube_node_status_condition"
+            },
+            {"action": "drop", "source_labels": ["namespace"], "regex": "kube-system|monitoring"},
+            {"action": "drop", "source_labels": ["__name__"], "regex": "kube_pod_created"},
+            {"action": "drop", "source_labels": ["namespace", "pod"], "separator": "/", "regex": "batch-.*/.*-[0-9]+"},
+            {"action": "labeldrop", "regex": "uid|container_id"},
+            {"action": "replace", "source_labels": ["pod"], "regex": "(.*)", "target_label": "pod_name"}
+        ]
+    )JSON";
+};
+
+double RelabelBenchmark::Run(bool fastPath, size_t& kept) {
+    BOOL_FLAG(enable_prom_relabel_fast_path) = fastPath;
+    Json::Value configJson;
+    string errorMsg;
+    ParseJsonTable(mConfig, configJson, errorMsg);
+    RelabelConfigList configList;
+    configList.Init(configJson);
+    BOOL_FLAG(enable_prom_relabel_fast_path) = true;
+
+    chrono::steady_clock::duration elapsed{};
+    kept = 0;
+    for (size_t round = 0; round < mRounds; ++round) {
+        PipelineEventGroup group(make_shared<SourceBuffer>());
+        for (size_t i = 0; i < mSeriesCnt; ++i) {
+            auto* e = group.AddMetricEvent();
+            e->SetName(mNames[i % mNames.size()]);
+            e->SetTag(string("namespace"), mNamespaces[i / mNames.size() % mNamespaces.size()]);
+            e->SetTag(string("pod"), "pod-" + to_string(i % 1000));
+            e->SetTag(string("container"), string("main"));
+            e->SetTag(string("uid"), "7d2b3c1e-" + to_string(i));
+            e->SetTag(string("node"), "node-" + to_string(i % 50));
+        }
+        auto start = chrono::steady_clock::now();
+        for (auto& e : group.MutableEvents()) {
+            if (configList.Process(e.Cast<MetricEvent>())) {
+                ++kept;
+            }
+        }
+        elapsed += chrono::steady_clock::now() - start;
+    }
+    return chrono::duration<double, nano>(elapsed).count() / (mSeriesCnt * mRounds);
+}
+
+void RelabelBenchmark::TestKubeStateMetrics() {
+    size_t regexKept = 0, fastKept = 0;
+    double regexCost = Run(false, regexKept);
+    double fastCost = Run(true, fastKept);
+    APSARA_TEST_EQUAL(regexKept, fastKept);
+    cout << "regex: kept " << regexKept << ", " << regexCost << "ns per series" << endl;
+    cout << "fast path: kept " << fastKept << ", " << fastCost << "ns per series" << endl;
+    // Result (1 core, release mode, 100k series x 10 rounds):
+    // regex: kept 343750, 2130.99ns per series
+    // fast path: kept 343750, 380.438ns per series
+}
+
+UNIT_TEST_CASE(RelabelBenchmark, TestKubeStateMetrics)
+
+} // namespace logtail
+
+UNIT_TEST_MAIN
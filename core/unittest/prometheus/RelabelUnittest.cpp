@@ -19,10 +19,14 @@
 #include <boost/regex.hpp>
 #include <string>
 
+#include "common/Flags.h"
 #include "common/JsonUtil.h"
+#include "models/PipelineEventGroup.h"
 #include "prometheus/labels/Relabel.h"
 #include "unittest/Unittest.h"
 
+DECLARE_FLAG_BOOL(enable_prom_relabel_fast_path);
+
 using namespace std;
 
 namespace logtail {
@@ -49,6 +53,8 @@ public:
     void TestLowerCase();
     void TestUpperCase();
     void TestMultiRelabel();
+    void TestRegexMatcher();
+    void TestFilterMetricEvent();
 };
 
 
@@ -512,6 +518,115 @@ void RelabelConfigUnittest::TestMultiRelabel() {
     APSARA_TEST_TRUE(configList.Process(result));
 }
 
+void RelabelConfigUnittest::TestRegexMatcher() {
+    auto compile = [](const string& re) {
+        RegexMatcher matcher;
+        matcher.Compile(re);
+        return matcher;
+    };
+    APSARA_TEST_TRUE(RegexMatcher::Type::ALL == compile(".*").GetType());
+    APSARA_TEST_TRUE(RegexMatcher::Type::ALL == compile("(.*)").GetType());
+    APSARA_TEST_TRUE(RegexMatcher::Type::ALL == compile("().*").GetType());
+
+    auto literal = compile("kube_pod_info");
+    APSARA_TEST_TRUE(RegexMatcher::Type::LITERAL == literal.GetType());
+    APSARA_TEST_TRUE(literal.Match("kube_pod_info"));
+    APSARA_TEST_FALSE(literal.Match("kube_pod_info_total"));
+    APSARA_TEST_FALSE(literal.Match("kube_pod"));
+    auto escaped = compile("10\\.0\\.0\\.1");
+    APSARA_TEST_TRUE(RegexMatcher::Type::LITERAL == escaped.GetType());
+    APSARA_TEST_TRUE(escaped.Match("10.0.0.1"));
+    APSARA_TEST_FALSE(escaped.Match("10a0b0c1"));
+
+    auto prefix = compile("(kube_pod_.*)");
+    APSARA_TEST_TRUE(RegexMatcher::Type::PREFIX == prefix.GetType());
+    APSARA_TEST_TRUE(prefix.Match("kube_pod_"));
+    APSARA_TEST_TRUE(prefix.Match("kube_pod_info"));
+    APSARA_TEST_FALSE(prefix.Match("kube_node_info"));
+
+    auto alternation = compile("(?:kube-system|monitoring|)");
+    APSARA_TEST_TRUE(RegexMatcher::Type::ALTERNATION == alternation.GetType());
+    APSARA_TEST_TRUE(alternation.Match("kube-system"));
+    APSARA_TEST_TRUE(alternation.Match("monitoring"));
+    APSARA_TEST_TRUE(alternation.Match(""));
+    APSARA_TEST_FALSE(alternation.Match("kube-system2"));
+    // the copy shares the alternatives
+    auto copied = alternation;
+    alternation = RegexMatcher();
+    APSARA_TEST_TRUE(copied.Match("monitoring"));
+
+    // left to boost::regex
+    APSARA_TEST_TRUE(RegexMatcher::Type::REGEX == compile("kube_.*_created").GetType());
+    APSARA_TEST_TRUE(RegexMatcher::Type::REGEX == compile("(a)|(b)").GetType());
+    APSARA_TEST_TRUE(RegexMatcher::Type::REGEX == compile("(?!a)b").GetType());
+    APSARA_TEST_TRUE(RegexMatcher::Type::REGEX == compile("\\d+").GetType());
+    APSARA_TEST_TRUE(RegexMatcher::Type::REGEX == compile("a\\.*").GetType());
+    APSARA_TEST_TRUE(RegexMatcher::Type::REGEX == compile("a|b.*").GetType());
+}
+
+void RelabelConfigUnittest::TestFilterMetricEvent() {
+    Json::Value configJson;
+    string errorMsg;
+    string configStr = R"(
+        [
+            {"action": "keep", "source_labels": ["__name__"], "regex": "kube_pod_.*"},
+            {"action": "drop", "source_labels": ["namespace", "pod"], "separator": "/", "regex": "kube-.*/.*-[0-9]+"},
+            {"action": "drop", "source_labels": ["namespace"], "regex": "kube-system|monitoring"},
+            {"action": "dropmetric", "match_list": ["kube_pod_created"]},
+            {"action": "labeldrop", "regex": "uid"},
+            {"action": "keepequal", "source_labels": ["pod"], "target_label": "pod_name"}
+        ]
+    )";
+    APSARA_TEST_TRUE(ParseJsonTable(configStr, configJson, errorMsg));
+    RelabelConfigList configList;
+    APSARA_TEST_TRUE(configList.Init(configJson));
+    APSARA_TEST_EQUAL(3U, configList.mSteps.size());
+    APSARA_TEST_TRUE(configList.mSteps[0].mIsFilter);
+    // the rule with a regex runs last
+    APSARA_TEST_EQUAL((vector<size_t>{0, 2, 3, 1}), configList.mSteps[0].mConfigIndexes);
+    APSARA_TEST_FALSE(configList.mSteps[1].mIsFilter);
+    APSARA_TEST_TRUE(configList.mSteps[2].mIsFilter);
+
+    BOOL_FLAG(enable_prom_relabel_fast_path) = false;
+    RelabelConfigList slowConfigList;
+    APSARA_TEST_TRUE(slowConfigList.Init(configJson));
+    BOOL_FLAG(enable_prom_relabel_fast_path) = true;
+    APSARA_TEST_EQUAL(6U, slowConfigList.mSteps.size());
+
+    auto process = [](const RelabelConfigList& list,
+                      const string& name,
+                      const string& ns,
+                      const string& pod,
+                      const string& podName,
+                      size_t& tagsSize) {
+        PipelineEventGroup group(make_shared<SourceBuffer>());
+        auto* e = group.AddMetricEvent();
+        e->SetName(name);
+        e->SetTag(string("namespace"), ns);
+        e->SetTag(string("pod"), pod);
+        e->SetTag(string("pod_name"), podName);
+        e->SetTag(string("uid"), string("123"));
+        bool res = list.Process(*e);
+        tagsSize = e->TagsSize();
+        return res;
+    };
+    vector<vector<string>> cases = {{"kube_pod_info", "default", "nginx-abc", "nginx-abc"},
+                                    {"kube_node_info", "default", "nginx-abc", "nginx-abc"},
+                                    {"kube_pod_info", "kube-proxy", "proxy-0", "proxy-0"},
+                                    {"kube_pod_info", "kube-proxy", "proxy-a", "proxy-a"},
+                                    {"kube_pod_info", "monitoring", "nginx-abc", "nginx-abc"},
+                                    {"kube_pod_created", "default", "nginx-abc", "nginx-abc"},
+                                    {"kube_pod_info", "default", "nginx-abc", "nginx"}};
+    vector<bool> expected = {true, false, false, true, false, false, false};
+    for (size_t i = 0; i < cases.size(); ++i) {
+        size_t fastTagsSize = 0, slowTagsSize = 0;
+        const auto& c = cases[i];
+        APSARA_TEST_EQUAL(static_cast<bool>(expected[i]), process(configList, c[0], c[1], c[2], c[3], fastTagsSize));
+        APSARA_TEST_EQUAL(static_cast<bool>(expected[i]), process(slowConfigList, c[0], c[1], c[2], c[3], slowTagsSize));
+        APSARA_TEST_EQUAL(slowTagsSize, fastTagsSize);
+    }
+}
+
 UNIT_TEST_CASE(ActionConverterUnittest, TestStringToAction)
 UNIT_TEST_CASE(ActionConverterUnittest, TestActionToString)
 
@@ -529,6 +644,8 @@ UNIT_TEST_CASE(RelabelConfigUnittest, TestKeepEqual)
 UNIT_TEST_CASE(RelabelConfigUnittest, TestLowerCase)
 UNIT_TEST_CASE(RelabelConfigUnittest, TestUpperCase)
 UNIT_TEST_CASE(RelabelConfigUnittest, TestMultiRelabel)
+UNIT_TEST_CASE(RelabelConfigUnittest, TestRegexMatcher)
+UNIT_TEST_CASE(RelabelConfigUnittest, TestFilterMetricEvent)
 
 } // namespace logtail
 
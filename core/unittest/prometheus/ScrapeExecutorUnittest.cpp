@@ -0,0 +1,193 @@
+// Copyright 2025 iLogtail Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <memory>
+#include <thread>
+
+#include "common/Flags.h"
+#include "common/http/AsynCurlRunner.h"
+#include "common/http/HttpResponse.h"
+#include "prometheus/async/PromHttpRequest.h"
+#include "prometheus/component/ScrapeExecutor.h"
+#include "unittest/Unittest.h"
+
+DECLARE_FLAG_INT32(prom_scrape_max_in_flight);
+DECLARE_FLAG_INT64(prom_scrape_max_in_flight_bytes);
+
+using namespace std;
+
+namespace logtail {
+
+class ScrapeExecutorUnittest : public testing::Test {
+public:
+    void TestInFlightLimit();
+    void TestInFlightBytesLimit();
+    void TestLargeScrape();
+    void TestClear();
+    void TestCancelledRequest();
+
+protected:
+    void TearDown() override {
+        ScrapeExecutor::GetInstance()->Clear();
+        ScrapeExecutor::GetInstance()->mInFlightCnt = 0;
+        ScrapeExecutor::GetInstance()->mInFlightSize = 0;
+        AsynCurlRunner::GetInstance()->mQueue.Clear();
+        INT32_FLAG(prom_scrape_max_in_flight) = 256;
+        INT64_FLAG(prom_scrape_max_in_flight_bytes) = 256 * 1024 * 1024;
+    }
+
+private:
+    unique_ptr<PromHttpRequest> CreateRequest(uint64_t estimatedSize,
+                                              CounterPtr queueDelayMs = nullptr,
+                                              shared_ptr<PromFuture<HttpResponse&, uint64_t>> future = nullptr) {
+        auto request = make_unique<PromHttpRequest>("GET",
+                                                    false,
+                                                    "127.0.0.1",
+                                                    8080,
+                                                    "/metrics",
+                                                    "",
+                                                    map<string, string>(),
+                                                    "",
+                                                    HttpResponse(),
+                                                    10,
+                                                    3,
+                                                    std::move(future));
+        request->SetScrapeStat(estimatedSize, std::move(queueDelayMs));
+        return request;
+    }
+
+    // pop a started request and finish it
+    void FinishOne() {
+        unique_ptr<AsynHttpRequest> request;
+        APSARA_TEST_TRUE(AsynCurlRunner::GetInstance()->mQueue.TryPop(request));
+        request->OnSendDone(request->mResponse);
+    }
+};
+
+void ScrapeExecutorUnittest::TestInFlightLimit() {
+    INT32_FLAG(prom_scrape_max_in_flight) = 2;
+    INT64_FLAG(prom_scrape_max_in_flight_bytes) = 0;
+    auto executor = ScrapeExecutor::GetInstance();
+    auto queueDelayMs = make_shared<Counter>("queue_delay_ms");
+
+    executor->Submit(CreateRequest(10));
+    executor->Submit(CreateRequest(10));
+    executor->Submit(CreateRequest(10, queueDelayMs));
+    APSARA_TEST_EQUAL(2U, executor->mInFlightCnt);
+    APSARA_TEST_EQUAL(20U, executor->mInFlightSize);
+    APSARA_TEST_EQUAL(1U, executor->mWaitingQueue.size());
+    APSARA_TEST_EQUAL(2U, AsynCurlRunner::GetInstance()->mQueue.Size());
+    APSARA_TEST_EQUAL(1U, executor->mQueuedTotal->GetValue());
+
+    this_thread::sleep_for(chrono::milliseconds(10));
+    FinishOne();
+    APSARA_TEST_EQUAL(2U, executor->mInFlightCnt);
+    APSARA_TEST_EQUAL(0U, executor->mWaitingQueue.size());
+    APSARA_TEST_EQUAL(2U, AsynCurlRunner::GetInstance()->mQueue.Size());
+    APSARA_TEST_TRUE(queueDelayMs->GetValue() >= 10U);
+    APSARA_TEST_EQUAL(queueDelayMs->GetValue(), executor->mQueueDelayMs->GetValue());
+
+    FinishOne();
+    FinishOne();
+    APSARA_TEST_EQUAL(0U, executor->mInFlightCnt);
+    APSARA_TEST_EQUAL(0U, executor->mInFlightSize);
+}
+
+void ScrapeExecutorUnittest::TestInFlightBytesLimit() {
+    INT32_FLAG(prom_scrape_max_in_flight) = 0;
+    INT64_FLAG(prom_scrape_max_in_flight_bytes) = 100;
+    auto executor = ScrapeExecutor::GetInstance();
+
+    executor->Submit(CreateRequest(60));
+    executor->Submit(CreateRequest(60));
+    // fits, but waits behind the large one
+    executor->Submit(CreateRequest(10));
+    APSARA_TEST_EQUAL(1U, executor->mInFlightCnt);
+    APSARA_TEST_EQUAL(2U, executor->mWaitingQueue.size());
+
+    FinishOne();
+    APSARA_TEST_EQUAL(2U, executor->mInFlightCnt);
+    APSARA_TEST_EQUAL(70U, executor->mInFlightSize);
+    APSARA_TEST_EQUAL(0U, executor->mWaitingQueue.size());
+}
+
+void ScrapeExecutorUnittest::TestLargeScrape() {
+    INT32_FLAG(prom_scrape_max_in_flight) = 0;
+    INT64_FLAG(prom_scrape_max_in_flight_bytes) = 100;
+    auto executor = ScrapeExecutor::GetInstance();
+
+    // started at once when nothing is in flight, otherwise it would never be scraped
+    executor->Submit(CreateRequest(200));
+    APSARA_TEST_EQUAL(1U, executor->mInFlightCnt);
+    executor->Submit(CreateRequest(1));
+    APSARA_TEST_EQUAL(1U, executor->mWaitingQueue.size());
+
+    FinishOne();
+    APSARA_TEST_EQUAL(1U, executor->mInFlightCnt);
+    APSARA_TEST_EQUAL(1U, executor->mInFlightSize);
+    FinishOne();
+    APSARA_TEST_EQUAL(0U, executor->mInFlightCnt);
+}
+
+void ScrapeExecutorUnittest::TestClear() {
+    INT32_FLAG(prom_scrape_max_in_flight) = 1;
+    INT64_FLAG(prom_scrape_max_in_flight_bytes) = 0;
+    auto executor = ScrapeExecutor::GetInstance();
+
+    executor->Submit(CreateRequest(10));
+    executor->Submit(CreateRequest(10));
+    executor->Clear();
+    // the started request is still in flight
+    APSARA_TEST_EQUAL(1U, executor->mInFlightCnt);
+    APSARA_TEST_EQUAL(10U, executor->mInFlightSize);
+    APSARA_TEST_EQUAL(0U, executor->mWaitingQueue.size());
+
+    FinishOne();
+    APSARA_TEST_EQUAL(0U, executor->mInFlightCnt);
+    APSARA_TEST_EQUAL(0U, executor->mInFlightSize);
+    APSARA_TEST_EQUAL(0U, AsynCurlRunner::GetInstance()->mQueue.Size());
+}
+
+void ScrapeExecutorUnittest::TestCancelledRequest() {
+    INT32_FLAG(prom_scrape_max_in_flight) = 1;
+    INT64_FLAG(prom_scrape_max_in_flight_bytes) = 0;
+    auto executor = ScrapeExecutor::GetInstance();
+    auto cancelledFuture = make_shared<PromFuture<HttpResponse&, uint64_t>>();
+
+    executor->Submit(CreateRequest(10));
+    executor->Submit(CreateRequest(10, nullptr, cancelledFuture));
+    executor->Submit(CreateRequest(10));
+    APSARA_TEST_EQUAL(2U, executor->mWaitingQueue.size());
+    cancelledFuture->Cancel();
+
+    // the cancelled request is dropped and the next one is started
+    FinishOne();
+    APSARA_TEST_EQUAL(1U, executor->mInFlightCnt);
+    APSARA_TEST_EQUAL(0U, executor->mWaitingQueue.size());
+    unique_ptr<AsynHttpRequest> request;
+    APSARA_TEST_TRUE(AsynCurlRunner::GetInstance()->mQueue.TryPop(request));
+    APSARA_TEST_FALSE(static_cast<PromHttpRequest*>(request.get())->IsCancelled());
+    request->OnSendDone(request->mResponse);
+    APSARA_TEST_EQUAL(0U, executor->mInFlightCnt);
+}
+
+UNIT_TEST_CASE(ScrapeExecutorUnittest, TestInFlightLimit)
+UNIT_TEST_CASE(ScrapeExecutorUnittest, TestInFlightBytesLimit)
+UNIT_TEST_CASE(ScrapeExecutorUnittest, TestLargeScrape)
+UNIT_TEST_CASE(ScrapeExecutorUnittest, TestClear)
+UNIT_TEST_CASE(ScrapeExecutorUnittest, TestCancelledRequest)
+
+} // namespace logtail
+
+UNIT_TEST_MAIN
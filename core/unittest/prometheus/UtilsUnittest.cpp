@@ -18,6 +18,7 @@ public:
     void TestSizeToByte();
     void TestNetworkCodeToString();
     void TestHttpCodeToState();
+    void TestGetRandSpreadMilliSec();
 };
 
 void PromUtilsUnittest::TestDurationToSecond() {
@@ -72,11 +73,27 @@ void PromUtilsUnittest::TestHttpCodeToState() {
     APSARA_TEST_EQUAL("OK", prom::HttpCodeToState(200));
 }
 
+void PromUtilsUnittest::TestGetRandSpreadMilliSec() {
+    APSARA_TEST_EQUAL(0UL, GetRandSpreadMilliSec("target", 0));
+    APSARA_TEST_EQUAL(GetRandSpreadMilliSec("target", 15000), GetRandSpreadMilliSec("target", 15000));
+    // targets are spread over the whole window
+    uint64_t minSpread = 15000, maxSpread = 0;
+    for (int i = 0; i < 1000; ++i) {
+        auto spread = GetRandSpreadMilliSec("target" + std::to_string(i), 15000);
+        APSARA_TEST_TRUE(spread < 15000);
+        minSpread = std::min(minSpread, spread);
+        maxSpread = std::max(maxSpread, spread);
+    }
+    APSARA_TEST_TRUE(minSpread < 1000);
+    APSARA_TEST_TRUE(maxSpread > 14000);
+}
+
 UNIT_TEST_CASE(PromUtilsUnittest, TestDurationToSecond);
 UNIT_TEST_CASE(PromUtilsUnittest, TestSecondToDuration);
 UNIT_TEST_CASE(PromUtilsUnittest, TestSizeToByte);
 UNIT_TEST_CASE(PromUtilsUnittest, TestNetworkCodeToString);
 UNIT_TEST_CASE(PromUtilsUnittest, TestHttpCodeToState);
+UNIT_TEST_CASE(PromUtilsUnittest, TestGetRandSpreadMilliSec);
 
 } // namespace logtail
 
@@ -34,6 +34,7 @@ public:
     void TestSetQueueUpstreamAndDownStream();
     void TestPushQueue();
     void TestPopItem();
+    void TestCpuFairSchedule();
     void TestIsAllQueueEmpty();
     void OnPipelineUpdate();
 
@@ -323,6 +324,60 @@ void ProcessQueueManagerUnittest::TestPopItem() {
     APSARA_TEST_TRUE(sProcessQueueManager->mCurrentQueueIndex.second == sProcessQueueManager->mQueues[key1].first);
 }
 
+void ProcessQueueManagerUnittest::TestCpuFairSchedule() {
+    unique_ptr<ProcessQueueItem> item;
+    string configName;
+    CollectionPipelineContext ctx;
+
+    ctx.SetConfigName("test_config_1");
+    QueueKey key1 = QueueKeyManager::GetInstance()->GetKey("test_config_1");
+    sProcessQueueManager->CreateOrUpdateBoundedQueue(key1, 0, ctx);
+    sProcessQueueManager->EnablePop("test_config_1");
+    ctx.SetConfigName("test_config_2");
+    QueueKey key2 = QueueKeyManager::GetInstance()->GetKey("test_config_2");
+    sProcessQueueManager->CreateOrUpdateBoundedQueue(key2, 0, ctx);
+    sProcessQueueManager->EnablePop("test_config_2");
+    ctx.SetConfigName("test_config_3");
+    QueueKey key3 = QueueKeyManager::GetInstance()->GetKey("test_config_3");
+    sProcessQueueManager->CreateOrUpdateBoundedQueue(key3, 0, ctx);
+    sProcessQueueManager->EnablePop("test_config_3");
+    auto& que1 = *sProcessQueueManager->mQueues[key1].first;
+    auto& que2 = *sProcessQueueManager->mQueues[key2].first;
+    auto& que3 = *sProcessQueueManager->mQueues[key3].first;
+
+    // queue 3 is idle and does not take part in sharing
+    sProcessQueueManager->AddCpuTime(key1, chrono::milliseconds(90));
+    sProcessQueueManager->AddCpuTime(key2, chrono::milliseconds(10));
+    APSARA_TEST_EQUAL(90000000U, que1->GetCpuTime());
+    sProcessQueueManager->PushQueue(key1, GenerateItem());
+    sProcessQueueManager->PushQueue(key1, GenerateItem());
+    sProcessQueueManager->PushQueue(key2, GenerateItem());
+    sProcessQueueManager->mCurrentQueueIndex = {0, sProcessQueueManager->mQueues[key1].first};
+    sProcessQueueManager->mLastCpuShareUpdateTime = chrono::steady_clock::time_point();
+
+    // queue 1 exceeds its share, so queue 2 is served first
+    APSARA_TEST_TRUE(sProcessQueueManager->PopItem(0, item, configName));
+    APSARA_TEST_EQUAL("test_config_2", configName);
+    APSARA_TEST_TRUE(que1->IsOverCpuShare());
+    APSARA_TEST_EQUAL(1U, que1->mOverCpuShareFlag->GetValue());
+    APSARA_TEST_FALSE(que2->IsOverCpuShare());
+    APSARA_TEST_FALSE(que3->IsOverCpuShare());
+    APSARA_TEST_EQUAL(45000000U, que1->GetCpuTime());
+    // queue 1 is still served when other queues have nothing to pop
+    APSARA_TEST_TRUE(sProcessQueueManager->PopItem(0, item, configName));
+    APSARA_TEST_EQUAL("test_config_1", configName);
+
+    // share is weighted
+    sProcessQueueManager->SetCpuWeight(key1, 9);
+    sProcessQueueManager->AddCpuTime(key1, chrono::milliseconds(45));
+    sProcessQueueManager->AddCpuTime(key2, chrono::milliseconds(5));
+    sProcessQueueManager->mLastCpuShareUpdateTime = chrono::steady_clock::time_point();
+    APSARA_TEST_TRUE(sProcessQueueManager->PopItem(0, item, configName));
+    APSARA_TEST_EQUAL("test_config_1", configName);
+    APSARA_TEST_FALSE(que1->IsOverCpuShare());
+    APSARA_TEST_EQUAL(0U, que1->mOverCpuShareFlag->GetValue());
+}
+
 void ProcessQueueManagerUnittest::TestIsAllQueueEmpty() {
     CollectionPipelineContext ctx;
     ctx.SetConfigName("test_config_1");
@@ -475,6 +530,7 @@ UNIT_TEST_CASE(ProcessQueueManagerUnittest, TestDeleteQueue)
 UNIT_TEST_CASE(ProcessQueueManagerUnittest, TestSetQueueUpstreamAndDownStream)
 UNIT_TEST_CASE(ProcessQueueManagerUnittest, TestPushQueue)
 UNIT_TEST_CASE(ProcessQueueManagerUnittest, TestPopItem)
+UNIT_TEST_CASE(ProcessQueueManagerUnittest, TestCpuFairSchedule)
 UNIT_TEST_CASE(ProcessQueueManagerUnittest, TestIsAllQueueEmpty)
 UNIT_TEST_CASE(ProcessQueueManagerUnittest, OnPipelineUpdate)
 
@@ -0,0 +1,182 @@
+// Copyright 2025 iLogtail Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <ctime>
+
+#include <fstream>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "boost/filesystem.hpp"
+
+#include "common/DevInode.h"
+#include "file_server/reader/GloablFileDescriptorManager.h"
+#include "file_server/reader/LogFileReader.h"
+#include "unittest/Unittest.h"
+
+DECLARE_FLAG_INT32(max_reader_open_files);
+
+using namespace std;
+
+namespace logtail {
+
+class GloablFileDescriptorManagerUnittest : public testing::Test {
+public:
+    void TestEvictLeastRecentlyUsed();
+    void TestSkipHotAndDeletedFile();
+    void TestReopen();
+    void TestRotateAfterEvict();
+
+protected:
+    void SetUp() override {
+        mMaxReaderOpenFiles = INT32_FLAG(max_reader_open_files);
+        INT32_FLAG(max_reader_open_files) = 2;
+        boost::filesystem::create_directories(mDir);
+        for (size_t i = 0; i < 3; ++i) {
+            string fileName = to_string(i) + ".log";
+            ofstream(mDir + "/" + fileName) << "";
+            mReaders.emplace_back(new LogFileReader(mDir,
+                                                    fileName,
+                                                    GetFileDevInode(mDir + "/" + fileName),
+                                                    make_pair(&mReaderOpts, &mCtx),
+                                                    make_pair(&mMultilineOpts, &mCtx),
+                                                    make_pair(&mTagOpts, &mCtx)));
+        }
+        GloablFileDescriptorManager::GetInstance()->GetAndResetOpenCnt();
+        GloablFileDescriptorManager::GetInstance()->GetAndResetReopenCnt();
+        GloablFileDescriptorManager::GetInstance()->GetAndResetEvictCnt();
+    }
+
+    void TearDown() override {
+        mReaders.clear();
+        boost::filesystem::remove_all(mDir);
+        INT32_FLAG(max_reader_open_files) = mMaxReaderOpenFiles;
+    }
+
+private:
+    vector<LogFileReaderPtr> mReaders;
+    FileReaderOptions mReaderOpts;
+    MultilineOptions mMultilineOpts;
+    FileTagOptions mTagOpts;
+    CollectionPipelineContext mCtx;
+    string mDir = "GloablFileDescriptorManagerUnittest";
+    int32_t mMaxReaderOpenFiles = 0;
+};
+
+void GloablFileDescriptorManagerUnittest::TestEvictLeastRecentlyUsed() {
+    auto manager = GloablFileDescriptorManager::GetInstance();
+    APSARA_TEST_TRUE(mReaders[0]->UpdateFilePtr());
+    APSARA_TEST_TRUE(mReaders[1]->UpdateFilePtr());
+    APSARA_TEST_EQUAL(2, manager->GetOpenedFilePtrSize());
+    // reader 0 becomes the most recently used
+    APSARA_TEST_TRUE(mReaders[0]->UpdateFilePtr());
+
+    APSARA_TEST_TRUE(mReaders[2]->UpdateFilePtr());
+    APSARA_TEST_EQUAL(2, manager->GetOpenedFilePtrSize());
+    APSARA_TEST_TRUE(mReaders[0]->IsFileOpened());
+    APSARA_TEST_FALSE(mReaders[1]->IsFileOpened());
+    APSARA_TEST_TRUE(mReaders[1]->mFdEvicted);
+    APSARA_TEST_TRUE(mReaders[2]->IsFileOpened());
+    APSARA_TEST_EQUAL(3U, manager->GetAndResetOpenCnt());
+    APSARA_TEST_EQUAL(1U, manager->GetAndResetEvictCnt());
+
+    mReaders[0]->CloseFilePtr();
+    mReaders[2]->CloseFilePtr();
+    APSARA_TEST_EQUAL(0, manager->GetOpenedFilePtrSize());
+}
+
+void GloablFileDescriptorManagerUnittest::TestSkipHotAndDeletedFile() {
+    auto manager = GloablFileDescriptorManager::GetInstance();
+    APSARA_TEST_TRUE(mReaders[0]->UpdateFilePtr());
+    APSARA_TEST_TRUE(mReaders[1]->UpdateFilePtr());
+    mReaders[0]->mLastMTime = time(nullptr);
+    mReaders[1]->SetFileDeleted(true);
+
+    errno = 0;
+    APSARA_TEST_FALSE(mReaders[2]->UpdateFilePtr());
+    APSARA_TEST_EQUAL(EMFILE, errno);
+    APSARA_TEST_TRUE(mReaders[0]->IsFileOpened());
+    APSARA_TEST_TRUE(mReaders[1]->IsFileOpened());
+    APSARA_TEST_EQUAL(0U, manager->GetAndResetEvictCnt());
+
+    // file which is not read to end is never evicted
+    mReaders[0]->mLastMTime = 0;
+    mReaders[0]->mLastFileSize = 100;
+    errno = 0;
+    APSARA_TEST_FALSE(mReaders[2]->UpdateFilePtr());
+    APSARA_TEST_EQUAL(EMFILE, errno);
+    APSARA_TEST_TRUE(mReaders[0]->IsFileOpened());
+
+    mReaders[0]->mLastFileSize = 0;
+    APSARA_TEST_TRUE(mReaders[2]->UpdateFilePtr());
+    APSARA_TEST_FALSE(mReaders[0]->IsFileOpened());
+    APSARA_TEST_EQUAL(1U, manager->GetAndResetEvictCnt());
+
+    mReaders[1]->CloseFilePtr();
+    mReaders[2]->CloseFilePtr();
+    APSARA_TEST_EQUAL(0, manager->GetOpenedFilePtrSize());
+}
+
+void GloablFileDescriptorManagerUnittest::TestReopen() {
+    auto manager = GloablFileDescriptorManager::GetInstance();
+    APSARA_TEST_TRUE(mReaders[0]->UpdateFilePtr());
+    APSARA_TEST_TRUE(mReaders[1]->UpdateFilePtr());
+    APSARA_TEST_TRUE(mReaders[2]->UpdateFilePtr());
+    APSARA_TEST_FALSE(mReaders[0]->IsFileOpened());
+
+    // evicted file is reopened lazily by dev inode
+    APSARA_TEST_TRUE(mReaders[0]->UpdateFilePtr());
+    APSARA_TEST_TRUE(mReaders[0]->IsFileOpened());
+    APSARA_TEST_FALSE(mReaders[0]->mFdEvicted);
+    APSARA_TEST_FALSE(mReaders[1]->IsFileOpened());
+    APSARA_TEST_EQUAL(4U, manager->GetAndResetOpenCnt());
+    APSARA_TEST_EQUAL(1U, manager->GetAndResetReopenCnt());
+    APSARA_TEST_EQUAL(2U, manager->GetAndResetEvictCnt());
+
+    mReaders[0]->CloseFilePtr();
+    mReaders[2]->CloseFilePtr();
+    APSARA_TEST_EQUAL(0, manager->GetOpenedFilePtrSize());
+}
+
+void GloablFileDescriptorManagerUnittest::TestRotateAfterEvict() {
+    APSARA_TEST_TRUE(mReaders[0]->UpdateFilePtr());
+    APSARA_TEST_TRUE(mReaders[1]->UpdateFilePtr());
+    APSARA_TEST_TRUE(mReaders[2]->UpdateFilePtr());
+    APSARA_TEST_FALSE(mReaders[0]->IsFileOpened());
+
+    // file is rotated and appended while its fd is evicted
+    boost::filesystem::rename(mDir + "/0.log", mDir + "/0.log.1");
+    ofstream(mDir + "/0.log.1", ios::app) << "appended after eviction\n";
+    ofstream(mDir + "/0.log") << "new file\n";
+
+    // the rotated file is reopened by dev inode, so the appended data is not lost
+    APSARA_TEST_TRUE(mReaders[0]->UpdateFilePtr());
+    APSARA_TEST_TRUE(mReaders[0]->IsFileOpened());
+    APSARA_TEST_EQUAL(mDir + "/0.log.1", mReaders[0]->mRealLogPath);
+    APSARA_TEST_TRUE(mReaders[0]->CheckDevInode());
+
+    mReaders[0]->CloseFilePtr();
+    mReaders[2]->CloseFilePtr();
+    APSARA_TEST_EQUAL(0, GloablFileDescriptorManager::GetInstance()->GetOpenedFilePtrSize());
+}
+
+UNIT_TEST_CASE(GloablFileDescriptorManagerUnittest, TestEvictLeastRecentlyUsed)
+UNIT_TEST_CASE(GloablFileDescriptorManagerUnittest, TestSkipHotAndDeletedFile)
+UNIT_TEST_CASE(GloablFileDescriptorManagerUnittest, TestReopen)
+UNIT_TEST_CASE(GloablFileDescriptorManagerUnittest, TestRotateAfterEvict)
+
+} // namespace logtail
+
+UNIT_TEST_MAIN
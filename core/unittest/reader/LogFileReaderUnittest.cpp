@@ -17,6 +17,7 @@
 #include <fstream>
 
 #include "checkpoint/CheckPointManager.h"
+#include "collection_pipeline/queue/ProcessQueueManager.h"
 #include "common/FileSystemUtil.h"
 #include "common/RuntimeUtil.h"
 #include "common/memory/SourceBuffer.h"
@@ -70,6 +71,9 @@ public:
     }
     void TestReadGBK();
     void TestReadUTF8();
+    void TestReadWithPrefetch();
+    void TestReadUTF8WithAdaptiveBufferSize();
+    void TestReadUTF8LongLogWithAdaptiveBufferSize();
 
     std::unique_ptr<char[]> expectedContent;
     static std::string logPathDir;
@@ -83,6 +87,9 @@ public:
 
 UNIT_TEST_CASE(LogFileReaderUnittest, TestReadGBK);
 UNIT_TEST_CASE(LogFileReaderUnittest, TestReadUTF8);
+UNIT_TEST_CASE(LogFileReaderUnittest, TestReadWithPrefetch);
+UNIT_TEST_CASE(LogFileReaderUnittest, TestReadUTF8WithAdaptiveBufferSize);
+UNIT_TEST_CASE(LogFileReaderUnittest, TestReadUTF8LongLogWithAdaptiveBufferSize);
 
 std::string LogFileReaderUnittest::logPathDir;
 std::string LogFileReaderUnittest::gbkFile;
@@ -571,6 +578,147 @@ void LogFileReaderUnittest::TestReadUTF8() {
     }
 }
 
+void LogFileReaderUnittest::TestReadWithPrefetch() {
+    ctx.SetProcessQueueKey(0);
+    ProcessQueueManager::GetInstance()->CreateOrUpdateBoundedQueue(0, 0, ctx);
+    MultilineOptions multilineOpts;
+    FileReaderOptions gbkReaderOpts;
+    gbkReaderOpts.mInputType = FileReaderOptions::InputType::InputFile;
+    gbkReaderOpts.mFileEncoding = FileReaderOptions::Encoding::GBK;
+    LogFileReaderPtr utf8Reader(new LogFileReader(logPathDir,
+                                                  utf8File,
+                                                  DevInode(),
+                                                  std::make_pair(&readerOpts, &ctx),
+                                                  std::make_pair(&multilineOpts, &ctx),
+                                                  std::make_pair(&fileTagOpts, &ctx)));
+    LogFileReaderPtr gbkReader(new LogFileReader(logPathDir,
+                                                 gbkFile,
+                                                 DevInode(),
+                                                 std::make_pair(&gbkReaderOpts, &ctx),
+                                                 std::make_pair(&multilineOpts, &ctx),
+                                                 std::make_pair(&fileTagOpts, &ctx)));
+    std::vector<LogFileReaderPtr> readers = {utf8Reader, gbkReader};
+    for (auto& reader : readers) {
+        reader->UpdateReaderManual();
+        reader->InitReader(true, LogFileReader::BACKWARD_TO_BEGINNING);
+        reader->CheckFileSignatureAndOffset(true);
+    }
+
+    LogFileReader::PrefetchReaders(readers);
+    for (auto& reader : readers) {
+        APSARA_TEST_TRUE_FATAL(reader->mPrefetchBuffer != nullptr);
+        APSARA_TEST_EQUAL_FATAL(0, reader->mPrefetchOffset);
+        APSARA_TEST_EQUAL_FATAL(reader->mLogFileOp.GetFileSize(), static_cast<int64_t>(reader->mPrefetchSize));
+    }
+    { // prefetched data is consumed by the following read
+        LogBuffer logBuffer;
+        bool moreData = false;
+        utf8Reader->ReadUTF8(logBuffer, utf8Reader->mLogFileOp.GetFileSize(), moreData);
+        APSARA_TEST_FALSE_FATAL(moreData);
+        APSARA_TEST_STREQ_FATAL(expectedContent.get(), logBuffer.rawBuffer.data());
+        APSARA_TEST_TRUE_FATAL(utf8Reader->mPrefetchBuffer == nullptr);
+    }
+    {
+        LogBuffer logBuffer;
+        bool moreData = false;
+        gbkReader->ReadGBK(logBuffer, gbkReader->mLogFileOp.GetFileSize(), moreData);
+        APSARA_TEST_FALSE_FATAL(moreData);
+        APSARA_TEST_STREQ_FATAL(expectedContent.get(), logBuffer.rawBuffer.data());
+        APSARA_TEST_TRUE_FATAL(gbkReader->mPrefetchBuffer == nullptr);
+    }
+    { // nothing to prefetch when read to end
+        LogFileReader::PrefetchReaders(readers);
+        APSARA_TEST_TRUE_FATAL(utf8Reader->mPrefetchBuffer == nullptr);
+        APSARA_TEST_TRUE_FATAL(gbkReader->mPrefetchBuffer == nullptr);
+    }
+    ProcessQueueManager::GetInstance()->DeleteQueue(0);
+}
+
+void LogFileReaderUnittest::TestReadUTF8WithAdaptiveBufferSize() {
+    Json::Value config;
+    config["StartPattern"] = "no matching pattern";
+    MultilineOptions multilineOpts;
+    multilineOpts.Init(config, ctx, "");
+    LogFileReader reader(logPathDir,
+                         utf8File,
+                         DevInode(),
+                         std::make_pair(&readerOpts, &ctx),
+                         std::make_pair(&multilineOpts, &ctx),
+                         std::make_pair(&fileTagOpts, &ctx));
+    LogFileReader::BUFFER_SIZE = 15;
+    reader.UpdateReaderManual();
+    reader.InitReader(true, LogFileReader::BACKWARD_TO_BEGINNING);
+    reader.CheckFileSignatureAndOffset(true);
+    { // read buffer grows when it is filled up
+        LogBuffer logBuffer;
+        bool moreData = false;
+        reader.ReadUTF8(logBuffer, reader.mLogFileOp.GetFileSize(), moreData);
+        APSARA_TEST_TRUE_FATAL(moreData);
+        APSARA_TEST_STREQ_FATAL(std::string(expectedContent.get(), 15).c_str(), logBuffer.rawBuffer.data());
+        APSARA_TEST_EQUAL_FATAL(30UL, reader.getReadBufferSize());
+    }
+    { // log is still split at BUFFER_SIZE with enlarged read buffer
+        LogBuffer logBuffer;
+        bool moreData = false;
+        reader.ReadUTF8(logBuffer, reader.mLogFileOp.GetFileSize(), moreData);
+        APSARA_TEST_TRUE_FATAL(moreData);
+        APSARA_TEST_STREQ_FATAL(std::string(expectedContent.get() + 15, 15).c_str(), logBuffer.rawBuffer.data());
+        APSARA_TEST_EQUAL_FATAL(15UL, reader.mCache.size());
+        APSARA_TEST_EQUAL_FATAL(60UL, reader.getReadBufferSize());
+    }
+    { // read buffer shrinks for trickle reads, but never below BUFFER_SIZE
+        reader.adjustReadBufferSize(10);
+        APSARA_TEST_EQUAL_FATAL(30UL, reader.getReadBufferSize());
+        reader.adjustReadBufferSize(5);
+        APSARA_TEST_EQUAL_FATAL(15UL, reader.getReadBufferSize());
+        reader.adjustReadBufferSize(1);
+        APSARA_TEST_EQUAL_FATAL(15UL, reader.getReadBufferSize());
+    }
+}
+
+void LogFileReaderUnittest::TestReadUTF8LongLogWithAdaptiveBufferSize() {
+    const std::string dir = GetProcessExecutionDir();
+    const std::string fileName = "long_log.txt";
+    const std::string longLog(25, 'a');
+    { std::ofstream(dir + PATH_SEPARATOR + fileName) << "short\n" << longLog << "\ntail\n"; }
+    MultilineOptions multilineOpts;
+    LogFileReader reader(dir,
+                         fileName,
+                         DevInode(),
+                         std::make_pair(&readerOpts, &ctx),
+                         std::make_pair(&multilineOpts, &ctx),
+                         std::make_pair(&fileTagOpts, &ctx));
+    LogFileReader::BUFFER_SIZE = 15;
+    reader.UpdateReaderManual();
+    reader.InitReader(true, LogFileReader::BACKWARD_TO_BEGINNING);
+    reader.CheckFileSignatureAndOffset(true);
+    reader.mReadBufferSize = 120;
+    { // the long log has a boundary inside the read buffer, stop before it
+        LogBuffer logBuffer;
+        bool moreData = false;
+        reader.ReadUTF8(logBuffer, reader.mLogFileOp.GetFileSize(), moreData);
+        APSARA_TEST_TRUE_FATAL(moreData);
+        APSARA_TEST_EQUAL_FATAL(std::string("short"), logBuffer.rawBuffer.to_string());
+        APSARA_TEST_TRUE_FATAL(reader.mCache.empty());
+    }
+    { // the long log is split at BUFFER_SIZE rather than at the read buffer size
+        LogBuffer logBuffer;
+        bool moreData = false;
+        reader.ReadUTF8(logBuffer, reader.mLogFileOp.GetFileSize(), moreData);
+        APSARA_TEST_TRUE_FATAL(moreData);
+        APSARA_TEST_EQUAL_FATAL(longLog.substr(0, 15), logBuffer.rawBuffer.to_string());
+        APSARA_TEST_TRUE_FATAL(reader.mCache.empty());
+    }
+    { // the rest is read again from the file
+        LogBuffer logBuffer;
+        bool moreData = false;
+        reader.ReadUTF8(logBuffer, reader.mLogFileOp.GetFileSize(), moreData);
+        APSARA_TEST_FALSE_FATAL(moreData);
+        APSARA_TEST_EQUAL_FATAL(longLog.substr(15) + "\ntail", logBuffer.rawBuffer.to_string());
+    }
+    remove((dir + PATH_SEPARATOR + fileName).c_str());
+}
+
 class LogMultiBytesUnittest : public ::testing::Test {
 public:
     static void SetUpTestCase() {
@@ -16,10 +16,12 @@
 
 #include "json/json.h"
 
+#include "common/memory/ChunkPool.h"
 #include "file_server/reader/LogFileReader.h"
 #include "unittest/Unittest.h"
 
 DECLARE_FLAG_INT32(force_release_deleted_file_fd_timeout);
+DECLARE_FLAG_INT64(source_buffer_pool_max_bytes);
 
 namespace logtail {
 
@@ -28,6 +30,7 @@ public:
     void SetUp() override {}
     void TearDown() override {}
     void TestBufferAllocatorAllocate();
+    void TestBufferAllocatorReuseChunk();
 };
 
 void SourceBufferUnittest::TestBufferAllocatorAllocate() {
@@ -61,7 +64,45 @@ void SourceBufferUnittest::TestBufferAllocatorAllocate() {
     APSARA_TEST_EQUAL('c', static_cast<char*>(alloc3)[0]);
 }
 
+void SourceBufferUnittest::TestBufferAllocatorReuseChunk() {
+    ChunkPool::GetInstance()->Clear();
+    uint8_t* chunk = nullptr;
+    {
+        BufferAllocator allocator;
+        // large allocation is acquired from chunk pool with capacity rounded up to power of two
+        chunk = static_cast<uint8_t*>(allocator.Allocate(100 * 1024));
+        APSARA_TEST_EQUAL(1U, allocator.mPooledChunks.size());
+        APSARA_TEST_EQUAL(128U * 1024, allocator.mPooledChunks[0].second);
+        APSARA_TEST_EQUAL(1U, allocator.mAllocatedChunks.size());
+    }
+    APSARA_TEST_EQUAL(128U * 1024, ChunkPool::GetInstance()->GetPooledBytes());
+    {
+        BufferAllocator allocator;
+        APSARA_TEST_EQUAL(chunk, static_cast<uint8_t*>(allocator.Allocate(120 * 1024)));
+        APSARA_TEST_EQUAL(0U, ChunkPool::GetInstance()->GetPooledBytes());
+        // chunk of different size class is not reused
+        APSARA_TEST_NOT_EQUAL(chunk, static_cast<uint8_t*>(allocator.Allocate(300 * 1024)));
+        allocator.Reset();
+        APSARA_TEST_EQUAL(0U, allocator.mPooledChunks.size());
+        APSARA_TEST_EQUAL((128U + 512U) * 1024, ChunkPool::GetInstance()->GetPooledBytes());
+    }
+    APSARA_TEST_EQUAL(1.0 / 3, ChunkPool::GetInstance()->GetAndResetReuseRatio());
+    APSARA_TEST_EQUAL(0.0, ChunkPool::GetInstance()->GetAndResetReuseRatio());
+
+    // idle chunks exceeding the limit are freed
+    INT64_FLAG(source_buffer_pool_max_bytes) = 0;
+    ChunkPool::GetInstance()->Clear();
+    {
+        BufferAllocator allocator;
+        allocator.Allocate(100 * 1024);
+    }
+    APSARA_TEST_EQUAL(0U, ChunkPool::GetInstance()->GetPooledBytes());
+    INT64_FLAG(source_buffer_pool_max_bytes) = 64 * 1024 * 1024;
+    ChunkPool::GetInstance()->Clear();
+}
+
 UNIT_TEST_CASE(SourceBufferUnittest, TestBufferAllocatorAllocate);
+UNIT_TEST_CASE(SourceBufferUnittest, TestBufferAllocatorReuseChunk);
 
 } // namespace logtail
 
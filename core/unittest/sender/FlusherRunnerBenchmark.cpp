@@ -0,0 +1,149 @@
+// Copyright 2025 iLogtail Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <cstdio>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <deque>
+#include <future>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "app_config/AppConfig.h"
+#include "runner/FlusherRunner.h"
+#include "runner/sink/http/HttpSink.h"
+#include "unittest/plugin/PluginMock.h"
+
+using namespace std;
+
+namespace logtail {
+
+// Measure the enqueue-to-send latency of requests dispatched by FlusherRunner::PushToHttpSink, i.e. the time from an
+// item being available to its request being handed to http sink, when the global send concurrency is exhausted by
+// bursts. Items arrive in bursts of 20 every 2.5ms (8k/s), while the sink completes each request after 1ms with a
+// concurrency of 10 (10k/s). Waiting for a free slot by sleeping 10ms as before is compared with the semaphore.
+class FlusherRunnerBenchmark {
+public:
+    FlusherRunnerBenchmark(size_t burstCnt, size_t burstSize) : mBurstCnt(burstCnt), mBurstSize(burstSize) {}
+
+    void SetUp();
+    void TearDown();
+    void Run(const char* name, bool polling);
+
+private:
+    void RunSink(vector<int64_t>& latencies);
+
+    size_t mBurstCnt;
+    size_t mBurstSize;
+    unique_ptr<FlusherHttpMock> mFlusher;
+    CollectionPipelineContext mCtx;
+    atomic_bool mStop = false;
+};
+
+void FlusherRunnerBenchmark::SetUp() {
+    AppConfig::GetInstance()->mSendRequestGlobalConcurrency = 10;
+    mFlusher = make_unique<FlusherHttpMock>();
+    Json::Value tmp;
+    mFlusher->SetContext(mCtx);
+    mFlusher->SetMetricsRecordRef("name", "1");
+    mFlusher->Init(Json::Value(), tmp);
+}
+
+void FlusherRunnerBenchmark::TearDown() {
+    HttpSink::GetInstance()->mQueue.Clear();
+}
+
+void FlusherRunnerBenchmark::RunSink(vector<int64_t>& latencies) {
+    const auto kResponseTime = chrono::milliseconds(1);
+    // requests are completed in order, since all of them take the same time
+    deque<pair<chrono::steady_clock::time_point, unique_ptr<HttpSinkRequest>>> sending;
+    while (!mStop || !sending.empty()) {
+        unique_ptr<HttpSinkRequest> req;
+        bool got = sending.empty() ? HttpSink::GetInstance()->mQueue.WaitAndPop(req, 10)
+                                   : HttpSink::GetInstance()->mQueue.TryPop(req);
+        if (got) {
+            latencies.push_back(
+                chrono::duration_cast<chrono::microseconds>(req->mEnqueTime - req->mItem->mFirstEnqueTime).count());
+            sending.emplace_back(chrono::steady_clock::now() + kResponseTime, std::move(req));
+            continue;
+        }
+        if (sending.empty()) {
+            continue;
+        }
+        if (sending.front().first > chrono::steady_clock::now()) {
+            this_thread::sleep_for(chrono::microseconds(50));
+            continue;
+        }
+        sending.pop_front();
+        FlusherRunner::GetInstance()->DecreaseHttpSendingCnt();
+    }
+}
+
+void FlusherRunnerBenchmark::Run(const char* name, bool polling) {
+    vector<unique_ptr<SenderQueueItem>> items;
+    for (size_t i = 0; i < mBurstCnt * mBurstSize; ++i) {
+        items.push_back(make_unique<SenderQueueItem>("content", 10, mFlusher.get(), mFlusher->GetQueueKey()));
+    }
+    vector<int64_t> latencies;
+    mStop = false;
+    auto sink = async(launch::async, &FlusherRunnerBenchmark::RunSink, this, ref(latencies));
+
+    auto burstTime = chrono::steady_clock::now();
+    for (size_t i = 0; i < mBurstCnt; ++i) {
+        this_thread::sleep_until(burstTime);
+        auto enqueTime = chrono::system_clock::now();
+        for (size_t j = 0; j < mBurstSize; ++j) {
+            auto item = items[i * mBurstSize + j].get();
+            item->mFirstEnqueTime = enqueTime;
+            if (polling) {
+                while (FlusherRunner::GetInstance()->GetSendingBufferCount()
+                       >= AppConfig::GetInstance()->GetSendRequestGlobalConcurrency()) {
+                    this_thread::sleep_for(chrono::milliseconds(10));
+                }
+                FlusherRunner::GetInstance()->PushToHttpSink(item, false);
+            } else {
+                FlusherRunner::GetInstance()->PushToHttpSink(item);
+            }
+        }
+        burstTime += chrono::microseconds(2500);
+    }
+    mStop = true;
+    sink.get();
+
+    sort(latencies.begin(), latencies.end());
+    printf("%s: requests %lu, enqueue-to-send p50 %ldus, p99 %ldus, max %ldus\n",
+           name,
+           latencies.size(),
+           latencies[latencies.size() / 2],
+           latencies[latencies.size() * 99 / 100],
+           latencies.back());
+}
+
+} // namespace logtail
+
+int main(int argc, char* argv[]) {
+    logtail::FlusherRunnerBenchmark benchmark(2000, 20);
+    benchmark.SetUp();
+    benchmark.Run("sleep polling", true);
+    benchmark.Run("semaphore", false);
+    benchmark.TearDown();
+    /* Result (1 core):
+       sleep polling: requests 40000, enqueue-to-send p50 17183us, p99 20927us, max 27345us
+       semaphore: requests 40000, enqueue-to-send p50 1023us, p99 1788us, max 5416us
+     */
+    return 0;
+}
@@ -30,6 +30,7 @@ class FlusherRunnerUnittest : public ::testing::Test {
 public:
     void TestDispatch();
     void TestPushToHttpSink();
+    void TestWaitForHttpSendingSlot();
 
 protected:
     static void SetUpTestCase() { AppConfig::GetInstance()->mSendRequestGlobalConcurrency = 10; }
@@ -139,8 +140,21 @@ void FlusherRunnerUnittest::TestPushToHttpSink() {
     }
 }
 
+void FlusherRunnerUnittest::TestWaitForHttpSendingSlot() {
+    FlusherRunner::GetInstance()->mHttpSendingCnt = 10;
+    auto res = async(launch::async, []() { FlusherRunner::GetInstance()->WaitForHttpSendingSlot(); });
+    APSARA_TEST_EQUAL(future_status::timeout, res.wait_for(chrono::milliseconds(20)));
+
+    // woken up by the released slot, instead of the 100ms fallback timeout
+    FlusherRunner::GetInstance()->DecreaseHttpSendingCnt();
+    APSARA_TEST_EQUAL(future_status::ready, res.wait_for(chrono::milliseconds(50)));
+    APSARA_TEST_EQUAL(9, FlusherRunner::GetInstance()->GetSendingBufferCount());
+    FlusherRunner::GetInstance()->mHttpSendingCnt = 0;
+}
+
 UNIT_TEST_CASE(FlusherRunnerUnittest, TestDispatch)
 UNIT_TEST_CASE(FlusherRunnerUnittest, TestPushToHttpSink)
+UNIT_TEST_CASE(FlusherRunnerUnittest, TestWaitForHttpSendingSlot)
 
 } // namespace logtail
 
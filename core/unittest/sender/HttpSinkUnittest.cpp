@@ -0,0 +1,81 @@
+// Copyright 2025 iLogtail Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <set>
+
+#include "runner/sink/http/HttpSink.h"
+#include "unittest/Unittest.h"
+#include "unittest/plugin/PluginMock.h"
+
+using namespace std;
+
+namespace logtail {
+
+class HttpSinkUnittest : public ::testing::Test {
+public:
+    void TestShardByDestination();
+
+protected:
+    void SetUp() override {
+        Json::Value tmp;
+        mFlusher.SetContext(mCtx);
+        mFlusher.SetMetricsRecordRef("name", "1");
+        mFlusher.Init(Json::Value(), tmp);
+    }
+
+private:
+    unique_ptr<HttpSinkRequest> CreateRequest(const string& host, SenderQueueItem* item) {
+        return make_unique<HttpSinkRequest>("POST", false, host, 80, "/", "", map<string, string>(), "", item);
+    }
+
+    CollectionPipelineContext mCtx;
+    FlusherHttpMock mFlusher;
+};
+
+void HttpSinkUnittest::TestShardByDestination() {
+    HttpSink sink;
+    SenderQueueItem item("content", 10, &mFlusher, 0);
+    // no shard before init
+    APSARA_TEST_FALSE(sink.AddRequest(CreateRequest("a.example.com", &item)));
+
+    sink.mShards.push_back(make_unique<HttpSink::Shard>());
+    // all requests go to the only shard
+    APSARA_TEST_EQUAL(0U, sink.GetShardIndex(*CreateRequest("a.example.com", &item)));
+
+    for (size_t i = 1; i < 4; ++i) {
+        sink.mShards.push_back(make_unique<HttpSink::Shard>());
+    }
+    set<size_t> indexes;
+    for (QueueKey key = 0; key < 100; ++key) {
+        SenderQueueItem keyItem("content", 10, &mFlusher, key);
+        auto req = CreateRequest("a.example.com", &keyItem);
+        size_t index = sink.GetShardIndex(*req);
+        // the same destination always goes to the same shard
+        APSARA_TEST_EQUAL(index, sink.GetShardIndex(*CreateRequest("a.example.com", &keyItem)));
+        indexes.insert(index);
+
+        APSARA_TEST_TRUE(sink.AddRequest(std::move(req)));
+        unique_ptr<HttpSinkRequest> res;
+        APSARA_TEST_TRUE(sink.mShards[index]->mQueue.TryPop(res));
+        APSARA_TEST_EQUAL(&keyItem, res->mItem);
+    }
+    // flushers sending to the same host are spread over shards
+    APSARA_TEST_EQUAL(4U, indexes.size());
+}
+
+UNIT_TEST_CASE(HttpSinkUnittest, TestShardByDestination)
+
+} // namespace logtail
+
+UNIT_TEST_MAIN
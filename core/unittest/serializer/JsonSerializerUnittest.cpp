@@ -0,0 +1,180 @@
+// Copyright 2025 iLogtail Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <cmath>
+
+#include "collection_pipeline/serializer/JsonSerializer.h"
+#include "common/JsonUtil.h"
+#include "plugin/flusher/file/FlusherFile.h"
+#include "unittest/Unittest.h"
+
+using namespace std;
+
+namespace logtail {
+
+class JsonSerializerUnittest : public ::testing::Test {
+public:
+    void TestSerializeLog();
+    void TestSerializeMetric();
+    void TestSerializeRaw();
+    void TestEscape();
+
+protected:
+    static void SetUpTestCase() { sFlusher = make_unique<FlusherFile>(); }
+
+    void SetUp() override {
+        mCtx.SetConfigName("test_config");
+        sFlusher->SetContext(mCtx);
+        sFlusher->SetMetricsRecordRef(FlusherFile::sName, "1");
+    }
+
+private:
+    static BatchedEvents ToBatchedEvents(PipelineEventGroup& group);
+    static vector<Json::Value> ParseLines(const string& res);
+
+    static unique_ptr<FlusherFile> sFlusher;
+
+    CollectionPipelineContext mCtx;
+};
+
+unique_ptr<FlusherFile> JsonSerializerUnittest::sFlusher;
+
+void JsonSerializerUnittest::TestSerializeLog() {
+    JsonEventGroupSerializer serializer(sFlusher.get());
+    PipelineEventGroup group(make_shared<SourceBuffer>());
+    group.SetTag(string("__topic__"), string("topic"));
+    group.SetTag(string("key_2"), string("tag"));
+    group.SetTag(string("__time__"), string("tag"));
+    {
+        LogEvent* e = group.AddLogEvent();
+        e->SetContent(string("key_1"), string("value_1"));
+        e->SetTimestamp(1234567890);
+    }
+    {
+        // contents take precedence over tags
+        LogEvent* e = group.AddLogEvent();
+        e->SetContent(string("key_2"), string("value_2"));
+        e->SetContent(string("__time__"), string("1234567891"));
+        e->SetTimestamp(1234567890);
+    }
+    string res, errorMsg;
+    APSARA_TEST_TRUE(serializer.DoSerialize(ToBatchedEvents(group), res, errorMsg));
+    APSARA_TEST_EQUAL(
+        "{\"__topic__\":\"topic\",\"key_2\":\"tag\",\"__time__\":1234567890,\"key_1\":\"value_1\"}\n"
+        "{\"__topic__\":\"topic\",\"key_2\":\"value_2\",\"__time__\":\"1234567891\"}\n",
+        res);
+
+    // empty group
+    PipelineEventGroup emptyGroup(make_shared<SourceBuffer>());
+    APSARA_TEST_FALSE(serializer.DoSerialize(ToBatchedEvents(emptyGroup), res, errorMsg));
+}
+
+void JsonSerializerUnittest::TestSerializeMetric() {
+    JsonEventGroupSerializer serializer(sFlusher.get());
+    PipelineEventGroup group(make_shared<SourceBuffer>());
+    group.SetTag(string("__topic__"), string("topic"));
+    {
+        MetricEvent* e = group.AddMetricEvent();
+        e->SetName("test_gauge");
+        e->SetTag(string("key_1"), string("value_1"));
+        e->SetTag(string("key_2"), string("value_2"));
+        e->SetTimestamp(1234567890);
+        e->SetValue<UntypedSingleValue>(0.1);
+    }
+    {
+        MetricEvent* e = group.AddMetricEvent();
+        e->SetName("test_multi");
+        e->SetTimestamp(1234567890);
+        map<StringView, UntypedMultiDoubleValue> values{{"a", {UntypedValueMetricType::MetricTypeCounter, 10.0}},
+                                                        {"b", {UntypedValueMetricType::MetricTypeGauge, NAN}}};
+        e->SetValue(values);
+    }
+    {
+        // no value
+        MetricEvent* e = group.AddMetricEvent();
+        e->SetName("test_empty");
+    }
+    string res, errorMsg;
+    APSARA_TEST_TRUE(serializer.DoSerialize(ToBatchedEvents(group), res, errorMsg));
+    APSARA_TEST_EQUAL("{\"__topic__\":\"topic\",\"__time__\":1234567890,\"__labels__\":{\"key_1\":\"value_1\",\"key_2\":"
+                      "\"value_2\"},\"__name__\":\"test_gauge\",\"__value__\":0.10000000000000001}\n"
+                      "{\"__topic__\":\"topic\",\"__time__\":1234567890,\"__labels__\":{},\"__name__\":\"test_multi\","
+                      "\"__value__\":{\"a\":10.0,\"b\":null}}\n",
+                      res);
+    auto lines = ParseLines(res);
+    APSARA_TEST_EQUAL(2U, lines.size());
+    APSARA_TEST_EQUAL(0.1, lines[0]["__value__"].asDouble());
+}
+
+void JsonSerializerUnittest::TestSerializeRaw() {
+    JsonEventGroupSerializer serializer(sFlusher.get());
+    PipelineEventGroup group(make_shared<SourceBuffer>());
+    group.SetTag(string("__topic__"), string("topic"));
+    group.SetTag(string("content"), string("tag"));
+    RawEvent* e = group.AddRawEvent();
+    e->SetContent(string("raw"));
+    e->SetTimestamp(1234567890);
+    string res, errorMsg;
+    APSARA_TEST_TRUE(serializer.DoSerialize(ToBatchedEvents(group), res, errorMsg));
+    APSARA_TEST_EQUAL("{\"__topic__\":\"topic\",\"__time__\":1234567890,\"content\":\"raw\"}\n", res);
+}
+
+void JsonSerializerUnittest::TestEscape() {
+    JsonEventGroupSerializer serializer(sFlusher.get());
+    PipelineEventGroup group(make_shared<SourceBuffer>());
+    LogEvent* e = group.AddLogEvent();
+    string value = string("\"\\/\b\f\n\r\t\x01\x1f") + string(1, '\0') + "中文";
+    e->SetContent(string("k\"ey"), value);
+    e->SetTimestamp(1234567890);
+    string res, errorMsg;
+    APSARA_TEST_TRUE(serializer.DoSerialize(ToBatchedEvents(group), res, errorMsg));
+    APSARA_TEST_EQUAL(
+        "{\"__time__\":1234567890,\"k\\\"ey\":\"\\\"\\\\/\\b\\f\\n\\r\\t\\u0001\\u001f\\u0000中文\"}\n", res);
+    auto lines = ParseLines(res);
+    APSARA_TEST_EQUAL(1U, lines.size());
+    APSARA_TEST_EQUAL(value, lines[0]["k\"ey"].asString());
+}
+
+BatchedEvents JsonSerializerUnittest::ToBatchedEvents(PipelineEventGroup& group) {
+    return BatchedEvents(std::move(group.MutableEvents()),
+                         std::move(group.GetSizedTags()),
+                         std::move(group.GetSourceBuffer()),
+                         group.GetMetadata(EventGroupMetaKey::SOURCE_ID),
+                         std::move(group.GetExactlyOnceCheckpoint()));
+}
+
+vector<Json::Value> JsonSerializerUnittest::ParseLines(const string& res) {
+    vector<Json::Value> lines;
+    size_t begin = 0;
+    while (begin < res.size()) {
+        size_t end = res.find('\n', begin);
+        Json::Value line;
+        string errorMsg;
+        if (!ParseJsonTable(res.substr(begin, end - begin), line, errorMsg)) {
+            break;
+        }
+        lines.push_back(line);
+        begin = end + 1;
+    }
+    return lines;
+}
+
+UNIT_TEST_CASE(JsonSerializerUnittest, TestSerializeLog)
+UNIT_TEST_CASE(JsonSerializerUnittest, TestSerializeMetric)
+UNIT_TEST_CASE(JsonSerializerUnittest, TestSerializeRaw)
+UNIT_TEST_CASE(JsonSerializerUnittest, TestEscape)
+
+} // namespace logtail
+
+UNIT_TEST_MAIN
@@ -0,0 +1,382 @@
+// Copyright 2025 iLogtail Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <google/protobuf/io/coded_stream.h>
+
+#include <cstring>
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "collection_pipeline/serializer/OTLPSerializer.h"
+#include "plugin/flusher/otlp/FlusherOTLP.h"
+#include "unittest/Unittest.h"
+
+using namespace std;
+
+namespace logtail {
+
+// decodes any message by wire format, so as not to depend on the generated code of otlp protos
+struct DecodedMessage {
+    multimap<uint32_t, string> mBytes;
+    multimap<uint32_t, uint64_t> mNumbers;
+
+    bool Parse(const string& data) {
+        google::protobuf::io::CodedInputStream input(reinterpret_cast<const uint8_t*>(data.data()), data.size());
+        uint32_t tag = 0;
+        while ((tag = input.ReadTag()) != 0) {
+            uint32_t field = tag >> 3;
+            switch (tag & 0x07) {
+                case 0: {
+                    uint64_t value = 0;
+                    if (!input.ReadVarint64(&value)) {
+                        return false;
+                    }
+                    mNumbers.emplace(field, value);
+                    break;
+                }
+                case 1: {
+                    uint64_t value = 0;
+                    if (!input.ReadLittleEndian64(&value)) {
+                        return false;
+                    }
+                    mNumbers.emplace(field, value);
+                    break;
+                }
+                case 2: {
+                    uint32_t len = 0;
+                    string value;
+                    if (!input.ReadVarint32(&len) || !input.ReadString(&value, len)) {
+                        return false;
+                    }
+                    mBytes.emplace(field, std::move(value));
+                    break;
+                }
+                default:
+                    return false;
+            }
+        }
+        return input.ConsumedEntireMessage();
+    }
+
+    vector<DecodedMessage> GetMessages(uint32_t field) const {
+        vector<DecodedMessage> res;
+        auto range = mBytes.equal_range(field);
+        for (auto it = range.first; it != range.second; ++it) {
+            res.emplace_back();
+            res.back().Parse(it->second);
+        }
+        return res;
+    }
+
+    DecodedMessage GetMessage(uint32_t field) const {
+        auto res = GetMessages(field);
+        return res.empty() ? DecodedMessage() : res[0];
+    }
+
+    string GetString(uint32_t field) const {
+        auto it = mBytes.find(field);
+        return it == mBytes.end() ? "" : it->second;
+    }
+
+    uint64_t GetNumber(uint32_t field) const {
+        auto it = mNumbers.find(field);
+        return it == mNumbers.end() ? 0 : it->second;
+    }
+
+    bool HasField(uint32_t field) const { return mBytes.count(field) > 0 || mNumbers.count(field) > 0; }
+
+    // repeated KeyValue with string values
+    vector<pair<string, string>> GetAttributes(uint32_t field) const {
+        vector<pair<string, string>> res;
+        for (const auto& kv : GetMessages(field)) {
+            res.emplace_back(kv.GetString(1), kv.GetMessage(2).GetString(1));
+        }
+        return res;
+    }
+};
+
+class OTLPSerializerUnittest : public ::testing::Test {
+public:
+    void TestSerializeLogs();
+    void TestSerializeMetrics();
+    void TestSerializeTraces();
+    void TestLongMessage();
+    void TestInvalidEvents();
+
+protected:
+    static void SetUpTestCase() { sFlusher = make_unique<FlusherOTLP>(); }
+
+    void SetUp() override {
+        mCtx.SetConfigName("test_config");
+        sFlusher->SetContext(mCtx);
+        sFlusher->SetMetricsRecordRef(FlusherOTLP::sName, "1");
+    }
+
+private:
+    static unique_ptr<FlusherOTLP> sFlusher;
+
+    CollectionPipelineContext mCtx;
+};
+
+unique_ptr<FlusherOTLP> OTLPSerializerUnittest::sFlusher;
+
+static BatchedEvents ToBatchedEvents(PipelineEventGroup& group) {
+    return BatchedEvents(std::move(group.MutableEvents()),
+                         std::move(group.GetSizedTags()),
+                         std::move(group.GetSourceBuffer()),
+                         group.GetMetadata(EventGroupMetaKey::SOURCE_ID),
+                         std::move(group.GetExactlyOnceCheckpoint()));
+}
+
+void OTLPSerializerUnittest::TestSerializeLogs() {
+    OTLPEventGroupListSerializer serializer(sFlusher.get(), OTLPSignal::LOGS);
+    BatchedEventsList batchList;
+    // the first two groups share the same resource
+    for (uint32_t i = 0; i < 3; ++i) {
+        PipelineEventGroup group(make_shared<SourceBuffer>());
+        group.SetTag(string("host.name"), i < 2 ? string("host_1") : string("host_2"));
+        group.SetTag(string("__topic__"), string("topic"));
+        group.SetTag(string("empty"), string(""));
+        {
+            auto e = group.AddLogEvent();
+            e->SetTimestamp(1700000000 + i, 500);
+            e->SetContent(string("content"), string("hello"));
+            e->SetContent(string("file"), string("/var/log/a.log"));
+            e->SetLevel("ERROR");
+        }
+        {
+            auto e = group.AddRawEvent();
+            e->SetTimestamp(1700000000 + i);
+            e->SetContent(string("raw"));
+        }
+        batchList.emplace_back(ToBatchedEvents(group));
+    }
+
+    string res, errorMsg;
+    APSARA_TEST_TRUE(serializer.DoSerialize(std::move(batchList), res, errorMsg));
+    DecodedMessage request;
+    APSARA_TEST_TRUE(request.Parse(res));
+    auto resourceLogs = request.GetMessages(1);
+    APSARA_TEST_EQUAL(2U, resourceLogs.size());
+
+    auto attributes = resourceLogs[0].GetMessage(1).GetAttributes(1);
+    APSARA_TEST_EQUAL(1U, attributes.size());
+    APSARA_TEST_EQUAL(make_pair(string("host.name"), string("host_1")), attributes[0]);
+    auto scopeLogs = resourceLogs[0].GetMessages(2);
+    APSARA_TEST_EQUAL(1U, scopeLogs.size());
+    APSARA_TEST_FALSE(scopeLogs[0].HasField(1));
+    auto records = scopeLogs[0].GetMessages(2);
+    APSARA_TEST_EQUAL(4U, records.size());
+    APSARA_TEST_EQUAL(1700000000000000500ULL, records[0].GetNumber(1));
+    APSARA_TEST_EQUAL("ERROR", records[0].GetString(3));
+    APSARA_TEST_EQUAL("hello", records[0].GetMessage(5).GetString(1));
+    auto logAttributes = records[0].GetAttributes(6);
+    APSARA_TEST_EQUAL(1U, logAttributes.size());
+    APSARA_TEST_EQUAL(make_pair(string("file"), string("/var/log/a.log")), logAttributes[0]);
+    APSARA_TEST_EQUAL(1700000000000000000ULL, records[1].GetNumber(1));
+    APSARA_TEST_EQUAL("raw", records[1].GetMessage(5).GetString(1));
+    APSARA_TEST_FALSE(records[1].HasField(6));
+    APSARA_TEST_EQUAL(1700000001000000500ULL, records[2].GetNumber(1));
+
+    attributes = resourceLogs[1].GetMessage(1).GetAttributes(1);
+    APSARA_TEST_EQUAL(make_pair(string("host.name"), string("host_2")), attributes[0]);
+    APSARA_TEST_EQUAL(2U, resourceLogs[1].GetMessage(2).GetMessages(2).size());
+}
+
+void OTLPSerializerUnittest::TestSerializeMetrics() {
+    OTLPEventGroupListSerializer serializer(sFlusher.get(), OTLPSignal::METRICS);
+    BatchedEventsList batchList;
+    PipelineEventGroup group(make_shared<SourceBuffer>());
+    {
+        auto e = group.AddMetricEvent();
+        e->SetName("up");
+        e->SetTag(string("job"), string("node"));
+        e->SetTimestamp(1700000000);
+        e->SetValue<UntypedSingleValue>(1.5);
+    }
+    {
+        auto e = group.AddMetricEvent();
+        e->SetName("cpu");
+        e->SetTimestamp(1700000000);
+        e->SetValue(
+            map<StringView, UntypedMultiDoubleValue>{{"user", {UntypedValueMetricType::MetricTypeGauge, 0.5}},
+                                                     {"total", {UntypedValueMetricType::MetricTypeCounter, 10}}});
+    }
+    batchList.emplace_back(ToBatchedEvents(group));
+
+    string res, errorMsg;
+    APSARA_TEST_TRUE(serializer.DoSerialize(std::move(batchList), res, errorMsg));
+    DecodedMessage request;
+    APSARA_TEST_TRUE(request.Parse(res));
+    auto resourceMetrics = request.GetMessages(1);
+    APSARA_TEST_EQUAL(1U, resourceMetrics.size());
+    // no resource without group tags
+    APSARA_TEST_FALSE(resourceMetrics[0].HasField(1));
+    auto metrics = resourceMetrics[0].GetMessage(2).GetMessages(2);
+    APSARA_TEST_EQUAL(3U, metrics.size());
+
+    APSARA_TEST_EQUAL("up", metrics[0].GetString(1));
+    APSARA_TEST_FALSE(metrics[0].HasField(7));
+    auto point = metrics[0].GetMessage(5).GetMessage(1);
+    APSARA_TEST_EQUAL(1700000000000000000ULL, point.GetNumber(3));
+    uint64_t bits = point.GetNumber(4);
+    double value = 0;
+    memcpy(&value, &bits, sizeof(value));
+    APSARA_TEST_EQUAL(1.5, value);
+    auto attributes = point.GetAttributes(7);
+    APSARA_TEST_EQUAL(1U, attributes.size());
+    APSARA_TEST_EQUAL(make_pair(string("job"), string("node")), attributes[0]);
+
+    // values are ordered by keys
+    APSARA_TEST_EQUAL("cpu_total", metrics[1].GetString(1));
+    auto sum = metrics[1].GetMessage(7);
+    APSARA_TEST_EQUAL(2U, sum.GetNumber(2));
+    APSARA_TEST_EQUAL(1U, sum.GetNumber(3));
+    bits = sum.GetMessage(1).GetNumber(4);
+    memcpy(&value, &bits, sizeof(value));
+    APSARA_TEST_EQUAL(10.0, value);
+    APSARA_TEST_EQUAL("cpu_user", metrics[2].GetString(1));
+    APSARA_TEST_TRUE(metrics[2].HasField(5));
+}
+
+void OTLPSerializerUnittest::TestSerializeTraces() {
+    OTLPEventGroupListSerializer serializer(sFlusher.get(), OTLPSignal::TRACES);
+    BatchedEventsList batchList;
+    PipelineEventGroup group(make_shared<SourceBuffer>());
+    group.SetTag(string("service.name"), string("svc"));
+    for (size_t i = 0; i < 2; ++i) {
+        auto e = group.AddSpanEvent();
+        e->SetTraceId("0102030405060708090a0b0c0d0e0f10");
+        e->SetSpanId(i == 0 ? "a1a2a3a4a5a6a7a8" : "B1B2B3B4B5B6B7B8");
+        e->SetName("span");
+        e->SetStartTimeNs(1700000000000000000);
+        e->SetEndTimeNs(1700000000000001000);
+        e->SetTag(string("http.method"), string("GET"));
+        e->SetScopeTag(string(SpanEvent::OTLP_SCOPE_NAME), string(i == 0 ? "scope_1" : "scope_2"));
+        e->SetScopeTag(string(SpanEvent::OTLP_SCOPE_VERSION), string("1.0"));
+        if (i == 0) {
+            e->SetKind(SpanEvent::Kind::Server);
+            e->SetStatus(SpanEvent::StatusCode::Error);
+            e->SetParentSpanId("0000000000000001");
+            auto innerEvent = e->AddEvent();
+            innerEvent->SetName("exception");
+            innerEvent->SetTimestampNs(1700000000000000500);
+            auto link = e->AddLink();
+            link->SetTraceId("0102030405060708090a0b0c0d0e0f10");
+            link->SetSpanId("0000000000000002");
+            auto invalidLink = e->AddLink();
+            invalidLink->SetTraceId("invalid");
+            invalidLink->SetSpanId("0000000000000003");
+        }
+    }
+    batchList.emplace_back(ToBatchedEvents(group));
+
+    string res, errorMsg;
+    APSARA_TEST_TRUE(serializer.DoSerialize(std::move(batchList), res, errorMsg));
+    DecodedMessage request;
+    APSARA_TEST_TRUE(request.Parse(res));
+    auto resourceSpans = request.GetMessages(1);
+    APSARA_TEST_EQUAL(1U, resourceSpans.size());
+    auto scopeSpans = resourceSpans[0].GetMessages(2);
+    APSARA_TEST_EQUAL(2U, scopeSpans.size());
+    APSARA_TEST_EQUAL("scope_1", scopeSpans[0].GetMessage(1).GetString(1));
+    APSARA_TEST_EQUAL("1.0", scopeSpans[0].GetMessage(1).GetString(2));
+    APSARA_TEST_EQUAL("scope_2", scopeSpans[1].GetMessage(1).GetString(1));
+
+    auto spans = scopeSpans[0].GetMessages(2);
+    APSARA_TEST_EQUAL(1U, spans.size());
+    const auto& span = spans[0];
+    APSARA_TEST_EQUAL(string("\x01\x02\x03\x04\x05\x06\x07\x08\x09\x0a\x0b\x0c\x0d\x0e\x0f\x10", 16),
+                      span.GetString(1));
+    APSARA_TEST_EQUAL(string("\xa1\xa2\xa3\xa4\xa5\xa6\xa7\xa8", 8), span.GetString(2));
+    APSARA_TEST_EQUAL(string("\x00\x00\x00\x00\x00\x00\x00\x01", 8), span.GetString(4));
+    APSARA_TEST_EQUAL("span", span.GetString(5));
+    APSARA_TEST_EQUAL(static_cast<uint64_t>(SpanEvent::Kind::Server), span.GetNumber(6));
+    APSARA_TEST_EQUAL(1700000000000000000ULL, span.GetNumber(7));
+    APSARA_TEST_EQUAL(1700000000000001000ULL, span.GetNumber(8));
+    APSARA_TEST_EQUAL(make_pair(string("http.method"), string("GET")), span.GetAttributes(9)[0]);
+    auto innerEvents = span.GetMessages(11);
+    APSARA_TEST_EQUAL(1U, innerEvents.size());
+    APSARA_TEST_EQUAL(1700000000000000500ULL, innerEvents[0].GetNumber(1));
+    APSARA_TEST_EQUAL("exception", innerEvents[0].GetString(2));
+    auto links = span.GetMessages(13);
+    APSARA_TEST_EQUAL(1U, links.size());
+    APSARA_TEST_EQUAL(string("\x00\x00\x00\x00\x00\x00\x00\x02", 8), links[0].GetString(2));
+    APSARA_TEST_EQUAL(static_cast<uint64_t>(SpanEvent::StatusCode::Error), span.GetMessage(15).GetNumber(3));
+
+    spans = scopeSpans[1].GetMessages(2);
+    APSARA_TEST_EQUAL(string("\xb1\xb2\xb3\xb4\xb5\xb6\xb7\xb8", 8), spans[0].GetString(2));
+    APSARA_TEST_FALSE(spans[0].HasField(4));
+    APSARA_TEST_FALSE(spans[0].HasField(6));
+    APSARA_TEST_FALSE(spans[0].HasField(15));
+}
+
+void OTLPSerializerUnittest::TestLongMessage() {
+    OTLPEventGroupListSerializer serializer(sFlusher.get(), OTLPSignal::LOGS);
+    BatchedEventsList batchList;
+    PipelineEventGroup group(make_shared<SourceBuffer>());
+    // lengths taking one, two and three bytes
+    const vector<size_t> sizes{100, 200, 20000};
+    for (auto size : sizes) {
+        auto e = group.AddLogEvent();
+        e->SetTimestamp(1700000000);
+        e->SetContent(string("content"), string(size, 'a'));
+    }
+    batchList.emplace_back(ToBatchedEvents(group));
+
+    string res, errorMsg;
+    APSARA_TEST_TRUE(serializer.DoSerialize(std::move(batchList), res, errorMsg));
+    DecodedMessage request;
+    APSARA_TEST_TRUE(request.Parse(res));
+    auto records = request.GetMessage(1).GetMessage(2).GetMessages(2);
+    APSARA_TEST_EQUAL(sizes.size(), records.size());
+    for (size_t i = 0; i < sizes.size(); ++i) {
+        APSARA_TEST_EQUAL(string(sizes[i], 'a'), records[i].GetMessage(5).GetString(1));
+    }
+}
+
+void OTLPSerializerUnittest::TestInvalidEvents() {
+    BatchedEventsList batchList;
+    PipelineEventGroup group(make_shared<SourceBuffer>());
+    group.AddLogEvent()->SetTimestamp(1700000000);
+    {
+        auto e = group.AddSpanEvent();
+        e->SetTraceId("0102030405060708090a0b0c0d0e0f1");
+        e->SetSpanId("a1a2a3a4a5a6a7a8");
+    }
+    {
+        auto e = group.AddSpanEvent();
+        e->SetTraceId("0102030405060708090a0b0c0d0e0f10");
+        e->SetSpanId("a1a2a3a4a5a6a7a8");
+        e->SetParentSpanId("xx");
+    }
+    batchList.emplace_back(ToBatchedEvents(group));
+
+    OTLPEventGroupListSerializer serializer(sFlusher.get(), OTLPSignal::TRACES);
+    string res, errorMsg;
+    APSARA_TEST_FALSE(serializer.DoSerialize(std::move(batchList), res, errorMsg));
+    APSARA_TEST_EQUAL("no valid event in event group", errorMsg);
+}
+
+UNIT_TEST_CASE(OTLPSerializerUnittest, TestSerializeLogs)
+UNIT_TEST_CASE(OTLPSerializerUnittest, TestSerializeMetrics)
+UNIT_TEST_CASE(OTLPSerializerUnittest, TestSerializeTraces)
+UNIT_TEST_CASE(OTLPSerializerUnittest, TestLongMessage)
+UNIT_TEST_CASE(OTLPSerializerUnittest, TestInvalidEvents)
+
+} // namespace logtail
+
+UNIT_TEST_MAIN
@@ -0,0 +1,205 @@
+// Copyright 2025 iLogtail Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <google/protobuf/io/coded_stream.h>
+
+#include <cstring>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "collection_pipeline/serializer/RemoteWriteSerializer.h"
+#include "plugin/flusher/prometheus/FlusherPrometheusRemoteWrite.h"
+#include "unittest/Unittest.h"
+
+using namespace std;
+
+namespace logtail {
+
+struct DecodedTimeSeries {
+    vector<pair<string, string>> mLabels;
+    vector<pair<double, int64_t>> mSamples;
+};
+
+// decodes prometheus.WriteRequest by wire format, so as not to depend on the generated code
+static bool DecodeWriteRequest(const string& data, vector<DecodedTimeSeries>& res) {
+    google::protobuf::io::CodedInputStream input(reinterpret_cast<const uint8_t*>(data.data()), data.size());
+    uint32_t tag = 0, len = 0;
+    while ((tag = input.ReadTag()) != 0) {
+        if (tag != 0x0A || !input.ReadVarint32(&len)) {
+            return false;
+        }
+        auto seriesLimit = input.PushLimit(len);
+        res.emplace_back();
+        while ((tag = input.ReadTag()) != 0) {
+            if (!input.ReadVarint32(&len)) {
+                return false;
+            }
+            auto limit = input.PushLimit(len);
+            if (tag == 0x0A) {
+                string name, value;
+                if (input.ReadTag() != 0x0A || !input.ReadVarint32(&len) || !input.ReadString(&name, len)
+                    || input.ReadTag() != 0x12 || !input.ReadVarint32(&len) || !input.ReadString(&value, len)) {
+                    return false;
+                }
+                res.back().mLabels.emplace_back(name, value);
+            } else if (tag == 0x12) {
+                uint64_t value = 0, timestamp = 0;
+                if (input.ReadTag() != 0x09 || !input.ReadLittleEndian64(&value) || input.ReadTag() != 0x10
+                    || !input.ReadVarint64(&timestamp)) {
+                    return false;
+                }
+                double d = 0;
+                memcpy(&d, &value, sizeof(d));
+                res.back().mSamples.emplace_back(d, static_cast<int64_t>(timestamp));
+            } else {
+                return false;
+            }
+            input.PopLimit(limit);
+        }
+        input.PopLimit(seriesLimit);
+    }
+    return true;
+}
+
+class RemoteWriteSerializerUnittest : public ::testing::Test {
+public:
+    void TestSerializeEventGroupList();
+    void TestMultiValues();
+    void TestInvalidEvents();
+
+protected:
+    static void SetUpTestCase() { sFlusher = make_unique<FlusherPrometheusRemoteWrite>(); }
+
+    void SetUp() override {
+        mCtx.SetConfigName("test_config");
+        sFlusher->SetContext(mCtx);
+        sFlusher->SetMetricsRecordRef(FlusherPrometheusRemoteWrite::sName, "1");
+    }
+
+private:
+    static unique_ptr<FlusherPrometheusRemoteWrite> sFlusher;
+
+    CollectionPipelineContext mCtx;
+};
+
+unique_ptr<FlusherPrometheusRemoteWrite> RemoteWriteSerializerUnittest::sFlusher;
+
+static BatchedEvents ToBatchedEvents(PipelineEventGroup& group) {
+    return BatchedEvents(std::move(group.MutableEvents()),
+                         std::move(group.GetSizedTags()),
+                         std::move(group.GetSourceBuffer()),
+                         group.GetMetadata(EventGroupMetaKey::SOURCE_ID),
+                         std::move(group.GetExactlyOnceCheckpoint()));
+}
+
+void RemoteWriteSerializerUnittest::TestSerializeEventGroupList() {
+    RemoteWriteEventGroupListSerializer serializer(sFlusher.get());
+    BatchedEventsList batchList;
+    // two scrapes of the same target
+    for (uint32_t i = 0; i < 2; ++i) {
+        PipelineEventGroup group(make_shared<SourceBuffer>());
+        group.SetTag(string("instance"), string("127.0.0.1:9100"));
+        group.SetTag(string("__source__"), string("source"));
+        group.SetTag(string("job"), string("group_job"));
+        {
+            auto e = group.AddMetricEvent();
+            e->SetName("up");
+            e->SetTag(string("job"), string("node"));
+            e->SetTag(string("empty"), string(""));
+            // later scrape added first
+            e->SetTimestamp(1700000001 - i, 500000000);
+            e->SetValue<UntypedSingleValue>(1.0 + i);
+        }
+        {
+            auto e = group.AddMetricEvent();
+            e->SetName("scrape_samples");
+            e->SetTimestamp(1700000001 - i);
+            e->SetValue<UntypedSingleValue>(10.0);
+        }
+        batchList.emplace_back(ToBatchedEvents(group));
+    }
+
+    string res, errorMsg;
+    APSARA_TEST_TRUE(serializer.DoSerialize(std::move(batchList), res, errorMsg));
+    vector<DecodedTimeSeries> seriesList;
+    APSARA_TEST_TRUE(DecodeWriteRequest(res, seriesList));
+    APSARA_TEST_EQUAL(2U, seriesList.size());
+
+    const auto& up = seriesList[0];
+    APSARA_TEST_EQUAL(3U, up.mLabels.size());
+    APSARA_TEST_EQUAL(make_pair(string("__name__"), string("up")), up.mLabels[0]);
+    APSARA_TEST_EQUAL(make_pair(string("instance"), string("127.0.0.1:9100")), up.mLabels[1]);
+    APSARA_TEST_EQUAL(make_pair(string("job"), string("node")), up.mLabels[2]);
+    APSARA_TEST_EQUAL(2U, up.mSamples.size());
+    APSARA_TEST_EQUAL(make_pair(2.0, int64_t(1700000000500)), up.mSamples[0]);
+    APSARA_TEST_EQUAL(make_pair(1.0, int64_t(1700000001500)), up.mSamples[1]);
+
+    const auto& samples = seriesList[1];
+    APSARA_TEST_EQUAL(3U, samples.mLabels.size());
+    APSARA_TEST_EQUAL(make_pair(string("__name__"), string("scrape_samples")), samples.mLabels[0]);
+    APSARA_TEST_EQUAL(make_pair(string("job"), string("group_job")), samples.mLabels[2]);
+    APSARA_TEST_EQUAL(2U, samples.mSamples.size());
+    APSARA_TEST_EQUAL(int64_t(1700000000000), samples.mSamples[0].second);
+}
+
+void RemoteWriteSerializerUnittest::TestMultiValues() {
+    RemoteWriteEventGroupListSerializer serializer(sFlusher.get());
+    BatchedEventsList batchList;
+    PipelineEventGroup group(make_shared<SourceBuffer>());
+    auto e = group.AddMetricEvent();
+    e->SetName("cpu");
+    e->SetTag(string("host"), string("h1"));
+    e->SetTimestamp(1700000000);
+    e->SetValue(map<StringView, UntypedMultiDoubleValue>{{"user", {UntypedValueMetricType::MetricTypeGauge, 0.5}},
+                                                          {"sys", {UntypedValueMetricType::MetricTypeGauge, 0.25}}});
+    batchList.emplace_back(ToBatchedEvents(group));
+
+    string res, errorMsg;
+    APSARA_TEST_TRUE(serializer.DoSerialize(std::move(batchList), res, errorMsg));
+    vector<DecodedTimeSeries> seriesList;
+    APSARA_TEST_TRUE(DecodeWriteRequest(res, seriesList));
+    APSARA_TEST_EQUAL(2U, seriesList.size());
+    APSARA_TEST_EQUAL(make_pair(string("__name__"), string("cpu_sys")), seriesList[0].mLabels[0]);
+    APSARA_TEST_EQUAL(make_pair(0.25, int64_t(1700000000000)), seriesList[0].mSamples[0]);
+    APSARA_TEST_EQUAL(make_pair(string("__name__"), string("cpu_user")), seriesList[1].mLabels[0]);
+    APSARA_TEST_EQUAL(make_pair(string("host"), string("h1")), seriesList[1].mLabels[1]);
+    APSARA_TEST_EQUAL(make_pair(0.5, int64_t(1700000000000)), seriesList[1].mSamples[0]);
+}
+
+void RemoteWriteSerializerUnittest::TestInvalidEvents() {
+    RemoteWriteEventGroupListSerializer serializer(sFlusher.get());
+    BatchedEventsList batchList;
+    PipelineEventGroup group(make_shared<SourceBuffer>());
+    group.AddLogEvent()->SetTimestamp(1700000000);
+    {
+        // invalid timestamp
+        auto e = group.AddMetricEvent();
+        e->SetName("up");
+        e->SetTimestamp(0);
+        e->SetValue<UntypedSingleValue>(1.0);
+    }
+    batchList.emplace_back(ToBatchedEvents(group));
+
+    string res, errorMsg;
+    APSARA_TEST_FALSE(serializer.DoSerialize(std::move(batchList), res, errorMsg));
+}
+
+UNIT_TEST_CASE(RemoteWriteSerializerUnittest, TestSerializeEventGroupList)
+UNIT_TEST_CASE(RemoteWriteSerializerUnittest, TestMultiValues)
+UNIT_TEST_CASE(RemoteWriteSerializerUnittest, TestInvalidEvents)
+
+} // namespace logtail
+
+UNIT_TEST_MAIN
@@ -26,6 +26,8 @@ class SLSSerializerUnittest : public ::testing::Test {
 public:
     void TestSerializeEventGroup();
     void TestSerializeEventGroupList();
+    void TestSerializeSpanJson();
+    void TestSerializeSpanBenchmark();
 
 protected:
     static void SetUpTestCase() { sFlusher = make_unique<FlusherSLS>(); }
@@ -439,6 +441,87 @@ void SLSSerializerUnittest::TestSerializeEventGroupList() {
     APSARA_TEST_EQUAL(sls_logs::SlsCompressType::SLS_CMP_NONE, logPackageList.packages(0).compress_type());
 }
 
+void SLSSerializerUnittest::TestSerializeSpanJson() {
+    SLSEventGroupSerializer serializer(sFlusher.get());
+    {
+        PipelineEventGroup group(make_shared<SourceBuffer>());
+        auto span = group.AddSpanEvent();
+        span->SetTag(string("key\"1"), string("value\n1"));
+        span->SetTag(string("key2"), string("value2"));
+        span->SetTag(string("key3"), string("value3"));
+        // scope tag overrides tag with the same key
+        span->SetScopeTag(string("key2"), string("scope-value2"));
+        auto link = span->AddLink();
+        link->SetTraceId("trace-id");
+        link->SetSpanId("span-id");
+        link->SetTag(string("link-key"), string("link-value"));
+        auto innerEvent = span->AddEvent();
+        innerEvent->SetName("inner\tevent");
+        innerEvent->SetTimestampNs(1234567890123456789ULL);
+        span->SetTimestamp(1234567890);
+        BatchedEvents batch(std::move(group.MutableEvents()),
+                            std::move(group.GetSizedTags()),
+                            std::move(group.GetSourceBuffer()),
+                            group.GetMetadata(EventGroupMetaKey::SOURCE_ID),
+                            std::move(group.GetExactlyOnceCheckpoint()));
+        string res, errorMsg;
+        APSARA_TEST_TRUE(serializer.DoSerialize(std::move(batch), res, errorMsg));
+        sls_logs::LogGroup logGroup;
+        APSARA_TEST_TRUE(logGroup.ParseFromString(res));
+        const auto& log = logGroup.logs(0);
+        APSARA_TEST_EQUAL("attributes", log.contents(7).key());
+        APSARA_TEST_EQUAL(R"({"key\"1":"value\n1","key3":"value3","key2":"scope-value2"})", log.contents(7).value());
+        APSARA_TEST_EQUAL("links", log.contents(8).key());
+        APSARA_TEST_EQUAL(R"([{"traceId":"trace-id","spanId":"span-id","attributes":{"link-key":"link-value"}}])",
+                          log.contents(8).value());
+        APSARA_TEST_EQUAL("events", log.contents(9).key());
+        APSARA_TEST_EQUAL(R"([{"name":"inner\tevent","timestamp":1234567890123456789}])", log.contents(9).value());
+    }
+    {
+        // no tags, links or events
+        PipelineEventGroup group(make_shared<SourceBuffer>());
+        group.AddSpanEvent()->SetTimestamp(1234567890);
+        BatchedEvents batch(std::move(group.MutableEvents()),
+                            std::move(group.GetSizedTags()),
+                            std::move(group.GetSourceBuffer()),
+                            group.GetMetadata(EventGroupMetaKey::SOURCE_ID),
+                            std::move(group.GetExactlyOnceCheckpoint()));
+        string res, errorMsg;
+        APSARA_TEST_TRUE(serializer.DoSerialize(std::move(batch), res, errorMsg));
+        sls_logs::LogGroup logGroup;
+        APSARA_TEST_TRUE(logGroup.ParseFromString(res));
+        const auto& log = logGroup.logs(0);
+        APSARA_TEST_EQUAL("{}", log.contents(7).value());
+        APSARA_TEST_EQUAL("", log.contents(8).value());
+        APSARA_TEST_EQUAL("", log.contents(9).value());
+    }
+}
+
+void SLSSerializerUnittest::TestSerializeSpanBenchmark() {
+    const size_t kGroupCnt = 100;
+    const size_t kSpanCnt = 100;
+    SLSEventGroupSerializer serializer(sFlusher.get());
+    vector<BatchedEvents> batches;
+    for (size_t i = 0; i < kGroupCnt; ++i) {
+        auto batch = CreateBatchedSpanEvents();
+        // copied spans are views of the same source buffer
+        for (size_t j = 1; j < kSpanCnt; ++j) {
+            batch.mEvents.emplace_back(batch.mEvents[0].Copy());
+        }
+        batches.emplace_back(std::move(batch));
+    }
+
+    auto start = chrono::steady_clock::now();
+    size_t totalSize = 0;
+    for (auto& batch : batches) {
+        string res, errorMsg;
+        APSARA_TEST_TRUE(serializer.DoSerialize(std::move(batch), res, errorMsg));
+        totalSize += res.size();
+    }
+    auto elapsed = chrono::duration_cast<chrono::microseconds>(chrono::steady_clock::now() - start).count();
+    cout << "serialized " << kGroupCnt * kSpanCnt << " spans into " << totalSize << " bytes in " << elapsed << " us"
+         << endl;
+}
 
 BatchedEvents
 SLSSerializerUnittest::CreateBatchedLogEvents(bool enableNanosecond, bool withEmptyContent, bool withNonEmptyContent) {
@@ -603,6 +686,8 @@ BatchedEvents SLSSerializerUnittest::CreateBatchedSpanEvents() {
 
 UNIT_TEST_CASE(SLSSerializerUnittest, TestSerializeEventGroup)
 UNIT_TEST_CASE(SLSSerializerUnittest, TestSerializeEventGroupList)
+UNIT_TEST_CASE(SLSSerializerUnittest, TestSerializeSpanJson)
+UNIT_TEST_CASE(SLSSerializerUnittest, TestSerializeSpanBenchmark)
 
 } // namespace logtail
 
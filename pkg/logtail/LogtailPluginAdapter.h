@@ -50,6 +50,14 @@ extern "C" {
         int lines,
         const char *shardHash, int shardHashSize);
 
+    long long LogtailGetPipelineHandle(const char *configName, int configNameSize);
+
+    int LogtailSendPbBatch(long long pipelineHandle,
+        const char *logstore, int logstoreSize,
+        char *pbBuffer, int *pbSizes, int count,
+        int lines,
+        const char *shardHash, int shardHashSize);
+
     int LogtailCtlCmd(const char * configName, int configNameSize, int cmdId, const char * params, int paramsLen);
 
     // version for logtail plugin adapter, used for check plugin adapter version
@@ -67,6 +67,26 @@ func SendPbV2(configName string, logstore string, pbBuffer []byte, lines int, ha
 	return int(rstVal)
 }
 
+// GetPipelineHandle returns the handle of the pipeline to be used by SendPbBatch, or negative if batch sending is not
+// supported for the config.
+func GetPipelineHandle(configName string) int64 {
+	return int64(C.LogtailGetPipelineHandle((*C.char)(util.StringPointer(configName)), C.int(len(configName))))
+}
+
+// SendPbBatch sends serialized log groups of the same logstore and shard hash in one call, pbBuffer holds them in
+// sequence with sizes given by pbSizes. -2 is returned when the handle is no longer valid.
+func SendPbBatch(handle int64, logstore string, pbBuffer []byte, pbSizes []int32, lines int, hash string) int {
+	if len(pbSizes) == 0 {
+		return 0
+	}
+	rstVal := C.LogtailSendPbBatch(C.longlong(handle),
+		(*C.char)(util.StringPointer(logstore)), C.int(len(logstore)),
+		(*C.char)(unsafe.Pointer(&pbBuffer[0])), (*C.int)(unsafe.Pointer(&pbSizes[0])), C.int(len(pbSizes)),
+		C.int(lines),
+		(*C.char)(util.StringPointer(hash)), C.int(len(hash)))
+	return int(rstVal)
+}
+
 func IsValidToSend(logstoreKey int64) bool {
 	return C.LogtailIsValidToSend(C.longlong(logstoreKey)) == 0
 }
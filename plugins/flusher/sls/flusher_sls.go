@@ -32,6 +32,9 @@ type SlsFlusher struct { // nolint:revive
 	KeepShardHash   bool
 
 	context pipeline.Context
+	// handle of the pipeline in Logtail, which is negative when batch sending is not supported
+	pipelineHandle int64
+	handleConfig   string
 }
 
 // Init ...
@@ -54,26 +57,76 @@ func (p *SlsFlusher) IsReady(projectName string, logstoreName string, logstoreKe
 
 // Flush ...
 // Because IsReady is called before, Logtail must have space in sending queue,
-// just call LogtailSendPb through cgo to push data into queue, Logtail will
+// just call LogtailSendPbBatch through cgo to push data into queue, Logtail will
 // send data to its destination (SLS mostly) according to its config.
+// Consecutive log groups of the same logstore and shard hash are handed over in
+// one call, so that Logtail can pack them into fewer requests.
 func (p *SlsFlusher) Flush(projectName string, logstoreName string, configName string, logGroupList []*protocol.LogGroup) error {
+	handle := p.getPipelineHandle(configName, false)
+	if handle < 0 {
+		return p.flushOneByOne(configName, logGroupList)
+	}
+
+	var buf []byte
+	var sizes []int32
+	var lines int
+	var logstore, shardHash string
+	send := func() error {
+		if len(sizes) == 0 {
+			return nil
+		}
+		rst := logtail.SendPbBatch(handle, logstore, buf, sizes, lines, shardHash)
+		if rst == -2 {
+			// pipeline in Logtail has been updated
+			if handle = p.getPipelineHandle(configName, true); handle >= 0 {
+				rst = logtail.SendPbBatch(handle, logstore, buf, sizes, lines, shardHash)
+			}
+		}
+		if rst < 0 {
+			return fmt.Errorf("send error %d", rst)
+		}
+		buf = buf[:0]
+		sizes = sizes[:0]
+		lines = 0
+		return nil
+	}
 	for _, logGroup := range logGroupList {
 		if len(logGroup.Logs) == 0 {
 			continue
 		}
-
-		var shardHash string
-		if p.EnableShardHash {
-			for idx, tag := range logGroup.LogTags {
-				if tag.Key == util.ShardHashTagKey {
-					shardHash = tag.Value
-					if !p.KeepShardHash {
-						logGroup.LogTags = append(logGroup.LogTags[0:idx], logGroup.LogTags[idx+1:]...)
-					}
-					break
-				}
+		hash := p.extractShardHash(logGroup)
+		if len(sizes) > 0 && (logGroup.Category != logstore || hash != shardHash) {
+			if err := send(); err != nil {
+				return err
 			}
 		}
+		logstore = logGroup.Category
+		shardHash = hash
+
+		size := logGroup.Size()
+		offset := len(buf)
+		if cap(buf)-offset < size {
+			newBuf := make([]byte, offset, 2*cap(buf)+size)
+			copy(newBuf, buf)
+			buf = newBuf
+		}
+		buf = buf[:offset+size]
+		if _, err := logGroup.MarshalToSizedBuffer(buf[offset:]); err != nil {
+			return fmt.Errorf("loggroup marshal err %v", err)
+		}
+		sizes = append(sizes, int32(size))
+		lines += len(logGroup.Logs)
+	}
+	return send()
+}
+
+func (p *SlsFlusher) flushOneByOne(configName string, logGroupList []*protocol.LogGroup) error {
+	for _, logGroup := range logGroupList {
+		if len(logGroup.Logs) == 0 {
+			continue
+		}
+
+		shardHash := p.extractShardHash(logGroup)
 		buf, err := logGroup.Marshal()
 		if err != nil {
 			return fmt.Errorf("loggroup marshal err %v", err)
@@ -93,6 +146,34 @@ func (p *SlsFlusher) Flush(projectName string, logstoreName string, configName s
 	return nil
 }
 
+func (p *SlsFlusher) extractShardHash(logGroup *protocol.LogGroup) string {
+	if !p.EnableShardHash {
+		return ""
+	}
+	for idx, tag := range logGroup.LogTags {
+		if tag.Key == util.ShardHashTagKey {
+			shardHash := tag.Value
+			if !p.KeepShardHash {
+				logGroup.LogTags = append(logGroup.LogTags[0:idx], logGroup.LogTags[idx+1:]...)
+			}
+			return shardHash
+		}
+	}
+	return ""
+}
+
+// getPipelineHandle returns the cached handle unless refresh is set. A config not found in Logtail yet is not cached.
+func (p *SlsFlusher) getPipelineHandle(configName string, refresh bool) int64 {
+	if refresh || p.handleConfig != configName {
+		p.pipelineHandle = logtail.GetPipelineHandle(configName)
+		p.handleConfig = configName
+		if p.pipelineHandle == -2 {
+			p.handleConfig = ""
+		}
+	}
+	return p.pipelineHandle
+}
+
 // SetUrgent ...
 // We do nothing here because necessary flag has already been set in Logtail
 // before this method is called. Any future call of IsReady will return